@@ -1,4 +1,5 @@
 #!/bin/bash
 mkdir -p bin
-gcc -Wall -Wextra -pedantic -o bin/basec src/main.c src/util/basec_build.c src/ds/basec_string.c src/ds/basec_array.c -Iinclude
-gcc -Wall -Wextra -pedantic -o bin/test src/test.c src/util/basec_build.c src/ds/basec_string.c src/ds/basec_array.c src/util/basec_test.c src/ds/tests/test_string.c src/ds/tests/test_array.c -Iinclude
+gcc -Wall -Wextra -pedantic -o bin/basec src/main.c src/util/basec_build.c src/ds/basec_string.c src/ds/basec_array.c src/io/basec_file.c src/util/basec_hash.c src/ds/basec_hashmap.c src/ds/basec_strmap.c src/ds/basec_interner.c src/ds/basec_hashset.c src/ds/basec_heap.c src/ds/basec_deque.c src/concurrency/basec_queue.c src/concurrency/basec_jobs.c src/concurrency/basec_concurrent_array.c src/ds/basec_chunked_array.c src/util/basec_memory.c src/ds/basec_soa.c -Iinclude
+gcc -Wall -Wextra -pedantic -o bin/test src/test.c src/util/basec_build.c src/ds/basec_string.c src/ds/basec_array.c src/io/basec_file.c src/util/basec_hash.c src/ds/basec_hashmap.c src/ds/basec_strmap.c src/ds/basec_interner.c src/ds/basec_hashset.c src/ds/basec_heap.c src/ds/basec_deque.c src/concurrency/basec_queue.c src/concurrency/basec_jobs.c src/concurrency/basec_concurrent_array.c src/ds/basec_chunked_array.c src/util/basec_memory.c src/ds/basec_soa.c src/util/basec_test.c src/ds/tests/test_string.c src/ds/tests/test_array.c src/io/tests/test_file.c src/util/tests/test_hash.c src/ds/tests/test_hashmap.c src/ds/tests/test_strmap.c src/ds/tests/test_interner.c src/ds/tests/test_hashset.c src/ds/tests/test_heap.c src/ds/tests/test_deque.c src/concurrency/tests/test_queue.c src/concurrency/tests/test_jobs.c src/concurrency/tests/test_concurrent_array.c src/ds/tests/test_chunked_array.c src/util/tests/test_memory.c src/ds/tests/test_soa.c -Iinclude
+gcc -Wall -Wextra -pedantic -O2 -o bin/bench src/bench.c src/util/basec_build.c src/ds/basec_string.c src/ds/basec_array.c src/io/basec_file.c src/util/basec_hash.c src/ds/basec_hashmap.c src/ds/basec_strmap.c src/ds/basec_interner.c src/ds/basec_hashset.c src/ds/basec_heap.c src/ds/basec_deque.c src/concurrency/basec_queue.c src/concurrency/basec_jobs.c src/concurrency/basec_concurrent_array.c src/ds/basec_chunked_array.c src/util/basec_memory.c src/ds/basec_soa.c src/util/basec_bench.c src/ds/benches/bench_string.c src/io/benches/bench_file.c src/util/benches/bench_hash.c src/ds/benches/bench_hashmap.c src/ds/benches/bench_strmap.c src/ds/benches/bench_interner.c src/ds/benches/bench_hashset.c src/ds/benches/bench_array.c src/ds/benches/bench_heap.c src/ds/benches/bench_deque.c src/concurrency/benches/bench_queue.c src/concurrency/benches/bench_jobs.c src/concurrency/benches/bench_concurrent_array.c src/ds/benches/bench_chunked_array.c src/util/benches/bench_memory.c src/ds/benches/bench_soa.c -Iinclude
@@ -0,0 +1,177 @@
+/**
+ * @file basec_concurrent_array.h
+ * @brief An append only array that many threads can grow at once
+ */
+#ifndef BASEC_CONCURRENT_ARRAY_H
+#define BASEC_CONCURRENT_ARRAY_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+
+#define BASEC_CONCURRENT_ARRAY_CACHE_LINE 64
+#define BASEC_CONCURRENT_ARRAY_SEGMENTS   48
+
+/**
+ * @struct BasecConcurrentArray
+ * @brief An array of segments that never move once allocated
+ *
+ * The first segment holds first_capacity elements and every later segment
+ * twice as many as the one before it, so index i lives in segment
+ * log2(i + first_capacity) - log2(first_capacity). Writers claim indices
+ * with one atomic add on length, and the first writer to reach a segment
+ * allocates it, so growing never copies elements and pointers to elements
+ * stay valid until the array is destroyed or frozen.
+ */
+typedef struct {
+    _Alignas(BASEC_CONCURRENT_ARRAY_CACHE_LINE) u64 length;
+    _Alignas(BASEC_CONCURRENT_ARRAY_CACHE_LINE)
+    void* segments[BASEC_CONCURRENT_ARRAY_SEGMENTS];
+    u64   element_size;
+    u64   first_capacity;
+    u64   first_shift;
+} BasecConcurrentArray;
+
+/**
+ * @enum BasecConcurrentArrayResult
+ * @brief The result of a concurrent array operation
+ */
+typedef enum {
+    BASEC_CONCURRENT_ARRAY_SUCCESS,
+    BASEC_CONCURRENT_ARRAY_NULL_POINTER,
+    BASEC_CONCURRENT_ARRAY_INVALID_ELEMENT_SIZE,
+    BASEC_CONCURRENT_ARRAY_INVALID_CAPACITY,
+    BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE,
+    BASEC_CONCURRENT_ARRAY_OUT_OF_BOUNDS,
+    BASEC_CONCURRENT_ARRAY_FULL,
+} BasecConcurrentArrayResult;
+
+/**
+ * @brief Handle the result of a concurrent array operation
+ * @param result The result of the operation
+ */
+void basec_concurrent_array_handle_result(BasecConcurrentArrayResult result);
+
+/**
+ * @brief Create a concurrent array
+ * @param array The array to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements of the first segment, rounded up
+ *                 to a power of two, at most 2^32
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_create(
+    BasecConcurrentArray** array,
+    u64                    element_size,
+    u64                    capacity
+);
+
+/**
+ * @brief Claim consecutive indices to fill in later, from any thread
+ *
+ * The segments holding the indices are allocated before returning, so
+ * basec_concurrent_array_at can be used to write every claimed element.
+ *
+ * @param array The array to grow
+ * @param count The number of indices to claim
+ * @param index_out The first claimed index
+ * @return The result of the operation, BASEC_CONCURRENT_ARRAY_FULL if the
+ *         indices are past the last segment
+ */
+BasecConcurrentArrayResult basec_concurrent_array_reserve(
+    BasecConcurrentArray* array,
+    u64                   count,
+    u64*                  index_out
+);
+
+/**
+ * @brief Add an element to the end of the array, from any thread
+ * @param array The array to append to
+ * @param element The element to append
+ * @param index_out The index of the element, NULL if not needed
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_append(
+    BasecConcurrentArray* array,
+    const void*           element,
+    u64*                  index_out
+);
+
+/**
+ * @brief Add consecutive elements to the end of the array, from any thread
+ *
+ * Claims all the indices with one atomic add, which keeps contention low
+ * when many threads append at once.
+ *
+ * @param array The array to append to
+ * @param elements The elements to append, in order
+ * @param count The number of elements
+ * @param index_out The index of the first element, NULL if not needed
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_append_n(
+    BasecConcurrentArray* array,
+    const void*           elements,
+    u64                   count,
+    u64*                  index_out
+);
+
+/**
+ * @brief Get the address of an element, which stays the same as the array
+ *        grows
+ *
+ * An element can be read once the thread that wrote it has made the write
+ * visible, for example by returning from the append before a join.
+ *
+ * @param array The array
+ * @param index The index of the element, a claimed index
+ * @param element_out The address of the element
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_at(
+    BasecConcurrentArray* array,
+    u64                   index,
+    void**                element_out
+);
+
+/**
+ * @brief Get the number of claimed indices
+ * @param array The array
+ * @param length_out The number of claimed indices
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_length(
+    BasecConcurrentArray* array,
+    u64*                  length_out
+);
+
+/**
+ * @brief Turn the array into a contiguous BasecArray once every writer is
+ *        done
+ *
+ * The elements are copied in order, except when they all fit in the first
+ * segment, which then becomes the BasecArray's data without a copy. The
+ * concurrent array is destroyed either way.
+ *
+ * @param array The array to freeze, set to NULL
+ * @param array_out The array to store the elements in
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_freeze(
+    BasecConcurrentArray** array,
+    BasecArray**           array_out
+);
+
+/**
+ * @brief Destroy a concurrent array
+ * @param array The array to destroy
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_destroy(
+    BasecConcurrentArray** array
+);
+
+#endif
@@ -0,0 +1,228 @@
+/**
+ * @file basec_jobs.h
+ * @brief A work stealing thread pool that runs jobs and parallel loops
+ */
+#ifndef BASEC_JOBS_H
+#define BASEC_JOBS_H
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "basec_types.h"
+#include "concurrency/basec_queue.h"
+
+#define BASEC_JOBS_DEQUE_CAPACITY 4096
+#define BASEC_JOBS_INJECT_CAPACITY 4096
+#define BASEC_JOBS_MAX_WORKERS 256
+
+/**
+ * @brief A function run by a job
+ * @param context The context passed when the job was submitted
+ */
+typedef void (*BasecJobFunction)(void* context);
+
+/**
+ * @brief A function run on one chunk of a parallel loop
+ * @param begin The first index of the chunk
+ * @param end One past the last index of the chunk
+ * @param context The context passed to the loop
+ */
+typedef void (*BasecJobRangeFunction)(u64 begin, u64 end, void* context);
+
+/**
+ * @struct BasecJob
+ * @brief A submitted job, held as a handle until it is waited on
+ */
+typedef struct BasecJob BasecJob;
+
+/**
+ * @struct BasecJobsWorker
+ * @brief A worker thread and the deque of jobs it owns
+ */
+typedef struct BasecJobsWorker BasecJobsWorker;
+
+/**
+ * @struct BasecJobsRange
+ * @brief A half open range of indices, [begin, end)
+ */
+typedef struct {
+    u64 begin;
+    u64 end;
+} BasecJobsRange;
+
+/**
+ * @struct BasecJobs
+ * @brief A fixed pool of workers that share jobs by stealing
+ *
+ * Every worker pushes and pops the jobs it submits at the bottom of its own
+ * Chase-Lev deque, which takes no atomic read-modify-write in the common
+ * case. Idle workers steal the oldest job from the top of another worker's
+ * deque, and jobs submitted from outside the pool go through the injected
+ * queue. A thread waiting on a job runs other jobs until it finishes, so a
+ * job may submit and wait on jobs of its own without blocking a worker.
+ */
+typedef struct {
+    BasecJobsWorker* workers;
+    u64              worker_count;
+    BasecMpmcQueue*  injected;
+    u64              pending;
+    u64              sleeping;
+    bool             stopping;
+    pthread_mutex_t  lock;
+    pthread_cond_t   wake;
+} BasecJobs;
+
+/**
+ * @enum BasecJobsResult
+ * @brief The result of a job system operation
+ */
+typedef enum {
+    BASEC_JOBS_SUCCESS,
+    BASEC_JOBS_NULL_POINTER,
+    BASEC_JOBS_INVALID_WORKERS,
+    BASEC_JOBS_INVALID_RANGE,
+    BASEC_JOBS_INVALID_GRAIN,
+    BASEC_JOBS_ALLOCATION_FAILURE,
+    BASEC_JOBS_THREAD_FAILURE,
+} BasecJobsResult;
+
+/**
+ * @brief Handle the result of a job system operation
+ * @param result The result of the operation
+ */
+void basec_jobs_handle_result(BasecJobsResult result);
+
+/**
+ * @brief Create a pool of workers
+ * @param jobs The pool to create
+ * @param workers The number of worker threads, 0 for one per online CPU, up
+ *                to BASEC_JOBS_MAX_WORKERS
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_create(BasecJobs** jobs, u64 workers);
+
+/**
+ * @brief Get the pool shared by every module, creating it on first use
+ *
+ * The shared pool has one worker per online CPU and lives until the process
+ * exits. Parallel algorithms use it unless they are given a pool.
+ *
+ * @param jobs_out The shared pool
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_shared(BasecJobs** jobs_out);
+
+/**
+ * @brief Get the number of workers in a pool
+ * @param jobs The pool
+ * @param count_out The number of workers
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_worker_count(BasecJobs* jobs, u64* count_out);
+
+/**
+ * @brief Submit a job to the pool
+ *
+ * From a worker the job goes to the bottom of its own deque, where it is
+ * likely to run next while its data is still in cache. A job that finds
+ * every queue full runs on the submitting thread instead.
+ *
+ * @param jobs The pool to run the job
+ * @param function The function to run
+ * @param context The context to pass to the function
+ * @param job_out The handle to wait on, NULL to not wait on the job
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_submit(
+    BasecJobs*       jobs,
+    BasecJobFunction function,
+    void*            context,
+    BasecJob**       job_out
+);
+
+/**
+ * @brief Submit a job to run once another job finishes
+ *
+ * The continuation is queued by the thread that finishes the job it
+ * follows, or right away if that job has already finished.
+ *
+ * @param jobs The pool to run the job
+ * @param after The job to run after, a handle not yet waited on
+ * @param function The function to run
+ * @param context The context to pass to the function
+ * @param job_out The handle to wait on, NULL to not wait on the job
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_submit_after(
+    BasecJobs*       jobs,
+    BasecJob*        after,
+    BasecJobFunction function,
+    void*            context,
+    BasecJob**       job_out
+);
+
+/**
+ * @brief Wait for a job to finish and release its handle
+ *
+ * The waiting thread runs other jobs of the pool until the job finishes.
+ *
+ * @param jobs The pool running the job
+ * @param job The handle to wait on, set to NULL
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_wait(BasecJobs* jobs, BasecJob** job);
+
+/**
+ * @brief Run a function over a range of indices in parallel
+ *
+ * The range is split into chunks of grain indices, which the calling
+ * thread and up to one helper job per worker claim one at a time, so
+ * uneven chunks balance out. Returns once every chunk has run.
+ *
+ * @param jobs The pool to run the loop
+ * @param range The range of indices
+ * @param grain The number of indices in every chunk but the last
+ * @param function The function to run on every chunk
+ * @param context The context to pass to the function
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_parallel_for(
+    BasecJobs*            jobs,
+    BasecJobsRange        range,
+    u64                   grain,
+    BasecJobRangeFunction function,
+    void*                 context
+);
+
+/**
+ * @brief Run a function over a range of indices on the shared pool
+ * @param range The range of indices
+ * @param grain The number of indices in every chunk but the last
+ * @param function The function to run on every chunk
+ * @param context The context to pass to the function
+ * @return The result of the operation
+ */
+BasecJobsResult basec_parallel_for(
+    BasecJobsRange        range,
+    u64                   grain,
+    BasecJobRangeFunction function,
+    void*                 context
+);
+
+/**
+ * @brief Destroy a pool of workers
+ *
+ * Runs every submitted job to completion before stopping the workers. No
+ * thread may submit to the pool once it is destroyed.
+ *
+ * @param jobs The pool to destroy
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_destroy(BasecJobs** jobs);
+
+#endif
@@ -0,0 +1,203 @@
+/**
+ * @file basec_queue.h
+ * @brief Bounded lock free queues for passing elements between threads
+ */
+#ifndef BASEC_QUEUE_H
+#define BASEC_QUEUE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basec_types.h"
+
+#define BASEC_QUEUE_CACHE_LINE 64
+
+/**
+ * @struct BasecSpscQueue
+ * @brief A ring of fixed size elements for one producer and one consumer
+ *
+ * The producer owns tail and the consumer owns head, each on its own cache
+ * line next to a cached copy of the other side's position. Threads only
+ * read the other side's position when their cached copy says the ring is
+ * full or empty, so most pushes and pops touch no shared line.
+ */
+typedef struct {
+    _Alignas(BASEC_QUEUE_CACHE_LINE) u64 tail;
+    u64 cached_head;
+    _Alignas(BASEC_QUEUE_CACHE_LINE) u64 head;
+    u64 cached_tail;
+    _Alignas(BASEC_QUEUE_CACHE_LINE) void* data;
+    u64 element_size;
+    u64 capacity;
+} BasecSpscQueue;
+
+/**
+ * @struct BasecMpmcQueue
+ * @brief A ring of fixed size elements for any number of producers and
+ *        consumers
+ *
+ * Every slot holds a sequence number ahead of its element. A slot is free
+ * for the producer claiming position p when its sequence is p, and full for
+ * the consumer claiming p when its sequence is p + 1, so threads claim
+ * positions with one compare and swap and never wait on each other's locks.
+ */
+typedef struct {
+    _Alignas(BASEC_QUEUE_CACHE_LINE) u64 enqueue;
+    _Alignas(BASEC_QUEUE_CACHE_LINE) u64 dequeue;
+    _Alignas(BASEC_QUEUE_CACHE_LINE) u8* slots;
+    u64 slot_size;
+    u64 element_size;
+    u64 capacity;
+} BasecMpmcQueue;
+
+/**
+ * @enum BasecQueueResult
+ * @brief The result of a queue operation
+ */
+typedef enum {
+    BASEC_QUEUE_SUCCESS,
+    BASEC_QUEUE_NULL_POINTER,
+    BASEC_QUEUE_INVALID_ELEMENT_SIZE,
+    BASEC_QUEUE_INVALID_CAPACITY,
+    BASEC_QUEUE_ALLOCATION_FAILURE,
+    BASEC_QUEUE_FULL,
+    BASEC_QUEUE_EMPTY,
+} BasecQueueResult;
+
+/**
+ * @brief Handle the result of a queue operation
+ * @param result The result of the operation
+ */
+void basec_queue_handle_result(BasecQueueResult result);
+
+/**
+ * @brief Create a single producer, single consumer queue
+ * @param queue The queue to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements the queue holds, rounded up to a
+ *                 power of two
+ * @return The result of the operation
+ */
+BasecQueueResult basec_spsc_queue_create(
+    BasecSpscQueue** queue,
+    u64              element_size,
+    u64              capacity
+);
+
+/**
+ * @brief Add an element to the queue, from the producer thread
+ * @param queue The queue to push to
+ * @param element The element to push
+ * @return The result of the operation, BASEC_QUEUE_FULL if the queue is full
+ */
+BasecQueueResult basec_spsc_queue_push(
+    BasecSpscQueue* queue,
+    const void*     element
+);
+
+/**
+ * @brief Remove the oldest element, from the consumer thread
+ * @param queue The queue to pop from
+ * @param element_out The popped element
+ * @return The result of the operation, BASEC_QUEUE_EMPTY if the queue is
+ *         empty
+ */
+BasecQueueResult basec_spsc_queue_pop(
+    BasecSpscQueue* queue,
+    void*           element_out
+);
+
+/**
+ * @brief Add as many elements as fit, from the producer thread
+ *
+ * The elements are published to the consumer together, with one store.
+ *
+ * @param queue The queue to push to
+ * @param elements The elements to push, in order
+ * @param count The number of elements
+ * @param pushed_out The number of elements pushed
+ * @return The result of the operation, BASEC_QUEUE_FULL if none fit
+ */
+BasecQueueResult basec_spsc_queue_push_n(
+    BasecSpscQueue* queue,
+    const void*     elements,
+    u64             count,
+    u64*            pushed_out
+);
+
+/**
+ * @brief Remove up to a number of the oldest elements, from the consumer
+ *        thread
+ * @param queue The queue to pop from
+ * @param elements_out The popped elements, in order
+ * @param count The largest number of elements to pop
+ * @param popped_out The number of elements popped
+ * @return The result of the operation, BASEC_QUEUE_EMPTY if the queue is
+ *         empty
+ */
+BasecQueueResult basec_spsc_queue_pop_n(
+    BasecSpscQueue* queue,
+    void*           elements_out,
+    u64             count,
+    u64*            popped_out
+);
+
+/**
+ * @brief Destroy a single producer, single consumer queue
+ *
+ * Neither thread may use the queue once it is destroyed.
+ *
+ * @param queue The queue to destroy
+ * @return The result of the operation
+ */
+BasecQueueResult basec_spsc_queue_destroy(BasecSpscQueue** queue);
+
+/**
+ * @brief Create a multi producer, multi consumer queue
+ * @param queue The queue to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements the queue holds, rounded up to a
+ *                 power of two of at least 2
+ * @return The result of the operation
+ */
+BasecQueueResult basec_mpmc_queue_create(
+    BasecMpmcQueue** queue,
+    u64              element_size,
+    u64              capacity
+);
+
+/**
+ * @brief Add an element to the queue, from any thread
+ * @param queue The queue to push to
+ * @param element The element to push
+ * @return The result of the operation, BASEC_QUEUE_FULL if the queue is full
+ */
+BasecQueueResult basec_mpmc_queue_push(
+    BasecMpmcQueue* queue,
+    const void*     element
+);
+
+/**
+ * @brief Remove the oldest element, from any thread
+ * @param queue The queue to pop from
+ * @param element_out The popped element
+ * @return The result of the operation, BASEC_QUEUE_EMPTY if the queue is
+ *         empty
+ */
+BasecQueueResult basec_mpmc_queue_pop(
+    BasecMpmcQueue* queue,
+    void*           element_out
+);
+
+/**
+ * @brief Destroy a multi producer, multi consumer queue
+ *
+ * No thread may use the queue once it is destroyed.
+ *
+ * @param queue The queue to destroy
+ * @return The result of the operation
+ */
+BasecQueueResult basec_mpmc_queue_destroy(BasecMpmcQueue** queue);
+
+#endif
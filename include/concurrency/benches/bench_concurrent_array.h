@@ -0,0 +1,36 @@
+#ifndef BASEC_CONCURRENT_ARRAY_BENCH_H
+#define BASEC_CONCURRENT_ARRAY_BENCH_H
+
+#include <pthread.h>
+
+#include "util/basec_bench.h"
+#include "ds/basec_array.h"
+#include "concurrency/basec_concurrent_array.h"
+
+/**
+ * @brief Benchmark appending from several threads to a mutex guarded
+ *        BasecArray and to a BasecConcurrentArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_concurrent_array_append(void);
+
+/**
+ * @brief Benchmark appending batches from several threads to a
+ *        BasecConcurrentArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_concurrent_array_append_n(void);
+
+/**
+ * @brief Benchmark freezing a BasecConcurrentArray into a BasecArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_concurrent_array_freeze(void);
+
+/**
+ * @brief Run the ConcurrentArray benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_concurrent_array_run(void);
+
+#endif
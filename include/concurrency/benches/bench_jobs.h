@@ -0,0 +1,31 @@
+#ifndef BASEC_JOBS_BENCH_H
+#define BASEC_JOBS_BENCH_H
+
+#include "util/basec_bench.h"
+#include "concurrency/basec_jobs.h"
+
+/**
+ * @brief Benchmark a serial loop as the baseline for parallel loops
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_jobs_serial(void);
+
+/**
+ * @brief Benchmark basec_jobs_parallel_for across worker counts
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_jobs_parallel_for(void);
+
+/**
+ * @brief Benchmark the cost of submitting and waiting on empty jobs
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_jobs_submit_wait(void);
+
+/**
+ * @brief Run the Jobs benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_jobs_run(void);
+
+#endif
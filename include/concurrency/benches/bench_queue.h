@@ -0,0 +1,41 @@
+#ifndef BASEC_QUEUE_BENCH_H
+#define BASEC_QUEUE_BENCH_H
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "util/basec_bench.h"
+#include "ds/basec_array.h"
+#include "concurrency/basec_queue.h"
+
+/**
+ * @brief Benchmark a mutex guarded BasecArray across thread counts
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_queue_mutex(void);
+
+/**
+ * @brief Benchmark BasecMpmcQueue across thread counts
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_queue_mpmc(void);
+
+/**
+ * @brief Benchmark BasecSpscQueue throughput with batched pushes and pops
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_queue_spsc(void);
+
+/**
+ * @brief Benchmark the round trip latency of two BasecSpscQueues
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_queue_spsc_latency(void);
+
+/**
+ * @brief Run the Queue benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_queue_run(void);
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef BASEC_CONCURRENT_ARRAY_TEST_H
+#define BASEC_CONCURRENT_ARRAY_TEST_H
+
+#include <pthread.h>
+
+#include "util/basec_test.h"
+#include "concurrency/basec_concurrent_array.h"
+
+/**
+ * @brief Test the creation of concurrent arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_create(c_str fail_message);
+
+/**
+ * @brief Test that appended elements keep their addresses as the array grows
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_append(c_str fail_message);
+
+/**
+ * @brief Test appending from several threads at once
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_threads(c_str fail_message);
+
+/**
+ * @brief Test turning concurrent arrays into contiguous arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_freeze(c_str fail_message);
+
+/**
+ * @brief Test the destruction of concurrent arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_destroy(c_str fail_message);
+
+/**
+ * @brief Add ConcurrentArray tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_concurrent_array_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef BASEC_JOBS_TEST_H
+#define BASEC_JOBS_TEST_H
+
+#include "util/basec_test.h"
+#include "concurrency/basec_jobs.h"
+
+/**
+ * @brief Test the creation of pools of workers
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_create(c_str fail_message);
+
+/**
+ * @brief Test submitting jobs and waiting on their handles
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_submit_wait(c_str fail_message);
+
+/**
+ * @brief Test that continuations run after the jobs they follow
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_continuation(c_str fail_message);
+
+/**
+ * @brief Test jobs that submit and wait on jobs of their own
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_nested(c_str fail_message);
+
+/**
+ * @brief Test running a function over a range of indices in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_parallel_for(c_str fail_message);
+
+/**
+ * @brief Test that destroying a pool runs every submitted job
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_destroy(c_str fail_message);
+
+/**
+ * @brief Add Jobs tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_jobs_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
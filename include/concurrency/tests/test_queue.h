@@ -0,0 +1,59 @@
+#ifndef BASEC_QUEUE_TEST_H
+#define BASEC_QUEUE_TEST_H
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "util/basec_test.h"
+#include "concurrency/basec_queue.h"
+
+/**
+ * @brief Test the creation of the queues
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_create(c_str fail_message);
+
+/**
+ * @brief Test pushing and popping a single producer queue on one thread
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_spsc_push_pop(c_str fail_message);
+
+/**
+ * @brief Test passing elements from a producer thread to a consumer thread
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_spsc_threads(c_str fail_message);
+
+/**
+ * @brief Test pushing and popping a multi producer queue on one thread
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_mpmc_push_pop(c_str fail_message);
+
+/**
+ * @brief Test passing elements between several producers and consumers
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_mpmc_threads(c_str fail_message);
+
+/**
+ * @brief Test the destruction of the queues
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_destroy(c_str fail_message);
+
+/**
+ * @brief Add Queue tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_queue_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
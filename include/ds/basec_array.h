@@ -10,18 +10,78 @@
 #include <string.h>
 
 #include "basec_types.h"
+#include "util/basec_hash.h"
+#include "util/basec_memory.h"
+#include "concurrency/basec_jobs.h"
+
+/**
+ * @struct BasecArrayIndex
+ * @brief A hash index from element bytes to positions, see
+ *        basec_array_enable_index
+ */
+typedef struct BasecArrayIndex BasecArrayIndex;
 
 /**
  * @struct BasecArray
  * @brief A dynamic array
+ *
+ * Data of BASEC_MEMORY_MAP_THRESHOLD bytes or more is mapped rather than
+ * allocated, see basec_memory_resize, and mapped is set. data is aligned to
+ * alignment bytes, and mapped data is backed by transparent huge pages
+ * when huge_pages is set.
  */
 typedef struct {
-    void* data;
-    u64   element_size;
-    u64   length;
-    u64   capacity;
+    void*            data;
+    u64              element_size;
+    u64              length;
+    u64              capacity;
+    BasecArrayIndex* index;
+    bool             mapped;
+    u64              alignment;
+    bool             huge_pages;
 } BasecArray;
 
+/**
+ * @brief Compare two elements, like the comparators taken by qsort
+ * @param a The first element
+ * @param b The second element
+ * @return Negative if a orders first, positive if b does, 0 if equal
+ */
+typedef i32 (*BasecArrayCompare)(const void* a, const void* b);
+
+/**
+ * @brief Visit an element, see basec_array_par_for_each
+ * @param element The element, which may be modified
+ * @param index The index of the element
+ * @param context The context passed with the visitor
+ */
+typedef void (*BasecArrayVisit)(void* element, u64 index, void* context);
+
+/**
+ * @brief Compute the output element for an element, see basec_array_par_map
+ * @param element The element
+ * @param element_out The output element to fill in
+ * @param context The context passed with the function
+ */
+typedef void (*BasecArrayMap)(
+    const void* element,
+    void*       element_out,
+    void*       context
+);
+
+/**
+ * @brief Combine an element into an accumulator, accumulator = accumulator
+ *        op element, for an associative op
+ * @param accumulator The accumulator, updated in place
+ * @param element The element to combine into it
+ * @param context The context passed with the function
+ */
+typedef void (*BasecArrayCombine)(
+    void*       accumulator,
+    const void* element,
+    void*       context
+);
+
 /**
  * @enum BasecArrayResult
  * @brief The result of an array operation
@@ -36,6 +96,8 @@ typedef enum {
     BASEC_ARRAY_EMPTY,
     BASEC_ARRAY_OUT_OF_BOUNDS,
     BASEC_ARRAY_NOT_FOUND,
+    BASEC_ARRAY_INVALID_KEY_OFFSET,
+    BASEC_ARRAY_INVALID_ALIGNMENT,
 } BasecArrayResult;
 
 /**
@@ -57,6 +119,38 @@ BasecArrayResult basec_array_create(
     u64          capacity
 );
 
+/**
+ * @brief Create an array whose data is aligned to alignment bytes, also
+ *        after it grows
+ *
+ * Every element is aligned when element_size is a multiple of alignment,
+ * like 64 byte elements on 64 byte cache lines.
+ *
+ * @param array The array to create
+ * @param element_size The size of the elements in the array
+ * @param capacity The capacity of the array
+ * @param alignment The alignment, a power of two up to the page size
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_create_aligned(
+    BasecArray** array,
+    u64          element_size,
+    u64          capacity,
+    u64          alignment
+);
+
+/**
+ * @brief Ask for transparent huge pages on the data of the array, now and
+ *        as it grows
+ *
+ * Only mapped data, BASEC_MEMORY_MAP_THRESHOLD bytes or more, can use huge
+ * pages. They cut TLB misses on random access to large arrays.
+ *
+ * @param array The array
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_advise_huge_pages(BasecArray* array);
+
 /**
  * @brief Append an element to the array
  * @param array The array to append to
@@ -103,6 +197,35 @@ BasecArrayResult basec_array_get(
  */
 BasecArrayResult basec_array_set(BasecArray* array, u64 index, void* element);
 
+/**
+ * @brief Remove an element, moving the elements after it down
+ * @param array The array to remove from
+ * @param index The index of the element to remove
+ * @param element_out The removed element, may be NULL
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_remove(
+    BasecArray* array,
+    u64         index,
+    void*       element_out
+);
+
+/**
+ * @brief Remove an element, moving the last element into its place
+ *
+ * Does not keep the order of the elements, but takes constant time.
+ *
+ * @param array The array to remove from
+ * @param index The index of the element to remove
+ * @param element_out The removed element, may be NULL
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_swap_remove(
+    BasecArray* array,
+    u64         index,
+    void*       element_out
+);
+
 /**
  * @brief Check if the array contains an element
  * @param array The array to check
@@ -142,6 +265,231 @@ BasecArrayResult basec_array_find_all(
     BasecArray** array_out
 );
 
+/**
+ * @brief Hash an element of the array
+ * @param array The array holding the element
+ * @param index The index of the element
+ * @param hash_out The hash of the element's bytes
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_hash_element(
+    BasecArray* array,
+    u64         index,
+    u64*        hash_out
+);
+
+/**
+ * @brief Sort the elements of the array in place
+ * @param array The array to sort
+ * @param compare The comparator ordering the elements
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_sort(
+    BasecArray*       array,
+    BasecArrayCompare compare
+);
+
+/**
+ * @brief Remove repeated elements from a sorted array in place
+ *
+ * Elements are repeats when their bytes are equal, so the array must be
+ * sorted with a comparator that places equal bytes next to each other. The
+ * first of each run of repeats is kept.
+ *
+ * @param array The sorted array to remove repeats from
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_unique_sorted(BasecArray* array);
+
+/**
+ * @brief Partially sort the array so one element lands where a sort puts it
+ *
+ * Afterwards the element at n is the one a full sort would place there, no
+ * element before it orders after it and no element after it orders before
+ * it. Runs a quickselect in linear time on average.
+ *
+ * @param array The array to partially sort
+ * @param n The index of the element to place
+ * @param compare The comparator ordering the elements
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_nth_element(
+    BasecArray*       array,
+    u64               n,
+    BasecArrayCompare compare
+);
+
+/**
+ * @brief Copy the k elements that order first, in sorted order
+ *
+ * Selects the k elements before sorting them, so only k of the elements are
+ * sorted. The array itself is left unchanged.
+ *
+ * @param array The array to select from
+ * @param k The number of elements to keep, at most the array's length
+ * @param compare The comparator ordering the elements
+ * @param array_out The array to store the elements in
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_top_k(
+    BasecArray*       array,
+    u64               k,
+    BasecArrayCompare compare,
+    BasecArray**      array_out
+);
+
+/**
+ * @brief Visit every element of the array in parallel
+ *
+ * The parallel functions split arrays into chunks of whole cache lines,
+ * about four per worker, and run arrays under 64 KB on the calling thread.
+ *
+ * @param array The array to visit
+ * @param visit The function to run on every element
+ * @param context The context to pass to the function
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_for_each(
+    BasecArray*     array,
+    BasecArrayVisit visit,
+    void*           context,
+    BasecJobs*      jobs
+);
+
+/**
+ * @brief Compute an output element for every element in parallel
+ * @param array The array to map
+ * @param element_size_out The size of the output elements
+ * @param map The function computing every output element
+ * @param context The context to pass to the function
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @param array_out The array to store the output elements in, in order
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_map(
+    BasecArray*   array,
+    u64           element_size_out,
+    BasecArrayMap map,
+    void*         context,
+    BasecJobs*    jobs,
+    BasecArray**  array_out
+);
+
+/**
+ * @brief Combine every element of the array in parallel
+ *
+ * Every chunk is combined into its own copy of identity, and the chunks'
+ * results are then combined in order, so combine must be associative but
+ * need not be commutative.
+ *
+ * @param array The array to reduce
+ * @param identity The element that combine leaves other elements unchanged
+ *                 with
+ * @param combine The associative function combining two elements
+ * @param context The context to pass to the function
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @param result_out The combined elements, identity for an empty array
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_reduce(
+    BasecArray*       array,
+    const void*       identity,
+    BasecArrayCombine combine,
+    void*             context,
+    BasecJobs*        jobs,
+    void*             result_out
+);
+
+/**
+ * @brief Replace every element with the combination of it and all elements
+ *        before it, in parallel
+ *
+ * Combines every chunk into its total, combines the totals in order and
+ * then scans every chunk starting from the total before it, which reads
+ * the array twice.
+ *
+ * @param array The array to scan in place
+ * @param combine The associative function combining two elements
+ * @param context The context to pass to the function
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_inclusive_scan(
+    BasecArray*       array,
+    BasecArrayCombine combine,
+    void*             context,
+    BasecJobs*        jobs
+);
+
+/**
+ * @brief Sort the elements of the array in parallel
+ *
+ * Sorts chunks with qsort, then merges pairs of sorted runs level by level.
+ * Every level is split into equal slices of output, whose inputs are found
+ * by binary search, so the last merges use every worker too. Like
+ * basec_array_sort, the order of equal elements is not kept.
+ *
+ * @param array The array to sort
+ * @param compare The comparator ordering the elements
+ * @param scratch An array of the same element size to merge into, grown as
+ *                needed and left empty, or NULL to allocate one for the call
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_sort(
+    BasecArray*       array,
+    BasecArrayCompare compare,
+    BasecArray*       scratch,
+    BasecJobs*        jobs
+);
+
+/**
+ * @brief Sort the elements of the array by a u64 key inside every element,
+ *        in parallel
+ *
+ * Runs a least significant digit radix sort, one pass per byte of the keys
+ * that differs between elements. Every chunk counts its digits and then
+ * moves its elements to the offsets the counts give it, which keeps the
+ * order of elements with equal keys.
+ *
+ * @param array The array to sort
+ * @param key_offset The offset of the u64 key in every element, the element
+ *                   with the smallest key is placed first
+ * @param scratch An array of the same element size to move elements into,
+ *                grown as needed and left empty, or NULL to allocate one for
+ *                the call
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_radix_sort(
+    BasecArray* array,
+    u64         key_offset,
+    BasecArray* scratch,
+    BasecJobs*  jobs
+);
+
+/**
+ * @brief Keep a hash index of the array's elements for fast lookups
+ *
+ * Once enabled, basec_array_find, basec_array_contains and
+ * basec_array_find_all look elements up in the index instead of scanning
+ * the array. The array's own functions keep the index up to date. Writing
+ * to data or length directly does not, call this again afterwards to
+ * rebuild the index.
+ *
+ * @param array The array to index
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_enable_index(BasecArray* array);
+
+/**
+ * @brief Drop the hash index of an array
+ * @param array The array to stop indexing
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_disable_index(BasecArray* array);
+
 /**
  * @brief Destroy an array
  * @param array The array to destroy
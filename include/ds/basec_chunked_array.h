@@ -0,0 +1,187 @@
+/**
+ * @file basec_chunked_array.h
+ * @brief A dynamic array of fixed size blocks that grows without copying
+ */
+#ifndef BASEC_CHUNKED_ARRAY_H
+#define BASEC_CHUNKED_ARRAY_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+
+/**
+ * @struct BasecChunkedArray
+ * @brief A dynamic array split into blocks of block_capacity elements
+ *
+ * Growing allocates one more block and appends its address to the block
+ * index, so elements are never copied and never move, and growing never
+ * needs more than one extra block of memory. block_capacity is a power of
+ * two, so element i is at (i & (block_capacity - 1)) in block
+ * i >> block_shift.
+ */
+typedef struct {
+    BasecArray* blocks;
+    u64         element_size;
+    u64         length;
+    u64         block_capacity;
+    u64         block_shift;
+} BasecChunkedArray;
+
+/**
+ * @enum BasecChunkedArrayResult
+ * @brief The result of a chunked array operation
+ */
+typedef enum {
+    BASEC_CHUNKED_ARRAY_SUCCESS,
+    BASEC_CHUNKED_ARRAY_NULL_POINTER,
+    BASEC_CHUNKED_ARRAY_INVALID_ELEMENT_SIZE,
+    BASEC_CHUNKED_ARRAY_INVALID_CAPACITY,
+    BASEC_CHUNKED_ARRAY_ALLOCATION_FAILURE,
+    BASEC_CHUNKED_ARRAY_EMPTY,
+    BASEC_CHUNKED_ARRAY_OUT_OF_BOUNDS,
+} BasecChunkedArrayResult;
+
+/**
+ * @brief Handle the result of a chunked array operation
+ * @param result The result of the operation
+ */
+void basec_chunked_array_handle_result(BasecChunkedArrayResult result);
+
+/**
+ * @brief Create a chunked array
+ * @param array The array to create
+ * @param element_size The size of the elements
+ * @param block_capacity The number of elements per block, rounded up to a
+ *                       power of two
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_create(
+    BasecChunkedArray** array,
+    u64                 element_size,
+    u64                 block_capacity
+);
+
+/**
+ * @brief Append an element to the array
+ * @param array The array to append to
+ * @param element The element to append
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_append(
+    BasecChunkedArray* array,
+    const void*        element
+);
+
+/**
+ * @brief Append consecutive elements to the array, a block at a time
+ * @param array The array to append to
+ * @param elements The elements to append, in order
+ * @param count The number of elements
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_append_n(
+    BasecChunkedArray* array,
+    const void*        elements,
+    u64                count
+);
+
+/**
+ * @brief Remove the last element of the array
+ *
+ * Blocks emptied by popping are kept for the next appends.
+ *
+ * @param array The array to pop from
+ * @param element_out The popped element
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_pop(
+    BasecChunkedArray* array,
+    void*              element_out
+);
+
+/**
+ * @brief Get an element from the array
+ * @param array The array to get from
+ * @param index The index of the element
+ * @param element_out The element
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_get(
+    BasecChunkedArray* array,
+    u64                index,
+    void*              element_out
+);
+
+/**
+ * @brief Set an element in the array
+ * @param array The array to set in
+ * @param index The index of the element
+ * @param element The element to set
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_set(
+    BasecChunkedArray* array,
+    u64                index,
+    const void*        element
+);
+
+/**
+ * @brief Get the address of an element, which stays the same as the array
+ *        grows
+ * @param array The array
+ * @param index The index of the element
+ * @param element_out The address of the element
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_at(
+    BasecChunkedArray* array,
+    u64                index,
+    void**             element_out
+);
+
+/**
+ * @brief Get the number of elements in the array
+ * @param array The array
+ * @param length_out The number of elements
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_length(
+    BasecChunkedArray* array,
+    u64*               length_out
+);
+
+/**
+ * @brief Remove every element, keeping the blocks for the next appends
+ * @param array The array to clear
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_clear(BasecChunkedArray* array);
+
+/**
+ * @brief Copy the elements of a chunked array into one contiguous BasecArray
+ *
+ * For consumers that need the elements in one block of memory, like sorts
+ * and parallel algorithms. The chunked array is left as it was.
+ *
+ * @param array The chunked array to copy
+ * @param array_out The array to store the elements in
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_array_flatten(
+    BasecChunkedArray* array,
+    BasecArray**       array_out
+);
+
+/**
+ * @brief Destroy a chunked array
+ * @param array The array to destroy
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_destroy(
+    BasecChunkedArray** array
+);
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * @file basec_deque.h
+ * @brief A double ended queue on a ring buffer
+ */
+#ifndef BASEC_DEQUE_H
+#define BASEC_DEQUE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basec_types.h"
+
+/**
+ * @struct BasecDeque
+ * @brief A ring buffer of fixed size elements
+ *
+ * The capacity is a power of two, so positions wrap with a mask. The front
+ * element lives at head and the rest follow it, wrapping to the start of
+ * data, which makes pushing and popping at either end constant time.
+ */
+typedef struct {
+    void* data;
+    u64   element_size;
+    u64   capacity;
+    u64   head;
+    u64   length;
+} BasecDeque;
+
+/**
+ * @struct BasecDequeSegments
+ * @brief The elements of a deque as two contiguous runs, front first
+ *
+ * second is NULL with a length of 0 when the elements do not wrap.
+ */
+typedef struct {
+    void* first;
+    u64   first_length;
+    void* second;
+    u64   second_length;
+} BasecDequeSegments;
+
+/**
+ * @enum BasecDequeResult
+ * @brief The result of a deque operation
+ */
+typedef enum {
+    BASEC_DEQUE_SUCCESS,
+    BASEC_DEQUE_NULL_POINTER,
+    BASEC_DEQUE_INVALID_ELEMENT_SIZE,
+    BASEC_DEQUE_INVALID_CAPACITY,
+    BASEC_DEQUE_ALLOCATION_FAILURE,
+    BASEC_DEQUE_EMPTY,
+    BASEC_DEQUE_OUT_OF_BOUNDS,
+} BasecDequeResult;
+
+/**
+ * @brief Handle the result of a deque operation
+ * @param result The result of the operation
+ */
+void basec_deque_handle_result(BasecDequeResult result);
+
+/**
+ * @brief Create a deque
+ * @param deque The deque to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing, rounded
+ *                 up to a power of two
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_create(
+    BasecDeque** deque,
+    u64          element_size,
+    u64          capacity
+);
+
+/**
+ * @brief Add an element after the back of the deque
+ * @param deque The deque to push to
+ * @param element The element to push
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_push_back(BasecDeque* deque, const void* element);
+
+/**
+ * @brief Add an element before the front of the deque
+ * @param deque The deque to push to
+ * @param element The element to push
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_push_front(
+    BasecDeque* deque,
+    const void* element
+);
+
+/**
+ * @brief Remove the element at the back of the deque
+ * @param deque The deque to pop from
+ * @param element_out The popped element
+ * @return The result of the operation, BASEC_DEQUE_EMPTY if the deque is
+ *         empty
+ */
+BasecDequeResult basec_deque_pop_back(BasecDeque* deque, void* element_out);
+
+/**
+ * @brief Remove the element at the front of the deque
+ * @param deque The deque to pop from
+ * @param element_out The popped element
+ * @return The result of the operation, BASEC_DEQUE_EMPTY if the deque is
+ *         empty
+ */
+BasecDequeResult basec_deque_pop_front(BasecDeque* deque, void* element_out);
+
+/**
+ * @brief Add several elements after the back of the deque
+ *
+ * Copies the elements with at most two memcpy calls, one up to the end of
+ * the ring and one for the part that wraps.
+ *
+ * @param deque The deque to push to
+ * @param elements The elements to push, in order
+ * @param count The number of elements
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_push_back_n(
+    BasecDeque* deque,
+    const void* elements,
+    u64         count
+);
+
+/**
+ * @brief Remove several elements from the front of the deque
+ *
+ * Copies the elements with at most two memcpy calls. Pass NULL to drop
+ * elements already read through basec_deque_segments.
+ *
+ * @param deque The deque to pop from
+ * @param elements_out The popped elements, in order, may be NULL
+ * @param count The number of elements
+ * @return The result of the operation, BASEC_DEQUE_OUT_OF_BOUNDS if the
+ *         deque holds fewer than count elements
+ */
+BasecDequeResult basec_deque_pop_front_n(
+    BasecDeque* deque,
+    void*       elements_out,
+    u64         count
+);
+
+/**
+ * @brief Get an element of the deque
+ * @param deque The deque to get from
+ * @param index The index of the element, counting from the front
+ * @param element_out The element
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_get(
+    BasecDeque* deque,
+    u64         index,
+    void*       element_out
+);
+
+/**
+ * @brief Get the elements of the deque without copying them
+ *
+ * The segments point into the deque and stay valid until it is modified.
+ *
+ * @param deque The deque to view
+ * @param segments_out The runs of elements, front first
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_segments(
+    BasecDeque*         deque,
+    BasecDequeSegments* segments_out
+);
+
+/**
+ * @brief Get the number of elements in the deque
+ * @param deque The deque
+ * @param length_out The number of elements
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_length(BasecDeque* deque, u64* length_out);
+
+/**
+ * @brief Remove every element, keeping the capacity
+ * @param deque The deque to clear
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_clear(BasecDeque* deque);
+
+/**
+ * @brief Destroy a deque
+ * @param deque The deque to destroy
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_destroy(BasecDeque** deque);
+
+#endif
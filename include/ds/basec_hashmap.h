@@ -0,0 +1,190 @@
+/**
+ * @file basec_hashmap.h
+ * @brief An open addressing hash map with fixed size keys and values
+ */
+#ifndef BASEC_HASHMAP_H
+#define BASEC_HASHMAP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+#include "util/basec_hash.h"
+
+#define BASEC_HASHMAP_GROUP_SIZE 16
+
+/**
+ * @struct BasecHashMap
+ * @brief A hash map storing keys and values inline
+ *
+ * Every slot has a control byte that is either empty, deleted, or the low 7
+ * bits of the hash of the key stored in it. Lookups compare a group of 16
+ * control bytes at once and only compare keys whose hash bits match. The
+ * first group of control bytes is mirrored after the last, so a group can
+ * start at any slot.
+ */
+typedef struct {
+    BasecArray* control;
+    BasecArray* slots;
+    u64         key_size;
+    u64         value_size;
+    u64         value_offset;
+    u64         length;
+    u64         capacity;
+    u64         growth_left;
+    u64         seed;
+} BasecHashMap;
+
+/**
+ * @struct BasecHashMapIterator
+ * @brief An iterator over the entries of a hash map, in slot order
+ */
+typedef struct {
+    BasecHashMap* map;
+    u64           index;
+} BasecHashMapIterator;
+
+/**
+ * @enum BasecHashMapResult
+ * @brief The result of a hash map operation
+ */
+typedef enum {
+    BASEC_HASHMAP_SUCCESS,
+    BASEC_HASHMAP_NULL_POINTER,
+    BASEC_HASHMAP_INVALID_KEY_SIZE,
+    BASEC_HASHMAP_INVALID_CAPACITY,
+    BASEC_HASHMAP_ALLOCATION_FAILURE,
+    BASEC_HASHMAP_NOT_FOUND,
+    BASEC_HASHMAP_END_OF_MAP,
+} BasecHashMapResult;
+
+/**
+ * @brief Handle the result of a hash map operation
+ * @param result The result of the operation
+ */
+void basec_hashmap_handle_result(BasecHashMapResult result);
+
+/**
+ * @brief Create a hash map
+ * @param map The map to create
+ * @param key_size The size of the keys
+ * @param value_size The size of the values, 0 to store keys only
+ * @param capacity The number of entries to hold without growing
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_create(
+    BasecHashMap** map,
+    u64            key_size,
+    u64            value_size,
+    u64            capacity
+);
+
+/**
+ * @brief Insert an entry, replacing the value if the key is already present
+ * @param map The map to insert into
+ * @param key The key of the entry
+ * @param value The value of the entry, may be NULL when values have no size
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_insert(
+    BasecHashMap* map,
+    const void*   key,
+    const void*   value
+);
+
+/**
+ * @brief Get the value stored for a key
+ * @param map The map to search
+ * @param key The key to find
+ * @param value_out The value to copy the entry's value into
+ * @return The result of the operation, BASEC_HASHMAP_NOT_FOUND if the key is
+ *         not present
+ */
+BasecHashMapResult basec_hashmap_get(
+    BasecHashMap* map,
+    const void*   key,
+    void*         value_out
+);
+
+/**
+ * @brief Check if the map contains a key
+ * @param map The map to search
+ * @param key The key to find
+ * @param contains_out Whether the key is present
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_contains(
+    BasecHashMap* map,
+    const void*   key,
+    bool*         contains_out
+);
+
+/**
+ * @brief Remove the entry for a key
+ * @param map The map to remove from
+ * @param key The key to remove
+ * @return The result of the operation, BASEC_HASHMAP_NOT_FOUND if the key is
+ *         not present
+ */
+BasecHashMapResult basec_hashmap_remove(BasecHashMap* map, const void* key);
+
+/**
+ * @brief Make room for a number of entries so they insert without growing
+ * @param map The map to reserve in
+ * @param count The number of entries the map should hold
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_reserve(BasecHashMap* map, u64 count);
+
+/**
+ * @brief Get the number of entries in the map
+ * @param map The map
+ * @param length_out The number of entries
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_length(BasecHashMap* map, u64* length_out);
+
+/**
+ * @brief Start iterating over the entries of a map
+ *
+ * Entries are visited in slot order, walking the table from start to end.
+ * The map must not be modified while iterating.
+ *
+ * @param map The map to iterate over
+ * @param iterator_out The iterator to initialise
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_iterator(
+    BasecHashMap*         map,
+    BasecHashMapIterator* iterator_out
+);
+
+/**
+ * @brief Get the next entry of a map
+ * @param iterator The iterator to advance
+ * @param key_out The key of the entry, pointing into the map
+ * @param value_out The value of the entry, pointing into the map, may be
+ *                  NULL
+ * @return The result of the operation, BASEC_HASHMAP_END_OF_MAP when no
+ *         entries remain
+ */
+BasecHashMapResult basec_hashmap_next(
+    BasecHashMapIterator* iterator,
+    void**                key_out,
+    void**                value_out
+);
+
+/**
+ * @brief Destroy a hash map
+ * @param map The map to destroy
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_destroy(BasecHashMap** map);
+
+#endif
@@ -0,0 +1,168 @@
+/**
+ * @file basec_hashset.h
+ * @brief A hash set of fixed size elements
+ */
+#ifndef BASEC_HASHSET_H
+#define BASEC_HASHSET_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+#include "ds/basec_hashmap.h"
+
+/**
+ * @struct BasecHashSet
+ * @brief A set of elements compared by their bytes
+ *
+ * Stored as a hash map whose values have no size, so every slot holds just
+ * an element.
+ */
+typedef struct {
+    BasecHashMap* map;
+    u64           element_size;
+} BasecHashSet;
+
+/**
+ * @struct BasecHashSetIterator
+ * @brief An iterator over the elements of a hash set, in slot order
+ */
+typedef struct {
+    BasecHashMapIterator iterator;
+} BasecHashSetIterator;
+
+/**
+ * @enum BasecHashSetResult
+ * @brief The result of a hash set operation
+ */
+typedef enum {
+    BASEC_HASHSET_SUCCESS,
+    BASEC_HASHSET_NULL_POINTER,
+    BASEC_HASHSET_INVALID_ELEMENT_SIZE,
+    BASEC_HASHSET_INVALID_CAPACITY,
+    BASEC_HASHSET_ALLOCATION_FAILURE,
+    BASEC_HASHSET_NOT_FOUND,
+    BASEC_HASHSET_END_OF_SET,
+} BasecHashSetResult;
+
+/**
+ * @brief Handle the result of a hash set operation
+ * @param result The result of the operation
+ */
+void basec_hashset_handle_result(BasecHashSetResult result);
+
+/**
+ * @brief Create a hash set
+ * @param set The set to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_create(
+    BasecHashSet** set,
+    u64            element_size,
+    u64            capacity
+);
+
+/**
+ * @brief Insert an element if it is not already present
+ * @param set The set to insert into
+ * @param element The element to insert
+ * @param inserted_out Whether the element was new, may be NULL
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_insert(
+    BasecHashSet* set,
+    const void*   element,
+    bool*         inserted_out
+);
+
+/**
+ * @brief Check if the set contains an element
+ * @param set The set to search
+ * @param element The element to find
+ * @param contains_out Whether the element is present
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_contains(
+    BasecHashSet* set,
+    const void*   element,
+    bool*         contains_out
+);
+
+/**
+ * @brief Remove an element
+ * @param set The set to remove from
+ * @param element The element to remove
+ * @return The result of the operation, BASEC_HASHSET_NOT_FOUND if the element
+ *         is not present
+ */
+BasecHashSetResult basec_hashset_remove(
+    BasecHashSet* set,
+    const void*   element
+);
+
+/**
+ * @brief Make room for a number of elements so they insert without growing
+ * @param set The set to reserve in
+ * @param count The number of elements the set should hold
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_reserve(BasecHashSet* set, u64 count);
+
+/**
+ * @brief Get the number of elements in the set
+ * @param set The set
+ * @param length_out The number of elements
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_length(BasecHashSet* set, u64* length_out);
+
+/**
+ * @brief Start iterating over the elements of a set
+ *
+ * The set must not be modified while iterating.
+ *
+ * @param set The set to iterate over
+ * @param iterator_out The iterator to initialise
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_iterator(
+    BasecHashSet*         set,
+    BasecHashSetIterator* iterator_out
+);
+
+/**
+ * @brief Get the next element of a set
+ * @param iterator The iterator to advance
+ * @param element_out The element, pointing into the set
+ * @return The result of the operation, BASEC_HASHSET_END_OF_SET when no
+ *         elements remain
+ */
+BasecHashSetResult basec_hashset_next(
+    BasecHashSetIterator* iterator,
+    void**                element_out
+);
+
+/**
+ * @brief Remove repeated elements from an array in place, keeping order
+ *
+ * Keeps the first occurrence of every element, in one pass over the array
+ * with a hash set of the elements seen so far. Elements are repeats when
+ * their bytes are equal.
+ *
+ * @param array The array to remove repeats from
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_array_unique(BasecArray* array);
+
+/**
+ * @brief Destroy a hash set
+ * @param set The set to destroy
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_destroy(BasecHashSet** set);
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * @file basec_heap.h
+ * @brief A d-ary heap of fixed size elements, for priority queues
+ */
+#ifndef BASEC_HEAP_H
+#define BASEC_HEAP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+
+#define BASEC_HEAP_BINARY     2
+#define BASEC_HEAP_QUATERNARY 4
+#define BASEC_HEAP_MAX_ARITY  16
+
+/**
+ * @struct BasecHeap
+ * @brief A heap whose root is the element that orders first
+ *
+ * Elements are ordered by compare, or by the u64 key at key_offset when
+ * compare is NULL, smallest first. Every node has arity children. A 4-ary
+ * heap is shallower than a binary one and its children share cache lines,
+ * which makes pops cheaper on large heaps.
+ */
+typedef struct {
+    BasecArray*       array;
+    BasecArrayCompare compare;
+    u64               key_offset;
+    u64               arity;
+    void*             scratch;
+} BasecHeap;
+
+/**
+ * @enum BasecHeapResult
+ * @brief The result of a heap operation
+ */
+typedef enum {
+    BASEC_HEAP_SUCCESS,
+    BASEC_HEAP_NULL_POINTER,
+    BASEC_HEAP_INVALID_ELEMENT_SIZE,
+    BASEC_HEAP_INVALID_CAPACITY,
+    BASEC_HEAP_INVALID_ARITY,
+    BASEC_HEAP_INVALID_KEY_OFFSET,
+    BASEC_HEAP_ALLOCATION_FAILURE,
+    BASEC_HEAP_EMPTY,
+} BasecHeapResult;
+
+/**
+ * @brief Handle the result of a heap operation
+ * @param result The result of the operation
+ */
+void basec_heap_handle_result(BasecHeapResult result);
+
+/**
+ * @brief Create a heap ordered by a comparator
+ * @param heap The heap to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing
+ * @param compare The comparator, the element ordering first is popped first
+ * @param arity The number of children of every node, BASEC_HEAP_BINARY or
+ *              BASEC_HEAP_QUATERNARY, up to BASEC_HEAP_MAX_ARITY
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_create(
+    BasecHeap**       heap,
+    u64               element_size,
+    u64               capacity,
+    BasecArrayCompare compare,
+    u64               arity
+);
+
+/**
+ * @brief Create a heap ordered by a u64 key inside every element
+ *
+ * Comparing keys inline is cheaper than calling a comparator, which suits
+ * scheduling queues ordered by a deadline or priority field.
+ *
+ * @param heap The heap to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing
+ * @param key_offset The offset of the u64 key in every element, the element
+ *                   with the smallest key is popped first
+ * @param arity The number of children of every node, BASEC_HEAP_BINARY or
+ *              BASEC_HEAP_QUATERNARY, up to BASEC_HEAP_MAX_ARITY
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_create_keyed(
+    BasecHeap** heap,
+    u64         element_size,
+    u64         capacity,
+    u64         key_offset,
+    u64         arity
+);
+
+/**
+ * @brief Add an element to the heap
+ * @param heap The heap to push to
+ * @param element The element to push
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_push(BasecHeap* heap, const void* element);
+
+/**
+ * @brief Add every element of an array to the heap
+ *
+ * Appends the elements and restores the heap bottom up, which takes linear
+ * time instead of the n log n of pushing them one by one.
+ *
+ * @param heap The heap to push to
+ * @param elements The array of elements, of the heap's element size
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_push_array(BasecHeap* heap, BasecArray* elements);
+
+/**
+ * @brief Remove the element that orders first
+ * @param heap The heap to pop from
+ * @param element_out The popped element
+ * @return The result of the operation, BASEC_HEAP_EMPTY if the heap is empty
+ */
+BasecHeapResult basec_heap_pop(BasecHeap* heap, void* element_out);
+
+/**
+ * @brief Get the element that orders first without removing it
+ * @param heap The heap
+ * @param element_out The first element
+ * @return The result of the operation, BASEC_HEAP_EMPTY if the heap is empty
+ */
+BasecHeapResult basec_heap_peek(BasecHeap* heap, void* element_out);
+
+/**
+ * @brief Get the number of elements in the heap
+ * @param heap The heap
+ * @param length_out The number of elements
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_length(BasecHeap* heap, u64* length_out);
+
+/**
+ * @brief Destroy a heap
+ * @param heap The heap to destroy
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_destroy(BasecHeap** heap);
+
+#endif
@@ -0,0 +1,173 @@
+/**
+ * @file basec_interner.h
+ * @brief A thread safe table mapping strings to small integer atoms
+ */
+#ifndef BASEC_INTERNER_H
+#define BASEC_INTERNER_H
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+#include "ds/basec_string.h"
+#include "ds/basec_strmap.h"
+#include "util/basec_hash.h"
+
+#define BASEC_INTERNER_SHARDS         16
+#define BASEC_INTERNER_FIRST_SEGMENT  64
+#define BASEC_INTERNER_SEGMENTS       26
+#define BASEC_INTERNER_BLOCK_SIZE     65536
+#define BASEC_INTERNER_CACHE_LINE     64
+
+/**
+ * @struct BasecInternerShard
+ * @brief A lock and the atoms of the strings hashing to it
+ *
+ * Each shard fills its own cache line, so threads interning strings of
+ * different shards do not contend on the same line.
+ */
+typedef struct {
+    _Alignas(BASEC_INTERNER_CACHE_LINE) pthread_rwlock_t lock;
+    BasecStrMap* atoms;
+} BasecInternerShard;
+
+/**
+ * @struct BasecInterner
+ * @brief A table giving every distinct string one atom and one canonical copy
+ *
+ * Atoms are numbered from 0 in the order their strings were first interned.
+ * Canonical copies are written once into blocks that never move, and the
+ * views of the atoms are kept in segments of doubling size that never move
+ * either, so looking up an atom's view takes no lock.
+ */
+typedef struct {
+    BasecInternerShard shards[BASEC_INTERNER_SHARDS];
+    pthread_mutex_t    lock;
+    BasecStringView*   views[BASEC_INTERNER_SEGMENTS];
+    BasecArray*        blocks;
+    c_str              block;
+    u64                block_length;
+    u64                block_capacity;
+    u64                length;
+    u64                seed;
+} BasecInterner;
+
+/**
+ * @enum BasecInternerResult
+ * @brief The result of an interner operation
+ */
+typedef enum {
+    BASEC_INTERNER_SUCCESS,
+    BASEC_INTERNER_NULL_POINTER,
+    BASEC_INTERNER_INVALID_ATOM,
+    BASEC_INTERNER_INVALID_DELIMITER,
+    BASEC_INTERNER_STRING_TOO_LONG,
+    BASEC_INTERNER_TOO_MANY_ATOMS,
+    BASEC_INTERNER_ALLOCATION_FAILURE,
+    BASEC_INTERNER_LOCK_FAILURE,
+    BASEC_INTERNER_ARRAY_FAILURE,
+    BASEC_INTERNER_NOT_FOUND,
+} BasecInternerResult;
+
+/**
+ * @brief Handle the result of an interner operation
+ * @param result The result of the operation
+ */
+void basec_interner_handle_result(BasecInternerResult result);
+
+/**
+ * @brief Create an interner
+ * @param interner The interner to create
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_create(BasecInterner** interner);
+
+/**
+ * @brief Get the atom of a string, adding the string if it is new
+ *
+ * Safe to call from several threads at once. Strings already interned only
+ * take a shared lock on one shard.
+ *
+ * @param interner The interner
+ * @param string The bytes of the string
+ * @param atom_out The atom of the string
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_intern(
+    BasecInterner*  interner,
+    BasecStringView string,
+    u32*            atom_out
+);
+
+/**
+ * @brief Get the atom of a string without adding it
+ * @param interner The interner
+ * @param string The bytes of the string
+ * @param atom_out The atom of the string
+ * @return The result of the operation, BASEC_INTERNER_NOT_FOUND if the string
+ *         was never interned
+ */
+BasecInternerResult basec_interner_find(
+    BasecInterner*  interner,
+    BasecStringView string,
+    u32*            atom_out
+);
+
+/**
+ * @brief Get the canonical copy of an atom's string
+ *
+ * The view is NUL terminated and stays valid until the interner is
+ * destroyed. Takes no lock.
+ *
+ * @param interner The interner
+ * @param atom The atom
+ * @param view_out The canonical view of the string
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_view(
+    BasecInterner*   interner,
+    u32              atom,
+    BasecStringView* view_out
+);
+
+/**
+ * @brief Get the number of atoms in the interner
+ * @param interner The interner
+ * @param length_out The number of atoms
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_length(
+    BasecInterner* interner,
+    u64*           length_out
+);
+
+/**
+ * @brief Split a string by a delimiter into the atoms of its parts
+ *
+ * Splits like basec_string_split, but interns every part instead of
+ * allocating a string for it.
+ *
+ * @param string The string to split
+ * @param delimiter The delimiter to split the string by
+ * @param interner The interner to intern the parts in
+ * @param array_out The array of u32 atoms, replaced if not NULL
+ * @return The result of the operation
+ */
+BasecInternerResult basec_string_split_interned(
+    BasecString*   string,
+    const c_str    delimiter,
+    BasecInterner* interner,
+    BasecArray**   array_out
+);
+
+/**
+ * @brief Destroy an interner and every canonical copy it holds
+ * @param interner The interner to destroy
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_destroy(BasecInterner** interner);
+
+#endif
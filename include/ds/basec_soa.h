@@ -0,0 +1,191 @@
+/**
+ * @file basec_soa.h
+ * @brief A struct of arrays, with one contiguous column per record field
+ */
+#ifndef BASEC_SOA_H
+#define BASEC_SOA_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+
+#define BASEC_SOA_COLUMN_ALIGNMENT 64
+
+/**
+ * @brief Describe the member of a record struct, for a field layout
+ * @param type The record struct
+ * @param member The member of the struct
+ */
+#define BASEC_SOA_FIELD(type, member) \
+    {offsetof(type, member), sizeof(((type*)0)->member)}
+
+/**
+ * @struct BasecSoAField
+ * @brief Where a field lies in a record
+ */
+typedef struct {
+    u64 offset;
+    u64 size;
+} BasecSoAField;
+
+/**
+ * @struct BasecSoASpan
+ * @brief The elements of one column, length elements of element_size
+ *        bytes from data
+ *
+ * The span points into the column and is invalidated when the SoA grows.
+ */
+typedef struct {
+    void* data;
+    u64   length;
+    u64   element_size;
+} BasecSoASpan;
+
+/**
+ * @struct BasecSoA
+ * @brief Records of row_size bytes stored as one BasecArray per field
+ *
+ * Row i is element i of every column. A scan that reads one field only
+ * loads that field's column, instead of every cache line of the records.
+ * Columns are aligned to BASEC_SOA_COLUMN_ALIGNMENT bytes.
+ */
+typedef struct {
+    BasecArray**   columns;
+    BasecSoAField* fields;
+    u64            field_count;
+    u64            row_size;
+    u64            length;
+} BasecSoA;
+
+/**
+ * @enum BasecSoAResult
+ * @brief The result of a SoA operation
+ */
+typedef enum {
+    BASEC_SOA_SUCCESS,
+    BASEC_SOA_NULL_POINTER,
+    BASEC_SOA_INVALID_LAYOUT,
+    BASEC_SOA_INVALID_CAPACITY,
+    BASEC_SOA_INVALID_FIELD,
+    BASEC_SOA_ALLOCATION_FAILURE,
+    BASEC_SOA_OUT_OF_BOUNDS,
+} BasecSoAResult;
+
+/**
+ * @brief Handle the result of a SoA operation
+ * @param result The result of the operation
+ */
+void basec_soa_handle_result(BasecSoAResult result);
+
+/**
+ * @brief Create a SoA from a field layout
+ *
+ * Fields may not overlap and must lie within row_size bytes. Bytes of a
+ * record outside every field, like padding, are not stored.
+ *
+ * @param soa The SoA to create
+ * @param fields The fields of a record, copied into the SoA
+ * @param field_count The number of fields
+ * @param row_size The size of a record, like sizeof of its struct
+ * @param capacity The number of rows to allocate room for
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_create(
+    BasecSoA**           soa,
+    const BasecSoAField* fields,
+    u64                  field_count,
+    u64                  row_size,
+    u64                  capacity
+);
+
+/**
+ * @brief Append a record, one field to each column
+ * @param soa The SoA to append to
+ * @param row The record, row_size bytes
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_append(BasecSoA* soa, const void* row);
+
+/**
+ * @brief Get a record, gathered from every column
+ * @param soa The SoA
+ * @param index The index of the row
+ * @param row_out The record to fill in, row_size bytes of which only the
+ *                fields are written
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_get(BasecSoA* soa, u64 index, void* row_out);
+
+/**
+ * @brief Set a record, scattered into every column
+ * @param soa The SoA
+ * @param index The index of the row
+ * @param row The record, row_size bytes
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_set(BasecSoA* soa, u64 index, const void* row);
+
+/**
+ * @brief Get the elements of one column
+ * @param soa The SoA
+ * @param field The index of the field in the layout
+ * @param span_out The span of the column
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_column(
+    BasecSoA*     soa,
+    u64           field,
+    BasecSoASpan* span_out
+);
+
+/**
+ * @brief Get the number of rows in the SoA
+ * @param soa The SoA
+ * @param length_out The number of rows
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_length(BasecSoA* soa, u64* length_out);
+
+/**
+ * @brief Create a SoA from the records of an array of structs
+ *
+ * The record size is the element size of the array. Any SoA already in
+ * soa_out is destroyed first.
+ *
+ * @param array The array of records
+ * @param fields The fields of a record, copied into the SoA
+ * @param field_count The number of fields
+ * @param soa_out The SoA holding the records
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_from_array(
+    BasecArray*          array,
+    const BasecSoAField* fields,
+    u64                  field_count,
+    BasecSoA**           soa_out
+);
+
+/**
+ * @brief Copy the rows of a SoA into an array of structs
+ *
+ * Bytes of the records outside every field are zeroed. Any array already
+ * in array_out is destroyed first.
+ *
+ * @param soa The SoA to copy
+ * @param array_out The array to store the records in
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_to_array(BasecSoA* soa, BasecArray** array_out);
+
+/**
+ * @brief Destroy a SoA
+ * @param soa The SoA to destroy
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_destroy(BasecSoA** soa);
+
+#endif
@@ -7,22 +7,57 @@
 #define BASEC_STRING_H
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
+#include <locale.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if defined(__SSE2__)
+#include <tmmintrin.h>
+#endif
 
 #include "basec_types.h"
 #include "ds/basec_array.h"
+#include "util/basec_hash.h"
+#include "util/basec_memory.h"
 
 /**
  * @brief A string
+ *
+ * data holds capacity + 1 bytes, room for a terminating '\0'. Data of
+ * BASEC_MEMORY_MAP_THRESHOLD bytes or more is mapped rather than allocated,
+ * see basec_memory_resize, and mapped is set.
  */
 typedef struct {
     c_str data;
     u64   length;
     u64   capacity;
+    bool  mapped;
 } BasecString;
 
+/**
+ * @brief A non-owning view of a sequence of characters
+ *
+ * Views are not guaranteed to be null terminated, always use the length.
+ */
+typedef struct {
+    c_str data;
+    u64   length;
+} BasecStringView;
+
+/**
+ * @brief An iterator over the codepoints of a UTF-8 view
+ */
+typedef struct {
+    BasecStringView view;
+    u64             offset;
+} BasecStringUtf8Iterator;
+
 /**
  * @brief A result for a string operation
  */
@@ -34,6 +69,12 @@ typedef enum {
     BASEC_STRING_MEMOP_FAILURE,
     BASEC_STRING_NOT_FOUND,
     BASEC_STRING_ARRAY_FAILURE,
+    BASEC_STRING_IO_FAILURE,
+    BASEC_STRING_PARSE_FAILURE,
+    BASEC_STRING_OUT_OF_RANGE,
+    BASEC_STRING_FORMAT_FAILURE,
+    BASEC_STRING_INVALID_UTF8,
+    BASEC_STRING_END_OF_STRING,
 } BasecStringResult;
 
 /**
@@ -104,6 +145,42 @@ BasecStringResult basec_string_append(
     const c_str  append_str
 );
 
+/**
+ * @brief Append an unsigned integer to the string
+ * @param string The string to append to
+ * @param value The value to append
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_append_u64(BasecString* string, u64 value);
+
+/**
+ * @brief Append a signed integer to the string
+ * @param string The string to append to
+ * @param value The value to append
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_append_i64(BasecString* string, i64 value);
+
+/**
+ * @brief Append a double to the string
+ *
+ * Uses the short digits that read back as the same double (Grisu2), in
+ * plain notation when the exponent is small and as 1.5e300 otherwise.
+ *
+ * @param string The string to append to
+ * @param value The value to append
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_append_f64(BasecString* string, f64 value);
+
+/**
+ * @brief Append an unsigned integer to the string in lowercase hexadecimal
+ * @param string The string to append to
+ * @param value The value to append
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_append_hex(BasecString* string, u64 value);
+
 /**
  * @brief Push a string to the string (same as append)
  * @param string The string to push to
@@ -138,6 +215,32 @@ BasecStringResult basec_string_find(
     u64*         index_out
 );
 
+/**
+ * @brief Check if string contains substring, ignoring ASCII case
+ * @param string The string to find the substring in
+ * @param substr The substring to find
+ * @param contains_out The boolean to store the result in
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_contains_icase(
+    BasecString* string,
+    const c_str  substr,
+    bool*        contains_out
+);
+
+/**
+ * @brief Find a substring in the string, ignoring ASCII case
+ * @param string The string to find the substring in
+ * @param substr The substring to find
+ * @param index_out The index of the substring
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_find_icase(
+    BasecString* string,
+    const c_str  substr,
+    u64*         index_out
+);
+
 /**
  * @brief Find all instances of a substring in the string
  * @param string The string to find the substrings in
@@ -179,6 +282,287 @@ BasecStringResult basec_string_split(
     BasecArray** array_out
 );
 
+/**
+ * @brief Append printf style formatted text to the string
+ *
+ * Formats straight into the string's spare capacity, growing it at most once
+ * when the text does not fit. %s, %c, %d, %i, %u, %x (with l, ll or z) and
+ * %f without flags, width or precision are written without going through
+ * printf. Two extra conversions print basec strings without a c_str:
+ * %S takes a BasecString* and %V a BasecStringView.
+ *
+ * @param string The string to append to
+ * @param format The printf style format
+ * @param ... The arguments of the format
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_appendf(
+    BasecString* string,
+    const c_str  format,
+    ...
+);
+
+/**
+ * @brief Append printf style formatted text to the string from a va_list
+ * @param string The string to append to
+ * @param format The printf style format
+ * @param args The arguments of the format
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_vappendf(
+    BasecString* string,
+    const c_str  format,
+    va_list      args
+);
+
+/**
+ * @brief Parse a view as an unsigned integer
+ *
+ * The whole view must be an optional '+' followed by decimal digits, no
+ * whitespace is skipped. Eight digits are converted at a time.
+ *
+ * @param view The view to parse
+ * @param value_out The parsed value
+ * @return The result of the operation, BASEC_STRING_PARSE_FAILURE if the
+ *         view is not a number and BASEC_STRING_OUT_OF_RANGE if it does not
+ *         fit
+ */
+BasecStringResult basec_string_parse_u64(BasecStringView view, u64* value_out);
+
+/**
+ * @brief Parse a view as a signed integer
+ * @param view The view to parse
+ * @param value_out The parsed value
+ * @return The result of the operation, BASEC_STRING_PARSE_FAILURE if the
+ *         view is not a number and BASEC_STRING_OUT_OF_RANGE if it does not
+ *         fit
+ */
+BasecStringResult basec_string_parse_i64(BasecStringView view, i64* value_out);
+
+/**
+ * @brief Parse a view as a double
+ *
+ * Accepts decimal and scientific notation with '.' as the decimal point
+ * regardless of locale, as well as inf, infinity and nan. The result is
+ * correctly rounded (Eisel-Lemire).
+ *
+ * @param view The view to parse
+ * @param value_out The parsed value
+ * @return The result of the operation, BASEC_STRING_PARSE_FAILURE if the
+ *         view is not a number and BASEC_STRING_OUT_OF_RANGE if it overflows
+ */
+BasecStringResult basec_string_parse_f64(BasecStringView view, f64* value_out);
+
+/**
+ * @brief Parse every string of an array as an unsigned integer
+ * @param strings The array of BasecString* to parse, e.g. from a split
+ * @param values_out The array of u64 to store the values in
+ * @param index_out The index of the string that failed to parse, may be NULL
+ * @return The result of the operation
+ */
+BasecStringResult basec_strings_parse_u64(
+    BasecArray*  strings,
+    BasecArray** values_out,
+    u64*         index_out
+);
+
+/**
+ * @brief Parse every string of an array as a signed integer
+ * @param strings The array of BasecString* to parse, e.g. from a split
+ * @param values_out The array of i64 to store the values in
+ * @param index_out The index of the string that failed to parse, may be NULL
+ * @return The result of the operation
+ */
+BasecStringResult basec_strings_parse_i64(
+    BasecArray*  strings,
+    BasecArray** values_out,
+    u64*         index_out
+);
+
+/**
+ * @brief Parse every string of an array as a double
+ * @param strings The array of BasecString* to parse, e.g. from a split
+ * @param values_out The array of f64 to store the values in
+ * @param index_out The index of the string that failed to parse, may be NULL
+ * @return The result of the operation
+ */
+BasecStringResult basec_strings_parse_f64(
+    BasecArray*  strings,
+    BasecArray** values_out,
+    u64*         index_out
+);
+
+/**
+ * @brief Check whether a view is valid UTF-8
+ *
+ * Overlong encodings, surrogates, codepoints above U+10FFFF and truncated
+ * sequences are all rejected. Uses a vectorized lookup table validator when
+ * the CPU supports SSSE3.
+ *
+ * @param view The view to check
+ * @param valid_out Whether the view is valid UTF-8
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_utf8_validate(
+    BasecStringView view,
+    bool*           valid_out
+);
+
+/**
+ * @brief Count the codepoints of a UTF-8 view
+ *
+ * Counts the bytes that are not continuation bytes, 16 at a time, so the
+ * view is assumed to be valid UTF-8.
+ *
+ * @param view The view to count the codepoints of
+ * @param length_out The number of codepoints
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_utf8_length(
+    BasecStringView view,
+    u64*            length_out
+);
+
+/**
+ * @brief Find the byte offset of a codepoint in a UTF-8 view
+ * @param view The view to search, assumed to be valid UTF-8
+ * @param index The index of the codepoint
+ * @param offset_out The byte offset the codepoint starts at
+ * @return The result of the operation, BASEC_STRING_OUT_OF_RANGE if the view
+ *         has fewer codepoints
+ */
+BasecStringResult basec_string_utf8_index(
+    BasecStringView view,
+    u64             index,
+    u64*            offset_out
+);
+
+/**
+ * @brief Create an iterator over the codepoints of a UTF-8 view
+ * @param view The view to iterate over
+ * @param iterator_out The iterator to initialize
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_utf8_iterator(
+    BasecStringView          view,
+    BasecStringUtf8Iterator* iterator_out
+);
+
+/**
+ * @brief Decode the next codepoint of an iterator
+ *
+ * An invalid sequence returns BASEC_STRING_INVALID_UTF8 and skips one byte, so
+ * iteration can carry on past it.
+ *
+ * @param iterator The iterator to advance
+ * @param codepoint_out The decoded codepoint
+ * @return The result of the operation, BASEC_STRING_END_OF_STRING when no
+ *         codepoints remain
+ */
+BasecStringResult basec_string_utf8_next(
+    BasecStringUtf8Iterator* iterator,
+    u32*                     codepoint_out
+);
+
+/**
+ * @brief Get a view of the whole string
+ * @param string The string to view
+ * @param view_out The view of the string
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_view(
+    BasecString*     string,
+    BasecStringView* view_out
+);
+
+/**
+ * @brief Convert the ASCII letters of the string to lowercase in place
+ * @param string The string to convert
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_to_lower(BasecString* string);
+
+/**
+ * @brief Convert the ASCII letters of the string to uppercase in place
+ * @param string The string to convert
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_to_upper(BasecString* string);
+
+/**
+ * @brief Trim leading ASCII whitespace from a view
+ * @param view The view to trim
+ * @param view_out The trimmed view
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_trim_start(
+    BasecStringView  view,
+    BasecStringView* view_out
+);
+
+/**
+ * @brief Trim trailing ASCII whitespace from a view
+ * @param view The view to trim
+ * @param view_out The trimmed view
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_trim_end(
+    BasecStringView  view,
+    BasecStringView* view_out
+);
+
+/**
+ * @brief Trim leading and trailing ASCII whitespace from a view
+ * @param view The view to trim
+ * @param view_out The trimmed view
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_trim(
+    BasecStringView  view,
+    BasecStringView* view_out
+);
+
+/**
+ * @brief Hash the contents of the string
+ * @param string The string to hash
+ * @param hash_out The hash of the string
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_hash(BasecString* string, u64* hash_out);
+
+/**
+ * @brief Map a file into memory as a read-only view
+ * @param path The path of the file to map
+ * @param view_out The view to store the mapped file in
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_map_file(
+    const c_str      path,
+    BasecStringView* view_out
+);
+
+/**
+ * @brief Unmap a view created by basec_string_map_file
+ * @param view The view to unmap
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_unmap_file(BasecStringView* view);
+
+/**
+ * @brief Read a file directly into a string
+ *
+ * If string_out already holds a string its buffer is reused, and only grown
+ * when the file does not fit.
+ *
+ * @param path The path of the file to read
+ * @param string_out The string to read the file into
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_read_file(
+    const c_str   path,
+    BasecString** string_out
+);
+
 /**
  * @brief Destroy a string
  * @param string The string to destroy
@@ -0,0 +1,205 @@
+/**
+ * @file basec_strmap.h
+ * @brief A hash map with string keys stored inline or in an arena
+ */
+#ifndef BASEC_STRMAP_H
+#define BASEC_STRMAP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+#include "ds/basec_string.h"
+#include "util/basec_hash.h"
+
+#define BASEC_STRMAP_GROUP_SIZE  16
+#define BASEC_STRMAP_INLINE_SIZE 20
+
+/**
+ * @struct BasecStrMapKey
+ * @brief The key at the start of every slot
+ *
+ * Keys of up to BASEC_STRMAP_INLINE_SIZE bytes are stored in bytes, longer
+ * keys store their u64 offset into the map's arena there instead. The full
+ * hash is kept so probes and resizes never rehash or compare keys that
+ * cannot match.
+ */
+typedef struct {
+    u64 hash;
+    u32 length;
+    c8  bytes[BASEC_STRMAP_INLINE_SIZE];
+} BasecStrMapKey;
+
+/**
+ * @struct BasecStrMap
+ * @brief A hash map from strings to fixed size values
+ */
+typedef struct {
+    BasecArray* control;
+    BasecArray* slots;
+    c_str       arena;
+    u64         arena_length;
+    u64         arena_capacity;
+    u64         arena_unused;
+    u64         value_size;
+    u64         value_offset;
+    u64         length;
+    u64         capacity;
+    u64         growth_left;
+    u64         seed;
+} BasecStrMap;
+
+/**
+ * @struct BasecStrMapIterator
+ * @brief An iterator over the entries of a string map, in slot order
+ */
+typedef struct {
+    BasecStrMap* map;
+    u64          index;
+} BasecStrMapIterator;
+
+/**
+ * @enum BasecStrMapResult
+ * @brief The result of a string map operation
+ */
+typedef enum {
+    BASEC_STRMAP_SUCCESS,
+    BASEC_STRMAP_NULL_POINTER,
+    BASEC_STRMAP_INVALID_CAPACITY,
+    BASEC_STRMAP_KEY_TOO_LONG,
+    BASEC_STRMAP_ALLOCATION_FAILURE,
+    BASEC_STRMAP_NOT_FOUND,
+    BASEC_STRMAP_END_OF_MAP,
+} BasecStrMapResult;
+
+/**
+ * @brief Handle the result of a string map operation
+ * @param result The result of the operation
+ */
+void basec_strmap_handle_result(BasecStrMapResult result);
+
+/**
+ * @brief Create a string map
+ * @param map The map to create
+ * @param value_size The size of the values, 0 to store keys only
+ * @param capacity The number of entries to hold without growing
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_create(
+    BasecStrMap** map,
+    u64           value_size,
+    u64           capacity
+);
+
+/**
+ * @brief Insert an entry, replacing the value if the key is already present
+ *
+ * The key's bytes are copied into the map.
+ *
+ * @param map The map to insert into
+ * @param key The key of the entry
+ * @param value The value of the entry, may be NULL when values have no size
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_insert(
+    BasecStrMap*    map,
+    BasecStringView key,
+    const void*     value
+);
+
+/**
+ * @brief Get the value stored for a key
+ * @param map The map to search
+ * @param key The key to find
+ * @param value_out The value to copy the entry's value into
+ * @return The result of the operation, BASEC_STRMAP_NOT_FOUND if the key is
+ *         not present
+ */
+BasecStrMapResult basec_strmap_get(
+    BasecStrMap*    map,
+    BasecStringView key,
+    void*           value_out
+);
+
+/**
+ * @brief Check if the map contains a key
+ * @param map The map to search
+ * @param key The key to find
+ * @param contains_out Whether the key is present
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_contains(
+    BasecStrMap*    map,
+    BasecStringView key,
+    bool*           contains_out
+);
+
+/**
+ * @brief Remove the entry for a key
+ * @param map The map to remove from
+ * @param key The key to remove
+ * @return The result of the operation, BASEC_STRMAP_NOT_FOUND if the key is
+ *         not present
+ */
+BasecStrMapResult basec_strmap_remove(BasecStrMap* map, BasecStringView key);
+
+/**
+ * @brief Make room for a number of entries so they insert without growing
+ * @param map The map to reserve in
+ * @param count The number of entries the map should hold
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_reserve(BasecStrMap* map, u64 count);
+
+/**
+ * @brief Get the number of entries in the map
+ * @param map The map
+ * @param length_out The number of entries
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_length(BasecStrMap* map, u64* length_out);
+
+/**
+ * @brief Start iterating over the entries of a map
+ *
+ * The map must not be modified while iterating.
+ *
+ * @param map The map to iterate over
+ * @param iterator_out The iterator to initialise
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_iterator(
+    BasecStrMap*         map,
+    BasecStrMapIterator* iterator_out
+);
+
+/**
+ * @brief Get the next entry of a map
+ * @param iterator The iterator to advance
+ * @param key_out The key of the entry, a view into the map that is valid
+ *                until the map is next modified
+ * @param value_out The value of the entry, pointing into the map, may be
+ *                  NULL
+ * @return The result of the operation, BASEC_STRMAP_END_OF_MAP when no
+ *         entries remain
+ */
+BasecStrMapResult basec_strmap_next(
+    BasecStrMapIterator* iterator,
+    BasecStringView*     key_out,
+    void**               value_out
+);
+
+/**
+ * @brief Destroy a string map
+ * @param map The map to destroy
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_destroy(BasecStrMap** map);
+
+#endif
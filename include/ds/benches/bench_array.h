@@ -0,0 +1,41 @@
+#ifndef BASEC_ARRAY_BENCH_H
+#define BASEC_ARRAY_BENCH_H
+
+#include "util/basec_bench.h"
+#include "ds/basec_array.h"
+
+/**
+ * @brief Benchmark basec_array_find with and without an index, for growing
+ *        numbers of elements
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_array_find_indexed(void);
+
+/**
+ * @brief Benchmark parallel reduces and scans against serial loops on the
+ *        shared pool
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_array_par(void);
+
+/**
+ * @brief Benchmark parallel merge and radix sorts from 1 to 8 workers
+ *        against basec_array_sort
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_array_par_sort(void);
+
+/**
+ * @brief Benchmark random reads from a large array with and without
+ *        transparent huge pages
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_array_huge_pages(void);
+
+/**
+ * @brief Run the Array benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_array_run(void);
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef BASEC_CHUNKED_ARRAY_BENCH_H
+#define BASEC_CHUNKED_ARRAY_BENCH_H
+
+#include <malloc.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "util/basec_bench.h"
+#include "ds/basec_array.h"
+#include "ds/basec_chunked_array.h"
+
+/**
+ * @brief Benchmark appending to BasecArray and BasecChunkedArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_chunked_array_append(void);
+
+/**
+ * @brief Benchmark the slowest appends to BasecArray and BasecChunkedArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_chunked_array_append_tail(void);
+
+/**
+ * @brief Benchmark the peak memory of filling BasecArray and
+ *        BasecChunkedArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_chunked_array_peak_rss(void);
+
+/**
+ * @brief Benchmark flattening a BasecChunkedArray into a BasecArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_chunked_array_flatten(void);
+
+/**
+ * @brief Run the ChunkedArray benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_chunked_array_run(void);
+
+#endif
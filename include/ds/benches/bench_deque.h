@@ -0,0 +1,32 @@
+#ifndef BASEC_DEQUE_BENCH_H
+#define BASEC_DEQUE_BENCH_H
+
+#include "util/basec_bench.h"
+#include "ds/basec_array.h"
+#include "ds/basec_deque.h"
+
+/**
+ * @brief Benchmark a FIFO on BasecArray, removing from the front
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_deque_array_fifo(void);
+
+/**
+ * @brief Benchmark a FIFO on BasecDeque, one element at a time
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_deque_fifo(void);
+
+/**
+ * @brief Benchmark a FIFO on BasecDeque, 64 elements at a time
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_deque_fifo_bulk(void);
+
+/**
+ * @brief Run the Deque benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_deque_run(void);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef BASEC_HASHMAP_BENCH_H
+#define BASEC_HASHMAP_BENCH_H
+
+#include "util/basec_bench.h"
+#include "ds/basec_hashmap.h"
+
+/**
+ * @brief Benchmark inserting keys into a hash map
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashmap_insert(void);
+
+/**
+ * @brief Benchmark looking up keys in a hash map
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashmap_get(void);
+
+/**
+ * @brief Benchmark lookups with basec_array_find against a hash map, for
+ *        growing numbers of keys
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashmap_versus_array_find(void);
+
+/**
+ * @brief Run the HashMap benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_hashmap_run(void);
+
+#endif
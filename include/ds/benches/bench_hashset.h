@@ -0,0 +1,31 @@
+#ifndef BASEC_HASHSET_BENCH_H
+#define BASEC_HASHSET_BENCH_H
+
+#include "util/basec_bench.h"
+#include "ds/basec_hashset.h"
+
+/**
+ * @brief Benchmark removing repeats with basec_array_contains in a loop
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashset_unique_contains(void);
+
+/**
+ * @brief Benchmark removing repeats with a hash set
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashset_unique(void);
+
+/**
+ * @brief Benchmark removing repeats by sorting first
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashset_unique_sorted(void);
+
+/**
+ * @brief Run the HashSet benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_hashset_run(void);
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef BASEC_HEAP_BENCH_H
+#define BASEC_HEAP_BENCH_H
+
+#include "util/basec_bench.h"
+#include "ds/basec_heap.h"
+
+/**
+ * @brief Benchmark pushing and popping 1M keys with a binary heap
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_push_pop_binary(void);
+
+/**
+ * @brief Benchmark pushing and popping 1M keys with a 4-ary heap
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_push_pop_quaternary(void);
+
+/**
+ * @brief Benchmark building a heap from an array of keys at once
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_push_array(void);
+
+/**
+ * @brief Benchmark finding the 100 smallest keys with a full sort
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_sort_top(void);
+
+/**
+ * @brief Benchmark finding the 100 smallest keys with basec_array_top_k
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_top_k(void);
+
+/**
+ * @brief Run the Heap benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_heap_run(void);
+
+#endif
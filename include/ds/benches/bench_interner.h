@@ -0,0 +1,19 @@
+#ifndef BASEC_INTERNER_BENCH_H
+#define BASEC_INTERNER_BENCH_H
+
+#include "util/basec_bench.h"
+#include "ds/basec_interner.h"
+
+/**
+ * @brief Benchmark splitting into heap strings against splitting into atoms
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_interner_versus_split(void);
+
+/**
+ * @brief Run the Interner benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_interner_run(void);
+
+#endif
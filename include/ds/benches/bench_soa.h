@@ -0,0 +1,35 @@
+#ifndef BASEC_SOA_BENCH_H
+#define BASEC_SOA_BENCH_H
+
+#include <string.h>
+
+#include "util/basec_bench.h"
+#include "ds/basec_array.h"
+#include "ds/basec_soa.h"
+
+/**
+ * @brief Benchmark appending records to a BasecArray and a BasecSoA
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_soa_append(void);
+
+/**
+ * @brief Benchmark summing one field of every record, in a BasecArray of
+ *        records and in a BasecSoA column
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_soa_scan(void);
+
+/**
+ * @brief Benchmark converting records between a BasecArray and a BasecSoA
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_soa_convert(void);
+
+/**
+ * @brief Run the SoA benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_soa_run(void);
+
+#endif
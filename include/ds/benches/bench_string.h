@@ -0,0 +1,136 @@
+#ifndef BASEC_STRING_BENCH_H
+#define BASEC_STRING_BENCH_H
+
+#include <ctype.h>
+
+#include "util/basec_bench.h"
+#include "ds/basec_string.h"
+
+/**
+ * @brief Benchmark loading a file with fread followed by basec_string_create
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_read_then_copy(void);
+
+/**
+ * @brief Benchmark loading a file with basec_string_read_file
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_read_file(void);
+
+/**
+ * @brief Benchmark loading a file with basec_string_map_file
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_map_file(void);
+
+/**
+ * @brief Benchmark formatting integers with snprintf and basec_string_append
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_snprintf_u64(void);
+
+/**
+ * @brief Benchmark formatting integers with basec_string_append_u64
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_append_u64(void);
+
+/**
+ * @brief Benchmark formatting doubles with snprintf and basec_string_append
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_snprintf_f64(void);
+
+/**
+ * @brief Benchmark formatting doubles with basec_string_append_f64
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_append_f64(void);
+
+/**
+ * @brief Benchmark formatting log lines with snprintf and basec_string_append
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_snprintf_line(void);
+
+/**
+ * @brief Benchmark formatting log lines with basec_string_appendf
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_appendf(void);
+
+/**
+ * @brief Benchmark parsing integers with strtoull
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_strtoull(void);
+
+/**
+ * @brief Benchmark parsing integers with basec_string_parse_u64
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_parse_u64(void);
+
+/**
+ * @brief Benchmark parsing doubles with strtod
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_strtod(void);
+
+/**
+ * @brief Benchmark parsing doubles with basec_string_parse_f64
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_parse_f64(void);
+
+/**
+ * @brief Benchmark decoding UTF-8 text one codepoint at a time
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_utf8_next(void);
+
+/**
+ * @brief Benchmark validating UTF-8 text with basec_string_utf8_validate
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_utf8_validate(void);
+
+/**
+ * @brief Benchmark counting UTF-8 codepoints with basec_string_utf8_length
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_utf8_length(void);
+
+/**
+ * @brief Benchmark lowercasing text one byte at a time with tolower
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_tolower(void);
+
+/**
+ * @brief Benchmark lowercasing text with basec_string_to_lower
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_to_lower(void);
+
+/**
+ * @brief Benchmark searching for a missing needle with basec_string_find
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_find(void);
+
+/**
+ * @brief Benchmark searching for a missing needle with
+ *        basec_string_find_icase
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_find_icase(void);
+
+/**
+ * @brief Run the String benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_string_run(void);
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef BASEC_STRMAP_BENCH_H
+#define BASEC_STRMAP_BENCH_H
+
+#include "util/basec_bench.h"
+#include "ds/basec_strmap.h"
+
+/**
+ * @brief Benchmark a string map with keys short enough to be stored inline
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_strmap_short_keys(void);
+
+/**
+ * @brief Benchmark a string map with keys that are stored in the arena
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_strmap_long_keys(void);
+
+/**
+ * @brief Run the StrMap benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_strmap_run(void);
+
+#endif
@@ -67,6 +67,111 @@ bool test_array_find(c_str fail_message);
  */
 bool test_array_find_all(c_str fail_message);
 
+/**
+ * @brief Test hashing an element of an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_hash_element(c_str fail_message);
+
+/**
+ * @brief Test sorting an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_sort(c_str fail_message);
+
+/**
+ * @brief Test removing repeats from a sorted array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_unique_sorted(c_str fail_message);
+
+/**
+ * @brief Test removing elements from an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_remove(c_str fail_message);
+
+/**
+ * @brief Test finding elements through an array's hash index
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_index(c_str fail_message);
+
+/**
+ * @brief Test placing the nth element of an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_nth_element(c_str fail_message);
+
+/**
+ * @brief Test copying the first elements of an array in order
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_top_k(c_str fail_message);
+
+/**
+ * @brief Test visiting every element of an array in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_for_each(c_str fail_message);
+
+/**
+ * @brief Test mapping an array into an output array in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_map(c_str fail_message);
+
+/**
+ * @brief Test reducing an array in parallel with an associative combiner
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_reduce(c_str fail_message);
+
+/**
+ * @brief Test an inclusive scan of an array in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_inclusive_scan(c_str fail_message);
+
+/**
+ * @brief Test sorting an array in parallel with a comparator
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_sort(c_str fail_message);
+
+/**
+ * @brief Test sorting an array by a u64 key in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_radix_sort(c_str fail_message);
+
+/**
+ * @brief Test that aligned arrays stay aligned as they grow
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_create_aligned(c_str fail_message);
+
+/**
+ * @brief Test asking for huge pages before and after an array is mapped
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_advise_huge_pages(c_str fail_message);
+
 /**
  * @brief Test the destruction of an array
  * @param fail_message The message to display if the test fails
@@ -0,0 +1,56 @@
+#ifndef BASEC_CHUNKED_ARRAY_TEST_H
+#define BASEC_CHUNKED_ARRAY_TEST_H
+
+#include "util/basec_test.h"
+#include "ds/basec_chunked_array.h"
+
+/**
+ * @brief Test the creation of chunked arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_create(c_str fail_message);
+
+/**
+ * @brief Test appending and getting elements across blocks
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_append(c_str fail_message);
+
+/**
+ * @brief Test appending batches that span several blocks
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_append_n(c_str fail_message);
+
+/**
+ * @brief Test setting, popping and clearing elements
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_pop(c_str fail_message);
+
+/**
+ * @brief Test copying a chunked array into a contiguous array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_flatten(c_str fail_message);
+
+/**
+ * @brief Test the destruction of chunked arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_destroy(c_str fail_message);
+
+/**
+ * @brief Add ChunkedArray tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_chunked_array_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
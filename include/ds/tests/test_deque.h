@@ -0,0 +1,49 @@
+#ifndef BASEC_DEQUE_TEST_H
+#define BASEC_DEQUE_TEST_H
+
+#include "util/basec_test.h"
+#include "ds/basec_deque.h"
+
+/**
+ * @brief Test the creation of a deque
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_create(c_str fail_message);
+
+/**
+ * @brief Test pushing and popping at both ends of a deque
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_push_pop(c_str fail_message);
+
+/**
+ * @brief Test pushing and popping several elements of a deque at once
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_bulk(c_str fail_message);
+
+/**
+ * @brief Test viewing the elements of a deque as two segments
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_segments(c_str fail_message);
+
+/**
+ * @brief Test the destruction of a deque
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_destroy(c_str fail_message);
+
+/**
+ * @brief Add Deque tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_deque_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef BASEC_HASHMAP_TEST_H
+#define BASEC_HASHMAP_TEST_H
+
+#include "util/basec_test.h"
+#include "ds/basec_hashmap.h"
+
+/**
+ * @brief Test the creation of a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_create(c_str fail_message);
+
+/**
+ * @brief Test inserting entries into a hash map and getting them back
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_insert(c_str fail_message);
+
+/**
+ * @brief Test removing entries from a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_remove(c_str fail_message);
+
+/**
+ * @brief Test reserving room in a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_reserve(c_str fail_message);
+
+/**
+ * @brief Test iterating over the entries of a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_iterator(c_str fail_message);
+
+/**
+ * @brief Test the destruction of a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_destroy(c_str fail_message);
+
+/**
+ * @brief Add HashMap tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_hashmap_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef BASEC_HASHSET_TEST_H
+#define BASEC_HASHSET_TEST_H
+
+#include "util/basec_test.h"
+#include "ds/basec_hashset.h"
+
+/**
+ * @brief Test the creation of a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_create(c_str fail_message);
+
+/**
+ * @brief Test inserting elements into a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_insert(c_str fail_message);
+
+/**
+ * @brief Test removing elements from a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_remove(c_str fail_message);
+
+/**
+ * @brief Test iterating over the elements of a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_iterator(c_str fail_message);
+
+/**
+ * @brief Test removing repeats from an array while keeping its order
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_unique(c_str fail_message);
+
+/**
+ * @brief Test the destruction of a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_destroy(c_str fail_message);
+
+/**
+ * @brief Add HashSet tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_hashset_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef BASEC_HEAP_TEST_H
+#define BASEC_HEAP_TEST_H
+
+#include "util/basec_test.h"
+#include "ds/basec_heap.h"
+
+/**
+ * @brief Test the creation of a heap
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_create(c_str fail_message);
+
+/**
+ * @brief Test pushing and popping elements of binary and 4-ary heaps
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_push_pop(c_str fail_message);
+
+/**
+ * @brief Test ordering a heap by a key inside its elements
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_keyed(c_str fail_message);
+
+/**
+ * @brief Test building a heap from an array of elements
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_push_array(c_str fail_message);
+
+/**
+ * @brief Test peeking at the first element of a heap
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_peek(c_str fail_message);
+
+/**
+ * @brief Test the destruction of a heap
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_destroy(c_str fail_message);
+
+/**
+ * @brief Add Heap tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_heap_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#ifndef BASEC_INTERNER_TEST_H
+#define BASEC_INTERNER_TEST_H
+
+#include "util/basec_test.h"
+#include "ds/basec_interner.h"
+
+/**
+ * @brief Test the creation of an interner
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_create(c_str fail_message);
+
+/**
+ * @brief Test interning strings and reading back their canonical views
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_intern(c_str fail_message);
+
+/**
+ * @brief Test finding strings in an interner without adding them
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_find(c_str fail_message);
+
+/**
+ * @brief Intern the same strings as other threads, in a different order
+ * @param arg The _TestInternerWorker of the thread
+ * @return NULL
+ */
+bool test_interner_threads(c_str fail_message);
+
+/**
+ * @brief Test splitting a string into atoms
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_split_interned(c_str fail_message);
+
+/**
+ * @brief Test the destruction of an interner
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_destroy(c_str fail_message);
+
+/**
+ * @brief Add Interner tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_interner_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+#ifndef BASEC_SOA_TEST_H
+#define BASEC_SOA_TEST_H
+
+#include "util/basec_test.h"
+#include "ds/basec_soa.h"
+
+/**
+ * @brief Test the creation of SoAs from field layouts
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_create(c_str fail_message);
+
+/**
+ * @brief Test appending rows and getting them back
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_append(c_str fail_message);
+
+/**
+ * @brief Test setting rows and reading fields through column spans
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_column(c_str fail_message);
+
+/**
+ * @brief Test converting between an array of structs and a SoA
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_array(c_str fail_message);
+
+/**
+ * @brief Test the destruction of SoAs
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_destroy(c_str fail_message);
+
+/**
+ * @brief Add SoA tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_soa_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
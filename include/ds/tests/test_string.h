@@ -47,6 +47,69 @@ bool test_string_prepend(c_str fail_message);
  */
 bool test_string_append(c_str fail_message);
 
+/**
+ * @brief Test appending unsigned integers to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_append_u64(c_str fail_message);
+
+/**
+ * @brief Test appending signed integers to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_append_i64(c_str fail_message);
+
+/**
+ * @brief Test appending doubles to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_append_f64(c_str fail_message);
+
+/**
+ * @brief Test appending hexadecimal integers to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_append_hex(c_str fail_message);
+
+/**
+ * @brief Test appending formatted text to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_appendf(c_str fail_message);
+
+/**
+ * @brief Test parsing unsigned integers from views
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_parse_u64(c_str fail_message);
+
+/**
+ * @brief Test parsing signed integers from views
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_parse_i64(c_str fail_message);
+
+/**
+ * @brief Test parsing doubles from views
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_parse_f64(c_str fail_message);
+
+/**
+ * @brief Test parsing a split string into a typed array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_strings_parse(c_str fail_message);
+
 /**
  * @brief Test pushing a string to a string
  * @param fail_message The message to display if the test fails
@@ -89,6 +152,69 @@ bool test_string_replace(c_str fail_message);
  */
 bool test_string_split(c_str fail_message);
 
+/**
+ * @brief Test the conversion of a string to lower and uppercase
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_to_lower(c_str fail_message);
+
+/**
+ * @brief Test trimming whitespace from a string view
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_trim(c_str fail_message);
+
+/**
+ * @brief Test finding a substring in a string, ignoring case
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_find_icase(c_str fail_message);
+
+/**
+ * @brief Test hashing the contents of a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_hash(c_str fail_message);
+
+/**
+ * @brief Test mapping a file into a string view
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_map_file(c_str fail_message);
+
+/**
+ * @brief Test reading a file into a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_read_file(c_str fail_message);
+
+/**
+ * @brief Test validating UTF-8
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_utf8_validate(c_str fail_message);
+
+/**
+ * @brief Test counting and indexing UTF-8 codepoints
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_utf8_length(c_str fail_message);
+
+/**
+ * @brief Test iterating over UTF-8 codepoints
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_utf8_iterator(c_str fail_message);
+
 /**
  * @brief Test the destruction of a string
  * @param fail_message The message to display if the test fails
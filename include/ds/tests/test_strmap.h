@@ -0,0 +1,49 @@
+#ifndef BASEC_STRMAP_TEST_H
+#define BASEC_STRMAP_TEST_H
+
+#include "util/basec_test.h"
+#include "ds/basec_strmap.h"
+
+/**
+ * @brief Test the creation of a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_create(c_str fail_message);
+
+/**
+ * @brief Test inserting short and long keys into a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_insert(c_str fail_message);
+
+/**
+ * @brief Test removing keys from a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_remove(c_str fail_message);
+
+/**
+ * @brief Test iterating over the entries of a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_iterator(c_str fail_message);
+
+/**
+ * @brief Test the destruction of a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_destroy(c_str fail_message);
+
+/**
+ * @brief Add StrMap tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_strmap_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,246 @@
+/**
+ * @file basec_file.h
+ * @brief Buffered file reading and writing
+ */
+#ifndef BASEC_FILE_H
+#define BASEC_FILE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+#include "basec_types.h"
+#include "ds/basec_array.h"
+#include "ds/basec_string.h"
+
+#define BASEC_FILE_DEFAULT_BUFFER_SIZE (1024 * 1024)
+#define BASEC_FILE_DEFAULT_QUEUE_DEPTH 64
+
+/**
+ * @struct BasecReader
+ * @brief A buffered file reader
+ *
+ * Data in [start, end) of the buffer has been read from the file but not yet
+ * consumed.
+ */
+typedef struct {
+    i32   fd;
+    c_str buffer;
+    u64   capacity;
+    u64   start;
+    u64   end;
+    bool  eof;
+} BasecReader;
+
+/**
+ * @struct BasecWriter
+ * @brief A buffered file writer
+ */
+typedef struct {
+    i32   fd;
+    c_str buffer;
+    u64   capacity;
+    u64   length;
+} BasecWriter;
+
+/**
+ * @enum BasecFileResult
+ * @brief The result of a file operation
+ */
+typedef enum {
+    BASEC_FILE_SUCCESS,
+    BASEC_FILE_NULL_POINTER,
+    BASEC_FILE_INVALID_CAPACITY,
+    BASEC_FILE_ALLOCATION_FAILURE,
+    BASEC_FILE_OPEN_FAILURE,
+    BASEC_FILE_READ_FAILURE,
+    BASEC_FILE_WRITE_FAILURE,
+    BASEC_FILE_END_OF_FILE,
+    BASEC_FILE_UNSUPPORTED,
+    BASEC_FILE_STRING_FAILURE,
+    BASEC_FILE_ARRAY_FAILURE,
+} BasecFileResult;
+
+/**
+ * @enum BasecFileBackend
+ * @brief The backend used to read a batch of files
+ *
+ * BASEC_FILE_BACKEND_AUTO uses io_uring when the kernel allows it, and falls
+ * back to a pool of reader threads otherwise.
+ */
+typedef enum {
+    BASEC_FILE_BACKEND_AUTO,
+    BASEC_FILE_BACKEND_IO_URING,
+    BASEC_FILE_BACKEND_THREADS,
+    BASEC_FILE_BACKEND_BLOCKING,
+} BasecFileBackend;
+
+/**
+ * @brief Handle the result of a file operation
+ * @param result The result of the operation
+ */
+void basec_file_handle_result(BasecFileResult result);
+
+/**
+ * @brief Read a batch of files into strings
+ *
+ * The queue depth is the number of reads kept in flight at once, for the
+ * thread backend it is the number of threads.
+ *
+ * @param paths The paths of the files to read
+ * @param count The number of paths
+ * @param backend The backend to read the files with
+ * @param queue_depth The number of reads to keep in flight
+ * @param strings_out The array of BasecString* to store the files in, in the
+ *                    same order as paths
+ * @return The result of the operation
+ */
+BasecFileResult basec_file_read_batch(
+    c_str*           paths,
+    u64              count,
+    BasecFileBackend backend,
+    u32              queue_depth,
+    BasecArray**     strings_out
+);
+
+/**
+ * @brief Open a file for buffered reading
+ * @param reader The reader to create
+ * @param path The path of the file to read
+ * @param buffer_size The size of the read buffer
+ * @return The result of the operation
+ */
+BasecFileResult basec_reader_open(
+    BasecReader** reader,
+    const c_str   path,
+    u64           buffer_size
+);
+
+/**
+ * @brief Read up to size bytes from the reader
+ * @param reader The reader to read from
+ * @param data_out The buffer to read into
+ * @param size The maximum number of bytes to read
+ * @param read_out The number of bytes read
+ * @return The result of the operation, BASEC_FILE_END_OF_FILE if none remain
+ */
+BasecFileResult basec_reader_read(
+    BasecReader* reader,
+    void*        data_out,
+    u64          size,
+    u64*         read_out
+);
+
+/**
+ * @brief Read the next line from the reader
+ *
+ * The line is returned as a view into the reader's buffer without the
+ * trailing newline, and is only valid until the next read. Lines longer than
+ * the buffer grow it.
+ *
+ * @param reader The reader to read from
+ * @param line_out The view to store the line in
+ * @return The result of the operation, BASEC_FILE_END_OF_FILE if none remain
+ */
+BasecFileResult basec_reader_read_line(
+    BasecReader*     reader,
+    BasecStringView* line_out
+);
+
+/**
+ * @brief Close a reader
+ * @param reader The reader to close
+ * @return The result of the operation
+ */
+BasecFileResult basec_reader_close(BasecReader** reader);
+
+/**
+ * @brief Open a file for buffered writing, truncating it if it exists
+ * @param writer The writer to create
+ * @param path The path of the file to write
+ * @param buffer_size The size of the write buffer
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_open(
+    BasecWriter** writer,
+    const c_str   path,
+    u64           buffer_size
+);
+
+/**
+ * @brief Write bytes to the writer
+ * @param writer The writer to write to
+ * @param data The bytes to write
+ * @param size The number of bytes to write
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_write(
+    BasecWriter* writer,
+    const void*  data,
+    u64          size
+);
+
+/**
+ * @brief Write a string to the writer
+ * @param writer The writer to write to
+ * @param string The string to write
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_write_string(
+    BasecWriter* writer,
+    BasecString* string
+);
+
+/**
+ * @brief Write a string view to the writer
+ * @param writer The writer to write to
+ * @param view The view to write
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_write_view(
+    BasecWriter*    writer,
+    BasecStringView view
+);
+
+/**
+ * @brief Write several views to the writer in one batch
+ *
+ * Views that fit are copied into the buffer, otherwise the buffer and the
+ * views are handed to the kernel together with writev.
+ *
+ * @param writer The writer to write to
+ * @param views The views to write
+ * @param count The number of views
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_writev(
+    BasecWriter*     writer,
+    BasecStringView* views,
+    u64              count
+);
+
+/**
+ * @brief Flush buffered data to the file
+ * @param writer The writer to flush
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_flush(BasecWriter* writer);
+
+/**
+ * @brief Flush and close a writer
+ * @param writer The writer to close
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_close(BasecWriter** writer);
+
+#endif
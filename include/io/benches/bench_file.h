@@ -0,0 +1,19 @@
+#ifndef BASEC_FILE_BENCH_H
+#define BASEC_FILE_BENCH_H
+
+#include "util/basec_bench.h"
+#include "io/basec_file.h"
+
+/**
+ * @brief Benchmark reading a batch of small files with each backend
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_file_read_batch(void);
+
+/**
+ * @brief Run the File benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_file_run(void);
+
+#endif
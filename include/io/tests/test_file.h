@@ -0,0 +1,56 @@
+#ifndef BASEC_FILE_TEST_H
+#define BASEC_FILE_TEST_H
+
+#include "util/basec_test.h"
+#include "io/basec_file.h"
+
+/**
+ * @brief Test opening a reader
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_reader_open(c_str fail_message);
+
+/**
+ * @brief Test reading bytes from a reader
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_reader_read(c_str fail_message);
+
+/**
+ * @brief Test reading lines from a reader
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_reader_read_line(c_str fail_message);
+
+/**
+ * @brief Test reading a batch of files with every backend
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_read_batch(c_str fail_message);
+
+/**
+ * @brief Test writing strings and bytes with a writer
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_writer_write(c_str fail_message);
+
+/**
+ * @brief Test batched writes with a writer
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_writer_writev(c_str fail_message);
+
+/**
+ * @brief Add File tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_file_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
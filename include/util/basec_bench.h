@@ -0,0 +1,81 @@
+/**
+ * @file basec_bench.h
+ * @brief A benchmarking framework
+ */
+#ifndef BASEC_BENCH_H
+#define BASEC_BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "basec_types.h"
+
+/**
+ * @struct BasecBenchTimer
+ * @brief A monotonic timer
+ */
+typedef struct {
+    u64 start_ns;
+    u64 elapsed_ns;
+} BasecBenchTimer;
+
+/**
+ * @enum BasecBenchResult
+ * @brief The result of a benchmark operation
+ */
+typedef enum {
+    BASEC_BENCH_SUCCESS,
+    BASEC_BENCH_NULL_POINTER,
+    BASEC_BENCH_ALLOCATION_FAILURE,
+    BASEC_BENCH_CLOCK_FAILURE,
+    BASEC_BENCH_RUN_FAILURE,
+} BasecBenchResult;
+
+/**
+ * @brief Handle a benchmark result
+ * @param result The result to handle
+ */
+void basec_bench_handle_result(BasecBenchResult result);
+
+/**
+ * @brief Start a timer
+ * @param timer The timer to start
+ * @return The result of the operation
+ */
+BasecBenchResult basec_bench_timer_start(BasecBenchTimer* timer);
+
+/**
+ * @brief Stop a timer
+ * @param timer The timer to stop
+ * @param elapsed_ns_out The elapsed time in nanoseconds
+ * @return The result of the operation
+ */
+BasecBenchResult basec_bench_timer_stop(
+    BasecBenchTimer* timer,
+    u64*             elapsed_ns_out
+);
+
+/**
+ * @brief Print the header of a benchmark module
+ * @param name The name of the module
+ * @return The result of the operation
+ */
+BasecBenchResult basec_bench_print_module(c_str name);
+
+/**
+ * @brief Print a benchmark measurement
+ * @param name The name of the benchmark
+ * @param iterations The number of iterations that were timed
+ * @param bytes The number of bytes processed per iteration (0 if unused)
+ * @param elapsed_ns The total elapsed time in nanoseconds
+ * @return The result of the operation
+ */
+BasecBenchResult basec_bench_print(
+    c_str name,
+    u64   iterations,
+    u64   bytes,
+    u64   elapsed_ns
+);
+
+#endif
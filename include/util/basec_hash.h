@@ -0,0 +1,127 @@
+/**
+ * @file basec_hash.h
+ * @brief Fast non-cryptographic 64 bit hashing
+ */
+#ifndef BASEC_HASH_H
+#define BASEC_HASH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/random.h>
+
+#include "basec_types.h"
+
+#define BASEC_HASH_DEFAULT_SEED 0
+#define BASEC_HASH_BLOCK_SIZE   48
+
+/**
+ * @struct BasecHashState
+ * @brief The state of an incremental hash
+ *
+ * Input is consumed in blocks of BASEC_HASH_BLOCK_SIZE bytes. The first 16
+ * bytes of the buffer keep the end of the last consumed block, which the
+ * final mix may read back, and pending input is kept after them.
+ */
+typedef struct {
+    u64  seed;
+    u64  lanes[2];
+    u64  length;
+    u64  buffered;
+    bool mixed;
+    u8   buffer[16 + BASEC_HASH_BLOCK_SIZE];
+} BasecHashState;
+
+/**
+ * @enum BasecHashResult
+ * @brief The result of a hash operation
+ */
+typedef enum {
+    BASEC_HASH_SUCCESS,
+    BASEC_HASH_NULL_POINTER,
+} BasecHashResult;
+
+/**
+ * @brief Handle the result of a hash operation
+ * @param result The result of the operation
+ */
+void basec_hash_handle_result(BasecHashResult result);
+
+/**
+ * @brief Hash bytes with the default seed
+ * @param data The bytes to hash
+ * @param length The number of bytes
+ * @param hash_out The hash of the bytes
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_bytes(
+    const void* data,
+    u64         length,
+    u64*        hash_out
+);
+
+/**
+ * @brief Hash bytes with a seed
+ *
+ * Keys chosen to collide under one seed do not collide under another, so
+ * tables exposed to untrusted keys should use a seed from
+ * basec_hash_random_seed.
+ *
+ * @param data The bytes to hash
+ * @param length The number of bytes
+ * @param seed The seed of the hash
+ * @param hash_out The hash of the bytes
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_bytes_seeded(
+    const void* data,
+    u64         length,
+    u64         seed,
+    u64*        hash_out
+);
+
+/**
+ * @brief Get an unpredictable seed from the kernel
+ * @param seed_out The seed
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_random_seed(u64* seed_out);
+
+/**
+ * @brief Start an incremental hash
+ *
+ * Hashing data in pieces gives the same result as hashing it all at once
+ * with basec_hash_bytes_seeded.
+ *
+ * @param state The state to initialise
+ * @param seed The seed of the hash
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_init(BasecHashState* state, u64 seed);
+
+/**
+ * @brief Add bytes to an incremental hash
+ * @param state The state of the hash
+ * @param data The bytes to add
+ * @param length The number of bytes
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_update(
+    BasecHashState* state,
+    const void*     data,
+    u64             length
+);
+
+/**
+ * @brief Get the hash of the bytes added so far
+ *
+ * The state is left untouched, so more bytes can still be added.
+ *
+ * @param state The state of the hash
+ * @param hash_out The hash of the bytes
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_final(BasecHashState* state, u64* hash_out);
+
+#endif
@@ -0,0 +1,144 @@
+/**
+ * @file basec_memory.h
+ * @brief Buffers that grow by remapping pages once they are large
+ */
+#ifndef BASEC_MEMORY_H
+#define BASEC_MEMORY_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#include "basec_types.h"
+
+#define BASEC_MEMORY_MAP_THRESHOLD (1024 * 1024)
+#define BASEC_MEMORY_ALIGNMENT     _Alignof(max_align_t)
+
+/**
+ * @enum BasecMemoryResult
+ * @brief The result of a memory operation
+ */
+typedef enum {
+    BASEC_MEMORY_SUCCESS,
+    BASEC_MEMORY_NULL_POINTER,
+    BASEC_MEMORY_INVALID_SIZE,
+    BASEC_MEMORY_INVALID_ALIGNMENT,
+    BASEC_MEMORY_ALLOCATION_FAILURE,
+} BasecMemoryResult;
+
+/**
+ * @brief Handle the result of a memory operation
+ * @param result The result of the operation
+ */
+void basec_memory_handle_result(BasecMemoryResult result);
+
+/**
+ * @brief Choose whether mapped buffers ask for transparent huge pages
+ *
+ * When enabled, every buffer mapped or remapped afterwards is advised with
+ * MADV_HUGEPAGE. Kernels without transparent huge pages ignore it.
+ *
+ * @param enabled Whether to ask for huge pages
+ */
+void basec_memory_set_huge_pages(bool enabled);
+
+/**
+ * @brief Ask for transparent huge pages on one mapped buffer
+ *
+ * The advice stays with the mapping as basec_memory_resize grows it.
+ *
+ * @param data The buffer
+ * @param size The size of the buffer in bytes
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_advise_huge_pages(void* data, u64 size);
+
+/**
+ * @brief Allocate a buffer, mapping it if it is at least
+ *        BASEC_MEMORY_MAP_THRESHOLD bytes
+ * @param data_out The buffer
+ * @param size The size of the buffer in bytes
+ * @param mapped_out Whether the buffer was mapped
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_allocate(
+    void** data_out,
+    u64    size,
+    bool*  mapped_out
+);
+
+/**
+ * @brief Allocate a buffer aligned to alignment bytes
+ *
+ * Mapped buffers are page aligned, so alignment can be at most the page
+ * size.
+ *
+ * @param data_out The buffer
+ * @param size The size of the buffer in bytes
+ * @param alignment The alignment, a power of two up to the page size
+ * @param mapped_out Whether the buffer was mapped
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_allocate_aligned(
+    void** data_out,
+    u64    size,
+    u64    alignment,
+    bool*  mapped_out
+);
+
+/**
+ * @brief Resize a buffer, keeping its first bytes
+ *
+ * Buffers that reach BASEC_MEMORY_MAP_THRESHOLD bytes move to their own
+ * mapping once, and are grown afterwards with mremap, which moves pages
+ * instead of copying them. On failure the buffer is left as it was.
+ *
+ * @param data The buffer, replaced by the resized buffer
+ * @param size The current size of the buffer in bytes
+ * @param new_size The new size of the buffer in bytes
+ * @param mapped Whether the buffer is mapped, updated for the new buffer
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_resize(
+    void** data,
+    u64    size,
+    u64    new_size,
+    bool*  mapped
+);
+
+/**
+ * @brief Resize a buffer allocated with basec_memory_allocate_aligned,
+ *        keeping its alignment
+ *
+ * realloc does not keep alignments beyond malloc's, so heap buffers with
+ * one are copied into a new aligned buffer. Heap buffers are under
+ * BASEC_MEMORY_MAP_THRESHOLD bytes, which keeps the copy small.
+ *
+ * @param data The buffer, replaced by the resized buffer
+ * @param size The current size of the buffer in bytes
+ * @param new_size The new size of the buffer in bytes
+ * @param alignment The alignment of the buffer
+ * @param mapped Whether the buffer is mapped, updated for the new buffer
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_resize_aligned(
+    void** data,
+    u64    size,
+    u64    new_size,
+    u64    alignment,
+    bool*  mapped
+);
+
+/**
+ * @brief Release a buffer
+ * @param data The buffer, set to NULL
+ * @param size The size of the buffer in bytes
+ * @param mapped Whether the buffer is mapped
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_release(void** data, u64 size, bool mapped);
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef BASEC_HASH_BENCH_H
+#define BASEC_HASH_BENCH_H
+
+#include "util/basec_bench.h"
+#include "util/basec_hash.h"
+
+/**
+ * @brief Benchmark hashing short keys of 8 to 64 bytes
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hash_short_keys(void);
+
+/**
+ * @brief Benchmark hashing a long buffer at once and incrementally
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hash_long_buffer(void);
+
+/**
+ * @brief Run the Hash benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_hash_run(void);
+
+#endif
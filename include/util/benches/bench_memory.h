@@ -0,0 +1,26 @@
+#ifndef BASEC_MEMORY_BENCH_H
+#define BASEC_MEMORY_BENCH_H
+
+#include "util/basec_bench.h"
+#include "util/basec_memory.h"
+#include "ds/basec_array.h"
+
+/**
+ * @brief Benchmark doubling a large buffer by copying and by remapping
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_memory_resize(void);
+
+/**
+ * @brief Benchmark the slowest grow while appending to a large BasecArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_memory_array_grow(void);
+
+/**
+ * @brief Run the Memory benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_memory_run(void);
+
+#endif
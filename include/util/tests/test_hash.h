@@ -0,0 +1,35 @@
+#ifndef BASEC_HASH_TEST_H
+#define BASEC_HASH_TEST_H
+
+#include "util/basec_test.h"
+#include "util/basec_hash.h"
+
+/**
+ * @brief Test hashing bytes with and without a seed
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hash_bytes(c_str fail_message);
+
+/**
+ * @brief Test that incremental hashing matches hashing all at once
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hash_incremental(c_str fail_message);
+
+/**
+ * @brief Test getting random seeds
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hash_random_seed(c_str fail_message);
+
+/**
+ * @brief Add Hash tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_hash_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
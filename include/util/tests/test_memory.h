@@ -0,0 +1,37 @@
+#ifndef BASEC_MEMORY_TEST_H
+#define BASEC_MEMORY_TEST_H
+
+#include "util/basec_test.h"
+#include "util/basec_memory.h"
+#include "ds/basec_array.h"
+#include "ds/basec_string.h"
+
+/**
+ * @brief Test allocating small and large buffers
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_memory_allocate(c_str fail_message);
+
+/**
+ * @brief Test resizing a buffer across the mapping threshold both ways
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_memory_resize(c_str fail_message);
+
+/**
+ * @brief Test that large arrays and strings keep their contents as they grow
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_memory_grow(c_str fail_message);
+
+/**
+ * @brief Add Memory tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_memory_add_tests(BasecTestSuite* test_suite);
+
+#endif
\ No newline at end of file
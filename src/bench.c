@@ -0,0 +1,97 @@
+#include "util/basec_build.h"
+#include "util/basec_bench.h"
+#include "ds/benches/bench_string.h"
+#include "ds/benches/bench_array.h"
+#include "ds/benches/bench_hashmap.h"
+#include "ds/benches/bench_hashset.h"
+#include "ds/benches/bench_heap.h"
+#include "ds/benches/bench_deque.h"
+#include "ds/benches/bench_chunked_array.h"
+#include "ds/benches/bench_soa.h"
+#include "ds/benches/bench_strmap.h"
+#include "ds/benches/bench_interner.h"
+#include "io/benches/bench_file.h"
+#include "util/benches/bench_hash.h"
+#include "util/benches/bench_memory.h"
+#include "concurrency/benches/bench_queue.h"
+#include "concurrency/benches/bench_jobs.h"
+#include "concurrency/benches/bench_concurrent_array.h"
+
+static void _build(void) {
+    BuildSystem* build_system = NULL;
+    BuildTarget  bench        = {
+        .name     = "bench",
+        .bin      = "bin/bench",
+        .cflags   = "-Wall -Wextra -pedantic -O2",
+        .sources  = {
+            "src/bench.c",
+            "src/util/basec_build.c",
+            "src/ds/basec_string.c",
+            "src/ds/basec_array.c",
+            "src/io/basec_file.c",
+            "src/util/basec_hash.c",
+            "src/ds/basec_hashmap.c",
+            "src/ds/basec_strmap.c",
+            "src/ds/basec_interner.c",
+            "src/ds/basec_hashset.c",
+            "src/ds/basec_heap.c",
+            "src/ds/basec_deque.c",
+            "src/concurrency/basec_queue.c",
+            "src/concurrency/basec_jobs.c",
+            "src/concurrency/basec_concurrent_array.c",
+            "src/ds/basec_chunked_array.c",
+            "src/util/basec_memory.c",
+            "src/ds/basec_soa.c",
+            "src/util/basec_bench.c",
+            "src/ds/benches/bench_string.c",
+            "src/io/benches/bench_file.c",
+            "src/util/benches/bench_hash.c",
+            "src/ds/benches/bench_hashmap.c",
+            "src/ds/benches/bench_strmap.c",
+            "src/ds/benches/bench_interner.c",
+            "src/ds/benches/bench_hashset.c",
+            "src/ds/benches/bench_array.c",
+            "src/ds/benches/bench_heap.c",
+            "src/ds/benches/bench_deque.c",
+            "src/concurrency/benches/bench_queue.c",
+            "src/concurrency/benches/bench_jobs.c",
+            "src/concurrency/benches/bench_concurrent_array.c",
+            "src/ds/benches/bench_chunked_array.c",
+            "src/util/benches/bench_memory.c",
+            "src/ds/benches/bench_soa.c",
+        },
+        .includes = {
+            "include",
+        },
+        .rebuild  = true,
+        .debug    = false
+    };
+
+    basec_build_handle_result(basec_build_system_create(&build_system));
+    basec_build_handle_result(basec_build_system_add_target(build_system, bench));
+    basec_build_handle_result(basec_build_system_build(build_system));
+    basec_build_handle_result(basec_build_system_destroy(&build_system));
+}
+
+int main(void) {
+    _build();
+
+    basec_bench_handle_result(bench_string_run());
+    basec_bench_handle_result(bench_array_run());
+    basec_bench_handle_result(bench_hashmap_run());
+    basec_bench_handle_result(bench_hashset_run());
+    basec_bench_handle_result(bench_heap_run());
+    basec_bench_handle_result(bench_deque_run());
+    basec_bench_handle_result(bench_chunked_array_run());
+    basec_bench_handle_result(bench_soa_run());
+    basec_bench_handle_result(bench_strmap_run());
+    basec_bench_handle_result(bench_interner_run());
+    basec_bench_handle_result(bench_file_run());
+    basec_bench_handle_result(bench_hash_run());
+    basec_bench_handle_result(bench_memory_run());
+    basec_bench_handle_result(bench_queue_run());
+    basec_bench_handle_result(bench_jobs_run());
+    basec_bench_handle_result(bench_concurrent_array_run());
+
+    return 0;
+}
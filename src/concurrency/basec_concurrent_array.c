@@ -0,0 +1,441 @@
+#include "concurrency/basec_concurrent_array.h"
+
+static const u64 _MAX_FIRST_CAPACITY = (u64)1 << 32;
+
+/**
+ * @brief Find the segment holding an index and the index's place in it
+ *
+ * Segment k holds first_capacity << k elements, so offsetting the index by
+ * the first segment's size makes its highest bit the segment.
+ *
+ * @param array The array
+ * @param index The index
+ * @param segment_out The segment of the index
+ * @param offset_out The index of the element in its segment
+ */
+static void _basec_concurrent_array_locate(
+    BasecConcurrentArray* array,
+    u64                   index,
+    u64*                  segment_out,
+    u64*                  offset_out
+) {
+    u64 position = index + array->first_capacity;
+    u64 segment  = 63 - (u64)__builtin_clzll(position) - array->first_shift;
+
+    *segment_out = segment;
+    *offset_out  = position - (array->first_capacity << segment);
+}
+
+/**
+ * @brief Get the number of elements the segments hold in all
+ *
+ * With a large first segment the last segments are never reached, indices
+ * then run out where offsetting them by first_capacity would overflow.
+ *
+ * @param array The array
+ * @return The number of elements
+ */
+static u64 _basec_concurrent_array_limit(BasecConcurrentArray* array) {
+    if (array->first_shift + BASEC_CONCURRENT_ARRAY_SEGMENTS < 64) {
+        return (array->first_capacity << BASEC_CONCURRENT_ARRAY_SEGMENTS) -
+               array->first_capacity;
+    }
+    return U64_MAX - array->first_capacity + 1;
+}
+
+/**
+ * @brief Allocate a segment unless another thread already has
+ *
+ * Threads that race for the same segment each allocate it and the loser of
+ * the compare and swap frees its copy, so no writer ever waits on another.
+ *
+ * @param array The array
+ * @param segment The segment to allocate
+ * @return The result of the operation
+ */
+static BasecConcurrentArrayResult _basec_concurrent_array_segment(
+    BasecConcurrentArray* array,
+    u64                   segment
+) {
+    void* expected = NULL;
+    void* data     = NULL;
+    u64   capacity = array->first_capacity << segment;
+
+    if (__atomic_load_n(&array->segments[segment], __ATOMIC_ACQUIRE) != NULL) {
+        return BASEC_CONCURRENT_ARRAY_SUCCESS;
+    }
+    if (capacity > U64_MAX / array->element_size) {
+        return BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE;
+    }
+
+    data = malloc(capacity * array->element_size);
+    if (data == NULL) return BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE;
+
+    if (!__atomic_compare_exchange_n(
+        &array->segments[segment],
+        &expected,
+        data,
+        false,
+        __ATOMIC_ACQ_REL,
+        __ATOMIC_ACQUIRE
+    )) free(data);
+    return BASEC_CONCURRENT_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Handle the result of a concurrent array operation
+ * @param result The result of the operation
+ */
+void basec_concurrent_array_handle_result(BasecConcurrentArrayResult result) {
+    switch (result) {
+        case BASEC_CONCURRENT_ARRAY_SUCCESS:
+            break;
+        case BASEC_CONCURRENT_ARRAY_NULL_POINTER:
+            (void)printf(
+                "[Error][ConcurrentArray] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_CONCURRENT_ARRAY_INVALID_ELEMENT_SIZE:
+            (void)printf(
+                "[Error][ConcurrentArray] "
+                "Operation failed due to an invalid element size.\n"
+            );
+            exit(1);
+        case BASEC_CONCURRENT_ARRAY_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][ConcurrentArray] "
+                "Operation failed due to an invalid capacity.\n"
+            );
+            exit(1);
+        case BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][ConcurrentArray] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_CONCURRENT_ARRAY_OUT_OF_BOUNDS:
+            (void)printf(
+                "[Error][ConcurrentArray] "
+                "Operation failed due to an out of bounds index.\n"
+            );
+            exit(1);
+        case BASEC_CONCURRENT_ARRAY_FULL:
+            (void)printf(
+                "[Error][ConcurrentArray] "
+                "Operation failed due to a full array.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][ConcurrentArray] "
+                "An unknown error occurred during concurrent array "
+                "operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a concurrent array
+ * @param array The array to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements of the first segment
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_create(
+    BasecConcurrentArray** array,
+    u64                    element_size,
+    u64                    capacity
+) {
+    if (array == NULL) return BASEC_CONCURRENT_ARRAY_NULL_POINTER;
+    if (element_size == 0) return BASEC_CONCURRENT_ARRAY_INVALID_ELEMENT_SIZE;
+    if (capacity == 0 || capacity > _MAX_FIRST_CAPACITY) {
+        return BASEC_CONCURRENT_ARRAY_INVALID_CAPACITY;
+    }
+
+    u64 shift = 0;
+
+    while (((u64)1 << shift) < capacity) shift++;
+    if (((u64)1 << shift) > U64_MAX / element_size) {
+        return BASEC_CONCURRENT_ARRAY_INVALID_ELEMENT_SIZE;
+    }
+
+    *array = (BasecConcurrentArray*)aligned_alloc(
+        BASEC_CONCURRENT_ARRAY_CACHE_LINE,
+        sizeof(BasecConcurrentArray)
+    );
+    if (*array == NULL) return BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < BASEC_CONCURRENT_ARRAY_SEGMENTS; i++) {
+        (*array)->segments[i] = NULL;
+    }
+
+    // The first segment is always there, freeze can hand it over as is
+    (*array)->segments[0] = malloc(((u64)1 << shift) * element_size);
+    if ((*array)->segments[0] == NULL) {
+        free(*array);
+        *array = NULL;
+        return BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE;
+    }
+
+    (*array)->length         = 0;
+    (*array)->element_size   = element_size;
+    (*array)->first_capacity = (u64)1 << shift;
+    (*array)->first_shift    = shift;
+    return BASEC_CONCURRENT_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Claim consecutive indices to fill in later, from any thread
+ * @param array The array to grow
+ * @param count The number of indices to claim
+ * @param index_out The first claimed index
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_reserve(
+    BasecConcurrentArray* array,
+    u64                   count,
+    u64*                  index_out
+) {
+    if (array == NULL || index_out == NULL) {
+        return BASEC_CONCURRENT_ARRAY_NULL_POINTER;
+    }
+
+    BasecConcurrentArrayResult result = BASEC_CONCURRENT_ARRAY_SUCCESS;
+    u64                        limit  = _basec_concurrent_array_limit(array);
+    u64                        first  = 0;
+    u64                        last   = 0;
+    u64                        offset = 0;
+
+    if (count > limit) return BASEC_CONCURRENT_ARRAY_FULL;
+
+    *index_out = __atomic_fetch_add(&array->length, count, __ATOMIC_RELAXED);
+    if (count == 0) return BASEC_CONCURRENT_ARRAY_SUCCESS;
+    if (*index_out > limit - count) return BASEC_CONCURRENT_ARRAY_FULL;
+
+    _basec_concurrent_array_locate(array, *index_out, &first, &offset);
+    _basec_concurrent_array_locate(
+        array,
+        *index_out + count - 1,
+        &last,
+        &offset
+    );
+    for (u64 segment = first; segment <= last; segment++) {
+        result = _basec_concurrent_array_segment(array, segment);
+        if (result != BASEC_CONCURRENT_ARRAY_SUCCESS) return result;
+    }
+    return BASEC_CONCURRENT_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Add an element to the end of the array, from any thread
+ * @param array The array to append to
+ * @param element The element to append
+ * @param index_out The index of the element, NULL if not needed
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_append(
+    BasecConcurrentArray* array,
+    const void*           element,
+    u64*                  index_out
+) {
+    return basec_concurrent_array_append_n(array, element, 1, index_out);
+}
+
+/**
+ * @brief Add consecutive elements to the end of the array, from any thread
+ * @param array The array to append to
+ * @param elements The elements to append, in order
+ * @param count The number of elements
+ * @param index_out The index of the first element, NULL if not needed
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_append_n(
+    BasecConcurrentArray* array,
+    const void*           elements,
+    u64                   count,
+    u64*                  index_out
+) {
+    if (array == NULL || elements == NULL) {
+        return BASEC_CONCURRENT_ARRAY_NULL_POINTER;
+    }
+
+    BasecConcurrentArrayResult result  = BASEC_CONCURRENT_ARRAY_SUCCESS;
+    const u8*                  source  = (const u8*)elements;
+    u8*                        data    = NULL;
+    u64                        index   = 0;
+    u64                        segment = 0;
+    u64                        offset  = 0;
+    u64                        run     = 0;
+
+    result = basec_concurrent_array_reserve(array, count, &index);
+    if (result != BASEC_CONCURRENT_ARRAY_SUCCESS) return result;
+    if (index_out != NULL) *index_out = index;
+
+    // The claimed indices span at most a few segments, copy one run each
+    while (count > 0) {
+        _basec_concurrent_array_locate(array, index, &segment, &offset);
+        data = (u8*)__atomic_load_n(
+            &array->segments[segment],
+            __ATOMIC_ACQUIRE
+        );
+        run  = (array->first_capacity << segment) - offset;
+        if (run > count) run = count;
+
+        (void)memcpy(
+            data + offset * array->element_size,
+            source,
+            run * array->element_size
+        );
+        source += run * array->element_size;
+        index  += run;
+        count  -= run;
+    }
+    return BASEC_CONCURRENT_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Get the address of an element
+ * @param array The array
+ * @param index The index of the element
+ * @param element_out The address of the element
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_at(
+    BasecConcurrentArray* array,
+    u64                   index,
+    void**                element_out
+) {
+    if (array == NULL || element_out == NULL) {
+        return BASEC_CONCURRENT_ARRAY_NULL_POINTER;
+    }
+    if (
+        index >= __atomic_load_n(&array->length, __ATOMIC_ACQUIRE) ||
+        index >= _basec_concurrent_array_limit(array)
+    ) return BASEC_CONCURRENT_ARRAY_OUT_OF_BOUNDS;
+
+    u8* data    = NULL;
+    u64 segment = 0;
+    u64 offset  = 0;
+
+    _basec_concurrent_array_locate(array, index, &segment, &offset);
+
+    // The index may be claimed by a writer that has not allocated it yet
+    data = (u8*)__atomic_load_n(&array->segments[segment], __ATOMIC_ACQUIRE);
+    if (data == NULL) return BASEC_CONCURRENT_ARRAY_OUT_OF_BOUNDS;
+
+    *element_out = data + offset * array->element_size;
+    return BASEC_CONCURRENT_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Get the number of claimed indices
+ * @param array The array
+ * @param length_out The number of claimed indices
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_length(
+    BasecConcurrentArray* array,
+    u64*                  length_out
+) {
+    if (array == NULL || length_out == NULL) {
+        return BASEC_CONCURRENT_ARRAY_NULL_POINTER;
+    }
+
+    *length_out = __atomic_load_n(&array->length, __ATOMIC_ACQUIRE);
+    return BASEC_CONCURRENT_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Turn the array into a contiguous BasecArray
+ * @param array The array to freeze, set to NULL
+ * @param array_out The array to store the elements in
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_freeze(
+    BasecConcurrentArray** array,
+    BasecArray**           array_out
+) {
+    if (array == NULL || *array == NULL || array_out == NULL) {
+        return BASEC_CONCURRENT_ARRAY_NULL_POINTER;
+    }
+
+    BasecArray* frozen  = NULL;
+    u8*         data    = NULL;
+    u8*         segment = NULL;
+    u64         limit   = _basec_concurrent_array_limit(*array);
+    u64         length  = (*array)->length;
+    u64         size    = (*array)->element_size;
+    u64         copied  = 0;
+    u64         run     = 0;
+
+    // Reservations that found the array full still counted their indices
+    if (length > limit) length = limit;
+
+    frozen = (BasecArray*)malloc(sizeof(BasecArray));
+    if (frozen == NULL) return BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE;
+
+    if (length <= (*array)->first_capacity) {
+        // Everything is in the first segment, which becomes the data
+        frozen->data          = (*array)->segments[0];
+        frozen->capacity      = (*array)->first_capacity;
+        (*array)->segments[0] = NULL;
+    } else {
+        if (length > U64_MAX / size) {
+            free(frozen);
+            return BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE;
+        }
+        data = (u8*)malloc(length * size);
+        if (data == NULL) {
+            free(frozen);
+            return BASEC_CONCURRENT_ARRAY_ALLOCATION_FAILURE;
+        }
+
+        // Indices whose segment failed to allocate were never written
+        for (u64 i = 0; copied < length; i++) {
+            segment = (u8*)(*array)->segments[i];
+            run     = (*array)->first_capacity << i;
+            if (run > length - copied) run = length - copied;
+
+            if (segment == NULL) {
+                (void)memset(data + copied * size, 0, run * size);
+            } else {
+                (void)memcpy(data + copied * size, segment, run * size);
+            }
+            copied += run;
+        }
+        frozen->data     = data;
+        frozen->capacity = length;
+    }
+    frozen->element_size = size;
+    frozen->length       = length;
+    frozen->index        = NULL;
+    frozen->mapped       = false;
+    frozen->alignment    = BASEC_MEMORY_ALIGNMENT;
+    frozen->huge_pages   = false;
+
+    if (*array_out != NULL) (void)basec_array_destroy(array_out);
+    *array_out = frozen;
+    return basec_concurrent_array_destroy(array);
+}
+
+/**
+ * @brief Destroy a concurrent array
+ * @param array The array to destroy
+ * @return The result of the operation
+ */
+BasecConcurrentArrayResult basec_concurrent_array_destroy(
+    BasecConcurrentArray** array
+) {
+    if (array == NULL || *array == NULL) {
+        return BASEC_CONCURRENT_ARRAY_NULL_POINTER;
+    }
+
+    for (u64 i = 0; i < BASEC_CONCURRENT_ARRAY_SEGMENTS; i++) {
+        free((*array)->segments[i]);
+    }
+    free(*array);
+    *array = NULL;
+    return BASEC_CONCURRENT_ARRAY_SUCCESS;
+}
@@ -0,0 +1,789 @@
+#include "concurrency/basec_jobs.h"
+
+static const u64 _SPIN_ROUNDS = 64;
+static const i64 _SLEEP_NS    = 1000000;
+
+/**
+ * @struct BasecJob
+ * @brief A submitted job
+ *
+ * A job is referenced by the pool until it has run, and by its handle until
+ * it is waited on, and is freed by whichever lets go last. Continuations
+ * form a list that the finishing thread swaps for the finished marker.
+ */
+struct BasecJob {
+    BasecJobFunction function;
+    void*            context;
+    BasecJob*        continuations;
+    BasecJob*        next;
+    u32              references;
+    bool             done;
+};
+
+/**
+ * @struct BasecJobsWorker
+ * @brief A worker thread and its Chase-Lev deque
+ *
+ * The owner pushes and takes at bottom, thieves take at top, and the two
+ * ends sit on their own cache lines.
+ */
+struct BasecJobsWorker {
+    _Alignas(BASEC_QUEUE_CACHE_LINE) i64 top;
+    _Alignas(BASEC_QUEUE_CACHE_LINE) i64 bottom;
+    _Alignas(BASEC_QUEUE_CACHE_LINE) BasecJob** buffer;
+    BasecJobs* jobs;
+    pthread_t  thread;
+    u64        seed;
+};
+
+/**
+ * @struct _BasecJobsLoop
+ * @brief The chunks of a parallel loop still to be claimed
+ */
+typedef struct {
+    u64                   next;
+    u64                   end;
+    u64                   grain;
+    BasecJobRangeFunction function;
+    void*                 context;
+} _BasecJobsLoop;
+
+static BasecJob _FINISHED;
+
+static _Thread_local BasecJobsWorker* _current_worker = NULL;
+
+static pthread_once_t  _shared_once   = PTHREAD_ONCE_INIT;
+static BasecJobs*      _shared        = NULL;
+static BasecJobsResult _shared_result = BASEC_JOBS_SUCCESS;
+
+/**
+ * @brief Get the worker running on this thread, if it belongs to a pool
+ * @param jobs The pool
+ * @return The worker, NULL if this thread is not one of the pool's workers
+ */
+static BasecJobsWorker* _basec_jobs_worker(BasecJobs* jobs) {
+    if (_current_worker == NULL || _current_worker->jobs != jobs) return NULL;
+    return _current_worker;
+}
+
+/**
+ * @brief Push a job to the bottom of a worker's deque, from its owner
+ * @param worker The worker
+ * @param job The job
+ * @return Whether the deque had room for the job
+ */
+static bool _basec_jobs_push(BasecJobsWorker* worker, BasecJob* job) {
+    i64 bottom = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED);
+    i64 top    = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+
+    if (bottom - top >= (i64)BASEC_JOBS_DEQUE_CAPACITY) return false;
+
+    __atomic_store_n(
+        &worker->buffer[bottom & (BASEC_JOBS_DEQUE_CAPACITY - 1)],
+        job,
+        __ATOMIC_RELAXED
+    );
+    __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Take the newest job from the bottom of a worker's deque, from its
+ *        owner
+ * @param worker The worker
+ * @return The job, NULL if the deque is empty
+ */
+static BasecJob* _basec_jobs_take(BasecJobsWorker* worker) {
+    i64       bottom = __atomic_load_n(&worker->bottom, __ATOMIC_RELAXED) - 1;
+    i64       top    = 0;
+    BasecJob* job    = NULL;
+
+    __atomic_store_n(&worker->bottom, bottom, __ATOMIC_RELAXED);
+    // Thieves must see the lowered bottom before the owner reads top
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    top = __atomic_load_n(&worker->top, __ATOMIC_RELAXED);
+
+    if (top > bottom) {
+        __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    job = __atomic_load_n(
+        &worker->buffer[bottom & (BASEC_JOBS_DEQUE_CAPACITY - 1)],
+        __ATOMIC_RELAXED
+    );
+    if (top == bottom) {
+        // The last job goes to whoever moves top first
+        if (
+            !__atomic_compare_exchange_n(
+                &worker->top,
+                &top,
+                top + 1,
+                false,
+                __ATOMIC_SEQ_CST,
+                __ATOMIC_RELAXED
+            )
+        ) job = NULL;
+        __atomic_store_n(&worker->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+    return job;
+}
+
+/**
+ * @brief Steal the oldest job from the top of a worker's deque, from any
+ *        thread
+ * @param worker The worker to steal from
+ * @return The job, NULL if the deque is empty or another thread won it
+ */
+static BasecJob* _basec_jobs_steal(BasecJobsWorker* worker) {
+    i64       top    = __atomic_load_n(&worker->top, __ATOMIC_ACQUIRE);
+    i64       bottom = 0;
+    BasecJob* job    = NULL;
+
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    bottom = __atomic_load_n(&worker->bottom, __ATOMIC_ACQUIRE);
+    if (top >= bottom) return NULL;
+
+    job = __atomic_load_n(
+        &worker->buffer[top & (BASEC_JOBS_DEQUE_CAPACITY - 1)],
+        __ATOMIC_RELAXED
+    );
+    if (
+        !__atomic_compare_exchange_n(
+            &worker->top,
+            &top,
+            top + 1,
+            false,
+            __ATOMIC_SEQ_CST,
+            __ATOMIC_RELAXED
+        )
+    ) return NULL;
+    return job;
+}
+
+/**
+ * @brief Find a job to run, from this thread's deque, the injected queue or
+ *        another worker's deque
+ * @param jobs The pool
+ * @return The job, NULL if no job was found
+ */
+static BasecJob* _basec_jobs_find(BasecJobs* jobs) {
+    BasecJobsWorker* worker = _basec_jobs_worker(jobs);
+    BasecJobsWorker* victim = NULL;
+    BasecJob*        job    = NULL;
+    u64              start  = 0;
+
+    if (worker != NULL && (job = _basec_jobs_take(worker)) != NULL) {
+        return job;
+    }
+    if (
+        basec_mpmc_queue_pop(jobs->injected, &job) == BASEC_QUEUE_SUCCESS
+    ) return job;
+
+    // Starting at a random victim keeps thieves from piling onto one worker
+    if (worker != NULL) {
+        worker->seed ^= worker->seed << 13;
+        worker->seed ^= worker->seed >> 7;
+        worker->seed ^= worker->seed << 17;
+        start         = worker->seed % jobs->worker_count;
+    }
+    for (u64 i = 0; i < jobs->worker_count; i++) {
+        victim = &jobs->workers[(start + i) % jobs->worker_count];
+        if (victim == worker) continue;
+        if ((job = _basec_jobs_steal(victim)) != NULL) return job;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Let go of a reference to a job, freeing it with the last one
+ * @param job The job
+ */
+static void _basec_jobs_release(BasecJob* job) {
+    if (__atomic_sub_fetch(&job->references, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(job);
+    }
+}
+
+static void _basec_jobs_schedule(BasecJobs* jobs, BasecJob* job);
+
+/**
+ * @brief Run a job, queue its continuations and let go of the pool's
+ *        reference to it
+ * @param jobs The pool
+ * @param job The job
+ */
+static void _basec_jobs_run(BasecJobs* jobs, BasecJob* job) {
+    BasecJob* continuation = NULL;
+    BasecJob* next         = NULL;
+
+    job->function(job->context);
+
+    continuation = __atomic_exchange_n(
+        &job->continuations,
+        &_FINISHED,
+        __ATOMIC_ACQ_REL
+    );
+    __atomic_store_n(&job->done, true, __ATOMIC_RELEASE);
+    while (continuation != NULL) {
+        next = continuation->next;
+        _basec_jobs_schedule(jobs, continuation);
+        continuation = next;
+    }
+
+    (void)__atomic_sub_fetch(&jobs->pending, 1, __ATOMIC_ACQ_REL);
+    _basec_jobs_release(job);
+}
+
+/**
+ * @brief Queue a job and wake a sleeping worker
+ *
+ * The job goes to this thread's deque if it is a worker of the pool, then
+ * to the injected queue, and runs right away if both are full.
+ *
+ * @param jobs The pool
+ * @param job The job
+ */
+static void _basec_jobs_schedule(BasecJobs* jobs, BasecJob* job) {
+    BasecJobsWorker* worker = _basec_jobs_worker(jobs);
+
+    if (
+        (worker == NULL || !_basec_jobs_push(worker, job)) &&
+        basec_mpmc_queue_push(jobs->injected, &job) != BASEC_QUEUE_SUCCESS
+    ) {
+        _basec_jobs_run(jobs, job);
+        return;
+    }
+
+    if (__atomic_load_n(&jobs->sleeping, __ATOMIC_ACQUIRE) > 0) {
+        (void)pthread_mutex_lock(&jobs->lock);
+        (void)pthread_cond_signal(&jobs->wake);
+        (void)pthread_mutex_unlock(&jobs->lock);
+    }
+}
+
+/**
+ * @brief Allocate a job and count it as pending
+ * @param jobs The pool
+ * @param function The function to run
+ * @param context The context to pass to the function
+ * @param job_out The handle to wait on, NULL to not wait on the job
+ * @return The job, NULL if the allocation failed
+ */
+static BasecJob* _basec_jobs_allocate(
+    BasecJobs*       jobs,
+    BasecJobFunction function,
+    void*            context,
+    BasecJob**       job_out
+) {
+    BasecJob* job = (BasecJob*)malloc(sizeof(BasecJob));
+
+    if (job == NULL) return NULL;
+
+    job->function      = function;
+    job->context       = context;
+    job->continuations = NULL;
+    job->next          = NULL;
+    job->references    = job_out != NULL ? 2 : 1;
+    job->done          = false;
+
+    (void)__atomic_add_fetch(&jobs->pending, 1, __ATOMIC_ACQ_REL);
+    if (job_out != NULL) *job_out = job;
+    return job;
+}
+
+/**
+ * @brief Sleep until a job is queued, for a millisecond at most
+ *
+ * The timeout bounds the delay of a wake up that races with going to sleep.
+ *
+ * @param jobs The pool
+ */
+static void _basec_jobs_sleep(BasecJobs* jobs) {
+    struct timespec deadline = { 0 };
+
+    (void)pthread_mutex_lock(&jobs->lock);
+    (void)__atomic_add_fetch(&jobs->sleeping, 1, __ATOMIC_ACQ_REL);
+    if (!__atomic_load_n(&jobs->stopping, __ATOMIC_ACQUIRE)) {
+        (void)clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += _SLEEP_NS;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec  += 1;
+            deadline.tv_nsec -= 1000000000;
+        }
+        (void)pthread_cond_timedwait(&jobs->wake, &jobs->lock, &deadline);
+    }
+    (void)__atomic_sub_fetch(&jobs->sleeping, 1, __ATOMIC_ACQ_REL);
+    (void)pthread_mutex_unlock(&jobs->lock);
+}
+
+/**
+ * @brief Run jobs until the pool stops
+ * @param argument The worker
+ * @return NULL
+ */
+static void* _basec_jobs_worker_main(void* argument) {
+    BasecJobsWorker* worker = (BasecJobsWorker*)argument;
+    BasecJobs*       jobs   = worker->jobs;
+    BasecJob*        job    = NULL;
+    u64              idle   = 0;
+
+    _current_worker = worker;
+    for (;;) {
+        if ((job = _basec_jobs_find(jobs)) != NULL) {
+            _basec_jobs_run(jobs, job);
+            idle = 0;
+            continue;
+        }
+        if (__atomic_load_n(&jobs->stopping, __ATOMIC_ACQUIRE)) break;
+
+        // Yield for a while before sleeping, since jobs tend to come in bursts
+        if (++idle < _SPIN_ROUNDS) {
+            (void)sched_yield();
+            continue;
+        }
+        _basec_jobs_sleep(jobs);
+        idle = 0;
+    }
+    _current_worker = NULL;
+    return NULL;
+}
+
+/**
+ * @brief Stop the workers of a pool and wait for their threads to exit
+ * @param jobs The pool
+ * @param started The number of workers whose threads were started
+ */
+static void _basec_jobs_stop(BasecJobs* jobs, u64 started) {
+    (void)pthread_mutex_lock(&jobs->lock);
+    __atomic_store_n(&jobs->stopping, true, __ATOMIC_RELEASE);
+    (void)pthread_cond_broadcast(&jobs->wake);
+    (void)pthread_mutex_unlock(&jobs->lock);
+
+    for (u64 i = 0; i < started; i++) {
+        (void)pthread_join(jobs->workers[i].thread, NULL);
+    }
+}
+
+/**
+ * @brief Free a pool whose workers are not running
+ * @param jobs The pool
+ */
+static void _basec_jobs_free(BasecJobs* jobs) {
+    if (jobs->workers != NULL) {
+        for (u64 i = 0; i < jobs->worker_count; i++) {
+            free(jobs->workers[i].buffer);
+        }
+    }
+    if (jobs->injected != NULL) {
+        (void)basec_mpmc_queue_destroy(&jobs->injected);
+    }
+    (void)pthread_cond_destroy(&jobs->wake);
+    (void)pthread_mutex_destroy(&jobs->lock);
+    free(jobs->workers);
+    free(jobs);
+}
+
+/**
+ * @brief Claim and run chunks of a parallel loop until none are left
+ * @param context The loop
+ */
+static void _basec_jobs_loop(void* context) {
+    _BasecJobsLoop* loop  = (_BasecJobsLoop*)context;
+    u64             begin = 0;
+    u64             end   = 0;
+
+    for (;;) {
+        begin = __atomic_load_n(&loop->next, __ATOMIC_RELAXED);
+        do {
+            if (begin >= loop->end) return;
+            end = loop->end - begin > loop->grain ?
+                  begin + loop->grain :
+                  loop->end;
+        } while (
+            !__atomic_compare_exchange_n(
+                &loop->next,
+                &begin,
+                end,
+                true,
+                __ATOMIC_RELAXED,
+                __ATOMIC_RELAXED
+            )
+        );
+        loop->function(begin, end, loop->context);
+    }
+}
+
+/**
+ * @brief Create the shared pool, once
+ */
+static void _basec_jobs_create_shared(void) {
+    _shared_result = basec_jobs_create(&_shared, 0);
+}
+
+/**
+ * @brief Handle the result of a job system operation
+ * @param result The result of the operation
+ */
+void basec_jobs_handle_result(BasecJobsResult result) {
+    switch (result) {
+        case BASEC_JOBS_SUCCESS:
+            break;
+        case BASEC_JOBS_NULL_POINTER:
+            (void)printf(
+                "[Error][Jobs] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_JOBS_INVALID_WORKERS:
+            (void)printf(
+                "[Error][Jobs] "
+                "Operation failed due to an invalid number of workers.\n"
+            );
+            exit(1);
+        case BASEC_JOBS_INVALID_RANGE:
+            (void)printf(
+                "[Error][Jobs] "
+                "Operation failed due to an invalid range.\n"
+            );
+            exit(1);
+        case BASEC_JOBS_INVALID_GRAIN:
+            (void)printf(
+                "[Error][Jobs] "
+                "Operation failed due to an invalid grain.\n"
+            );
+            exit(1);
+        case BASEC_JOBS_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][Jobs] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_JOBS_THREAD_FAILURE:
+            (void)printf(
+                "[Error][Jobs] "
+                "Operation failed due to a thread creation failure.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][Jobs] "
+                "An unknown error occurred during job system operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a pool of workers
+ * @param jobs The pool to create
+ * @param workers The number of worker threads, 0 for one per online CPU
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_create(BasecJobs** jobs, u64 workers) {
+    if (jobs == NULL) return BASEC_JOBS_NULL_POINTER;
+    if (workers > BASEC_JOBS_MAX_WORKERS) return BASEC_JOBS_INVALID_WORKERS;
+
+    long online  = 0;
+    u64  started = 0;
+
+    if (workers == 0) {
+        online  = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = online > 0 ? (u64)online : 1;
+        if (workers > BASEC_JOBS_MAX_WORKERS) {
+            workers = BASEC_JOBS_MAX_WORKERS;
+        }
+    }
+
+    *jobs = (BasecJobs*)malloc(sizeof(BasecJobs));
+    if (*jobs == NULL) return BASEC_JOBS_ALLOCATION_FAILURE;
+
+    (*jobs)->worker_count = workers;
+    (*jobs)->injected     = NULL;
+    (*jobs)->pending      = 0;
+    (*jobs)->sleeping     = 0;
+    (*jobs)->stopping     = false;
+    (void)pthread_mutex_init(&(*jobs)->lock, NULL);
+    (void)pthread_cond_init(&(*jobs)->wake, NULL);
+
+    (*jobs)->workers = (BasecJobsWorker*)aligned_alloc(
+        BASEC_QUEUE_CACHE_LINE,
+        workers * sizeof(BasecJobsWorker)
+    );
+    if ((*jobs)->workers != NULL) {
+        (void)memset((*jobs)->workers, 0, workers * sizeof(BasecJobsWorker));
+    }
+
+    for (u64 i = 0; (*jobs)->workers != NULL && i < workers; i++) {
+        (*jobs)->workers[i].jobs   = *jobs;
+        (*jobs)->workers[i].seed   = (i + 1) * 0x9E3779B97F4A7C15ULL;
+        (*jobs)->workers[i].buffer = (BasecJob**)malloc(
+            BASEC_JOBS_DEQUE_CAPACITY * sizeof(BasecJob*)
+        );
+        if ((*jobs)->workers[i].buffer == NULL) {
+            _basec_jobs_free(*jobs);
+            *jobs = NULL;
+            return BASEC_JOBS_ALLOCATION_FAILURE;
+        }
+    }
+
+    if (
+        (*jobs)->workers == NULL ||
+        basec_mpmc_queue_create(
+            &(*jobs)->injected,
+            sizeof(BasecJob*),
+            BASEC_JOBS_INJECT_CAPACITY
+        ) != BASEC_QUEUE_SUCCESS
+    ) {
+        _basec_jobs_free(*jobs);
+        *jobs = NULL;
+        return BASEC_JOBS_ALLOCATION_FAILURE;
+    }
+
+    for (; started < workers; started++) {
+        if (
+            pthread_create(
+                &(*jobs)->workers[started].thread,
+                NULL,
+                _basec_jobs_worker_main,
+                &(*jobs)->workers[started]
+            ) != 0
+        ) {
+            _basec_jobs_stop(*jobs, started);
+            _basec_jobs_free(*jobs);
+            *jobs = NULL;
+            return BASEC_JOBS_THREAD_FAILURE;
+        }
+    }
+
+    return BASEC_JOBS_SUCCESS;
+}
+
+/**
+ * @brief Get the pool shared by every module, creating it on first use
+ * @param jobs_out The shared pool
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_shared(BasecJobs** jobs_out) {
+    if (jobs_out == NULL) return BASEC_JOBS_NULL_POINTER;
+
+    (void)pthread_once(&_shared_once, _basec_jobs_create_shared);
+    if (_shared_result != BASEC_JOBS_SUCCESS) return _shared_result;
+
+    *jobs_out = _shared;
+    return BASEC_JOBS_SUCCESS;
+}
+
+/**
+ * @brief Get the number of workers in a pool
+ * @param jobs The pool
+ * @param count_out The number of workers
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_worker_count(BasecJobs* jobs, u64* count_out) {
+    if (jobs == NULL || count_out == NULL) return BASEC_JOBS_NULL_POINTER;
+
+    *count_out = jobs->worker_count;
+    return BASEC_JOBS_SUCCESS;
+}
+
+/**
+ * @brief Submit a job to the pool
+ * @param jobs The pool to run the job
+ * @param function The function to run
+ * @param context The context to pass to the function
+ * @param job_out The handle to wait on, NULL to not wait on the job
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_submit(
+    BasecJobs*       jobs,
+    BasecJobFunction function,
+    void*            context,
+    BasecJob**       job_out
+) {
+    if (jobs == NULL || function == NULL) return BASEC_JOBS_NULL_POINTER;
+
+    BasecJob* job = _basec_jobs_allocate(jobs, function, context, job_out);
+
+    if (job == NULL) return BASEC_JOBS_ALLOCATION_FAILURE;
+
+    _basec_jobs_schedule(jobs, job);
+    return BASEC_JOBS_SUCCESS;
+}
+
+/**
+ * @brief Submit a job to run once another job finishes
+ * @param jobs The pool to run the job
+ * @param after The job to run after, a handle not yet waited on
+ * @param function The function to run
+ * @param context The context to pass to the function
+ * @param job_out The handle to wait on, NULL to not wait on the job
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_submit_after(
+    BasecJobs*       jobs,
+    BasecJob*        after,
+    BasecJobFunction function,
+    void*            context,
+    BasecJob**       job_out
+) {
+    if (jobs == NULL || after == NULL || function == NULL) {
+        return BASEC_JOBS_NULL_POINTER;
+    }
+
+    BasecJob* job  = _basec_jobs_allocate(jobs, function, context, job_out);
+    BasecJob* head = NULL;
+
+    if (job == NULL) return BASEC_JOBS_ALLOCATION_FAILURE;
+
+    head = __atomic_load_n(&after->continuations, __ATOMIC_ACQUIRE);
+    for (;;) {
+        if (head == &_FINISHED) {
+            _basec_jobs_schedule(jobs, job);
+            break;
+        }
+        job->next = head;
+        if (
+            __atomic_compare_exchange_n(
+                &after->continuations,
+                &head,
+                job,
+                true,
+                __ATOMIC_RELEASE,
+                __ATOMIC_ACQUIRE
+            )
+        ) break;
+    }
+    return BASEC_JOBS_SUCCESS;
+}
+
+/**
+ * @brief Wait for a job to finish and release its handle
+ * @param jobs The pool running the job
+ * @param job The handle to wait on, set to NULL
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_wait(BasecJobs* jobs, BasecJob** job) {
+    if (jobs == NULL || job == NULL || *job == NULL) {
+        return BASEC_JOBS_NULL_POINTER;
+    }
+
+    BasecJob* other = NULL;
+
+    while (!__atomic_load_n(&(*job)->done, __ATOMIC_ACQUIRE)) {
+        if ((other = _basec_jobs_find(jobs)) != NULL) {
+            _basec_jobs_run(jobs, other);
+        } else {
+            (void)sched_yield();
+        }
+    }
+
+    _basec_jobs_release(*job);
+    *job = NULL;
+    return BASEC_JOBS_SUCCESS;
+}
+
+/**
+ * @brief Run a function over a range of indices in parallel
+ * @param jobs The pool to run the loop
+ * @param range The range of indices
+ * @param grain The number of indices in every chunk but the last
+ * @param function The function to run on every chunk
+ * @param context The context to pass to the function
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_parallel_for(
+    BasecJobs*            jobs,
+    BasecJobsRange        range,
+    u64                   grain,
+    BasecJobRangeFunction function,
+    void*                 context
+) {
+    if (jobs == NULL || function == NULL) return BASEC_JOBS_NULL_POINTER;
+    if (range.begin > range.end) return BASEC_JOBS_INVALID_RANGE;
+    if (grain == 0) return BASEC_JOBS_INVALID_GRAIN;
+    if (range.begin == range.end) return BASEC_JOBS_SUCCESS;
+
+    _BasecJobsLoop loop      = { 0 };
+    BasecJob*      helpers[BASEC_JOBS_MAX_WORKERS];
+    u64            chunks    = (range.end - range.begin - 1) / grain + 1;
+    u64            count     = 0;
+    u64            submitted = 0;
+
+    if (chunks == 1) {
+        function(range.begin, range.end, context);
+        return BASEC_JOBS_SUCCESS;
+    }
+
+    loop.next     = range.begin;
+    loop.end      = range.end;
+    loop.grain    = grain;
+    loop.function = function;
+    loop.context  = context;
+
+    // The calling thread claims chunks too, so one helper per worker is enough
+    count = chunks - 1 < jobs->worker_count ? chunks - 1 : jobs->worker_count;
+    for (; submitted < count; submitted++) {
+        if (
+            basec_jobs_submit(
+                jobs,
+                _basec_jobs_loop,
+                &loop,
+                &helpers[submitted]
+            ) != BASEC_JOBS_SUCCESS
+        ) break;
+    }
+
+    _basec_jobs_loop(&loop);
+    for (u64 i = 0; i < submitted; i++) {
+        (void)basec_jobs_wait(jobs, &helpers[i]);
+    }
+    return BASEC_JOBS_SUCCESS;
+}
+
+/**
+ * @brief Run a function over a range of indices on the shared pool
+ * @param range The range of indices
+ * @param grain The number of indices in every chunk but the last
+ * @param function The function to run on every chunk
+ * @param context The context to pass to the function
+ * @return The result of the operation
+ */
+BasecJobsResult basec_parallel_for(
+    BasecJobsRange        range,
+    u64                   grain,
+    BasecJobRangeFunction function,
+    void*                 context
+) {
+    BasecJobs*      jobs   = NULL;
+    BasecJobsResult result = basec_jobs_shared(&jobs);
+
+    if (result != BASEC_JOBS_SUCCESS) return result;
+
+    return basec_jobs_parallel_for(jobs, range, grain, function, context);
+}
+
+/**
+ * @brief Destroy a pool of workers
+ * @param jobs The pool to destroy
+ * @return The result of the operation
+ */
+BasecJobsResult basec_jobs_destroy(BasecJobs** jobs) {
+    if (jobs == NULL || *jobs == NULL) return BASEC_JOBS_NULL_POINTER;
+
+    BasecJob* job = NULL;
+
+    // Jobs submitted without a handle are only freed once they have run
+    while (__atomic_load_n(&(*jobs)->pending, __ATOMIC_ACQUIRE) > 0) {
+        if ((job = _basec_jobs_find(*jobs)) != NULL) {
+            _basec_jobs_run(*jobs, job);
+        } else {
+            (void)sched_yield();
+        }
+    }
+
+    _basec_jobs_stop(*jobs, (*jobs)->worker_count);
+    _basec_jobs_free(*jobs);
+    *jobs = NULL;
+    return BASEC_JOBS_SUCCESS;
+}
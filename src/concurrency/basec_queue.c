@@ -0,0 +1,470 @@
+#include "concurrency/basec_queue.h"
+
+static const u64 _MAX_CAPACITY = (u64)1 << 62;
+
+/**
+ * @brief Round a capacity up to a power of two
+ * @param capacity The requested capacity
+ * @param minimum The smallest capacity to return
+ * @return The capacity
+ */
+static u64 _basec_queue_capacity(u64 capacity, u64 minimum) {
+    u64 rounded = minimum;
+
+    while (rounded < capacity) rounded <<= 1;
+    return rounded;
+}
+
+/**
+ * @brief Copy elements into a ring, in at most two runs
+ * @param data The ring
+ * @param capacity The number of elements in the ring
+ * @param element_size The size of the elements
+ * @param position The position of the first element, before masking
+ * @param elements The elements to copy
+ * @param count The number of elements
+ */
+static void _basec_queue_write(
+    u8*       data,
+    u64       capacity,
+    u64       element_size,
+    u64       position,
+    const u8* elements,
+    u64       count
+) {
+    u64 start = position & (capacity - 1);
+    u64 first = capacity - start < count ? capacity - start : count;
+
+    (void)memcpy(data + start * element_size, elements, first * element_size);
+    if (count > first) {
+        (void)memcpy(
+            data,
+            elements + first * element_size,
+            (count - first) * element_size
+        );
+    }
+}
+
+/**
+ * @brief Copy elements out of a ring, in at most two runs
+ * @param data The ring
+ * @param capacity The number of elements in the ring
+ * @param element_size The size of the elements
+ * @param position The position of the first element, before masking
+ * @param elements_out The copied elements
+ * @param count The number of elements
+ */
+static void _basec_queue_read(
+    const u8* data,
+    u64       capacity,
+    u64       element_size,
+    u64       position,
+    u8*       elements_out,
+    u64       count
+) {
+    u64 start = position & (capacity - 1);
+    u64 first = capacity - start < count ? capacity - start : count;
+
+    (void)memcpy(
+        elements_out,
+        data + start * element_size,
+        first * element_size
+    );
+    if (count > first) {
+        (void)memcpy(
+            elements_out + first * element_size,
+            data,
+            (count - first) * element_size
+        );
+    }
+}
+
+/**
+ * @brief Handle the result of a queue operation
+ * @param result The result of the operation
+ */
+void basec_queue_handle_result(BasecQueueResult result) {
+    switch (result) {
+        case BASEC_QUEUE_SUCCESS:
+            break;
+        case BASEC_QUEUE_NULL_POINTER:
+            (void)printf(
+                "[Error][Queue] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_QUEUE_INVALID_ELEMENT_SIZE:
+            (void)printf(
+                "[Error][Queue] "
+                "Operation failed due to an invalid element size.\n"
+            );
+            exit(1);
+        case BASEC_QUEUE_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][Queue] "
+                "Operation failed due to an invalid capacity.\n"
+            );
+            exit(1);
+        case BASEC_QUEUE_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][Queue] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_QUEUE_FULL:
+            (void)printf(
+                "[Error][Queue] "
+                "Operation failed due to a full queue.\n"
+            );
+            exit(1);
+        case BASEC_QUEUE_EMPTY:
+            (void)printf(
+                "[Error][Queue] "
+                "Operation failed due to an empty queue.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][Queue] "
+                "An unknown error occurred during queue operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a single producer, single consumer queue
+ * @param queue The queue to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements the queue holds
+ * @return The result of the operation
+ */
+BasecQueueResult basec_spsc_queue_create(
+    BasecSpscQueue** queue,
+    u64              element_size,
+    u64              capacity
+) {
+    if (queue == NULL) return BASEC_QUEUE_NULL_POINTER;
+    if (element_size == 0) return BASEC_QUEUE_INVALID_ELEMENT_SIZE;
+    if (capacity == 0 || capacity > _MAX_CAPACITY) {
+        return BASEC_QUEUE_INVALID_CAPACITY;
+    }
+
+    *queue = (BasecSpscQueue*)aligned_alloc(
+        BASEC_QUEUE_CACHE_LINE,
+        sizeof(BasecSpscQueue)
+    );
+    if (*queue == NULL) return BASEC_QUEUE_ALLOCATION_FAILURE;
+
+    (*queue)->capacity = _basec_queue_capacity(capacity, 1);
+    (*queue)->data     = malloc((*queue)->capacity * element_size);
+    if ((*queue)->data == NULL) {
+        free(*queue);
+        *queue = NULL;
+        return BASEC_QUEUE_ALLOCATION_FAILURE;
+    }
+
+    (*queue)->tail         = 0;
+    (*queue)->cached_head  = 0;
+    (*queue)->head         = 0;
+    (*queue)->cached_tail  = 0;
+    (*queue)->element_size = element_size;
+    return BASEC_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Add an element to the queue, from the producer thread
+ * @param queue The queue to push to
+ * @param element The element to push
+ * @return The result of the operation
+ */
+BasecQueueResult basec_spsc_queue_push(
+    BasecSpscQueue* queue,
+    const void*     element
+) {
+    u64 pushed = 0;
+
+    return basec_spsc_queue_push_n(queue, element, 1, &pushed);
+}
+
+/**
+ * @brief Remove the oldest element, from the consumer thread
+ * @param queue The queue to pop from
+ * @param element_out The popped element
+ * @return The result of the operation
+ */
+BasecQueueResult basec_spsc_queue_pop(
+    BasecSpscQueue* queue,
+    void*           element_out
+) {
+    u64 popped = 0;
+
+    return basec_spsc_queue_pop_n(queue, element_out, 1, &popped);
+}
+
+/**
+ * @brief Add as many elements as fit, from the producer thread
+ * @param queue The queue to push to
+ * @param elements The elements to push, in order
+ * @param count The number of elements
+ * @param pushed_out The number of elements pushed
+ * @return The result of the operation
+ */
+BasecQueueResult basec_spsc_queue_push_n(
+    BasecSpscQueue* queue,
+    const void*     elements,
+    u64             count,
+    u64*            pushed_out
+) {
+    if (queue == NULL || elements == NULL || pushed_out == NULL) {
+        return BASEC_QUEUE_NULL_POINTER;
+    }
+
+    u64 tail  = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+    u64 space = queue->capacity - (tail - queue->cached_head);
+
+    *pushed_out = 0;
+    if (count == 0) return BASEC_QUEUE_SUCCESS;
+
+    // Only look at the consumer's line when the cached head says it is full
+    if (space < count) {
+        queue->cached_head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+        space              = queue->capacity - (tail - queue->cached_head);
+    }
+    if (space == 0) return BASEC_QUEUE_FULL;
+    *pushed_out = space < count ? space : count;
+
+    _basec_queue_write(
+        (u8*)queue->data,
+        queue->capacity,
+        queue->element_size,
+        tail,
+        (const u8*)elements,
+        *pushed_out
+    );
+    __atomic_store_n(&queue->tail, tail + *pushed_out, __ATOMIC_RELEASE);
+    return BASEC_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Remove up to a number of the oldest elements, from the consumer
+ *        thread
+ * @param queue The queue to pop from
+ * @param elements_out The popped elements, in order
+ * @param count The largest number of elements to pop
+ * @param popped_out The number of elements popped
+ * @return The result of the operation
+ */
+BasecQueueResult basec_spsc_queue_pop_n(
+    BasecSpscQueue* queue,
+    void*           elements_out,
+    u64             count,
+    u64*            popped_out
+) {
+    if (queue == NULL || elements_out == NULL || popped_out == NULL) {
+        return BASEC_QUEUE_NULL_POINTER;
+    }
+
+    u64 head      = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+    u64 available = queue->cached_tail - head;
+
+    *popped_out = 0;
+    if (count == 0) return BASEC_QUEUE_SUCCESS;
+
+    if (available < count) {
+        queue->cached_tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+        available          = queue->cached_tail - head;
+    }
+    if (available == 0) return BASEC_QUEUE_EMPTY;
+    *popped_out = available < count ? available : count;
+
+    _basec_queue_read(
+        (const u8*)queue->data,
+        queue->capacity,
+        queue->element_size,
+        head,
+        (u8*)elements_out,
+        *popped_out
+    );
+    __atomic_store_n(&queue->head, head + *popped_out, __ATOMIC_RELEASE);
+    return BASEC_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Destroy a single producer, single consumer queue
+ * @param queue The queue to destroy
+ * @return The result of the operation
+ */
+BasecQueueResult basec_spsc_queue_destroy(BasecSpscQueue** queue) {
+    if (queue == NULL || *queue == NULL) return BASEC_QUEUE_NULL_POINTER;
+
+    free((*queue)->data);
+    free(*queue);
+    *queue = NULL;
+    return BASEC_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Create a multi producer, multi consumer queue
+ * @param queue The queue to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements the queue holds
+ * @return The result of the operation
+ */
+BasecQueueResult basec_mpmc_queue_create(
+    BasecMpmcQueue** queue,
+    u64              element_size,
+    u64              capacity
+) {
+    if (queue == NULL) return BASEC_QUEUE_NULL_POINTER;
+    if (element_size == 0 || element_size > _MAX_CAPACITY) {
+        return BASEC_QUEUE_INVALID_ELEMENT_SIZE;
+    }
+    if (capacity == 0 || capacity > _MAX_CAPACITY) {
+        return BASEC_QUEUE_INVALID_CAPACITY;
+    }
+
+    u64 slot_size = 0;
+    u64 bytes     = 0;
+
+    // The sequence leads every slot, so slots stay aligned for it
+    slot_size = (sizeof(u64) + element_size + sizeof(u64) - 1) &
+                ~(u64)(sizeof(u64) - 1);
+    capacity  = _basec_queue_capacity(capacity, 2);
+    bytes     = (capacity * slot_size + BASEC_QUEUE_CACHE_LINE - 1) &
+                ~(u64)(BASEC_QUEUE_CACHE_LINE - 1);
+
+    *queue = (BasecMpmcQueue*)aligned_alloc(
+        BASEC_QUEUE_CACHE_LINE,
+        sizeof(BasecMpmcQueue)
+    );
+    if (*queue == NULL) return BASEC_QUEUE_ALLOCATION_FAILURE;
+
+    (*queue)->slots = (u8*)aligned_alloc(BASEC_QUEUE_CACHE_LINE, bytes);
+    if ((*queue)->slots == NULL) {
+        free(*queue);
+        *queue = NULL;
+        return BASEC_QUEUE_ALLOCATION_FAILURE;
+    }
+
+    // Slot i is free for the producer claiming position i
+    for (u64 i = 0; i < capacity; i++) {
+        *(u64*)((*queue)->slots + i * slot_size) = i;
+    }
+    (*queue)->enqueue      = 0;
+    (*queue)->dequeue      = 0;
+    (*queue)->slot_size    = slot_size;
+    (*queue)->element_size = element_size;
+    (*queue)->capacity     = capacity;
+    return BASEC_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Add an element to the queue, from any thread
+ * @param queue The queue to push to
+ * @param element The element to push
+ * @return The result of the operation
+ */
+BasecQueueResult basec_mpmc_queue_push(
+    BasecMpmcQueue* queue,
+    const void*     element
+) {
+    if (queue == NULL || element == NULL) return BASEC_QUEUE_NULL_POINTER;
+
+    u64 position = __atomic_load_n(&queue->enqueue, __ATOMIC_RELAXED);
+    u8* slot     = NULL;
+    u64 sequence = 0;
+    i64 distance = 0;
+
+    for (;;) {
+        slot     = queue->slots +
+                   (position & (queue->capacity - 1)) * queue->slot_size;
+        sequence = __atomic_load_n((u64*)slot, __ATOMIC_ACQUIRE);
+        distance = (i64)(sequence - position);
+
+        // Behind means a consumer has not freed the slot a lap ago yet
+        if (distance < 0) return BASEC_QUEUE_FULL;
+        if (
+            distance == 0 &&
+            __atomic_compare_exchange_n(
+                &queue->enqueue,
+                &position,
+                position + 1,
+                true,
+                __ATOMIC_RELAXED,
+                __ATOMIC_RELAXED
+            )
+        ) break;
+        if (distance > 0) {
+            position = __atomic_load_n(&queue->enqueue, __ATOMIC_RELAXED);
+        }
+    }
+
+    (void)memcpy(slot + sizeof(u64), element, queue->element_size);
+    __atomic_store_n((u64*)slot, position + 1, __ATOMIC_RELEASE);
+    return BASEC_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Remove the oldest element, from any thread
+ * @param queue The queue to pop from
+ * @param element_out The popped element
+ * @return The result of the operation
+ */
+BasecQueueResult basec_mpmc_queue_pop(
+    BasecMpmcQueue* queue,
+    void*           element_out
+) {
+    if (queue == NULL || element_out == NULL) return BASEC_QUEUE_NULL_POINTER;
+
+    u64 position = __atomic_load_n(&queue->dequeue, __ATOMIC_RELAXED);
+    u8* slot     = NULL;
+    u64 sequence = 0;
+    i64 distance = 0;
+
+    for (;;) {
+        slot     = queue->slots +
+                   (position & (queue->capacity - 1)) * queue->slot_size;
+        sequence = __atomic_load_n((u64*)slot, __ATOMIC_ACQUIRE);
+        distance = (i64)(sequence - (position + 1));
+
+        // Behind means no producer has filled the slot for this lap yet
+        if (distance < 0) return BASEC_QUEUE_EMPTY;
+        if (
+            distance == 0 &&
+            __atomic_compare_exchange_n(
+                &queue->dequeue,
+                &position,
+                position + 1,
+                true,
+                __ATOMIC_RELAXED,
+                __ATOMIC_RELAXED
+            )
+        ) break;
+        if (distance > 0) {
+            position = __atomic_load_n(&queue->dequeue, __ATOMIC_RELAXED);
+        }
+    }
+
+    (void)memcpy(element_out, slot + sizeof(u64), queue->element_size);
+    __atomic_store_n(
+        (u64*)slot,
+        position + queue->capacity,
+        __ATOMIC_RELEASE
+    );
+    return BASEC_QUEUE_SUCCESS;
+}
+
+/**
+ * @brief Destroy a multi producer, multi consumer queue
+ * @param queue The queue to destroy
+ * @return The result of the operation
+ */
+BasecQueueResult basec_mpmc_queue_destroy(BasecMpmcQueue** queue) {
+    if (queue == NULL || *queue == NULL) return BASEC_QUEUE_NULL_POINTER;
+
+    free((*queue)->slots);
+    free(*queue);
+    *queue = NULL;
+    return BASEC_QUEUE_SUCCESS;
+}
@@ -0,0 +1,277 @@
+#include "concurrency/benches/bench_concurrent_array.h"
+
+#define _BENCH_CONCURRENT_ARRAY_ELEMENTS    1048576
+#define _BENCH_CONCURRENT_ARRAY_CAPACITY    1024
+#define _BENCH_CONCURRENT_ARRAY_BATCH       64
+#define _BENCH_CONCURRENT_ARRAY_MAX_THREADS 8
+
+/**
+ * @struct _BenchConcurrentArrayWriter
+ * @brief The array a thread appends to and its share of the elements
+ */
+typedef struct {
+    BasecArray*           array;
+    pthread_mutex_t*      lock;
+    BasecConcurrentArray* concurrent;
+    u64                   batch;
+    u64                   count;
+} _BenchConcurrentArrayWriter;
+
+/**
+ * @brief Append elements to a BasecArray guarded by a mutex
+ * @param arg The _BenchConcurrentArrayWriter of the thread
+ * @return NULL
+ */
+static void* _bench_concurrent_array_mutex_writer(void* arg) {
+    _BenchConcurrentArrayWriter* writer = (_BenchConcurrentArrayWriter*)arg;
+
+    for (u64 i = 0; i < writer->count; i++) {
+        (void)pthread_mutex_lock(writer->lock);
+        (void)basec_array_append(writer->array, &i);
+        (void)pthread_mutex_unlock(writer->lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Append elements to a BasecConcurrentArray, batch at a time
+ * @param arg The _BenchConcurrentArrayWriter of the thread
+ * @return NULL
+ */
+static void* _bench_concurrent_array_writer(void* arg) {
+    _BenchConcurrentArrayWriter* writer = (_BenchConcurrentArrayWriter*)arg;
+    u64                          size   = 0;
+    u64                          elements[_BENCH_CONCURRENT_ARRAY_BATCH];
+
+    for (u64 next = 0; next < writer->count; next += size) {
+        size = writer->count - next;
+        if (size > writer->batch) size = writer->batch;
+        for (u64 i = 0; i < size; i++) elements[i] = next + i;
+
+        (void)basec_concurrent_array_append_n(
+            writer->concurrent,
+            elements,
+            size,
+            NULL
+        );
+    }
+    return NULL;
+}
+
+/**
+ * @brief Benchmark appending from several threads at once
+ * @param threads The number of appending threads
+ * @param batch The elements appended per call, 0 for a locked BasecArray
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_concurrent_array_threads(
+    u64 threads,
+    u64 batch
+) {
+    BasecBenchTimer             timer        = {0};
+    u64                         elapsed_ns   = 0;
+    BasecBenchResult            bench_result = BASEC_BENCH_SUCCESS;
+    _BenchConcurrentArrayWriter writers[_BENCH_CONCURRENT_ARRAY_MAX_THREADS];
+    pthread_t                   handles[_BENCH_CONCURRENT_ARRAY_MAX_THREADS];
+    pthread_mutex_t             lock;
+    BasecArray*                 array        = NULL;
+    BasecConcurrentArray*       concurrent   = NULL;
+    u64                         started      = 0;
+    u64                         length       = 0;
+    c8                          name[64];
+
+    if (pthread_mutex_init(&lock, NULL) != 0) return BASEC_BENCH_RUN_FAILURE;
+    if (
+        basec_array_create(
+            &array,
+            sizeof(u64),
+            _BENCH_CONCURRENT_ARRAY_CAPACITY
+        ) != BASEC_ARRAY_SUCCESS ||
+        basec_concurrent_array_create(
+            &concurrent,
+            sizeof(u64),
+            _BENCH_CONCURRENT_ARRAY_CAPACITY
+        ) != BASEC_CONCURRENT_ARRAY_SUCCESS
+    ) bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < threads; i++) {
+        writers[i].array      = array;
+        writers[i].lock       = &lock;
+        writers[i].concurrent = concurrent;
+        writers[i].batch      = batch;
+        writers[i].count      = _BENCH_CONCURRENT_ARRAY_ELEMENTS / threads;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    while (bench_result == BASEC_BENCH_SUCCESS && started < threads) {
+        if (
+            pthread_create(
+                &handles[started],
+                NULL,
+                batch == 0 ? &_bench_concurrent_array_mutex_writer :
+                             &_bench_concurrent_array_writer,
+                &writers[started]
+            ) != 0
+        ) {
+            bench_result = BASEC_BENCH_RUN_FAILURE;
+        } else {
+            started++;
+        }
+    }
+    for (u64 i = 0; i < started; i++) (void)pthread_join(handles[i], NULL);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        length = array->length;
+        if (batch != 0) length = concurrent->length;
+        if (length != threads * writers[0].count) {
+            bench_result = BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+
+    if (array != NULL) (void)basec_array_destroy(&array);
+    if (concurrent != NULL) (void)basec_concurrent_array_destroy(&concurrent);
+    (void)pthread_mutex_destroy(&lock);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    if (batch == 0) {
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "mutex + basec_array, %lu threads",
+            (unsigned long)threads
+        );
+    } else if (batch == 1) {
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "basec_concurrent_array, %lu threads",
+            (unsigned long)threads
+        );
+    } else {
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "basec_concurrent_array x%lu, %lu threads",
+            (unsigned long)batch,
+            (unsigned long)threads
+        );
+    }
+    return basec_bench_print(name, length, sizeof(u64), elapsed_ns);
+}
+
+/**
+ * @brief Benchmark appending from several threads to a mutex guarded
+ *        BasecArray and to a BasecConcurrentArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_concurrent_array_append(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    for (
+        u64 threads = 1;
+        bench_result == BASEC_BENCH_SUCCESS &&
+        threads <= _BENCH_CONCURRENT_ARRAY_MAX_THREADS;
+        threads *= 2
+    ) {
+        bench_result = _bench_concurrent_array_threads(threads, 0);
+        if (bench_result == BASEC_BENCH_SUCCESS) {
+            bench_result = _bench_concurrent_array_threads(threads, 1);
+        }
+    }
+
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark appending batches from several threads to a
+ *        BasecConcurrentArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_concurrent_array_append_n(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    for (
+        u64 threads = 1;
+        bench_result == BASEC_BENCH_SUCCESS &&
+        threads <= _BENCH_CONCURRENT_ARRAY_MAX_THREADS;
+        threads *= 2
+    ) {
+        bench_result = _bench_concurrent_array_threads(
+            threads,
+            _BENCH_CONCURRENT_ARRAY_BATCH
+        );
+    }
+
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark freezing a BasecConcurrentArray into a BasecArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_concurrent_array_freeze(void) {
+    BasecBenchTimer       timer        = {0};
+    u64                   elapsed_ns   = 0;
+    BasecBenchResult      bench_result = BASEC_BENCH_SUCCESS;
+    BasecConcurrentArray* concurrent   = NULL;
+    BasecArray*           frozen       = NULL;
+    u64                   element      = 0;
+
+    if (
+        basec_concurrent_array_create(
+            &concurrent,
+            sizeof(u64),
+            _BENCH_CONCURRENT_ARRAY_CAPACITY
+        ) != BASEC_CONCURRENT_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_CONCURRENT_ARRAY_ELEMENTS; i++) {
+        (void)basec_concurrent_array_append(concurrent, &i, NULL);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    if (
+        basec_concurrent_array_freeze(&concurrent, &frozen) !=
+        BASEC_CONCURRENT_ARRAY_SUCCESS
+    ) bench_result = BASEC_BENCH_RUN_FAILURE;
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        element = ((u64*)frozen->data)[_BENCH_CONCURRENT_ARRAY_ELEMENTS - 1];
+        if (element != _BENCH_CONCURRENT_ARRAY_ELEMENTS - 1) {
+            bench_result = BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+    if (concurrent != NULL) (void)basec_concurrent_array_destroy(&concurrent);
+    if (frozen != NULL) (void)basec_array_destroy(&frozen);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_concurrent_array_freeze",
+        _BENCH_CONCURRENT_ARRAY_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Run the ConcurrentArray benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_concurrent_array_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("ConcurrentArray");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_concurrent_array_append();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_concurrent_array_append_n();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_concurrent_array_freeze();
+    }
+
+    return bench_result;
+}
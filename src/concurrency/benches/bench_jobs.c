@@ -0,0 +1,214 @@
+#include "concurrency/benches/bench_jobs.h"
+
+#define _BENCH_JOBS_ELEMENTS    4194304
+#define _BENCH_JOBS_GRAIN       65536
+#define _BENCH_JOBS_MAX_WORKERS 8
+#define _BENCH_JOBS_BATCH       1024
+#define _BENCH_JOBS_ROUNDS      64
+
+/**
+ * @struct _BenchJobsSum
+ * @brief The elements a parallel loop reduces and the shared result
+ */
+typedef struct {
+    const u64* elements;
+    u64        sum;
+} _BenchJobsSum;
+
+/**
+ * @brief Mix and add up a run of elements
+ * @param elements The elements
+ * @param begin The first index
+ * @param end One past the last index
+ * @return The sum of the mixed elements
+ */
+static u64 _bench_jobs_mix(const u64* elements, u64 begin, u64 end) {
+    u64 sum = 0;
+
+    for (u64 i = begin; i < end; i++) {
+        sum += (elements[i] * elements[i]) ^ (elements[i] >> 3);
+    }
+    return sum;
+}
+
+/**
+ * @brief Add the mixed elements of a chunk to the shared result
+ * @param begin The first index of the chunk
+ * @param end One past the last index of the chunk
+ * @param context The _BenchJobsSum of the loop
+ */
+static void _bench_jobs_chunk(u64 begin, u64 end, void* context) {
+    _BenchJobsSum* sum   = (_BenchJobsSum*)context;
+    u64            local = _bench_jobs_mix(sum->elements, begin, end);
+
+    (void)__atomic_add_fetch(&sum->sum, local, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Do nothing, to measure the cost of a job alone
+ * @param context Unused
+ */
+static void _bench_jobs_empty(void* context) {
+    (void)context;
+}
+
+/**
+ * @brief Allocate the elements the loops reduce
+ * @return The elements, NULL if the allocation failed
+ */
+static u64* _bench_jobs_elements(void) {
+    u64* elements = (u64*)malloc(_BENCH_JOBS_ELEMENTS * sizeof(u64));
+
+    if (elements == NULL) return NULL;
+    for (u64 i = 0; i < _BENCH_JOBS_ELEMENTS; i++) elements[i] = i;
+    return elements;
+}
+
+/**
+ * @brief Benchmark a serial loop as the baseline for parallel loops
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_jobs_serial(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    u64*            elements   = _bench_jobs_elements();
+    volatile u64    sum        = 0;
+
+    if (elements == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    sum = _bench_jobs_mix(elements, 0, _BENCH_JOBS_ELEMENTS);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)sum;
+    free(elements);
+    return basec_bench_print(
+        "serial loop",
+        _BENCH_JOBS_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark basec_jobs_parallel_for across worker counts
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_jobs_parallel_for(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecJobs*       jobs         = NULL;
+    _BenchJobsSum    sum          = {0};
+    BasecJobsRange   range        = { 0, _BENCH_JOBS_ELEMENTS };
+    u64              expected     = 0;
+    c8               name[64];
+
+    sum.elements = _bench_jobs_elements();
+    if (sum.elements == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+    expected = _bench_jobs_mix(sum.elements, 0, _BENCH_JOBS_ELEMENTS);
+
+    for (
+        u64 workers = 1;
+        bench_result == BASEC_BENCH_SUCCESS &&
+        workers <= _BENCH_JOBS_MAX_WORKERS;
+        workers *= 2
+    ) {
+        if (basec_jobs_create(&jobs, workers) != BASEC_JOBS_SUCCESS) {
+            bench_result = BASEC_BENCH_RUN_FAILURE;
+            break;
+        }
+
+        sum.sum = 0;
+        basec_bench_handle_result(basec_bench_timer_start(&timer));
+        basec_jobs_handle_result(
+            basec_jobs_parallel_for(
+                jobs,
+                range,
+                _BENCH_JOBS_GRAIN,
+                _bench_jobs_chunk,
+                &sum
+            )
+        );
+        basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+        (void)basec_jobs_destroy(&jobs);
+
+        if (sum.sum != expected) {
+            bench_result = BASEC_BENCH_RUN_FAILURE;
+            break;
+        }
+
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "basec_jobs_parallel_for, %lu workers",
+            (unsigned long)workers
+        );
+        bench_result = basec_bench_print(
+            name,
+            _BENCH_JOBS_ELEMENTS,
+            sizeof(u64),
+            elapsed_ns
+        );
+    }
+
+    free((void*)sum.elements);
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark the cost of submitting and waiting on empty jobs
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_jobs_submit_wait(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecJobs*      jobs       = NULL;
+    BasecJob*       handles[_BENCH_JOBS_BATCH];
+
+    if (basec_jobs_create(&jobs, 2) != BASEC_JOBS_SUCCESS) {
+        return BASEC_BENCH_RUN_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 round = 0; round < _BENCH_JOBS_ROUNDS; round++) {
+        for (u64 i = 0; i < _BENCH_JOBS_BATCH; i++) {
+            basec_jobs_handle_result(
+                basec_jobs_submit(jobs, _bench_jobs_empty, NULL, &handles[i])
+            );
+        }
+        for (u64 i = 0; i < _BENCH_JOBS_BATCH; i++) {
+            basec_jobs_handle_result(basec_jobs_wait(jobs, &handles[i]));
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_jobs_destroy(&jobs);
+    return basec_bench_print(
+        "basec_jobs_submit + wait, empty jobs",
+        _BENCH_JOBS_ROUNDS * _BENCH_JOBS_BATCH,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Run the Jobs benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_jobs_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("Jobs");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_jobs_serial();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_jobs_parallel_for();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_jobs_submit_wait();
+    }
+
+    return bench_result;
+}
@@ -0,0 +1,404 @@
+#include "concurrency/benches/bench_queue.h"
+
+#define _BENCH_QUEUE_ELEMENTS    1048576
+#define _BENCH_QUEUE_CAPACITY    1024
+#define _BENCH_QUEUE_BATCH       64
+#define _BENCH_QUEUE_ROUND_TRIPS 20000
+#define _BENCH_QUEUE_MAX_THREADS 16
+
+/**
+ * @struct _BenchQueueWorker
+ * @brief The queue a thread passes elements through and its share of them
+ */
+typedef struct {
+    BasecArray*      array;
+    pthread_mutex_t* lock;
+    BasecMpmcQueue*  mpmc;
+    BasecSpscQueue*  spsc;
+    BasecSpscQueue*  reply;
+    u64              count;
+    u64              sum;
+} _BenchQueueWorker;
+
+/**
+ * @brief Push elements to a BasecArray guarded by a mutex
+ * @param arg The _BenchQueueWorker of the thread
+ * @return NULL
+ */
+static void* _bench_queue_mutex_producer(void* arg) {
+    _BenchQueueWorker* worker = (_BenchQueueWorker*)arg;
+
+    for (u64 i = 0; i < worker->count; i++) {
+        (void)pthread_mutex_lock(worker->lock);
+        (void)basec_array_append(worker->array, &i);
+        (void)pthread_mutex_unlock(worker->lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Pop elements from a BasecArray guarded by a mutex
+ * @param arg The _BenchQueueWorker of the thread
+ * @return NULL
+ */
+static void* _bench_queue_mutex_consumer(void* arg) {
+    _BenchQueueWorker* worker  = (_BenchQueueWorker*)arg;
+    u64                element = 0;
+    u64                popped  = 0;
+    bool               empty   = false;
+
+    while (popped < worker->count) {
+        (void)pthread_mutex_lock(worker->lock);
+        empty = basec_array_pop(worker->array, &element) != BASEC_ARRAY_SUCCESS;
+        (void)pthread_mutex_unlock(worker->lock);
+        if (empty) {
+            (void)sched_yield();
+            continue;
+        }
+        worker->sum += element;
+        popped++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Push elements to a multi producer queue
+ * @param arg The _BenchQueueWorker of the thread
+ * @return NULL
+ */
+static void* _bench_queue_mpmc_producer(void* arg) {
+    _BenchQueueWorker* worker = (_BenchQueueWorker*)arg;
+
+    for (u64 i = 0; i < worker->count; i++) {
+        while (
+            basec_mpmc_queue_push(worker->mpmc, &i) != BASEC_QUEUE_SUCCESS
+        ) (void)sched_yield();
+    }
+    return NULL;
+}
+
+/**
+ * @brief Pop elements from a multi producer queue
+ * @param arg The _BenchQueueWorker of the thread
+ * @return NULL
+ */
+static void* _bench_queue_mpmc_consumer(void* arg) {
+    _BenchQueueWorker* worker  = (_BenchQueueWorker*)arg;
+    u64                element = 0;
+
+    for (u64 i = 0; i < worker->count; i++) {
+        while (
+            basec_mpmc_queue_pop(worker->mpmc, &element) != BASEC_QUEUE_SUCCESS
+        ) (void)sched_yield();
+        worker->sum += element;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Push elements to a single producer queue in batches
+ * @param arg The _BenchQueueWorker of the thread
+ * @return NULL
+ */
+static void* _bench_queue_spsc_producer(void* arg) {
+    _BenchQueueWorker* worker                    = (_BenchQueueWorker*)arg;
+    u64                batch[_BENCH_QUEUE_BATCH] = {0};
+    u64                next                      = 0;
+    u64                size                      = 0;
+    u64                pushed                    = 0;
+
+    while (next < worker->count) {
+        size = worker->count - next;
+        if (size > _BENCH_QUEUE_BATCH) size = _BENCH_QUEUE_BATCH;
+        for (u64 i = 0; i < size; i++) batch[i] = next + i;
+
+        if (
+            basec_spsc_queue_push_n(worker->spsc, batch, size, &pushed) !=
+            BASEC_QUEUE_SUCCESS
+        ) {
+            (void)sched_yield();
+            continue;
+        }
+        next += pushed;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Answer every element of a single producer queue on another
+ * @param arg The _BenchQueueWorker of the thread
+ * @return NULL
+ */
+static void* _bench_queue_spsc_echo(void* arg) {
+    _BenchQueueWorker* worker  = (_BenchQueueWorker*)arg;
+    u64                element = 0;
+
+    for (u64 i = 0; i < worker->count; i++) {
+        while (
+            basec_spsc_queue_pop(worker->spsc, &element) != BASEC_QUEUE_SUCCESS
+        ) (void)sched_yield();
+        while (
+            basec_spsc_queue_push(worker->reply, &element) !=
+            BASEC_QUEUE_SUCCESS
+        ) (void)sched_yield();
+    }
+    return NULL;
+}
+
+/**
+ * @brief Benchmark passing elements between producer and consumer threads
+ * @param threads The number of threads, half producing and half consuming
+ * @param lock_free Whether to use BasecMpmcQueue instead of a locked array
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_queue_threads(u64 threads, bool lock_free) {
+    BasecBenchTimer   timer                             = {0};
+    u64               elapsed_ns                        = 0;
+    BasecBenchResult  bench_result                      = BASEC_BENCH_SUCCESS;
+    _BenchQueueWorker workers[_BENCH_QUEUE_MAX_THREADS] = {0};
+    pthread_t         handles[_BENCH_QUEUE_MAX_THREADS];
+    pthread_mutex_t   lock;
+    BasecArray*       array                             = NULL;
+    BasecMpmcQueue*   mpmc                              = NULL;
+    u64               pairs                             = threads / 2;
+    u64               started                           = 0;
+    u64               sum                               = 0;
+    c8                name[64];
+
+    if (pthread_mutex_init(&lock, NULL) != 0) return BASEC_BENCH_RUN_FAILURE;
+    if (
+        basec_array_create(&array, sizeof(u64), _BENCH_QUEUE_CAPACITY) !=
+        BASEC_ARRAY_SUCCESS ||
+        basec_mpmc_queue_create(&mpmc, sizeof(u64), _BENCH_QUEUE_CAPACITY) !=
+        BASEC_QUEUE_SUCCESS
+    ) bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < threads; i++) {
+        workers[i].array = array;
+        workers[i].lock  = &lock;
+        workers[i].mpmc  = mpmc;
+        workers[i].count = _BENCH_QUEUE_ELEMENTS / pairs;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    while (bench_result == BASEC_BENCH_SUCCESS && started < threads) {
+        void* (*work)(void*) = NULL;
+
+        if (lock_free) {
+            work = started % 2 == 0 ? &_bench_queue_mpmc_producer :
+                                      &_bench_queue_mpmc_consumer;
+        } else {
+            work = started % 2 == 0 ? &_bench_queue_mutex_producer :
+                                      &_bench_queue_mutex_consumer;
+        }
+        if (pthread_create(&handles[started], NULL, work, &workers[started])) {
+            bench_result = BASEC_BENCH_RUN_FAILURE;
+        } else {
+            started++;
+        }
+    }
+    for (u64 i = 0; i < started; i++) (void)pthread_join(handles[i], NULL);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    // Every producer pushes 0 to count - 1, so the consumers' sums are known
+    for (u64 i = 0; i < threads; i++) sum += workers[i].sum;
+    if (
+        bench_result == BASEC_BENCH_SUCCESS &&
+        sum != pairs * (workers[0].count * (workers[0].count - 1) / 2)
+    ) bench_result = BASEC_BENCH_RUN_FAILURE;
+
+    if (array != NULL) (void)basec_array_destroy(&array);
+    if (mpmc != NULL) (void)basec_mpmc_queue_destroy(&mpmc);
+    (void)pthread_mutex_destroy(&lock);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    (void)snprintf(
+        name,
+        sizeof(name),
+        "%s, %lu threads",
+        lock_free ? "basec_mpmc_queue" : "mutex + basec_array",
+        (unsigned long)threads
+    );
+    return basec_bench_print(
+        name,
+        pairs * workers[0].count,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark a mutex guarded BasecArray across thread counts
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_queue_mutex(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    for (
+        u64 threads = 2;
+        bench_result == BASEC_BENCH_SUCCESS &&
+        threads <= _BENCH_QUEUE_MAX_THREADS;
+        threads *= 2
+    ) bench_result = _bench_queue_threads(threads, false);
+
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark BasecMpmcQueue across thread counts
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_queue_mpmc(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    for (
+        u64 threads = 2;
+        bench_result == BASEC_BENCH_SUCCESS &&
+        threads <= _BENCH_QUEUE_MAX_THREADS;
+        threads *= 2
+    ) bench_result = _bench_queue_threads(threads, true);
+
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark BasecSpscQueue throughput with batched pushes and pops
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_queue_spsc(void) {
+    BasecBenchTimer   timer                     = {0};
+    u64               elapsed_ns                = 0;
+    BasecBenchResult  bench_result              = BASEC_BENCH_SUCCESS;
+    _BenchQueueWorker producer                  = {0};
+    BasecSpscQueue*   queue                     = NULL;
+    pthread_t         thread;
+    u64               batch[_BENCH_QUEUE_BATCH] = {0};
+    u64               received                  = 0;
+    u64               popped                    = 0;
+    u64               sum                       = 0;
+
+    if (
+        basec_spsc_queue_create(&queue, sizeof(u64), _BENCH_QUEUE_CAPACITY) !=
+        BASEC_QUEUE_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    producer.spsc  = queue;
+    producer.count = _BENCH_QUEUE_ELEMENTS;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    if (
+        pthread_create(&thread, NULL, &_bench_queue_spsc_producer, &producer)
+        != 0
+    ) {
+        (void)basec_spsc_queue_destroy(&queue);
+        return BASEC_BENCH_RUN_FAILURE;
+    }
+    while (received < _BENCH_QUEUE_ELEMENTS) {
+        if (
+            basec_spsc_queue_pop_n(queue, batch, _BENCH_QUEUE_BATCH, &popped)
+            != BASEC_QUEUE_SUCCESS
+        ) {
+            (void)sched_yield();
+            continue;
+        }
+        for (u64 i = 0; i < popped; i++) sum += batch[i];
+        received += popped;
+    }
+    (void)pthread_join(thread, NULL);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (
+        sum != (u64)_BENCH_QUEUE_ELEMENTS * (_BENCH_QUEUE_ELEMENTS - 1) / 2
+    ) bench_result = BASEC_BENCH_RUN_FAILURE;
+    (void)basec_spsc_queue_destroy(&queue);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_spsc_queue, 64 per batch, 2 threads",
+        _BENCH_QUEUE_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark the round trip latency of two BasecSpscQueues
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_queue_spsc_latency(void) {
+    BasecBenchTimer   timer        = {0};
+    u64               elapsed_ns   = 0;
+    BasecBenchResult  bench_result = BASEC_BENCH_SUCCESS;
+    _BenchQueueWorker echo         = {0};
+    BasecSpscQueue*   requests     = NULL;
+    BasecSpscQueue*   replies      = NULL;
+    pthread_t         thread;
+    u64               element      = 0;
+    bool              started      = false;
+
+    if (
+        basec_spsc_queue_create(&requests, sizeof(u64), 1) !=
+        BASEC_QUEUE_SUCCESS ||
+        basec_spsc_queue_create(&replies, sizeof(u64), 1) !=
+        BASEC_QUEUE_SUCCESS
+    ) bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+
+    echo.spsc  = requests;
+    echo.reply = replies;
+    echo.count = _BENCH_QUEUE_ROUND_TRIPS;
+
+    if (
+        bench_result == BASEC_BENCH_SUCCESS &&
+        pthread_create(&thread, NULL, &_bench_queue_spsc_echo, &echo) != 0
+    ) bench_result = BASEC_BENCH_RUN_FAILURE;
+    started = bench_result == BASEC_BENCH_SUCCESS;
+
+    // Every round trip completes even on a mismatch, so the echo thread ends
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; started && i < _BENCH_QUEUE_ROUND_TRIPS; i++) {
+        while (
+            basec_spsc_queue_push(requests, &i) != BASEC_QUEUE_SUCCESS
+        ) (void)sched_yield();
+        while (
+            basec_spsc_queue_pop(replies, &element) != BASEC_QUEUE_SUCCESS
+        ) (void)sched_yield();
+        if (element != i) bench_result = BASEC_BENCH_RUN_FAILURE;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (started) (void)pthread_join(thread, NULL);
+    if (requests != NULL) (void)basec_spsc_queue_destroy(&requests);
+    if (replies != NULL) (void)basec_spsc_queue_destroy(&replies);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_spsc_queue round trip, 2 threads",
+        _BENCH_QUEUE_ROUND_TRIPS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Run the Queue benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_queue_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("Queue");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_queue_mutex();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_queue_mpmc();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_queue_spsc();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_queue_spsc_latency();
+    }
+
+    return bench_result;
+}
@@ -0,0 +1,563 @@
+#include "concurrency/tests/test_concurrent_array.h"
+
+#define _TEST_CONCURRENT_ARRAY_ELEMENTS 20000
+#define _TEST_CONCURRENT_ARRAY_THREADS  4
+
+/**
+ * @struct _TestConcurrentArrayWriter
+ * @brief The array a writer thread appends to and the elements it appends
+ */
+typedef struct {
+    BasecConcurrentArray* array;
+    u64                   first;
+    u64                   count;
+    bool                  batched;
+    bool                  failed;
+} _TestConcurrentArrayWriter;
+
+/**
+ * @brief Append counting elements, one at a time or in batches
+ * @param arg The _TestConcurrentArrayWriter of the thread
+ * @return NULL
+ */
+static void* _test_concurrent_array_writer(void* arg) {
+    _TestConcurrentArrayWriter* writer      = (_TestConcurrentArrayWriter*)arg;
+    u64                         elements[7] = {0};
+    u64                         next        = 0;
+    u64                         batch       = 1;
+
+    while (next < writer->count && !writer->failed) {
+        if (writer->batched) batch = 1 + next % 7;
+        if (batch > writer->count - next) batch = writer->count - next;
+        for (u64 i = 0; i < batch; i++) elements[i] = writer->first + next + i;
+
+        writer->failed = basec_concurrent_array_append_n(
+            writer->array,
+            elements,
+            batch,
+            NULL
+        ) != BASEC_CONCURRENT_ARRAY_SUCCESS;
+        next += batch;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Test the creation of concurrent arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_create(c_str fail_message) {
+    BasecConcurrentArrayResult array_result = BASEC_CONCURRENT_ARRAY_SUCCESS;
+    BasecConcurrentArray*      array        = NULL;
+
+    array_result = basec_concurrent_array_create(&array, sizeof(u64), 100);
+    if (
+        array_result != BASEC_CONCURRENT_ARRAY_SUCCESS ||
+        array->first_capacity != 128 ||
+        array->length != 0 ||
+        array->segments[0] == NULL ||
+        array->segments[1] != NULL
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Concurrent array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (array != NULL) (void)basec_concurrent_array_destroy(&array);
+        return false;
+    }
+    (void)basec_concurrent_array_destroy(&array);
+
+    array_result = basec_concurrent_array_create(&array, 0, 100);
+    if (array_result != BASEC_CONCURRENT_ARRAY_INVALID_ELEMENT_SIZE) {
+        (void)strncpy(
+            fail_message,
+            "Creating array with element size 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_concurrent_array_create(&array, sizeof(u64), 0);
+    if (array_result != BASEC_CONCURRENT_ARRAY_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Creating array with capacity 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test that appended elements keep their addresses as the array grows
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_append(c_str fail_message) {
+    BasecConcurrentArrayResult array_result = BASEC_CONCURRENT_ARRAY_SUCCESS;
+    BasecConcurrentArray*      array        = NULL;
+    u64                        batch[300]   = {0};
+    u64                        element      = 7;
+    u64                        index        = 0;
+    u64                        length       = 0;
+    void*                      first        = NULL;
+    void*                      address      = NULL;
+    bool                       stable       = true;
+
+    array_result = basec_concurrent_array_create(&array, sizeof(u64), 4);
+    if (array_result != BASEC_CONCURRENT_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Concurrent array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)basec_concurrent_array_append(array, &element, &index);
+    (void)basec_concurrent_array_at(array, 0, &first);
+    for (u64 i = 1; i < 1000; i++) {
+        (void)basec_concurrent_array_append(array, &i, &index);
+        stable = stable && index == i;
+    }
+    (void)basec_concurrent_array_at(array, 0, &address);
+    if (!stable || address != first || *(u64*)first != 7) {
+        (void)strncpy(
+            fail_message,
+            "Appending moved elements or gave the wrong index",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_concurrent_array_destroy(&array);
+        return false;
+    }
+
+    // 1000 + 300 elements run from the middle of one segment into the next
+    for (u64 i = 0; i < 300; i++) batch[i] = 1000 + i;
+    array_result = basec_concurrent_array_append_n(array, batch, 300, &index);
+    for (u64 i = 1; i < 1300; i++) {
+        array_result = basec_concurrent_array_at(array, i, &address);
+        if (array_result != BASEC_CONCURRENT_ARRAY_SUCCESS) break;
+        stable = stable && *(u64*)address == i;
+    }
+    (void)basec_concurrent_array_length(array, &length);
+    if (
+        array_result != BASEC_CONCURRENT_ARRAY_SUCCESS ||
+        !stable ||
+        index != 1000 ||
+        length != 1300
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Appending a batch across segments failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_concurrent_array_destroy(&array);
+        return false;
+    }
+
+    // Claimed indices are written through their addresses
+    array_result = basec_concurrent_array_reserve(array, 5000, &index);
+    for (u64 i = 0; i < 5000; i++) {
+        if (array_result != BASEC_CONCURRENT_ARRAY_SUCCESS) break;
+        array_result = basec_concurrent_array_at(array, index + i, &address);
+        if (array_result == BASEC_CONCURRENT_ARRAY_SUCCESS) {
+            *(u64*)address = index + i;
+        }
+    }
+    (void)basec_concurrent_array_at(array, 6299, &address);
+    if (
+        array_result != BASEC_CONCURRENT_ARRAY_SUCCESS ||
+        index != 1300 ||
+        *(u64*)address != 6299
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Writing reserved indices failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_concurrent_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_concurrent_array_at(array, 6300, &address);
+    (void)basec_concurrent_array_destroy(&array);
+    if (array_result != BASEC_CONCURRENT_ARRAY_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Getting an unclaimed index succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test appending from several threads at once
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_threads(c_str fail_message) {
+    BasecConcurrentArrayResult array_result = BASEC_CONCURRENT_ARRAY_SUCCESS;
+    BasecConcurrentArray*      array        = NULL;
+    BasecArray*                frozen       = NULL;
+    _TestConcurrentArrayWriter writers[_TEST_CONCURRENT_ARRAY_THREADS];
+    pthread_t                  threads[_TEST_CONCURRENT_ARRAY_THREADS];
+    bool*                      seen         = NULL;
+    u64                        total        = 0;
+    u64                        started      = 0;
+    u64                        element      = 0;
+    bool                       failed       = false;
+
+    total = _TEST_CONCURRENT_ARRAY_THREADS * _TEST_CONCURRENT_ARRAY_ELEMENTS;
+    array_result = basec_concurrent_array_create(&array, sizeof(u64), 1);
+    seen         = (bool*)calloc(total, sizeof(bool));
+    if (array_result != BASEC_CONCURRENT_ARRAY_SUCCESS || seen == NULL) {
+        (void)strncpy(
+            fail_message,
+            "Concurrent array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (array != NULL) (void)basec_concurrent_array_destroy(&array);
+        free(seen);
+        return false;
+    }
+
+    for (u64 i = 0; i < _TEST_CONCURRENT_ARRAY_THREADS; i++) {
+        writers[i].array   = array;
+        writers[i].first   = i * _TEST_CONCURRENT_ARRAY_ELEMENTS;
+        writers[i].count   = _TEST_CONCURRENT_ARRAY_ELEMENTS;
+        writers[i].batched = i % 2 == 1;
+        writers[i].failed  = false;
+        if (
+            pthread_create(
+                &threads[started],
+                NULL,
+                &_test_concurrent_array_writer,
+                &writers[i]
+            ) == 0
+        ) started++;
+    }
+    for (u64 i = 0; i < started; i++) {
+        (void)pthread_join(threads[i], NULL);
+        failed = failed || writers[i].failed;
+    }
+
+    if (started != _TEST_CONCURRENT_ARRAY_THREADS || failed) {
+        (void)strncpy(
+            fail_message,
+            "Failed to append from writer threads",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_concurrent_array_destroy(&array);
+        free(seen);
+        return false;
+    }
+
+    array_result = basec_concurrent_array_freeze(&array, &frozen);
+    for (u64 i = 0; frozen != NULL && i < frozen->length; i++) {
+        element = ((u64*)frozen->data)[i];
+        if (element >= total || seen[element]) failed = true;
+        else seen[element] = true;
+    }
+    if (
+        array_result != BASEC_CONCURRENT_ARRAY_SUCCESS ||
+        array != NULL ||
+        frozen->length != total ||
+        failed
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Frozen array did not hold every element once",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (array != NULL) (void)basec_concurrent_array_destroy(&array);
+        if (frozen != NULL) (void)basec_array_destroy(&frozen);
+        free(seen);
+        return false;
+    }
+    (void)basec_array_destroy(&frozen);
+    free(seen);
+
+    return true;
+}
+
+/**
+ * @brief Test turning concurrent arrays into contiguous arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_freeze(c_str fail_message) {
+    BasecConcurrentArrayResult array_result  = BASEC_CONCURRENT_ARRAY_SUCCESS;
+    BasecConcurrentArray*      array         = NULL;
+    BasecArrayResult           append_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*                frozen        = NULL;
+    void*                      first         = NULL;
+    bool                       ordered       = true;
+
+    // Everything fits in the first segment, which is handed over as is
+    (void)basec_concurrent_array_create(&array, sizeof(u64), 16);
+    for (u64 i = 0; i < 10; i++) {
+        (void)basec_concurrent_array_append(array, &i, NULL);
+    }
+    first        = array->segments[0];
+    array_result = basec_concurrent_array_freeze(&array, &frozen);
+    for (u64 i = 0; frozen != NULL && i < frozen->length; i++) {
+        ordered = ordered && ((u64*)frozen->data)[i] == i;
+    }
+    if (
+        array_result != BASEC_CONCURRENT_ARRAY_SUCCESS ||
+        array != NULL ||
+        frozen->data != first ||
+        frozen->length != 10 ||
+        frozen->capacity != 16 ||
+        !ordered
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Freezing a single segment failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (array != NULL) (void)basec_concurrent_array_destroy(&array);
+        if (frozen != NULL) (void)basec_array_destroy(&frozen);
+        return false;
+    }
+
+    // The frozen array replaces the one already in array_out
+    (void)basec_concurrent_array_create(&array, sizeof(u64), 3);
+    for (u64 i = 0; i < 1000; i++) {
+        (void)basec_concurrent_array_append(array, &i, NULL);
+    }
+    array_result = basec_concurrent_array_freeze(&array, &frozen);
+    for (u64 i = 0; i < frozen->length; i++) {
+        ordered = ordered && ((u64*)frozen->data)[i] == i;
+    }
+    if (
+        array_result != BASEC_CONCURRENT_ARRAY_SUCCESS ||
+        frozen->length != 1000 ||
+        frozen->element_size != sizeof(u64) ||
+        !ordered
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Freezing several segments did not keep the order",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (array != NULL) (void)basec_concurrent_array_destroy(&array);
+        if (frozen != NULL) (void)basec_array_destroy(&frozen);
+        return false;
+    }
+
+    // The frozen array grows like any other
+    append_result = basec_array_append(frozen, &first);
+    (void)basec_array_destroy(&frozen);
+    if (append_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Appending to a frozen array failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test the destruction of concurrent arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_concurrent_array_destroy(c_str fail_message) {
+    BasecConcurrentArrayResult array_result = BASEC_CONCURRENT_ARRAY_SUCCESS;
+    BasecConcurrentArray*      array        = NULL;
+
+    (void)basec_concurrent_array_create(&array, sizeof(u64), 2);
+    for (u64 i = 0; i < 100; i++) {
+        (void)basec_concurrent_array_append(array, &i, NULL);
+    }
+
+    array_result = basec_concurrent_array_destroy(&array);
+    if (array_result != BASEC_CONCURRENT_ARRAY_SUCCESS || array != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Concurrent array destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_concurrent_array_destroy(&array);
+    if (array_result != BASEC_CONCURRENT_ARRAY_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying a destroyed array succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add ConcurrentArray tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_concurrent_array_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result             = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test             = NULL;
+    BasecTest*       append_test             = NULL;
+    BasecTest*       threads_test            = NULL;
+    BasecTest*       freeze_test             = NULL;
+    BasecTest*       destroy_test            = NULL;
+    BasecTestModule* concurrent_array_module = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_concurrent_array_create",
+        "Test the creation of concurrent arrays",
+        &test_concurrent_array_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &append_test,
+        "test_concurrent_array_append",
+        "Test that appended elements keep their addresses as the array grows",
+        &test_concurrent_array_append
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &threads_test,
+        "test_concurrent_array_threads",
+        "Test appending from several threads at once",
+        &test_concurrent_array_threads
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &freeze_test,
+        "test_concurrent_array_freeze",
+        "Test turning concurrent arrays into contiguous arrays",
+        &test_concurrent_array_freeze
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&threads_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_concurrent_array_destroy",
+        "Test the destruction of concurrent arrays",
+        &test_concurrent_array_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&freeze_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &concurrent_array_module,
+        "ConcurrentArray"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&freeze_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(
+        concurrent_array_module,
+        create_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&freeze_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&concurrent_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        concurrent_array_module,
+        append_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&freeze_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&concurrent_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        concurrent_array_module,
+        threads_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&freeze_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&concurrent_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        concurrent_array_module,
+        freeze_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&freeze_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&concurrent_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        concurrent_array_module,
+        destroy_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&concurrent_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(
+        test_suite,
+        concurrent_array_module
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&concurrent_array_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
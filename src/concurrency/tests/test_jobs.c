@@ -0,0 +1,625 @@
+#include "concurrency/tests/test_jobs.h"
+
+#define _TEST_JOBS_COUNT 1000
+#define _TEST_JOBS_CHAIN 64
+#define _TEST_JOBS_OUTER 16
+#define _TEST_JOBS_INNER 8
+#define _TEST_JOBS_RANGE 10007
+
+/**
+ * @struct _TestJobsStep
+ * @brief A link of a chain of continuations and the count it saw
+ */
+typedef struct {
+    u64* counter;
+    u64  seen;
+} _TestJobsStep;
+
+/**
+ * @struct _TestJobsNested
+ * @brief The pool an outer job submits its inner jobs to
+ */
+typedef struct {
+    BasecJobs* jobs;
+    u64*       counter;
+} _TestJobsNested;
+
+/**
+ * @brief Increment a shared counter
+ * @param context The counter
+ */
+static void _test_jobs_increment(void* context) {
+    (void)__atomic_add_fetch((u64*)context, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Record the count seen by a link of a chain and increment it
+ * @param context The _TestJobsStep of the link
+ */
+static void _test_jobs_step(void* context) {
+    _TestJobsStep* step = (_TestJobsStep*)context;
+
+    step->seen = __atomic_fetch_add(step->counter, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Submit inner jobs and wait on all of them
+ * @param context The _TestJobsNested of the outer job
+ */
+static void _test_jobs_nested(void* context) {
+    _TestJobsNested* nested = (_TestJobsNested*)context;
+    BasecJob*        handles[_TEST_JOBS_INNER];
+
+    for (u64 i = 0; i < _TEST_JOBS_INNER; i++) {
+        basec_jobs_handle_result(
+            basec_jobs_submit(
+                nested->jobs,
+                _test_jobs_increment,
+                nested->counter,
+                &handles[i]
+            )
+        );
+    }
+    for (u64 i = 0; i < _TEST_JOBS_INNER; i++) {
+        basec_jobs_handle_result(basec_jobs_wait(nested->jobs, &handles[i]));
+    }
+}
+
+/**
+ * @brief Count a visit to every index of a chunk
+ * @param begin The first index of the chunk
+ * @param end One past the last index of the chunk
+ * @param context The visit counts
+ */
+static void _test_jobs_visit(u64 begin, u64 end, void* context) {
+    u8* visits = (u8*)context;
+
+    for (u64 i = begin; i < end; i++) visits[i]++;
+}
+
+/**
+ * @brief Add the indices of a chunk to a shared sum
+ * @param begin The first index of the chunk
+ * @param end One past the last index of the chunk
+ * @param context The sum
+ */
+static void _test_jobs_sum(u64 begin, u64 end, void* context) {
+    u64 sum = 0;
+
+    for (u64 i = begin; i < end; i++) sum += i;
+    (void)__atomic_add_fetch((u64*)context, sum, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Test the creation of pools of workers
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_create(c_str fail_message) {
+    BasecJobsResult jobs_result = BASEC_JOBS_SUCCESS;
+    BasecJobs*      jobs        = NULL;
+    BasecJobs*      shared      = NULL;
+    BasecJobs*      again       = NULL;
+    u64             count       = 0;
+
+    jobs_result = basec_jobs_create(&jobs, 2);
+    if (
+        jobs_result != BASEC_JOBS_SUCCESS ||
+        basec_jobs_worker_count(jobs, &count) != BASEC_JOBS_SUCCESS ||
+        count != 2
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Pool creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (jobs != NULL) (void)basec_jobs_destroy(&jobs);
+        return false;
+    }
+    (void)basec_jobs_destroy(&jobs);
+
+    jobs_result = basec_jobs_create(&jobs, 0);
+    if (jobs_result != BASEC_JOBS_SUCCESS || jobs->worker_count == 0) {
+        (void)strncpy(
+            fail_message,
+            "Pool creation with one worker per CPU failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (jobs != NULL) (void)basec_jobs_destroy(&jobs);
+        return false;
+    }
+    (void)basec_jobs_destroy(&jobs);
+
+    if (
+        basec_jobs_create(&jobs, BASEC_JOBS_MAX_WORKERS + 1) !=
+        BASEC_JOBS_INVALID_WORKERS ||
+        basec_jobs_create(NULL, 2) != BASEC_JOBS_NULL_POINTER
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Pool creation accepted invalid arguments",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (
+        basec_jobs_shared(&shared) != BASEC_JOBS_SUCCESS ||
+        basec_jobs_shared(&again) != BASEC_JOBS_SUCCESS ||
+        shared == NULL ||
+        shared != again
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Shared pool is not created once",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test submitting jobs and waiting on their handles
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_submit_wait(c_str fail_message) {
+    BasecJobs* jobs    = NULL;
+    BasecJob*  handles[_TEST_JOBS_COUNT];
+    u64        counter = 0;
+    u64        waited  = 0;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 2));
+
+    for (u64 i = 0; i < _TEST_JOBS_COUNT; i++) {
+        basec_jobs_handle_result(
+            basec_jobs_submit(jobs, _test_jobs_increment, &counter, &handles[i])
+        );
+    }
+    for (u64 i = 0; i < _TEST_JOBS_COUNT; i++) {
+        basec_jobs_handle_result(basec_jobs_wait(jobs, &handles[i]));
+        if (handles[i] == NULL) waited++;
+    }
+
+    if (
+        __atomic_load_n(&counter, __ATOMIC_ACQUIRE) != _TEST_JOBS_COUNT ||
+        waited != _TEST_JOBS_COUNT
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Submitted jobs did not all run before their waits returned",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        return false;
+    }
+
+    if (
+        basec_jobs_submit(jobs, NULL, &counter, NULL) !=
+        BASEC_JOBS_NULL_POINTER ||
+        basec_jobs_wait(jobs, NULL) != BASEC_JOBS_NULL_POINTER
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Job submission accepted a null pointer",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        return false;
+    }
+
+    (void)basec_jobs_destroy(&jobs);
+    return true;
+}
+
+/**
+ * @brief Test that continuations run after the jobs they follow
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_continuation(c_str fail_message) {
+    BasecJobs*   jobs    = NULL;
+    BasecJob*    handles[_TEST_JOBS_CHAIN];
+    _TestJobsStep steps[_TEST_JOBS_CHAIN];
+    BasecJob*    fan[4];
+    u64          counter = 0;
+    u64          fanned  = 0;
+    bool         ordered = true;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 2));
+
+    // Every link of the chain must see the count left by the one before it
+    for (u64 i = 0; i < _TEST_JOBS_CHAIN; i++) {
+        steps[i].counter = &counter;
+        steps[i].seen    = U64_MAX;
+        if (i == 0) {
+            basec_jobs_handle_result(
+                basec_jobs_submit(jobs, _test_jobs_step, &steps[i], &handles[i])
+            );
+            continue;
+        }
+        basec_jobs_handle_result(
+            basec_jobs_submit_after(
+                jobs,
+                handles[i - 1],
+                _test_jobs_step,
+                &steps[i],
+                &handles[i]
+            )
+        );
+    }
+
+    // Continuations of one job may all run at once
+    for (u64 i = 0; i < 4; i++) {
+        basec_jobs_handle_result(
+            basec_jobs_submit_after(
+                jobs,
+                handles[_TEST_JOBS_CHAIN - 1],
+                _test_jobs_increment,
+                &fanned,
+                &fan[i]
+            )
+        );
+    }
+
+    for (u64 i = 0; i < 4; i++) {
+        basec_jobs_handle_result(basec_jobs_wait(jobs, &fan[i]));
+    }
+    for (u64 i = 0; i < _TEST_JOBS_CHAIN; i++) {
+        basec_jobs_handle_result(basec_jobs_wait(jobs, &handles[i]));
+        if (steps[i].seen != i) ordered = false;
+    }
+
+    if (!ordered || __atomic_load_n(&fanned, __ATOMIC_ACQUIRE) != 4) {
+        (void)strncpy(
+            fail_message,
+            "Continuations did not run after the jobs they follow",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        return false;
+    }
+
+    (void)basec_jobs_destroy(&jobs);
+    return true;
+}
+
+/**
+ * @brief Test jobs that submit and wait on jobs of their own
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_nested(c_str fail_message) {
+    BasecJobs*     jobs    = NULL;
+    BasecJob*      handles[_TEST_JOBS_OUTER];
+    _TestJobsNested nested  = {0};
+    u64            counter = 0;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 2));
+    nested.jobs    = jobs;
+    nested.counter = &counter;
+
+    // More outer jobs than workers all block in waits unless waits help
+    for (u64 i = 0; i < _TEST_JOBS_OUTER; i++) {
+        basec_jobs_handle_result(
+            basec_jobs_submit(jobs, _test_jobs_nested, &nested, &handles[i])
+        );
+    }
+    for (u64 i = 0; i < _TEST_JOBS_OUTER; i++) {
+        basec_jobs_handle_result(basec_jobs_wait(jobs, &handles[i]));
+    }
+
+    if (
+        __atomic_load_n(&counter, __ATOMIC_ACQUIRE) !=
+        _TEST_JOBS_OUTER * _TEST_JOBS_INNER
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Nested jobs did not all run",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        return false;
+    }
+
+    (void)basec_jobs_destroy(&jobs);
+    return true;
+}
+
+/**
+ * @brief Test running a function over a range of indices in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_parallel_for(c_str fail_message) {
+    BasecJobs*     jobs   = NULL;
+    u8*            visits = (u8*)calloc(_TEST_JOBS_RANGE, sizeof(u8));
+    BasecJobsRange range  = { 3, _TEST_JOBS_RANGE - 5 };
+    BasecJobsRange all    = { 0, _TEST_JOBS_RANGE };
+    u64            sum    = 0;
+    bool           once   = true;
+
+    if (visits == NULL) {
+        (void)strncpy(
+            fail_message,
+            "Visit counts allocation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 4));
+    basec_jobs_handle_result(
+        basec_jobs_parallel_for(jobs, range, 7, _test_jobs_visit, visits)
+    );
+
+    for (u64 i = 0; i < _TEST_JOBS_RANGE; i++) {
+        if (visits[i] != (i >= range.begin && i < range.end ? 1 : 0)) {
+            once = false;
+        }
+    }
+    if (!once) {
+        (void)strncpy(
+            fail_message,
+            "Parallel loop did not visit every index once",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        free(visits);
+        return false;
+    }
+
+    if (
+        basec_jobs_parallel_for(jobs, range, 0, _test_jobs_visit, visits) !=
+        BASEC_JOBS_INVALID_GRAIN ||
+        basec_jobs_parallel_for(
+            jobs,
+            (BasecJobsRange){ 5, 4 },
+            7,
+            _test_jobs_visit,
+            visits
+        ) != BASEC_JOBS_INVALID_RANGE ||
+        basec_jobs_parallel_for(
+            jobs,
+            (BasecJobsRange){ 4, 4 },
+            7,
+            _test_jobs_visit,
+            visits
+        ) != BASEC_JOBS_SUCCESS
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Parallel loop accepted an invalid grain or range",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        free(visits);
+        return false;
+    }
+    (void)basec_jobs_destroy(&jobs);
+    free(visits);
+
+    basec_jobs_handle_result(basec_parallel_for(all, 64, _test_jobs_sum, &sum));
+    if (sum != (u64)_TEST_JOBS_RANGE * (_TEST_JOBS_RANGE - 1) / 2) {
+        (void)strncpy(
+            fail_message,
+            "Parallel loop on the shared pool computed the wrong sum",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test that destroying a pool runs every submitted job
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_jobs_destroy(c_str fail_message) {
+    BasecJobsResult jobs_result = BASEC_JOBS_SUCCESS;
+    BasecJobs*      jobs        = NULL;
+    u64             counter     = 0;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 2));
+    for (u64 i = 0; i < _TEST_JOBS_COUNT; i++) {
+        basec_jobs_handle_result(
+            basec_jobs_submit(jobs, _test_jobs_increment, &counter, NULL)
+        );
+    }
+
+    jobs_result = basec_jobs_destroy(&jobs);
+    if (
+        jobs_result != BASEC_JOBS_SUCCESS ||
+        jobs != NULL ||
+        __atomic_load_n(&counter, __ATOMIC_ACQUIRE) != _TEST_JOBS_COUNT
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Pool destruction did not run every submitted job",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (basec_jobs_destroy(&jobs) != BASEC_JOBS_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Pool destruction accepted a null pool",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add Jobs tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_jobs_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result       = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test       = NULL;
+    BasecTest*       submit_wait_test  = NULL;
+    BasecTest*       continuation_test = NULL;
+    BasecTest*       nested_test       = NULL;
+    BasecTest*       parallel_for_test = NULL;
+    BasecTest*       destroy_test      = NULL;
+    BasecTestModule* test_jobs         = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_jobs_create",
+        "Test the creation of pools of workers",
+        &test_jobs_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &submit_wait_test,
+        "test_jobs_submit_wait",
+        "Test submitting jobs and waiting on their handles",
+        &test_jobs_submit_wait
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &continuation_test,
+        "test_jobs_continuation",
+        "Test that continuations run after the jobs they follow",
+        &test_jobs_continuation
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&submit_wait_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &nested_test,
+        "test_jobs_nested",
+        "Test jobs that submit and wait on jobs of their own",
+        &test_jobs_nested
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&submit_wait_test);
+        (void)basec_test_destroy(&continuation_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &parallel_for_test,
+        "test_jobs_parallel_for",
+        "Test running a function over a range of indices in parallel",
+        &test_jobs_parallel_for
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&submit_wait_test);
+        (void)basec_test_destroy(&continuation_test);
+        (void)basec_test_destroy(&nested_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_jobs_destroy",
+        "Test that destroying a pool runs every submitted job",
+        &test_jobs_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&submit_wait_test);
+        (void)basec_test_destroy(&continuation_test);
+        (void)basec_test_destroy(&nested_test);
+        (void)basec_test_destroy(&parallel_for_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &test_jobs,
+        "Jobs"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&submit_wait_test);
+        (void)basec_test_destroy(&continuation_test);
+        (void)basec_test_destroy(&nested_test);
+        (void)basec_test_destroy(&parallel_for_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(test_jobs, create_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&submit_wait_test);
+        (void)basec_test_destroy(&continuation_test);
+        (void)basec_test_destroy(&nested_test);
+        (void)basec_test_destroy(&parallel_for_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&test_jobs);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(test_jobs, submit_wait_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&submit_wait_test);
+        (void)basec_test_destroy(&continuation_test);
+        (void)basec_test_destroy(&nested_test);
+        (void)basec_test_destroy(&parallel_for_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&test_jobs);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(test_jobs, continuation_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&continuation_test);
+        (void)basec_test_destroy(&nested_test);
+        (void)basec_test_destroy(&parallel_for_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&test_jobs);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(test_jobs, nested_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&nested_test);
+        (void)basec_test_destroy(&parallel_for_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&test_jobs);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(test_jobs, parallel_for_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&parallel_for_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&test_jobs);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(test_jobs, destroy_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&test_jobs);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, test_jobs);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&test_jobs);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,683 @@
+#include "concurrency/tests/test_queue.h"
+
+#define _TEST_QUEUE_ELEMENTS 20000
+
+/**
+ * @struct _TestQueueProducer
+ * @brief The queue a producer thread pushes to and the elements it pushes
+ */
+typedef struct {
+    BasecSpscQueue* spsc;
+    BasecMpmcQueue* mpmc;
+    u64             first;
+    u64             count;
+} _TestQueueProducer;
+
+/**
+ * @struct _TestQueueConsumer
+ * @brief The queue a consumer thread pops from and what it received
+ */
+typedef struct {
+    BasecMpmcQueue* queue;
+    u64*            popped;
+    u64             total;
+    u64             sum;
+    u64             count;
+    u64             last[2];
+    bool            ordered;
+} _TestQueueConsumer;
+
+/**
+ * @brief Push counting elements to a single producer queue in batches
+ * @param arg The _TestQueueProducer of the thread
+ * @return NULL
+ */
+static void* _test_queue_spsc_producer(void* arg) {
+    _TestQueueProducer* producer    = (_TestQueueProducer*)arg;
+    u64                 elements[5] = {0};
+    u64                 next        = 0;
+    u64                 pushed      = 0;
+    u64                 batch       = 0;
+
+    // Batches of 1 to 5 elements keep crossing the end of the ring
+    while (next < producer->count) {
+        batch = 1 + next % 5;
+        if (batch > producer->count - next) batch = producer->count - next;
+        for (u64 i = 0; i < batch; i++) elements[i] = next + i;
+
+        if (
+            basec_spsc_queue_push_n(producer->spsc, elements, batch, &pushed)
+            != BASEC_QUEUE_SUCCESS
+        ) {
+            (void)sched_yield();
+            continue;
+        }
+        next += pushed;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Push counting elements to a multi producer queue
+ * @param arg The _TestQueueProducer of the thread
+ * @return NULL
+ */
+static void* _test_queue_mpmc_producer(void* arg) {
+    _TestQueueProducer* producer = (_TestQueueProducer*)arg;
+    u64                 element  = 0;
+
+    for (u64 i = 0; i < producer->count; i++) {
+        element = producer->first + i;
+        while (
+            basec_mpmc_queue_push(producer->mpmc, &element) !=
+            BASEC_QUEUE_SUCCESS
+        ) (void)sched_yield();
+    }
+    return NULL;
+}
+
+/**
+ * @brief Pop elements from a multi producer queue until all are received
+ *
+ * Elements of one producer are pushed in increasing order, so every
+ * consumer must also see them in increasing order.
+ *
+ * @param arg The _TestQueueConsumer of the thread
+ * @return NULL
+ */
+static void* _test_queue_mpmc_consumer(void* arg) {
+    _TestQueueConsumer* consumer = (_TestQueueConsumer*)arg;
+    u64                 element  = 0;
+    u64                 producer = 0;
+
+    consumer->ordered = true;
+    while (
+        __atomic_load_n(consumer->popped, __ATOMIC_RELAXED) < consumer->total
+    ) {
+        if (
+            basec_mpmc_queue_pop(consumer->queue, &element) !=
+            BASEC_QUEUE_SUCCESS
+        ) {
+            (void)sched_yield();
+            continue;
+        }
+        (void)__atomic_add_fetch(consumer->popped, 1, __ATOMIC_RELAXED);
+
+        producer = element / _TEST_QUEUE_ELEMENTS;
+        if (consumer->last[producer] > element) consumer->ordered = false;
+        consumer->last[producer] = element + 1;
+        consumer->sum           += element;
+        consumer->count++;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Test the creation of the queues
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_create(c_str fail_message) {
+    BasecQueueResult queue_result = BASEC_QUEUE_SUCCESS;
+    BasecSpscQueue*  spsc         = NULL;
+    BasecMpmcQueue*  mpmc         = NULL;
+
+    queue_result = basec_spsc_queue_create(&spsc, sizeof(u64), 100);
+    if (queue_result != BASEC_QUEUE_SUCCESS || spsc->capacity != 128) {
+        (void)strncpy(
+            fail_message,
+            "SPSC queue creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (spsc != NULL) (void)basec_spsc_queue_destroy(&spsc);
+        return false;
+    }
+    (void)basec_spsc_queue_destroy(&spsc);
+
+    queue_result = basec_mpmc_queue_create(&mpmc, 12, 1);
+    if (
+        queue_result != BASEC_QUEUE_SUCCESS ||
+        mpmc->capacity != 2 ||
+        mpmc->slot_size != 24
+    ) {
+        (void)strncpy(
+            fail_message,
+            "MPMC queue creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (mpmc != NULL) (void)basec_mpmc_queue_destroy(&mpmc);
+        return false;
+    }
+    (void)basec_mpmc_queue_destroy(&mpmc);
+
+    queue_result = basec_spsc_queue_create(&spsc, 0, 100);
+    if (queue_result != BASEC_QUEUE_INVALID_ELEMENT_SIZE) {
+        (void)strncpy(
+            fail_message,
+            "Creating queue with element size 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    queue_result = basec_mpmc_queue_create(&mpmc, sizeof(u64), 0);
+    if (queue_result != BASEC_QUEUE_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Creating queue with capacity 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test pushing and popping a single producer queue on one thread
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_spsc_push_pop(c_str fail_message) {
+    BasecQueueResult queue_result = BASEC_QUEUE_SUCCESS;
+    BasecSpscQueue*  queue        = NULL;
+    u64              elements[6]  = {0};
+    u64              element      = 0;
+    u64              count        = 0;
+
+    queue_result = basec_spsc_queue_create(&queue, sizeof(u64), 8);
+    if (queue_result != BASEC_QUEUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "SPSC queue creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 8; i++) (void)basec_spsc_queue_push(queue, &i);
+    queue_result = basec_spsc_queue_push(queue, &element);
+    if (queue_result != BASEC_QUEUE_FULL) {
+        (void)strncpy(
+            fail_message,
+            "Pushing to a full queue succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_spsc_queue_destroy(&queue);
+        return false;
+    }
+
+    // Freeing 5 slots lets a batch of 6 push only 5, wrapping the ring
+    (void)basec_spsc_queue_pop_n(queue, elements, 5, &count);
+    for (u64 i = 0; i < 6; i++) elements[i] = 8 + i;
+    queue_result = basec_spsc_queue_push_n(queue, elements, 6, &count);
+    if (queue_result != BASEC_QUEUE_SUCCESS || count != 5) {
+        (void)strncpy(
+            fail_message,
+            "Batch push did not fill the free slots",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_spsc_queue_destroy(&queue);
+        return false;
+    }
+
+    for (u64 i = 5; i < 13; i++) {
+        queue_result = basec_spsc_queue_pop(queue, &element);
+        if (queue_result != BASEC_QUEUE_SUCCESS || element != i) {
+            (void)strncpy(
+                fail_message,
+                "Popped elements are not in push order",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_spsc_queue_destroy(&queue);
+            return false;
+        }
+    }
+
+    queue_result = basec_spsc_queue_pop_n(queue, elements, 6, &count);
+    if (queue_result != BASEC_QUEUE_EMPTY || count != 0) {
+        (void)strncpy(
+            fail_message,
+            "Popping from an empty queue succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_spsc_queue_destroy(&queue);
+        return false;
+    }
+
+    (void)basec_spsc_queue_destroy(&queue);
+    return true;
+}
+
+/**
+ * @brief Test passing elements from a producer thread to a consumer thread
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_spsc_threads(c_str fail_message) {
+    BasecQueueResult   queue_result = BASEC_QUEUE_SUCCESS;
+    BasecSpscQueue*    queue        = NULL;
+    _TestQueueProducer producer     = {0};
+    pthread_t          thread;
+    u64                elements[7]  = {0};
+    u64                count        = 0;
+    u64                expected     = 0;
+    bool               ordered      = true;
+
+    queue_result = basec_spsc_queue_create(&queue, sizeof(u64), 16);
+    if (queue_result != BASEC_QUEUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "SPSC queue creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    producer.spsc  = queue;
+    producer.count = _TEST_QUEUE_ELEMENTS;
+    if (
+        pthread_create(&thread, NULL, &_test_queue_spsc_producer, &producer)
+        != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Failed to start producer thread",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_spsc_queue_destroy(&queue);
+        return false;
+    }
+
+    while (expected < _TEST_QUEUE_ELEMENTS) {
+        if (
+            basec_spsc_queue_pop_n(queue, elements, 7, &count) !=
+            BASEC_QUEUE_SUCCESS
+        ) {
+            (void)sched_yield();
+            continue;
+        }
+        for (u64 i = 0; i < count; i++) {
+            if (elements[i] != expected++) ordered = false;
+        }
+    }
+    (void)pthread_join(thread, NULL);
+    (void)basec_spsc_queue_destroy(&queue);
+
+    if (!ordered) {
+        (void)strncpy(
+            fail_message,
+            "Consumer did not receive elements in push order",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test pushing and popping a multi producer queue on one thread
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_mpmc_push_pop(c_str fail_message) {
+    BasecQueueResult queue_result = BASEC_QUEUE_SUCCESS;
+    BasecMpmcQueue*  queue        = NULL;
+    u64              element      = 0;
+
+    queue_result = basec_mpmc_queue_create(&queue, sizeof(u64), 4);
+    if (queue_result != BASEC_QUEUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "MPMC queue creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // Several laps around the ring reuse every slot's sequence
+    for (u64 lap = 0; lap < 3; lap++) {
+        for (u64 i = 0; i < 4; i++) {
+            element = lap * 4 + i;
+            (void)basec_mpmc_queue_push(queue, &element);
+        }
+        queue_result = basec_mpmc_queue_push(queue, &element);
+        if (queue_result != BASEC_QUEUE_FULL) {
+            (void)strncpy(
+                fail_message,
+                "Pushing to a full queue succeeded, but should fail",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_mpmc_queue_destroy(&queue);
+            return false;
+        }
+
+        for (u64 i = 0; i < 4; i++) {
+            queue_result = basec_mpmc_queue_pop(queue, &element);
+            if (queue_result != BASEC_QUEUE_SUCCESS || element != lap * 4 + i) {
+                (void)strncpy(
+                    fail_message,
+                    "Popped elements are not in push order",
+                    BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+                );
+                (void)basec_mpmc_queue_destroy(&queue);
+                return false;
+            }
+        }
+        queue_result = basec_mpmc_queue_pop(queue, &element);
+        if (queue_result != BASEC_QUEUE_EMPTY) {
+            (void)strncpy(
+                fail_message,
+                "Popping from an empty queue succeeded, but should fail",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_mpmc_queue_destroy(&queue);
+            return false;
+        }
+    }
+
+    (void)basec_mpmc_queue_destroy(&queue);
+    return true;
+}
+
+/**
+ * @brief Test passing elements between several producers and consumers
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_mpmc_threads(c_str fail_message) {
+    BasecQueueResult   queue_result = BASEC_QUEUE_SUCCESS;
+    BasecMpmcQueue*    queue        = NULL;
+    _TestQueueProducer producers[2] = {0};
+    _TestQueueConsumer consumers[2] = {0};
+    pthread_t          threads[4];
+    u64                started      = 0;
+    u64                popped       = 0;
+    u64                sum          = 0;
+    u64                count        = 0;
+    bool               ordered      = true;
+
+    queue_result = basec_mpmc_queue_create(&queue, sizeof(u64), 16);
+    if (queue_result != BASEC_QUEUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "MPMC queue creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 2; i++) {
+        producers[i].mpmc   = queue;
+        producers[i].first  = i * _TEST_QUEUE_ELEMENTS;
+        producers[i].count  = _TEST_QUEUE_ELEMENTS;
+        consumers[i].queue  = queue;
+        consumers[i].popped = &popped;
+        consumers[i].total  = 2 * _TEST_QUEUE_ELEMENTS;
+    }
+    for (u64 i = 0; i < 2; i++) {
+        if (
+            pthread_create(
+                &threads[started],
+                NULL,
+                &_test_queue_mpmc_producer,
+                &producers[i]
+            ) == 0
+        ) started++;
+        if (
+            pthread_create(
+                &threads[started],
+                NULL,
+                &_test_queue_mpmc_consumer,
+                &consumers[i]
+            ) == 0
+        ) started++;
+    }
+    for (u64 i = 0; i < started; i++) (void)pthread_join(threads[i], NULL);
+    (void)basec_mpmc_queue_destroy(&queue);
+
+    if (started != 4) {
+        (void)strncpy(
+            fail_message,
+            "Failed to start producer and consumer threads",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 2; i++) {
+        sum     += consumers[i].sum;
+        count   += consumers[i].count;
+        ordered  = ordered && consumers[i].ordered;
+    }
+    if (
+        count != 2 * _TEST_QUEUE_ELEMENTS ||
+        sum != _TEST_QUEUE_ELEMENTS * (2 * _TEST_QUEUE_ELEMENTS - 1) ||
+        !ordered
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Consumers did not receive every element once, in order",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test the destruction of the queues
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_queue_destroy(c_str fail_message) {
+    BasecQueueResult queue_result = BASEC_QUEUE_SUCCESS;
+    BasecSpscQueue*  spsc         = NULL;
+    BasecMpmcQueue*  mpmc         = NULL;
+
+    (void)basec_spsc_queue_create(&spsc, sizeof(u64), 8);
+    (void)basec_mpmc_queue_create(&mpmc, sizeof(u64), 8);
+
+    queue_result = basec_spsc_queue_destroy(&spsc);
+    if (queue_result != BASEC_QUEUE_SUCCESS || spsc != NULL) {
+        (void)strncpy(
+            fail_message,
+            "SPSC queue destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (mpmc != NULL) (void)basec_mpmc_queue_destroy(&mpmc);
+        return false;
+    }
+
+    queue_result = basec_mpmc_queue_destroy(&mpmc);
+    if (queue_result != BASEC_QUEUE_SUCCESS || mpmc != NULL) {
+        (void)strncpy(
+            fail_message,
+            "MPMC queue destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    queue_result = basec_mpmc_queue_destroy(&mpmc);
+    if (queue_result != BASEC_QUEUE_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying a destroyed queue succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add Queue tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_queue_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result        = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test        = NULL;
+    BasecTest*       spsc_push_pop_test = NULL;
+    BasecTest*       spsc_threads_test  = NULL;
+    BasecTest*       mpmc_push_pop_test = NULL;
+    BasecTest*       mpmc_threads_test  = NULL;
+    BasecTest*       destroy_test       = NULL;
+    BasecTestModule* queue_module       = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_queue_create",
+        "Test the creation of the queues",
+        &test_queue_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &spsc_push_pop_test,
+        "test_queue_spsc_push_pop",
+        "Test pushing and popping a single producer queue on one thread",
+        &test_queue_spsc_push_pop
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &spsc_threads_test,
+        "test_queue_spsc_threads",
+        "Test passing elements from a producer thread to a consumer thread",
+        &test_queue_spsc_threads
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&spsc_push_pop_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &mpmc_push_pop_test,
+        "test_queue_mpmc_push_pop",
+        "Test pushing and popping a multi producer queue on one thread",
+        &test_queue_mpmc_push_pop
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&spsc_push_pop_test);
+        (void)basec_test_destroy(&spsc_threads_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &mpmc_threads_test,
+        "test_queue_mpmc_threads",
+        "Test passing elements between several producers and consumers",
+        &test_queue_mpmc_threads
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&spsc_push_pop_test);
+        (void)basec_test_destroy(&spsc_threads_test);
+        (void)basec_test_destroy(&mpmc_push_pop_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_queue_destroy",
+        "Test the destruction of the queues",
+        &test_queue_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&spsc_push_pop_test);
+        (void)basec_test_destroy(&spsc_threads_test);
+        (void)basec_test_destroy(&mpmc_push_pop_test);
+        (void)basec_test_destroy(&mpmc_threads_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &queue_module,
+        "Queue"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&spsc_push_pop_test);
+        (void)basec_test_destroy(&spsc_threads_test);
+        (void)basec_test_destroy(&mpmc_push_pop_test);
+        (void)basec_test_destroy(&mpmc_threads_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(queue_module, create_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&spsc_push_pop_test);
+        (void)basec_test_destroy(&spsc_threads_test);
+        (void)basec_test_destroy(&mpmc_push_pop_test);
+        (void)basec_test_destroy(&mpmc_threads_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&queue_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(queue_module, spsc_push_pop_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&spsc_push_pop_test);
+        (void)basec_test_destroy(&spsc_threads_test);
+        (void)basec_test_destroy(&mpmc_push_pop_test);
+        (void)basec_test_destroy(&mpmc_threads_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&queue_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(queue_module, spsc_threads_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&spsc_threads_test);
+        (void)basec_test_destroy(&mpmc_push_pop_test);
+        (void)basec_test_destroy(&mpmc_threads_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&queue_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(queue_module, mpmc_push_pop_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&mpmc_push_pop_test);
+        (void)basec_test_destroy(&mpmc_threads_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&queue_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(queue_module, mpmc_threads_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&mpmc_threads_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&queue_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(queue_module, destroy_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&queue_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, queue_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&queue_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
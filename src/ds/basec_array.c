@@ -1,6 +1,15 @@
 #include "ds/basec_array.h"
 
-static const u8 _GROWTH_FACTOR = 2;
+static const u8  _GROWTH_FACTOR         = 2;
+static const u64 _INDEX_EMPTY           = U64_MAX;
+static const u64 _INDEX_MIN_CAPACITY    = 16;
+static const i64 _SELECT_MIN_LENGTH     = 16;
+static const u64 _CACHE_LINE            = 64;
+static const u64 _PAR_MIN_BYTES         = 65536;
+static const u64 _PAR_MIN_CHUNK_BYTES   = 16384;
+static const u64 _PAR_CHUNKS_PER_WORKER = 4;
+static const u64 _RADIX_BITS            = 8;
+static const u64 _RADIX_BUCKETS         = 256;
 
 /**
  * @brief Grow the array
@@ -10,13 +19,925 @@ static const u8 _GROWTH_FACTOR = 2;
 static BasecArrayResult _basec_array_grow(BasecArray* array) {
     if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
 
-    array->capacity *= _GROWTH_FACTOR;
-    array->data = realloc(array->data, array->capacity * array->element_size);
-    if (array->data == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+    u64 capacity = array->capacity * _GROWTH_FACTOR;
 
+    if (
+        basec_memory_resize_aligned(
+            &array->data,
+            array->capacity * array->element_size,
+            capacity * array->element_size,
+            array->alignment,
+            &array->mapped
+        ) != BASEC_MEMORY_SUCCESS
+    ) return BASEC_ARRAY_ALLOCATION_FAILURE;
+
+    // Data that just moved into a mapping takes the advice with it
+    if (array->huge_pages && array->mapped) {
+        (void)basec_memory_advise_huge_pages(
+            array->data,
+            capacity * array->element_size
+        );
+    }
+
+    array->capacity = capacity;
+    return BASEC_ARRAY_SUCCESS;
+}
+
+
+/**
+ * @struct _BasecArrayIndexEntry
+ * @brief The position of an element and the hash of its bytes
+ */
+typedef struct {
+    u64 hash;
+    u64 position;
+} _BasecArrayIndexEntry;
+
+/**
+ * @struct BasecArrayIndex
+ * @brief A linear probing table with an entry per element of the array
+ *
+ * Repeated elements have one entry each. Entries are kept at most half full
+ * and removed by shifting later entries back, so every entry for a hash
+ * lies between its home slot and the next empty slot.
+ */
+struct BasecArrayIndex {
+    _BasecArrayIndexEntry* entries;
+    u64                    capacity;
+    u64                    length;
+    u64                    seed;
+};
+
+/**
+ * @brief Get an element of the array
+ * @param array The array
+ * @param position The index of the element
+ * @return The element
+ */
+static void* _basec_array_element(BasecArray* array, u64 position) {
+    return (void*)((u64)array->data + position * array->element_size);
+}
+
+/**
+ * @brief Hash an element with the seed of the array's index
+ * @param array The indexed array
+ * @param element The element to hash
+ * @return The hash of the element's bytes
+ */
+static u64 _basec_array_index_hash(BasecArray* array, const void* element) {
+    u64 hash = 0;
+
+    (void)basec_hash_bytes_seeded(
+        element,
+        array->element_size,
+        array->index->seed,
+        &hash
+    );
+    return hash;
+}
+
+/**
+ * @brief Add an entry to an index that has room for it
+ * @param index The index
+ * @param hash The hash of the element
+ * @param position The index of the element in the array
+ */
+static void _basec_array_index_place(
+    BasecArrayIndex* index,
+    u64              hash,
+    u64              position
+) {
+    u64 mask = index->capacity - 1;
+    u64 slot = hash & mask;
+
+    while (index->entries[slot].position != _INDEX_EMPTY) {
+        slot = (slot + 1) & mask;
+    }
+    index->entries[slot].hash     = hash;
+    index->entries[slot].position = position;
+    index->length++;
+}
+
+/**
+ * @brief Move the entries of an index into a table of another size
+ * @param index The index
+ * @param capacity The number of slots of the new table, a power of two
+ * @return The result of the operation
+ */
+static BasecArrayResult _basec_array_index_resize(
+    BasecArrayIndex* index,
+    u64              capacity
+) {
+    _BasecArrayIndexEntry* old_entries  = index->entries;
+    u64                    old_capacity = index->capacity;
+    _BasecArrayIndexEntry* entries      = NULL;
+
+    entries = (_BasecArrayIndexEntry*)malloc(
+        capacity * sizeof(_BasecArrayIndexEntry)
+    );
+    if (entries == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+    for (u64 i = 0; i < capacity; i++) entries[i].position = _INDEX_EMPTY;
+
+    index->entries  = entries;
+    index->capacity = capacity;
+    index->length   = 0;
+    for (u64 i = 0; i < old_capacity; i++) {
+        if (old_entries[i].position == _INDEX_EMPTY) continue;
+        _basec_array_index_place(
+            index,
+            old_entries[i].hash,
+            old_entries[i].position
+        );
+    }
+
+    free(old_entries);
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Add the entry of an element to the array's index
+ * @param array The indexed array
+ * @param position The index of the element
+ * @return The result of the operation
+ */
+static BasecArrayResult _basec_array_index_insert(
+    BasecArray* array,
+    u64         position
+) {
+    BasecArrayIndex* index  = array->index;
+    BasecArrayResult result = BASEC_ARRAY_SUCCESS;
+
+    if ((index->length + 1) * 2 > index->capacity) {
+        result = _basec_array_index_resize(
+            index,
+            index->capacity * _GROWTH_FACTOR
+        );
+        if (result != BASEC_ARRAY_SUCCESS) return result;
+    }
+
+    _basec_array_index_place(
+        index,
+        _basec_array_index_hash(array, _basec_array_element(array, position)),
+        position
+    );
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Remove the entry of an element from the array's index
+ *
+ * The element must still be in the array, its bytes find the entry.
+ *
+ * @param array The indexed array
+ * @param position The index of the element
+ */
+static void _basec_array_index_remove(BasecArray* array, u64 position) {
+    BasecArrayIndex* index = array->index;
+    u64              mask  = index->capacity - 1;
+    u64              slot  = 0;
+    u64              next  = 0;
+    u64              home  = 0;
+
+    slot = _basec_array_index_hash(
+        array,
+        _basec_array_element(array, position)
+    ) & mask;
+    while (index->entries[slot].position != position) {
+        slot = (slot + 1) & mask;
+    }
+
+    // Shift back every later entry of the run that may sit at the hole
+    next = (slot + 1) & mask;
+    while (index->entries[next].position != _INDEX_EMPTY) {
+        home = index->entries[next].hash & mask;
+        if (((next - home) & mask) >= ((next - slot) & mask)) {
+            index->entries[slot] = index->entries[next];
+            slot                 = next;
+        }
+        next = (next + 1) & mask;
+    }
+    index->entries[slot].position = _INDEX_EMPTY;
+    index->length--;
+}
+
+/**
+ * @brief Compare two positions
+ * @param a The first position
+ * @param b The second position
+ * @return Negative if a is smaller, positive if b is, 0 if equal
+ */
+static i32 _basec_array_compare_positions(const void* a, const void* b) {
+    u64 left  = *(const u64*)a;
+    u64 right = *(const u64*)b;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Look an element up in the array's index
+ * @param array The indexed array
+ * @param element The element to find
+ * @param first_out The smallest index of the element, U64_MAX if absent
+ * @param all_out The array to append every index of the element to, may be
+ *                NULL
+ * @return The result of the operation
+ */
+static BasecArrayResult _basec_array_index_find(
+    BasecArray* array,
+    const void* element,
+    u64*        first_out,
+    BasecArray* all_out
+) {
+    BasecArrayIndex*       index  = array->index;
+    _BasecArrayIndexEntry* entry  = NULL;
+    BasecArrayResult       result = BASEC_ARRAY_SUCCESS;
+    u64                    mask   = index->capacity - 1;
+    u64                    hash   = _basec_array_index_hash(array, element);
+    u64                    slot   = hash & mask;
+
+    *first_out = U64_MAX;
+    while (index->entries[slot].position != _INDEX_EMPTY) {
+        entry = &index->entries[slot];
+        slot  = (slot + 1) & mask;
+        if (
+            entry->hash != hash ||
+            memcmp(
+                _basec_array_element(array, entry->position),
+                element,
+                array->element_size
+            ) != 0
+        ) continue;
+
+        if (entry->position < *first_out) *first_out = entry->position;
+        if (all_out != NULL) {
+            result = basec_array_append(all_out, &entry->position);
+            if (result != BASEC_ARRAY_SUCCESS) return result;
+        }
+    }
+
+    if (all_out != NULL && all_out->length > 1) {
+        qsort(
+            all_out->data,
+            all_out->length,
+            sizeof(u64),
+            &_basec_array_compare_positions
+        );
+    }
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Swap two elements of the array
+ * @param array The array
+ * @param a The index of the first element
+ * @param b The index of the second element
+ * @param scratch A buffer of the array's element size
+ */
+static void _basec_array_swap(BasecArray* array, i64 a, i64 b, void* scratch) {
+    u64 size = array->element_size;
+
+    (void)memcpy(scratch, _basec_array_element(array, (u64)a), size);
+    (void)memcpy(
+        _basec_array_element(array, (u64)a),
+        _basec_array_element(array, (u64)b),
+        size
+    );
+    (void)memcpy(_basec_array_element(array, (u64)b), scratch, size);
+}
+
+/**
+ * @brief Order two elements of the array, swapping them if needed
+ * @param array The array
+ * @param a The index of the element to order first
+ * @param b The index of the element to order second
+ * @param compare The comparator ordering the elements
+ * @param scratch A buffer of the array's element size
+ */
+static void _basec_array_order(
+    BasecArray*       array,
+    i64               a,
+    i64               b,
+    BasecArrayCompare compare,
+    void*             scratch
+) {
+    if (
+        compare(
+            _basec_array_element(array, (u64)b),
+            _basec_array_element(array, (u64)a)
+        ) < 0
+    ) _basec_array_swap(array, a, b, scratch);
+}
+
+/**
+ * @brief Place the nth element of a range of the array
+ *
+ * Partitions around the median of the first, middle and last elements and
+ * keeps only the side holding n, until the range is short enough to
+ * insertion sort.
+ *
+ * @param array The array
+ * @param low The index of the first element of the range
+ * @param high The index of the last element of the range
+ * @param n The index of the element to place
+ * @param compare The comparator ordering the elements
+ * @param scratch A buffer of twice the array's element size
+ */
+static void _basec_array_select(
+    BasecArray*       array,
+    i64               low,
+    i64               high,
+    i64               n,
+    BasecArrayCompare compare,
+    void*             scratch
+) {
+    u64 size  = array->element_size;
+    u8* pivot = (u8*)scratch + size;
+    i64 i     = 0;
+    i64 j     = 0;
+
+    while (high - low >= _SELECT_MIN_LENGTH) {
+        i = low + (high - low) / 2;
+        _basec_array_order(array, low, i, compare, scratch);
+        _basec_array_order(array, i, high, compare, scratch);
+        _basec_array_order(array, low, i, compare, scratch);
+        (void)memcpy(pivot, _basec_array_element(array, (u64)i), size);
+
+        // The median sits between the ends, so neither scan leaves the range
+        i = low - 1;
+        j = high + 1;
+        for (;;) {
+            do i++; while (
+                compare(_basec_array_element(array, (u64)i), pivot) < 0
+            );
+            do j--; while (
+                compare(_basec_array_element(array, (u64)j), pivot) > 0
+            );
+            if (i >= j) break;
+            _basec_array_swap(array, i, j, scratch);
+        }
+
+        if (n <= j) high = j;
+        else        low  = j + 1;
+    }
+
+    for (i = low + 1; i <= high; i++) {
+        (void)memcpy(pivot, _basec_array_element(array, (u64)i), size);
+        for (
+            j = i - 1;
+            j >= low &&
+            compare(_basec_array_element(array, (u64)j), pivot) > 0;
+            j--
+        ) {
+            (void)memcpy(
+                _basec_array_element(array, (u64)(j + 1)),
+                _basec_array_element(array, (u64)j),
+                size
+            );
+        }
+        (void)memcpy(_basec_array_element(array, (u64)(j + 1)), pivot, size);
+    }
+}
+
+/**
+ * @struct _BasecArrayPar
+ * @brief The state shared by the chunks of a parallel array operation
+ */
+typedef struct {
+    BasecArray*       array;
+    BasecArray*       array_out;
+    u64               grain;
+    u64               stride;
+    u8*               partials;
+    u8*               scratch;
+    const void*       identity;
+    BasecArrayVisit   visit;
+    BasecArrayMap     map;
+    BasecArrayCombine combine;
+    void*             context;
+    BasecArrayCompare compare;
+    u8*               source;
+    u8*               target;
+    u64               width;
+    u64               key_offset;
+    u64               shift;
+    u64*              counts;
+} _BasecArrayPar;
+
+/**
+ * @brief Get the pool a parallel operation runs on
+ * @param jobs The pool passed to the operation, NULL for the shared pool
+ * @return The pool, NULL to run on the calling thread
+ */
+static BasecJobs* _basec_array_par_jobs(BasecJobs* jobs) {
+    BasecJobs* shared = NULL;
+
+    if (jobs != NULL) return jobs;
+
+    // Without a pool the operation still completes, only serially
+    if (basec_jobs_shared(&shared) != BASEC_JOBS_SUCCESS) return NULL;
+    return shared;
+}
+
+/**
+ * @brief Pick the number of elements in every chunk of a parallel operation
+ *
+ * Chunks hold whole cache lines, so chunks written by different workers do
+ * not share lines when the data starts on a line.
+ *
+ * @param array The array the chunks write to
+ * @param jobs The pool, NULL to run on the calling thread
+ * @return The number of elements in every chunk but the last
+ */
+static u64 _basec_array_par_grain(BasecArray* array, BasecJobs* jobs) {
+    u64 size    = array->element_size;
+    u64 lowest  = size & (~size + 1);
+    u64 line    = _CACHE_LINE / (lowest < _CACHE_LINE ? lowest : _CACHE_LINE);
+    u64 grain   = 0;
+    u64 minimum = (_PAR_MIN_CHUNK_BYTES + size - 1) / size;
+
+    if (jobs == NULL || array->length * size < _PAR_MIN_BYTES) {
+        return array->length;
+    }
+
+    grain = jobs->worker_count * _PAR_CHUNKS_PER_WORKER;
+    grain = (array->length + grain - 1) / grain;
+    if (grain < minimum) grain = minimum;
+    return (grain + line - 1) / line * line;
+}
+
+/**
+ * @brief Run a function over a range, in chunks on a pool or all at once
+ * @param jobs The pool, NULL to run on the calling thread
+ * @param count The end of the range, which starts at 0
+ * @param grain The number of indices in every chunk but the last
+ * @param function The function to run
+ * @param par The state of the operation
+ */
+static void _basec_array_par_run(
+    BasecJobs*            jobs,
+    u64                   count,
+    u64                   grain,
+    BasecJobRangeFunction function,
+    _BasecArrayPar*       par
+) {
+    if (jobs == NULL || count <= grain) {
+        function(0, count, par);
+        return;
+    }
+
+    // The range and grain are valid, so the loop cannot fail
+    (void)basec_jobs_parallel_for(
+        jobs,
+        (BasecJobsRange){ 0, count },
+        grain,
+        function,
+        par
+    );
+}
+
+/**
+ * @brief Visit the elements of a chunk
+ * @param begin The first index
+ * @param end One past the last index
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_visit(u64 begin, u64 end, void* context) {
+    _BasecArrayPar* par = (_BasecArrayPar*)context;
+
+    for (u64 i = begin; i < end; i++) {
+        par->visit(_basec_array_element(par->array, i), i, par->context);
+    }
+}
+
+/**
+ * @brief Map the elements of a chunk
+ * @param begin The first index
+ * @param end One past the last index
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_map(u64 begin, u64 end, void* context) {
+    _BasecArrayPar* par = (_BasecArrayPar*)context;
+
+    for (u64 i = begin; i < end; i++) {
+        par->map(
+            _basec_array_element(par->array, i),
+            _basec_array_element(par->array_out, i),
+            par->context
+        );
+    }
+}
+
+/**
+ * @brief Combine the elements of chunks into their partial results
+ * @param first The first chunk
+ * @param last One past the last chunk
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_reduce(u64 first, u64 last, void* context) {
+    _BasecArrayPar* par     = (_BasecArrayPar*)context;
+    u8*             partial = NULL;
+    u64             begin   = 0;
+    u64             end     = 0;
+
+    for (u64 chunk = first; chunk < last; chunk++) {
+        partial = par->partials + chunk * par->stride;
+        end     = (chunk + 1) * par->grain;
+        if (end > par->array->length) end = par->array->length;
+
+        begin   = chunk * par->grain;
+
+        // Without an identity the chunk starts from its first element
+        if (par->identity != NULL) {
+            (void)memcpy(partial, par->identity, par->array->element_size);
+        } else {
+            (void)memcpy(
+                partial,
+                _basec_array_element(par->array, begin++),
+                par->array->element_size
+            );
+        }
+        for (u64 i = begin; i < end; i++) {
+            par->combine(
+                partial,
+                _basec_array_element(par->array, i),
+                par->context
+            );
+        }
+    }
+}
+
+/**
+ * @brief Scan chunks, starting from the total of the chunks before them
+ * @param first The first chunk
+ * @param last One past the last chunk
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_scan(u64 first, u64 last, void* context) {
+    _BasecArrayPar* par     = (_BasecArrayPar*)context;
+    u64             size    = par->array->element_size;
+    u8*             running = NULL;
+    u64             begin   = 0;
+    u64             end     = 0;
+
+    for (u64 chunk = first; chunk < last; chunk++) {
+        // The chunk's partial result is no longer needed, so it holds the
+        // running total
+        running = par->partials + chunk * par->stride;
+        begin   = chunk * par->grain;
+        end     = begin + par->grain;
+        if (end > par->array->length) end = par->array->length;
+
+        if (chunk == 0) {
+            (void)memcpy(running, _basec_array_element(par->array, 0), size);
+            begin++;
+        } else {
+            (void)memcpy(running, par->scratch + chunk * par->stride, size);
+        }
+        for (u64 i = begin; i < end; i++) {
+            par->combine(
+                running,
+                _basec_array_element(par->array, i),
+                par->context
+            );
+            (void)memcpy(_basec_array_element(par->array, i), running, size);
+        }
+    }
+}
+
+/**
+ * @brief Get a buffer to sort into, from a scratch array or allocated
+ * @param array The array to sort
+ * @param scratch The scratch array, NULL to allocate a buffer
+ * @param buffer_out The buffer, with room for every element of the array
+ * @return The result of the operation
+ */
+static BasecArrayResult _basec_array_par_scratch(
+    BasecArray* array,
+    BasecArray* scratch,
+    u8**        buffer_out
+) {
+    u64 size = array->length * array->element_size;
+
+    if (scratch == NULL) {
+        *buffer_out = (u8*)malloc(size);
+        if (*buffer_out == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+        return BASEC_ARRAY_SUCCESS;
+    }
+    if (scratch->element_size != array->element_size) {
+        return BASEC_ARRAY_INVALID_ELEMENT_SIZE;
+    }
+
+    if (scratch->capacity < array->length) {
+        if (
+            basec_memory_resize_aligned(
+                &scratch->data,
+                scratch->capacity * scratch->element_size,
+                size,
+                scratch->alignment,
+                &scratch->mapped
+            ) != BASEC_MEMORY_SUCCESS
+        ) return BASEC_ARRAY_ALLOCATION_FAILURE;
+        scratch->capacity = array->length;
+    }
+    scratch->length = 0;
+    *buffer_out     = (u8*)scratch->data;
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Finish sorting into a buffer, moving the elements back if they
+ *        ended up in it
+ * @param array The sorted array
+ * @param scratch The scratch array, NULL if the buffer was allocated
+ * @param par The state of the sort
+ * @param buffer The buffer
+ * @return The result of the operation
+ */
+static BasecArrayResult _basec_array_par_sorted(
+    BasecArray*     array,
+    BasecArray*     scratch,
+    _BasecArrayPar* par,
+    u8*             buffer
+) {
+    if (par->source != array->data) {
+        (void)memcpy(
+            array->data,
+            par->source,
+            array->length * array->element_size
+        );
+    }
+    if (scratch == NULL) free(buffer);
+
+    if (array->index != NULL) return basec_array_enable_index(array);
     return BASEC_ARRAY_SUCCESS;
 }
 
+/**
+ * @brief Copy one element
+ *
+ * Constant sizes let common elements be copied inline instead of through a
+ * call to memcpy, which dominates loops that move one element at a time.
+ *
+ * @param target Where to copy the element to
+ * @param source The element
+ * @param size The size of the element
+ */
+static void _basec_array_par_copy(u8* target, const u8* source, u64 size) {
+    switch (size) {
+        case sizeof(u32):
+            (void)memcpy(target, source, sizeof(u32));
+            break;
+        case sizeof(u64):
+            (void)memcpy(target, source, sizeof(u64));
+            break;
+        case 2 * sizeof(u64):
+            (void)memcpy(target, source, 2 * sizeof(u64));
+            break;
+        default:
+            (void)memcpy(target, source, size);
+            break;
+    }
+}
+
+/**
+ * @brief Sort chunks into runs
+ * @param first The first chunk
+ * @param last One past the last chunk
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_sort_runs(u64 first, u64 last, void* context) {
+    _BasecArrayPar* par   = (_BasecArrayPar*)context;
+    u64             size  = par->array->element_size;
+    u64             begin = 0;
+    u64             end   = 0;
+
+    for (u64 chunk = first; chunk < last; chunk++) {
+        begin = chunk * par->grain;
+        end   = begin + par->grain;
+        if (end > par->array->length) end = par->array->length;
+
+        qsort(par->source + begin * size, end - begin, size, par->compare);
+    }
+}
+
+/**
+ * @brief Find how many elements of the first run are among the first k
+ *        elements of merging two runs
+ *
+ * Merges take the first run's element when two elements are equal.
+ *
+ * @param par The state of the sort
+ * @param a The first run
+ * @param a_length The number of elements in the first run
+ * @param b The second run
+ * @param b_length The number of elements in the second run
+ * @param k The number of merged elements
+ * @return The number of elements taken from the first run
+ */
+static u64 _basec_array_par_corank(
+    _BasecArrayPar* par,
+    const u8*       a,
+    u64             a_length,
+    const u8*       b,
+    u64             b_length,
+    u64             k
+) {
+    u64 size = par->array->element_size;
+    u64 low  = k > b_length ? k - b_length : 0;
+    u64 high = k < a_length ? k : a_length;
+    u64 i    = 0;
+    u64 j    = 0;
+
+    while (low < high) {
+        i = low + (high - low) / 2;
+        j = k - i;
+
+        // a[i] orders no later than b[j - 1], so it was taken before it
+        if (j > 0 && par->compare(a + i * size, b + (j - 1) * size) <= 0) {
+            low = i + 1;
+        } else {
+            high = i;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief Merge the slices of pairs of runs that make up chunks of output
+ *
+ * Runs are a power of two chunks long, so every chunk of output falls in
+ * the merge of one pair of runs.
+ *
+ * @param first The first chunk
+ * @param last One past the last chunk
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_merge(u64 first, u64 last, void* context) {
+    _BasecArrayPar* par      = (_BasecArrayPar*)context;
+    u64             size     = par->array->element_size;
+    u64             length   = par->array->length;
+    u64             pair     = 0;
+    const u8*       a        = NULL;
+    const u8*       b        = NULL;
+    u64             a_length = 0;
+    u64             b_length = 0;
+    u64             begin    = 0;
+    u64             end      = 0;
+    u64             i        = 0;
+    u64             j        = 0;
+    u64             i_end    = 0;
+    u64             j_end    = 0;
+    u8*             out      = NULL;
+
+    for (u64 chunk = first; chunk < last; chunk++) {
+        begin = chunk * par->grain;
+        end   = begin + par->grain;
+        if (end > length) end = length;
+
+        pair     = begin / (2 * par->width) * (2 * par->width);
+        a        = par->source + pair * size;
+        a_length = length - pair < par->width ? length - pair : par->width;
+        b        = a + a_length * size;
+        b_length = length - pair - a_length;
+        if (b_length > par->width) b_length = par->width;
+
+        i = _basec_array_par_corank(
+            par,
+            a,
+            a_length,
+            b,
+            b_length,
+            begin - pair
+        );
+        i_end = _basec_array_par_corank(
+            par,
+            a,
+            a_length,
+            b,
+            b_length,
+            end - pair
+        );
+        j     = begin - pair - i;
+        j_end = end - pair - i_end;
+        out   = par->target + begin * size;
+
+        while (i < i_end && j < j_end) {
+            if (par->compare(a + i * size, b + j * size) <= 0) {
+                _basec_array_par_copy(out, a + i++ * size, size);
+            } else {
+                _basec_array_par_copy(out, b + j++ * size, size);
+            }
+            out += size;
+        }
+        (void)memcpy(out, a + i * size, (i_end - i) * size);
+        out += (i_end - i) * size;
+        (void)memcpy(out, b + j * size, (j_end - j) * size);
+    }
+}
+
+/**
+ * @brief Get the u64 key of an element
+ * @param par The state of the sort
+ * @param element The element
+ * @return The key
+ */
+static u64 _basec_array_par_key(_BasecArrayPar* par, const u8* element) {
+    u64 key = 0;
+
+    (void)memcpy(&key, element + par->key_offset, sizeof(u64));
+    return key;
+}
+
+/**
+ * @brief Find the bits in which the keys of chunks differ from the first
+ *        key
+ * @param first The first chunk
+ * @param last One past the last chunk
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_radix_bits(u64 first, u64 last, void* context) {
+    _BasecArrayPar* par   = (_BasecArrayPar*)context;
+    u64             size  = par->array->element_size;
+    u64             key   = _basec_array_par_key(par, par->source);
+    u64             bits  = 0;
+    u64             begin = 0;
+    u64             end   = 0;
+
+    for (u64 chunk = first; chunk < last; chunk++) {
+        begin = chunk * par->grain;
+        end   = begin + par->grain;
+        if (end > par->array->length) end = par->array->length;
+
+        bits = 0;
+        for (u64 i = begin; i < end; i++) {
+            bits |= _basec_array_par_key(par, par->source + i * size) ^ key;
+        }
+        par->counts[chunk * _RADIX_BUCKETS] = bits;
+    }
+}
+
+/**
+ * @brief Count the digits of the keys of chunks
+ * @param first The first chunk
+ * @param last One past the last chunk
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_radix_count(u64 first, u64 last, void* context) {
+    _BasecArrayPar* par    = (_BasecArrayPar*)context;
+    u64             size   = par->array->element_size;
+    u64*            counts = NULL;
+    u64             digit  = 0;
+    u64             begin  = 0;
+    u64             end    = 0;
+
+    for (u64 chunk = first; chunk < last; chunk++) {
+        counts = par->counts + chunk * _RADIX_BUCKETS;
+        begin  = chunk * par->grain;
+        end    = begin + par->grain;
+        if (end > par->array->length) end = par->array->length;
+
+        (void)memset(counts, 0, _RADIX_BUCKETS * sizeof(u64));
+        for (u64 i = begin; i < end; i++) {
+            digit = _basec_array_par_key(par, par->source + i * size);
+            counts[(digit >> par->shift) & (_RADIX_BUCKETS - 1)]++;
+        }
+    }
+}
+
+/**
+ * @brief Move the elements of chunks to the offsets of their digits
+ * @param first The first chunk
+ * @param last One past the last chunk
+ * @param context The _BasecArrayPar of the operation
+ */
+static void _basec_array_par_radix_move(u64 first, u64 last, void* context) {
+    _BasecArrayPar* par     = (_BasecArrayPar*)context;
+    u64             size    = par->array->element_size;
+    u64*            offsets = NULL;
+    const u8*       element = NULL;
+    u64             digit   = 0;
+    u64             begin   = 0;
+    u64             end     = 0;
+
+    for (u64 chunk = first; chunk < last; chunk++) {
+        offsets = par->counts + chunk * _RADIX_BUCKETS;
+        begin   = chunk * par->grain;
+        end     = begin + par->grain;
+        if (end > par->array->length) end = par->array->length;
+
+        for (u64 i = begin; i < end; i++) {
+            element = par->source + i * size;
+            digit   = _basec_array_par_key(par, element);
+            digit   = (digit >> par->shift) & (_RADIX_BUCKETS - 1);
+            _basec_array_par_copy(
+                par->target + offsets[digit]++ * size,
+                element,
+                size
+            );
+        }
+    }
+}
+
 /**
  * @brief Handle the result of an array operation
  * @param result The result of the operation
@@ -73,6 +994,18 @@ void basec_array_handle_result(BasecArrayResult result) {
                 "Operation failed due to an element not being found.\n"
             );
             exit(1);
+        case BASEC_ARRAY_INVALID_KEY_OFFSET:
+            (void)printf(
+                "[Error][Array] "
+                "Operation failed due to an invalid key offset.\n"
+            );
+            exit(1);
+        case BASEC_ARRAY_INVALID_ALIGNMENT:
+            (void)printf(
+                "[Error][Array] "
+                "Operation failed due to an invalid alignment.\n"
+            );
+            exit(1);
         default:
             (void)printf(
                 "[Error][Array] "
@@ -92,20 +1025,80 @@ BasecArrayResult basec_array_create(
     BasecArray** array, 
     u64          element_size, 
     u64          capacity
+) {
+    return basec_array_create_aligned(
+        array,
+        element_size,
+        capacity,
+        BASEC_MEMORY_ALIGNMENT
+    );
+}
+
+/**
+ * @brief Create an array whose data is aligned to alignment bytes, also
+ *        after it grows
+ * @param array The array to create
+ * @param element_size The size of the elements in the array
+ * @param capacity The capacity of the array
+ * @param alignment The alignment, a power of two up to the page size
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_create_aligned(
+    BasecArray** array,
+    u64          element_size,
+    u64          capacity,
+    u64          alignment
 ) {
     if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
     if (element_size <= 0) return BASEC_ARRAY_INVALID_ELEMENT_SIZE;
     if (capacity <= 0) return BASEC_ARRAY_INVALID_CAPACITY;
 
+    BasecMemoryResult memory_result = BASEC_MEMORY_SUCCESS;
+
     *array = (BasecArray*)malloc(sizeof(BasecArray));
     if (*array == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
 
-    (*array)->data = malloc(element_size * capacity);
-    if ((*array)->data == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+    memory_result = basec_memory_allocate_aligned(
+        &(*array)->data,
+        element_size * capacity,
+        alignment,
+        &(*array)->mapped
+    );
+    if (memory_result != BASEC_MEMORY_SUCCESS) {
+        free(*array);
+        *array = NULL;
+        if (memory_result == BASEC_MEMORY_INVALID_ALIGNMENT) {
+            return BASEC_ARRAY_INVALID_ALIGNMENT;
+        }
+        return BASEC_ARRAY_ALLOCATION_FAILURE;
+    }
 
     (*array)->element_size = element_size;
     (*array)->length = 0;
     (*array)->capacity = capacity;
+    (*array)->index = NULL;
+    (*array)->alignment = alignment;
+    (*array)->huge_pages = false;
+
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Ask for transparent huge pages on the data of the array, now and
+ *        as it grows
+ * @param array The array
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_advise_huge_pages(BasecArray* array) {
+    if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
+
+    array->huge_pages = true;
+    if (array->mapped) {
+        (void)basec_memory_advise_huge_pages(
+            array->data,
+            array->capacity * array->element_size
+        );
+    }
 
     return BASEC_ARRAY_SUCCESS;
 }
@@ -134,6 +1127,13 @@ BasecArrayResult basec_array_append(BasecArray* array, void* element) {
     ) == NULL) return BASEC_ARRAY_MEMOP_FAILURE;
 
     array->length++;
+    if (array->index != NULL) {
+        result = _basec_array_index_insert(array, array->length - 1);
+        if (result != BASEC_ARRAY_SUCCESS) {
+            array->length--;
+            return result;
+        }
+    }
     return BASEC_ARRAY_SUCCESS;
 }
 
@@ -159,6 +1159,9 @@ BasecArrayResult basec_array_pop(BasecArray* array, void* element_out) {
     if (element_out == NULL) return BASEC_ARRAY_NULL_POINTER;
     if (array->length == 0) return BASEC_ARRAY_EMPTY;
 
+    if (array->index != NULL) {
+        _basec_array_index_remove(array, array->length - 1);
+    }
     array->length--;
 
     if (memcpy(
@@ -205,12 +1208,98 @@ BasecArrayResult basec_array_set(BasecArray* array, u64 index, void* element) {
     if (array == NULL || element == NULL) return BASEC_ARRAY_NULL_POINTER;
     if (index >= array->length) return BASEC_ARRAY_OUT_OF_BOUNDS;
 
+    // Removing first leaves room, so adding the new entry cannot fail
+    if (array->index != NULL) _basec_array_index_remove(array, index);
+
     if (memcpy(
         (void*)((u64)array->data + index * array->element_size),
         element,
         array->element_size
     ) == NULL) return BASEC_ARRAY_MEMOP_FAILURE;
 
+    if (array->index != NULL) (void)_basec_array_index_insert(array, index);
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Remove an element, moving the elements after it down
+ * @param array The array to remove from
+ * @param index The index of the element to remove
+ * @param element_out The removed element, may be NULL
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_remove(
+    BasecArray* array,
+    u64         index,
+    void*       element_out
+) {
+    if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
+    if (index >= array->length) return BASEC_ARRAY_OUT_OF_BOUNDS;
+
+    u8* element = (u8*)_basec_array_element(array, index);
+
+    if (array->index != NULL) {
+        _basec_array_index_remove(array, index);
+        for (u64 i = 0; i < array->index->capacity; i++) {
+            u64* position = &array->index->entries[i].position;
+
+            if (*position != _INDEX_EMPTY && *position > index) (*position)--;
+        }
+    }
+
+    if (element_out != NULL) {
+        (void)memcpy(element_out, element, array->element_size);
+    }
+    (void)memmove(
+        element,
+        element + array->element_size,
+        (array->length - index - 1) * array->element_size
+    );
+    array->length--;
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Remove an element, moving the last element into its place
+ * @param array The array to remove from
+ * @param index The index of the element to remove
+ * @param element_out The removed element, may be NULL
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_swap_remove(
+    BasecArray* array,
+    u64         index,
+    void*       element_out
+) {
+    if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
+    if (index >= array->length) return BASEC_ARRAY_OUT_OF_BOUNDS;
+
+    u64 last = array->length - 1;
+
+    if (array->index != NULL) {
+        _basec_array_index_remove(array, index);
+        if (index != last) _basec_array_index_remove(array, last);
+    }
+
+    if (element_out != NULL) {
+        (void)memcpy(
+            element_out,
+            _basec_array_element(array, index),
+            array->element_size
+        );
+    }
+    if (index != last) {
+        (void)memcpy(
+            _basec_array_element(array, index),
+            _basec_array_element(array, last),
+            array->element_size
+        );
+    }
+    array->length--;
+
+    if (array->index != NULL && index != last) {
+        (void)_basec_array_index_insert(array, index);
+    }
     return BASEC_ARRAY_SUCCESS;
 }
 
@@ -230,6 +1319,14 @@ BasecArrayResult basec_array_contains(
         return BASEC_ARRAY_NULL_POINTER;
     }
 
+    u64 first = 0;
+
+    if (array->index != NULL) {
+        (void)_basec_array_index_find(array, element, &first, NULL);
+        *contains_out = first != U64_MAX;
+        return BASEC_ARRAY_SUCCESS;
+    }
+
     for (u64 i = 0; i < array->length; i++) {
         if (memcmp(
             (void*)((u64)array->data + i * array->element_size),
@@ -260,6 +1357,12 @@ BasecArrayResult basec_array_find(
         return BASEC_ARRAY_NULL_POINTER;
     }
 
+    if (array->index != NULL) {
+        (void)_basec_array_index_find(array, element, index_out, NULL);
+        if (*index_out == U64_MAX) return BASEC_ARRAY_NOT_FOUND;
+        return BASEC_ARRAY_SUCCESS;
+    }
+
     for (u64 i = 0; i < array->length; i++) {
         void* cur_element = (void*)((u64)array->data + i * array->element_size);
 
@@ -303,7 +1406,7 @@ BasecArrayResult basec_array_find_all(
     );
     if (array_result != BASEC_ARRAY_SUCCESS) return array_result;
 
-    for (u64 i = 0; i < array->length; i++) {
+    for (u64 i = 0; array->index == NULL && i < array->length; i++) {
         void* cur_element = (void*)((u64)array->data + i * array->element_size);
 
         if (memcmp(cur_element, element, array->element_size) == 0) {
@@ -314,6 +1417,12 @@ BasecArrayResult basec_array_find_all(
             if (array_result != BASEC_ARRAY_SUCCESS) return array_result;
         }
     }
+    if (array->index != NULL) {
+        u64 first = 0;
+
+        array_result = _basec_array_index_find(array, element, &first, indices);
+        if (array_result != BASEC_ARRAY_SUCCESS) return array_result;
+    }
 
     if (*array_out != NULL) {
         array_result = basec_array_destroy(array_out);
@@ -325,6 +1434,577 @@ BasecArrayResult basec_array_find_all(
     return BASEC_ARRAY_SUCCESS;
 }
 
+/**
+ * @brief Hash an element of the array
+ * @param array The array holding the element
+ * @param index The index of the element
+ * @param hash_out The hash of the element's bytes
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_hash_element(
+    BasecArray* array,
+    u64         index,
+    u64*        hash_out
+) {
+    if (array == NULL || hash_out == NULL) return BASEC_ARRAY_NULL_POINTER;
+    if (index >= array->length) return BASEC_ARRAY_OUT_OF_BOUNDS;
+
+    (void)basec_hash_bytes(
+        (void*)((u64)array->data + index * array->element_size),
+        array->element_size,
+        hash_out
+    );
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Sort the elements of the array in place
+ * @param array The array to sort
+ * @param compare The comparator ordering the elements
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_sort(
+    BasecArray*       array,
+    BasecArrayCompare compare
+) {
+    if (array == NULL || compare == NULL) return BASEC_ARRAY_NULL_POINTER;
+
+    if (array->length > 1) {
+        qsort(array->data, array->length, array->element_size, compare);
+    }
+    if (array->index != NULL) return basec_array_enable_index(array);
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Remove repeated elements from a sorted array in place
+ * @param array The sorted array to remove repeats from
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_unique_sorted(BasecArray* array) {
+    if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
+    if (array->length < 2) return BASEC_ARRAY_SUCCESS;
+
+    u8* data   = (u8*)array->data;
+    u64 size   = array->element_size;
+    u64 length = 1;
+
+    // Compare against the last kept element, the array is only written to
+    // once the first repeat is found
+    for (u64 i = 1; i < array->length; i++) {
+        if (memcmp(data + i * size, data + (length - 1) * size, size) == 0) {
+            continue;
+        }
+        if (length != i) {
+            (void)memcpy(data + length * size, data + i * size, size);
+        }
+        length++;
+    }
+
+    array->length = length;
+    if (array->index != NULL) return basec_array_enable_index(array);
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Partially sort the array so one element lands where a sort puts it
+ * @param array The array to partially sort
+ * @param n The index of the element to place
+ * @param compare The comparator ordering the elements
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_nth_element(
+    BasecArray*       array,
+    u64               n,
+    BasecArrayCompare compare
+) {
+    if (array == NULL || compare == NULL) return BASEC_ARRAY_NULL_POINTER;
+    if (n >= array->length) return BASEC_ARRAY_OUT_OF_BOUNDS;
+    if (array->length < 2) return BASEC_ARRAY_SUCCESS;
+
+    void* scratch = malloc(array->element_size * 2);
+    if (scratch == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+
+    _basec_array_select(
+        array,
+        0,
+        (i64)array->length - 1,
+        (i64)n,
+        compare,
+        scratch
+    );
+    free(scratch);
+
+    if (array->index != NULL) return basec_array_enable_index(array);
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Copy the k elements that order first, in sorted order
+ * @param array The array to select from
+ * @param k The number of elements to keep, at most the array's length
+ * @param compare The comparator ordering the elements
+ * @param array_out The array to store the elements in
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_top_k(
+    BasecArray*       array,
+    u64               k,
+    BasecArrayCompare compare,
+    BasecArray**      array_out
+) {
+    if (array == NULL || compare == NULL || array_out == NULL) {
+        return BASEC_ARRAY_NULL_POINTER;
+    }
+    if (k == 0 || k > array->length) return BASEC_ARRAY_OUT_OF_BOUNDS;
+
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      top          = NULL;
+
+    array_result = basec_array_create(
+        &top,
+        array->element_size,
+        array->length
+    );
+    if (array_result != BASEC_ARRAY_SUCCESS) return array_result;
+
+    (void)memcpy(top->data, array->data, array->length * array->element_size);
+    top->length = array->length;
+
+    // Everything before k - 1 orders before it, so only k elements are sorted
+    array_result = basec_array_nth_element(top, k - 1, compare);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)basec_array_destroy(&top);
+        return array_result;
+    }
+    top->length = k;
+    (void)basec_array_sort(top, compare);
+
+    if (*array_out != NULL) {
+        array_result = basec_array_destroy(array_out);
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            (void)basec_array_destroy(&top);
+            return array_result;
+        }
+    }
+    *array_out = top;
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Visit every element of the array in parallel
+ * @param array The array to visit
+ * @param visit The function to run on every element
+ * @param context The context to pass to the function
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_for_each(
+    BasecArray*     array,
+    BasecArrayVisit visit,
+    void*           context,
+    BasecJobs*      jobs
+) {
+    if (array == NULL || visit == NULL) return BASEC_ARRAY_NULL_POINTER;
+    if (array->length == 0) return BASEC_ARRAY_SUCCESS;
+
+    _BasecArrayPar par = {0};
+
+    par.array   = array;
+    par.visit   = visit;
+    par.context = context;
+    jobs        = _basec_array_par_jobs(jobs);
+
+    _basec_array_par_run(
+        jobs,
+        array->length,
+        _basec_array_par_grain(array, jobs),
+        _basec_array_par_visit,
+        &par
+    );
+
+    if (array->index != NULL) return basec_array_enable_index(array);
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Compute an output element for every element in parallel
+ * @param array The array to map
+ * @param element_size_out The size of the output elements
+ * @param map The function computing every output element
+ * @param context The context to pass to the function
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @param array_out The array to store the output elements in, in order
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_map(
+    BasecArray*   array,
+    u64           element_size_out,
+    BasecArrayMap map,
+    void*         context,
+    BasecJobs*    jobs,
+    BasecArray**  array_out
+) {
+    if (array == NULL || map == NULL || array_out == NULL) {
+        return BASEC_ARRAY_NULL_POINTER;
+    }
+
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      mapped       = NULL;
+    _BasecArrayPar   par          = {0};
+
+    array_result = basec_array_create(
+        &mapped,
+        element_size_out,
+        array->length > 0 ? array->length : 1
+    );
+    if (array_result != BASEC_ARRAY_SUCCESS) return array_result;
+    mapped->length = array->length;
+
+    par.array     = array;
+    par.array_out = mapped;
+    par.map       = map;
+    par.context   = context;
+    jobs          = _basec_array_par_jobs(jobs);
+
+    // Chunks follow the output, since that is the array being written
+    _basec_array_par_run(
+        jobs,
+        array->length,
+        _basec_array_par_grain(mapped, jobs),
+        _basec_array_par_map,
+        &par
+    );
+
+    if (*array_out != NULL) {
+        array_result = basec_array_destroy(array_out);
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            (void)basec_array_destroy(&mapped);
+            return array_result;
+        }
+    }
+    *array_out = mapped;
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Combine every element of the array in parallel
+ * @param array The array to reduce
+ * @param identity The element that combine leaves other elements unchanged
+ *                 with
+ * @param combine The associative function combining two elements
+ * @param context The context to pass to the function
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @param result_out The combined elements, identity for an empty array
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_reduce(
+    BasecArray*       array,
+    const void*       identity,
+    BasecArrayCombine combine,
+    void*             context,
+    BasecJobs*        jobs,
+    void*             result_out
+) {
+    if (
+        array == NULL ||
+        identity == NULL ||
+        combine == NULL ||
+        result_out == NULL
+    ) return BASEC_ARRAY_NULL_POINTER;
+
+    _BasecArrayPar par    = {0};
+    u64            chunks = 0;
+
+    par.array    = array;
+    par.identity = identity;
+    par.combine  = combine;
+    par.context  = context;
+    jobs         = _basec_array_par_jobs(jobs);
+
+    (void)memcpy(result_out, identity, array->element_size);
+    if (array->length == 0) return BASEC_ARRAY_SUCCESS;
+
+    // Partial results sit on their own cache lines, since every combine
+    // writes to one
+    par.grain  = _basec_array_par_grain(array, jobs);
+    par.stride = (array->element_size + _CACHE_LINE - 1) / _CACHE_LINE *
+                 _CACHE_LINE;
+    chunks     = (array->length + par.grain - 1) / par.grain;
+
+    par.partials = (u8*)aligned_alloc(_CACHE_LINE, chunks * par.stride);
+    if (par.partials == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+
+    _basec_array_par_run(jobs, chunks, 1, _basec_array_par_reduce, &par);
+    for (u64 chunk = 0; chunk < chunks; chunk++) {
+        combine(result_out, par.partials + chunk * par.stride, context);
+    }
+
+    free(par.partials);
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Replace every element with the combination of it and all elements
+ *        before it, in parallel
+ * @param array The array to scan in place
+ * @param combine The associative function combining two elements
+ * @param context The context to pass to the function
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_inclusive_scan(
+    BasecArray*       array,
+    BasecArrayCombine combine,
+    void*             context,
+    BasecJobs*        jobs
+) {
+    if (array == NULL || combine == NULL) return BASEC_ARRAY_NULL_POINTER;
+    if (array->length == 0) return BASEC_ARRAY_SUCCESS;
+
+    _BasecArrayPar par    = {0};
+    u64            size   = array->element_size;
+    u64            chunks = 0;
+    u8*            before = NULL;
+
+    par.array   = array;
+    par.combine = combine;
+    par.context = context;
+    jobs        = _basec_array_par_jobs(jobs);
+    par.grain   = _basec_array_par_grain(array, jobs);
+    par.stride  = (size + _CACHE_LINE - 1) / _CACHE_LINE * _CACHE_LINE;
+    chunks      = (array->length + par.grain - 1) / par.grain;
+
+    // The totals of every chunk, then the totals of the chunks before them
+    par.partials = (u8*)aligned_alloc(_CACHE_LINE, 2 * chunks * par.stride);
+    if (par.partials == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+    par.scratch = par.partials + chunks * par.stride;
+
+    // A single chunk needs no totals, so small arrays are read once
+    if (chunks > 1) {
+        _basec_array_par_run(jobs, chunks, 1, _basec_array_par_reduce, &par);
+    }
+    for (u64 chunk = 1; chunk < chunks; chunk++) {
+        before = par.scratch + chunk * par.stride;
+        if (chunk == 1) {
+            (void)memcpy(before, par.partials, size);
+            continue;
+        }
+        (void)memcpy(before, before - par.stride, size);
+        combine(before, par.partials + (chunk - 1) * par.stride, context);
+    }
+    _basec_array_par_run(jobs, chunks, 1, _basec_array_par_scan, &par);
+
+    free(par.partials);
+    if (array->index != NULL) return basec_array_enable_index(array);
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Sort the elements of the array in parallel
+ * @param array The array to sort
+ * @param compare The comparator ordering the elements
+ * @param scratch An array of the same element size to merge into, or NULL
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_sort(
+    BasecArray*       array,
+    BasecArrayCompare compare,
+    BasecArray*       scratch,
+    BasecJobs*        jobs
+) {
+    if (array == NULL || compare == NULL) return BASEC_ARRAY_NULL_POINTER;
+
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    _BasecArrayPar   par          = {0};
+    u8*              buffer       = NULL;
+    u64              chunks       = 0;
+    u8*              swap         = NULL;
+
+    jobs      = _basec_array_par_jobs(jobs);
+    par.array = array;
+    par.grain = _basec_array_par_grain(array, jobs);
+    if (par.grain >= array->length) return basec_array_sort(array, compare);
+
+    array_result = _basec_array_par_scratch(array, scratch, &buffer);
+    if (array_result != BASEC_ARRAY_SUCCESS) return array_result;
+
+    par.compare = compare;
+    par.source  = (u8*)array->data;
+    par.target  = buffer;
+    chunks      = (array->length + par.grain - 1) / par.grain;
+
+    _basec_array_par_run(jobs, chunks, 1, _basec_array_par_sort_runs, &par);
+    for (
+        par.width = par.grain;
+        par.width < array->length;
+        par.width *= 2
+    ) {
+        _basec_array_par_run(jobs, chunks, 1, _basec_array_par_merge, &par);
+        swap       = par.source;
+        par.source = par.target;
+        par.target = swap;
+    }
+
+    return _basec_array_par_sorted(array, scratch, &par, buffer);
+}
+
+/**
+ * @brief Sort the elements of the array by a u64 key inside every element,
+ *        in parallel
+ * @param array The array to sort
+ * @param key_offset The offset of the u64 key in every element
+ * @param scratch An array of the same element size to move elements into,
+ *                or NULL
+ * @param jobs The pool to run on, NULL for the shared pool
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_par_radix_sort(
+    BasecArray* array,
+    u64         key_offset,
+    BasecArray* scratch,
+    BasecJobs*  jobs
+) {
+    if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
+    if (
+        array->element_size < sizeof(u64) ||
+        key_offset > array->element_size - sizeof(u64)
+    ) return BASEC_ARRAY_INVALID_KEY_OFFSET;
+    if (array->length < 2) return BASEC_ARRAY_SUCCESS;
+
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    _BasecArrayPar   par          = {0};
+    u8*              buffer       = NULL;
+    u64              chunks       = 0;
+    u64              bits         = 0;
+    u64              offset       = 0;
+    u64              count        = 0;
+    u8*              swap         = NULL;
+
+    jobs           = _basec_array_par_jobs(jobs);
+    par.array      = array;
+    par.key_offset = key_offset;
+    par.grain      = _basec_array_par_grain(array, jobs);
+    par.source     = (u8*)array->data;
+    chunks         = (array->length + par.grain - 1) / par.grain;
+
+    par.counts = (u64*)aligned_alloc(
+        _CACHE_LINE,
+        chunks * _RADIX_BUCKETS * sizeof(u64)
+    );
+    if (par.counts == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+
+    array_result = _basec_array_par_scratch(array, scratch, &buffer);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        free(par.counts);
+        return array_result;
+    }
+    par.target = buffer;
+
+    // Bytes every key shares need no pass, which suits small key ranges
+    _basec_array_par_run(jobs, chunks, 1, _basec_array_par_radix_bits, &par);
+    for (u64 chunk = 0; chunk < chunks; chunk++) {
+        bits |= par.counts[chunk * _RADIX_BUCKETS];
+    }
+
+    for (par.shift = 0; par.shift < 64; par.shift += _RADIX_BITS) {
+        if (((bits >> par.shift) & (_RADIX_BUCKETS - 1)) == 0) continue;
+
+        _basec_array_par_run(
+            jobs,
+            chunks,
+            1,
+            _basec_array_par_radix_count,
+            &par
+        );
+
+        // Digits in order, and chunks in order within a digit, keep the
+        // sort stable
+        offset = 0;
+        for (u64 digit = 0; digit < _RADIX_BUCKETS; digit++) {
+            for (u64 chunk = 0; chunk < chunks; chunk++) {
+                count = par.counts[chunk * _RADIX_BUCKETS + digit];
+                par.counts[chunk * _RADIX_BUCKETS + digit] = offset;
+                offset += count;
+            }
+        }
+
+        _basec_array_par_run(
+            jobs,
+            chunks,
+            1,
+            _basec_array_par_radix_move,
+            &par
+        );
+        swap       = par.source;
+        par.source = par.target;
+        par.target = swap;
+    }
+
+    free(par.counts);
+    return _basec_array_par_sorted(array, scratch, &par, buffer);
+}
+
+/**
+ * @brief Keep a hash index of the array's elements for fast lookups
+ * @param array The array to index
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_enable_index(BasecArray* array) {
+    if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
+
+    BasecArrayResult result   = BASEC_ARRAY_SUCCESS;
+    u64              capacity = _INDEX_MIN_CAPACITY;
+
+    if (array->index == NULL) {
+        array->index = (BasecArrayIndex*)malloc(sizeof(BasecArrayIndex));
+        if (array->index == NULL) return BASEC_ARRAY_ALLOCATION_FAILURE;
+
+        array->index->entries = NULL;
+        (void)basec_hash_random_seed(&array->index->seed);
+    }
+
+    // Rebuilding drops the old entries, which may no longer match the data
+    free(array->index->entries);
+    array->index->entries  = NULL;
+    array->index->capacity = 0;
+    array->index->length   = 0;
+
+    while (capacity < array->length * 2) capacity *= _GROWTH_FACTOR;
+    result = _basec_array_index_resize(array->index, capacity);
+    if (result != BASEC_ARRAY_SUCCESS) {
+        free(array->index);
+        array->index = NULL;
+        return result;
+    }
+
+    for (u64 i = 0; i < array->length; i++) {
+        _basec_array_index_place(
+            array->index,
+            _basec_array_index_hash(array, _basec_array_element(array, i)),
+            i
+        );
+    }
+    return BASEC_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Drop the hash index of an array
+ * @param array The array to stop indexing
+ * @return The result of the operation
+ */
+BasecArrayResult basec_array_disable_index(BasecArray* array) {
+    if (array == NULL) return BASEC_ARRAY_NULL_POINTER;
+
+    if (array->index != NULL) {
+        free(array->index->entries);
+        free(array->index);
+        array->index = NULL;
+    }
+    return BASEC_ARRAY_SUCCESS;
+}
+
 /**
  * @brief Destroy an array
  * @param array The array to destroy
@@ -333,7 +2013,12 @@ BasecArrayResult basec_array_find_all(
 BasecArrayResult basec_array_destroy(BasecArray** array) {
     if (array == NULL || *array == NULL) return BASEC_ARRAY_NULL_POINTER;
 
-    free((*array)->data);
+    (void)basec_array_disable_index(*array);
+    (void)basec_memory_release(
+        &(*array)->data,
+        (*array)->capacity * (*array)->element_size,
+        (*array)->mapped
+    );
     free(*array);
     *array = NULL;
 
@@ -0,0 +1,409 @@
+#include "ds/basec_chunked_array.h"
+
+static const u64 _MAX_BLOCK_CAPACITY   = (u64)1 << 40;
+static const u64 _BLOCK_INDEX_CAPACITY = 16;
+
+/**
+ * @brief Get the address of an element
+ * @param array The array
+ * @param index The index of the element, a block must hold it
+ * @return The address of the element
+ */
+static u8* _basec_chunked_array_element(BasecChunkedArray* array, u64 index) {
+    u8* block = ((u8**)array->blocks->data)[index >> array->block_shift];
+
+    return block + (index & (array->block_capacity - 1)) * array->element_size;
+}
+
+/**
+ * @brief Make sure a block holds the element after the last
+ *
+ * Blocks left behind by pop and clear are reused before new ones are
+ * allocated.
+ *
+ * @param array The array
+ * @return The result of the operation
+ */
+static BasecChunkedArrayResult _basec_chunked_array_reserve(
+    BasecChunkedArray* array
+) {
+    void* block = NULL;
+
+    if ((array->length >> array->block_shift) < array->blocks->length) {
+        return BASEC_CHUNKED_ARRAY_SUCCESS;
+    }
+
+    block = malloc(array->block_capacity * array->element_size);
+    if (block == NULL) return BASEC_CHUNKED_ARRAY_ALLOCATION_FAILURE;
+
+    // Only the block index grows by copying, one pointer per block
+    if (basec_array_append(array->blocks, &block) != BASEC_ARRAY_SUCCESS) {
+        free(block);
+        return BASEC_CHUNKED_ARRAY_ALLOCATION_FAILURE;
+    }
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Handle the result of a chunked array operation
+ * @param result The result of the operation
+ */
+void basec_chunked_array_handle_result(BasecChunkedArrayResult result) {
+    switch (result) {
+        case BASEC_CHUNKED_ARRAY_SUCCESS:
+            break;
+        case BASEC_CHUNKED_ARRAY_NULL_POINTER:
+            (void)printf(
+                "[Error][ChunkedArray] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_CHUNKED_ARRAY_INVALID_ELEMENT_SIZE:
+            (void)printf(
+                "[Error][ChunkedArray] "
+                "Operation failed due to an invalid element size.\n"
+            );
+            exit(1);
+        case BASEC_CHUNKED_ARRAY_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][ChunkedArray] "
+                "Operation failed due to an invalid block capacity.\n"
+            );
+            exit(1);
+        case BASEC_CHUNKED_ARRAY_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][ChunkedArray] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_CHUNKED_ARRAY_EMPTY:
+            (void)printf(
+                "[Error][ChunkedArray] "
+                "Operation failed due to an empty array.\n"
+            );
+            exit(1);
+        case BASEC_CHUNKED_ARRAY_OUT_OF_BOUNDS:
+            (void)printf(
+                "[Error][ChunkedArray] "
+                "Operation failed due to an out of bounds index.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][ChunkedArray] "
+                "An unknown error occurred during chunked array operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a chunked array
+ * @param array The array to create
+ * @param element_size The size of the elements
+ * @param block_capacity The number of elements per block
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_create(
+    BasecChunkedArray** array,
+    u64                 element_size,
+    u64                 block_capacity
+) {
+    if (array == NULL) return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    if (element_size == 0) return BASEC_CHUNKED_ARRAY_INVALID_ELEMENT_SIZE;
+    if (block_capacity == 0 || block_capacity > _MAX_BLOCK_CAPACITY) {
+        return BASEC_CHUNKED_ARRAY_INVALID_CAPACITY;
+    }
+
+    u64 shift = 0;
+
+    while (((u64)1 << shift) < block_capacity) shift++;
+    if (((u64)1 << shift) > U64_MAX / element_size) {
+        return BASEC_CHUNKED_ARRAY_INVALID_ELEMENT_SIZE;
+    }
+
+    *array = (BasecChunkedArray*)malloc(sizeof(BasecChunkedArray));
+    if (*array == NULL) return BASEC_CHUNKED_ARRAY_ALLOCATION_FAILURE;
+
+    (*array)->blocks = NULL;
+    if (
+        basec_array_create(
+            &(*array)->blocks,
+            sizeof(void*),
+            _BLOCK_INDEX_CAPACITY
+        ) != BASEC_ARRAY_SUCCESS
+    ) {
+        free(*array);
+        *array = NULL;
+        return BASEC_CHUNKED_ARRAY_ALLOCATION_FAILURE;
+    }
+
+    (*array)->element_size   = element_size;
+    (*array)->length         = 0;
+    (*array)->block_capacity = (u64)1 << shift;
+    (*array)->block_shift    = shift;
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Append an element to the array
+ * @param array The array to append to
+ * @param element The element to append
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_append(
+    BasecChunkedArray* array,
+    const void*        element
+) {
+    if (array == NULL || element == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+
+    BasecChunkedArrayResult result = _basec_chunked_array_reserve(array);
+
+    if (result != BASEC_CHUNKED_ARRAY_SUCCESS) return result;
+
+    (void)memcpy(
+        _basec_chunked_array_element(array, array->length),
+        element,
+        array->element_size
+    );
+    array->length++;
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Append consecutive elements to the array, a block at a time
+ * @param array The array to append to
+ * @param elements The elements to append, in order
+ * @param count The number of elements
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_append_n(
+    BasecChunkedArray* array,
+    const void*        elements,
+    u64                count
+) {
+    if (array == NULL || elements == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+
+    BasecChunkedArrayResult result = BASEC_CHUNKED_ARRAY_SUCCESS;
+    const u8*               source = (const u8*)elements;
+    u64                     offset = 0;
+    u64                     run    = 0;
+
+    while (count > 0) {
+        result = _basec_chunked_array_reserve(array);
+        if (result != BASEC_CHUNKED_ARRAY_SUCCESS) return result;
+
+        offset = array->length & (array->block_capacity - 1);
+        run    = array->block_capacity - offset;
+        if (run > count) run = count;
+
+        (void)memcpy(
+            _basec_chunked_array_element(array, array->length),
+            source,
+            run * array->element_size
+        );
+        array->length += run;
+        source        += run * array->element_size;
+        count         -= run;
+    }
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Remove the last element of the array
+ * @param array The array to pop from
+ * @param element_out The popped element
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_pop(
+    BasecChunkedArray* array,
+    void*              element_out
+) {
+    if (array == NULL || element_out == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+    if (array->length == 0) return BASEC_CHUNKED_ARRAY_EMPTY;
+
+    array->length--;
+    (void)memcpy(
+        element_out,
+        _basec_chunked_array_element(array, array->length),
+        array->element_size
+    );
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Get an element from the array
+ * @param array The array to get from
+ * @param index The index of the element
+ * @param element_out The element
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_get(
+    BasecChunkedArray* array,
+    u64                index,
+    void*              element_out
+) {
+    if (array == NULL || element_out == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+    if (index >= array->length) return BASEC_CHUNKED_ARRAY_OUT_OF_BOUNDS;
+
+    (void)memcpy(
+        element_out,
+        _basec_chunked_array_element(array, index),
+        array->element_size
+    );
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Set an element in the array
+ * @param array The array to set in
+ * @param index The index of the element
+ * @param element The element to set
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_set(
+    BasecChunkedArray* array,
+    u64                index,
+    const void*        element
+) {
+    if (array == NULL || element == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+    if (index >= array->length) return BASEC_CHUNKED_ARRAY_OUT_OF_BOUNDS;
+
+    (void)memcpy(
+        _basec_chunked_array_element(array, index),
+        element,
+        array->element_size
+    );
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Get the address of an element
+ * @param array The array
+ * @param index The index of the element
+ * @param element_out The address of the element
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_at(
+    BasecChunkedArray* array,
+    u64                index,
+    void**             element_out
+) {
+    if (array == NULL || element_out == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+    if (index >= array->length) return BASEC_CHUNKED_ARRAY_OUT_OF_BOUNDS;
+
+    *element_out = _basec_chunked_array_element(array, index);
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Get the number of elements in the array
+ * @param array The array
+ * @param length_out The number of elements
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_length(
+    BasecChunkedArray* array,
+    u64*               length_out
+) {
+    if (array == NULL || length_out == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+
+    *length_out = array->length;
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Remove every element, keeping the blocks for the next appends
+ * @param array The array to clear
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_clear(BasecChunkedArray* array) {
+    if (array == NULL) return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+
+    array->length = 0;
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Copy the elements of a chunked array into one contiguous BasecArray
+ * @param array The chunked array to copy
+ * @param array_out The array to store the elements in
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_array_flatten(
+    BasecChunkedArray* array,
+    BasecArray**       array_out
+) {
+    if (array == NULL || array_out == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+
+    BasecArray* flat   = NULL;
+    u8*         data   = NULL;
+    u64         copied = 0;
+    u64         run    = 0;
+
+    if (
+        basec_array_create(
+            &flat,
+            array->element_size,
+            array->length > 0 ? array->length : 1
+        ) != BASEC_ARRAY_SUCCESS
+    ) {
+        if (flat != NULL) (void)basec_array_destroy(&flat);
+        return BASEC_CHUNKED_ARRAY_ALLOCATION_FAILURE;
+    }
+
+    data = (u8*)flat->data;
+    for (u64 block = 0; copied < array->length; block++) {
+        run = array->length - copied;
+        if (run > array->block_capacity) run = array->block_capacity;
+
+        (void)memcpy(
+            data + copied * array->element_size,
+            ((u8**)array->blocks->data)[block],
+            run * array->element_size
+        );
+        copied += run;
+    }
+    flat->length = array->length;
+
+    if (*array_out != NULL) (void)basec_array_destroy(array_out);
+    *array_out = flat;
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
+
+/**
+ * @brief Destroy a chunked array
+ * @param array The array to destroy
+ * @return The result of the operation
+ */
+BasecChunkedArrayResult basec_chunked_array_destroy(
+    BasecChunkedArray** array
+) {
+    if (array == NULL || *array == NULL) {
+        return BASEC_CHUNKED_ARRAY_NULL_POINTER;
+    }
+
+    for (u64 i = 0; i < (*array)->blocks->length; i++) {
+        free(((void**)(*array)->blocks->data)[i]);
+    }
+    (void)basec_array_destroy(&(*array)->blocks);
+    free(*array);
+    *array = NULL;
+    return BASEC_CHUNKED_ARRAY_SUCCESS;
+}
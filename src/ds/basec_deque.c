@@ -0,0 +1,418 @@
+#include "ds/basec_deque.h"
+
+static const u64 _MAX_CAPACITY = (u64)1 << 62;
+
+/**
+ * @brief Get the position of an element in the ring
+ * @param deque The deque
+ * @param index The index of the element, counting from the front
+ * @return The element
+ */
+static u8* _basec_deque_slot(BasecDeque* deque, u64 index) {
+    u64 position = (deque->head + index) & (deque->capacity - 1);
+
+    return (u8*)deque->data + position * deque->element_size;
+}
+
+/**
+ * @brief Grow the ring until it holds a number of elements
+ *
+ * Elements that wrapped past the end of the old ring are moved to just past
+ * it, so the elements stay in order from head.
+ *
+ * @param deque The deque to grow
+ * @param count The number of elements the deque must hold
+ * @return The result of the operation
+ */
+static BasecDequeResult _basec_deque_grow(BasecDeque* deque, u64 count) {
+    u64   capacity = deque->capacity;
+    u64   wrapped  = 0;
+    void* data     = NULL;
+
+    if (count <= capacity) return BASEC_DEQUE_SUCCESS;
+    if (count > _MAX_CAPACITY) return BASEC_DEQUE_ALLOCATION_FAILURE;
+
+    while (capacity < count) capacity <<= 1;
+    data = realloc(deque->data, capacity * deque->element_size);
+    if (data == NULL) return BASEC_DEQUE_ALLOCATION_FAILURE;
+
+    if (deque->head + deque->length > deque->capacity) {
+        wrapped = deque->head + deque->length - deque->capacity;
+        (void)memcpy(
+            (u8*)data + deque->capacity * deque->element_size,
+            data,
+            wrapped * deque->element_size
+        );
+    }
+
+    deque->data     = data;
+    deque->capacity = capacity;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Copy elements into the ring, in at most two runs
+ * @param deque The deque
+ * @param index The index of the first element, counting from the front
+ * @param elements The elements to copy
+ * @param count The number of elements
+ */
+static void _basec_deque_write(
+    BasecDeque* deque,
+    u64         index,
+    const u8*   elements,
+    u64         count
+) {
+    u64 size     = deque->element_size;
+    u64 position = (deque->head + index) & (deque->capacity - 1);
+    u64 first    = deque->capacity - position;
+
+    if (first > count) first = count;
+    (void)memcpy(
+        (u8*)deque->data + position * size,
+        elements,
+        first * size
+    );
+    if (count > first) {
+        (void)memcpy(
+            deque->data,
+            elements + first * size,
+            (count - first) * size
+        );
+    }
+}
+
+/**
+ * @brief Copy elements out of the ring, in at most two runs
+ * @param deque The deque
+ * @param index The index of the first element, counting from the front
+ * @param elements_out The copied elements
+ * @param count The number of elements
+ */
+static void _basec_deque_read(
+    BasecDeque* deque,
+    u64         index,
+    u8*         elements_out,
+    u64         count
+) {
+    u64 size     = deque->element_size;
+    u64 position = (deque->head + index) & (deque->capacity - 1);
+    u64 first    = deque->capacity - position;
+
+    if (first > count) first = count;
+    (void)memcpy(
+        elements_out,
+        (u8*)deque->data + position * size,
+        first * size
+    );
+    if (count > first) {
+        (void)memcpy(
+            elements_out + first * size,
+            deque->data,
+            (count - first) * size
+        );
+    }
+}
+
+/**
+ * @brief Handle the result of a deque operation
+ * @param result The result of the operation
+ */
+void basec_deque_handle_result(BasecDequeResult result) {
+    switch (result) {
+        case BASEC_DEQUE_SUCCESS:
+            break;
+        case BASEC_DEQUE_NULL_POINTER:
+            (void)printf(
+                "[Error][Deque] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_DEQUE_INVALID_ELEMENT_SIZE:
+            (void)printf(
+                "[Error][Deque] "
+                "Operation failed due to an invalid element size.\n"
+            );
+            exit(1);
+        case BASEC_DEQUE_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][Deque] "
+                "Operation failed due to an invalid capacity.\n"
+            );
+            exit(1);
+        case BASEC_DEQUE_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][Deque] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_DEQUE_EMPTY:
+            (void)printf(
+                "[Error][Deque] "
+                "Operation failed due to an empty deque.\n"
+            );
+            exit(1);
+        case BASEC_DEQUE_OUT_OF_BOUNDS:
+            (void)printf(
+                "[Error][Deque] "
+                "Operation failed due to an out of bounds index.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][Deque] "
+                "An unknown error occurred during deque operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a deque
+ * @param deque The deque to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_create(
+    BasecDeque** deque,
+    u64          element_size,
+    u64          capacity
+) {
+    if (deque == NULL) return BASEC_DEQUE_NULL_POINTER;
+    if (element_size == 0) return BASEC_DEQUE_INVALID_ELEMENT_SIZE;
+    if (capacity == 0 || capacity > _MAX_CAPACITY) {
+        return BASEC_DEQUE_INVALID_CAPACITY;
+    }
+
+    u64 rounded = 1;
+
+    while (rounded < capacity) rounded <<= 1;
+
+    *deque = (BasecDeque*)malloc(sizeof(BasecDeque));
+    if (*deque == NULL) return BASEC_DEQUE_ALLOCATION_FAILURE;
+
+    (*deque)->data = malloc(rounded * element_size);
+    if ((*deque)->data == NULL) {
+        free(*deque);
+        *deque = NULL;
+        return BASEC_DEQUE_ALLOCATION_FAILURE;
+    }
+
+    (*deque)->element_size = element_size;
+    (*deque)->capacity     = rounded;
+    (*deque)->head         = 0;
+    (*deque)->length       = 0;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Add an element after the back of the deque
+ * @param deque The deque to push to
+ * @param element The element to push
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_push_back(BasecDeque* deque, const void* element) {
+    if (deque == NULL || element == NULL) return BASEC_DEQUE_NULL_POINTER;
+
+    BasecDequeResult result = _basec_deque_grow(deque, deque->length + 1);
+    if (result != BASEC_DEQUE_SUCCESS) return result;
+
+    (void)memcpy(
+        _basec_deque_slot(deque, deque->length),
+        element,
+        deque->element_size
+    );
+    deque->length++;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Add an element before the front of the deque
+ * @param deque The deque to push to
+ * @param element The element to push
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_push_front(
+    BasecDeque* deque,
+    const void* element
+) {
+    if (deque == NULL || element == NULL) return BASEC_DEQUE_NULL_POINTER;
+
+    BasecDequeResult result = _basec_deque_grow(deque, deque->length + 1);
+    if (result != BASEC_DEQUE_SUCCESS) return result;
+
+    deque->head = (deque->head - 1) & (deque->capacity - 1);
+    (void)memcpy(_basec_deque_slot(deque, 0), element, deque->element_size);
+    deque->length++;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Remove the element at the back of the deque
+ * @param deque The deque to pop from
+ * @param element_out The popped element
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_pop_back(BasecDeque* deque, void* element_out) {
+    if (deque == NULL || element_out == NULL) return BASEC_DEQUE_NULL_POINTER;
+    if (deque->length == 0) return BASEC_DEQUE_EMPTY;
+
+    deque->length--;
+    (void)memcpy(
+        element_out,
+        _basec_deque_slot(deque, deque->length),
+        deque->element_size
+    );
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Remove the element at the front of the deque
+ * @param deque The deque to pop from
+ * @param element_out The popped element
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_pop_front(BasecDeque* deque, void* element_out) {
+    if (deque == NULL || element_out == NULL) return BASEC_DEQUE_NULL_POINTER;
+    if (deque->length == 0) return BASEC_DEQUE_EMPTY;
+
+    (void)memcpy(element_out, _basec_deque_slot(deque, 0), deque->element_size);
+    deque->head = (deque->head + 1) & (deque->capacity - 1);
+    deque->length--;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Add several elements after the back of the deque
+ * @param deque The deque to push to
+ * @param elements The elements to push, in order
+ * @param count The number of elements
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_push_back_n(
+    BasecDeque* deque,
+    const void* elements,
+    u64         count
+) {
+    if (deque == NULL || elements == NULL) return BASEC_DEQUE_NULL_POINTER;
+    if (count == 0) return BASEC_DEQUE_SUCCESS;
+    if (count > _MAX_CAPACITY) return BASEC_DEQUE_ALLOCATION_FAILURE;
+
+    BasecDequeResult result = _basec_deque_grow(deque, deque->length + count);
+    if (result != BASEC_DEQUE_SUCCESS) return result;
+
+    _basec_deque_write(deque, deque->length, (const u8*)elements, count);
+    deque->length += count;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Remove several elements from the front of the deque
+ * @param deque The deque to pop from
+ * @param elements_out The popped elements, in order, may be NULL
+ * @param count The number of elements
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_pop_front_n(
+    BasecDeque* deque,
+    void*       elements_out,
+    u64         count
+) {
+    if (deque == NULL) return BASEC_DEQUE_NULL_POINTER;
+    if (count > deque->length) return BASEC_DEQUE_OUT_OF_BOUNDS;
+
+    if (elements_out != NULL) {
+        _basec_deque_read(deque, 0, (u8*)elements_out, count);
+    }
+    deque->head    = (deque->head + count) & (deque->capacity - 1);
+    deque->length -= count;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Get an element of the deque
+ * @param deque The deque to get from
+ * @param index The index of the element, counting from the front
+ * @param element_out The element
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_get(
+    BasecDeque* deque,
+    u64         index,
+    void*       element_out
+) {
+    if (deque == NULL || element_out == NULL) return BASEC_DEQUE_NULL_POINTER;
+    if (index >= deque->length) return BASEC_DEQUE_OUT_OF_BOUNDS;
+
+    (void)memcpy(
+        element_out,
+        _basec_deque_slot(deque, index),
+        deque->element_size
+    );
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Get the elements of the deque without copying them
+ * @param deque The deque to view
+ * @param segments_out The runs of elements, front first
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_segments(
+    BasecDeque*         deque,
+    BasecDequeSegments* segments_out
+) {
+    if (deque == NULL || segments_out == NULL) {
+        return BASEC_DEQUE_NULL_POINTER;
+    }
+
+    u64 first = deque->capacity - deque->head;
+
+    if (first > deque->length) first = deque->length;
+    segments_out->first         = _basec_deque_slot(deque, 0);
+    segments_out->first_length  = first;
+    segments_out->second        = first < deque->length ? deque->data : NULL;
+    segments_out->second_length = deque->length - first;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Get the number of elements in the deque
+ * @param deque The deque
+ * @param length_out The number of elements
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_length(BasecDeque* deque, u64* length_out) {
+    if (deque == NULL || length_out == NULL) return BASEC_DEQUE_NULL_POINTER;
+
+    *length_out = deque->length;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Remove every element, keeping the capacity
+ * @param deque The deque to clear
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_clear(BasecDeque* deque) {
+    if (deque == NULL) return BASEC_DEQUE_NULL_POINTER;
+
+    deque->head   = 0;
+    deque->length = 0;
+    return BASEC_DEQUE_SUCCESS;
+}
+
+/**
+ * @brief Destroy a deque
+ * @param deque The deque to destroy
+ * @return The result of the operation
+ */
+BasecDequeResult basec_deque_destroy(BasecDeque** deque) {
+    if (deque == NULL || *deque == NULL) return BASEC_DEQUE_NULL_POINTER;
+
+    free((*deque)->data);
+    free(*deque);
+    *deque = NULL;
+    return BASEC_DEQUE_SUCCESS;
+}
@@ -0,0 +1,673 @@
+#include "ds/basec_hashmap.h"
+
+static const u8 _CONTROL_EMPTY   = 0x80;
+static const u8 _CONTROL_DELETED = 0xFE;
+static const u8 _GROWTH_FACTOR   = 2;
+
+/**
+ * @brief Get the alignment an element of a given size needs
+ * @param size The size of the element
+ * @return The largest power of two dividing size, at most 16
+ */
+static u64 _basec_hashmap_alignment(u64 size) {
+    u64 alignment = 1;
+
+    while (alignment < 16 && size % (alignment * 2) == 0) alignment *= 2;
+    return alignment;
+}
+
+/**
+ * @brief Round a size up to a multiple of an alignment
+ * @param size The size to round
+ * @param alignment The alignment, a power of two
+ * @return The rounded size
+ */
+static u64 _basec_hashmap_align(u64 size, u64 alignment) {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/**
+ * @brief Get the number of entries a table can hold before it must grow
+ *
+ * Tables are kept at most 7/8 full, past that probe sequences get long.
+ *
+ * @param capacity The number of slots of the table
+ * @return The number of entries
+ */
+static u64 _basec_hashmap_max_length(u64 capacity) {
+    return capacity - capacity / 8;
+}
+
+/**
+ * @brief Get the number of slots needed to hold a number of entries
+ * @param count The number of entries
+ * @return The number of slots, a power of two of at least one group
+ */
+static u64 _basec_hashmap_table_capacity(u64 count) {
+    u64 capacity = BASEC_HASHMAP_GROUP_SIZE;
+
+    while (_basec_hashmap_max_length(capacity) < count) {
+        capacity *= _GROWTH_FACTOR;
+    }
+    return capacity;
+}
+
+/**
+ * @brief Find the control bytes of a group equal to a byte
+ * @param group The 16 control bytes of the group
+ * @param byte The byte to match
+ * @return A bit per control byte, set when it matches
+ */
+static u32 _basec_hashmap_match(const u8* group, u8 byte) {
+#if defined(__SSE2__)
+    return (u32)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(
+            _mm_loadu_si128((const __m128i*)group),
+            _mm_set1_epi8((c8)byte)
+        )
+    );
+#else
+    u32 mask = 0;
+
+    for (u32 i = 0; i < BASEC_HASHMAP_GROUP_SIZE; i++) {
+        if (group[i] == byte) mask |= 1U << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Find the control bytes of a group that are empty or deleted
+ *
+ * Both markers have the top bit set, while full slots store 7 hash bits.
+ *
+ * @param group The 16 control bytes of the group
+ * @return A bit per control byte, set when its slot is free
+ */
+static u32 _basec_hashmap_match_free(const u8* group) {
+#if defined(__SSE2__)
+    return (u32)_mm_movemask_epi8(
+        _mm_loadu_si128((const __m128i*)group)
+    );
+#else
+    u32 mask = 0;
+
+    for (u32 i = 0; i < BASEC_HASHMAP_GROUP_SIZE; i++) {
+        if (group[i] & 0x80) mask |= 1U << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Get the hash of a key
+ * @param map The map the key belongs to
+ * @param key The key to hash
+ * @return The hash of the key
+ */
+static u64 _basec_hashmap_hash(BasecHashMap* map, const void* key) {
+    u64 hash = 0;
+
+    (void)basec_hash_bytes_seeded(key, map->key_size, map->seed, &hash);
+    return hash;
+}
+
+/**
+ * @brief Get the slot at an index
+ * @param map The map holding the slot
+ * @param index The index of the slot
+ * @return The first byte of the slot
+ */
+static u8* _basec_hashmap_slot(BasecHashMap* map, u64 index) {
+    return (u8*)map->slots->data + index * map->slots->element_size;
+}
+
+/**
+ * @brief Set the control byte of a slot, keeping the mirrored group in sync
+ * @param map The map holding the slot
+ * @param index The index of the slot
+ * @param byte The new control byte
+ */
+static void _basec_hashmap_set_control(
+    BasecHashMap* map,
+    u64           index,
+    u8            byte
+) {
+    u8* control = (u8*)map->control->data;
+
+    control[index] = byte;
+    if (index < BASEC_HASHMAP_GROUP_SIZE) control[map->capacity + index] = byte;
+}
+
+/**
+ * @brief Find the slot holding a key
+ *
+ * Groups are probed at triangular offsets, which visits every group of a
+ * power of two table. The search stops at the first group with an empty
+ * slot, since the key would have been placed there.
+ *
+ * @param map The map to search
+ * @param key The key to find
+ * @param hash The hash of the key
+ * @param index_out The index of the slot holding the key
+ * @return Whether the key was found
+ */
+static bool _basec_hashmap_find(
+    BasecHashMap* map,
+    const void*   key,
+    u64           hash,
+    u64*          index_out
+) {
+    const u8* control  = (const u8*)map->control->data;
+    u64       mask     = map->capacity - 1;
+    u64       position = (hash >> 7) & mask;
+    u64       stride   = 0;
+    u64       index    = 0;
+    u32       matches  = 0;
+    const u8* slot     = NULL;
+
+    while (true) {
+        matches = _basec_hashmap_match(control + position, (u8)(hash & 0x7F));
+        while (matches != 0) {
+            index = (position + (u64)__builtin_ctz(matches)) & mask;
+            slot  = _basec_hashmap_slot(map, index);
+            if (memcmp(slot, key, map->key_size) == 0) {
+                *index_out = index;
+                return true;
+            }
+            matches &= matches - 1;
+        }
+
+        if (_basec_hashmap_match(control + position, _CONTROL_EMPTY) != 0) {
+            return false;
+        }
+
+        stride   += BASEC_HASHMAP_GROUP_SIZE;
+        position  = (position + stride) & mask;
+        if (stride > map->capacity) return false;
+    }
+}
+
+/**
+ * @brief Find the first free slot in the probe sequence of a hash
+ * @param map The map to search
+ * @param hash The hash to probe for
+ * @return The index of the free slot
+ */
+static u64 _basec_hashmap_find_free(BasecHashMap* map, u64 hash) {
+    const u8* control  = (const u8*)map->control->data;
+    u64       mask     = map->capacity - 1;
+    u64       position = (hash >> 7) & mask;
+    u64       stride   = 0;
+    u32       matches  = 0;
+
+    // The table is never full, so a free slot always turns up
+    while ((matches = _basec_hashmap_match_free(control + position)) == 0) {
+        stride   += BASEC_HASHMAP_GROUP_SIZE;
+        position  = (position + stride) & mask;
+    }
+    return (position + (u64)__builtin_ctz(matches)) & mask;
+}
+
+/**
+ * @brief Allocate an empty table for the map
+ * @param map The map to allocate the table for
+ * @param capacity The number of slots, a power of two of at least one group
+ * @return The result of the operation
+ */
+static BasecHashMapResult _basec_hashmap_allocate(
+    BasecHashMap* map,
+    u64           capacity
+) {
+    BasecArray* control   = NULL;
+    BasecArray* slots     = NULL;
+    u64         alignment = _basec_hashmap_alignment(map->key_size);
+    u64         slot_size = 0;
+
+    if (map->value_size > 0) {
+        if (_basec_hashmap_alignment(map->value_size) > alignment) {
+            alignment = _basec_hashmap_alignment(map->value_size);
+        }
+        slot_size = _basec_hashmap_align(
+            map->value_offset + map->value_size,
+            alignment
+        );
+    } else {
+        slot_size = _basec_hashmap_align(map->key_size, alignment);
+    }
+
+    if (
+        basec_array_create(
+            &control,
+            sizeof(u8),
+            capacity + BASEC_HASHMAP_GROUP_SIZE
+        ) != BASEC_ARRAY_SUCCESS ||
+        basec_array_create(&slots, slot_size, capacity) != BASEC_ARRAY_SUCCESS
+    ) {
+        if (control != NULL) (void)basec_array_destroy(&control);
+        return BASEC_HASHMAP_ALLOCATION_FAILURE;
+    }
+
+    (void)memset(
+        control->data,
+        _CONTROL_EMPTY,
+        capacity + BASEC_HASHMAP_GROUP_SIZE
+    );
+    control->length = capacity + BASEC_HASHMAP_GROUP_SIZE;
+    slots->length   = capacity;
+
+    map->control     = control;
+    map->slots       = slots;
+    map->capacity    = capacity;
+    map->growth_left = _basec_hashmap_max_length(capacity) - map->length;
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Move every entry into a new table, dropping deleted markers
+ * @param map The map to resize
+ * @param capacity The number of slots of the new table
+ * @return The result of the operation
+ */
+static BasecHashMapResult _basec_hashmap_resize(
+    BasecHashMap* map,
+    u64           capacity
+) {
+    BasecHashMapResult map_result   = BASEC_HASHMAP_SUCCESS;
+    BasecArray*        old_control  = map->control;
+    BasecArray*        old_slots    = map->slots;
+    u64                old_capacity = map->capacity;
+    const u8*          control      = (const u8*)old_control->data;
+    u8*                slot         = NULL;
+    u64                hash         = 0;
+    u64                index        = 0;
+
+    map_result = _basec_hashmap_allocate(map, capacity);
+    if (map_result != BASEC_HASHMAP_SUCCESS) return map_result;
+
+    for (u64 i = 0; i < old_capacity; i++) {
+        if (control[i] & 0x80) continue;
+
+        slot  = (u8*)old_slots->data + i * old_slots->element_size;
+        hash  = _basec_hashmap_hash(map, slot);
+        index = _basec_hashmap_find_free(map, hash);
+        _basec_hashmap_set_control(map, index, (u8)(hash & 0x7F));
+        (void)memcpy(
+            _basec_hashmap_slot(map, index),
+            slot,
+            old_slots->element_size
+        );
+    }
+
+    (void)basec_array_destroy(&old_control);
+    (void)basec_array_destroy(&old_slots);
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Handle the result of a hash map operation
+ * @param result The result of the operation
+ */
+void basec_hashmap_handle_result(BasecHashMapResult result) {
+    switch (result) {
+        case BASEC_HASHMAP_SUCCESS:
+            break;
+        case BASEC_HASHMAP_NULL_POINTER:
+            (void)printf(
+                "[Error][HashMap] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_HASHMAP_INVALID_KEY_SIZE:
+            (void)printf(
+                "[Error][HashMap] "
+                "Operation failed due to an invalid key size.\n"
+            );
+            exit(1);
+        case BASEC_HASHMAP_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][HashMap] "
+                "Operation failed due to an invalid capacity.\n"
+            );
+            exit(1);
+        case BASEC_HASHMAP_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][HashMap] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_HASHMAP_NOT_FOUND:
+            (void)printf(
+                "[Error][HashMap] "
+                "Operation failed due to a key not being found.\n"
+            );
+            exit(1);
+        case BASEC_HASHMAP_END_OF_MAP:
+            (void)printf(
+                "[Error][HashMap] "
+                "Operation failed due to reaching the end of the map.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][HashMap] "
+                "An unknown error occurred during hash map operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a hash map
+ * @param map The map to create
+ * @param key_size The size of the keys
+ * @param value_size The size of the values, 0 to store keys only
+ * @param capacity The number of entries to hold without growing
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_create(
+    BasecHashMap** map,
+    u64            key_size,
+    u64            value_size,
+    u64            capacity
+) {
+    if (map == NULL) return BASEC_HASHMAP_NULL_POINTER;
+    if (key_size == 0) return BASEC_HASHMAP_INVALID_KEY_SIZE;
+    if (capacity == 0) return BASEC_HASHMAP_INVALID_CAPACITY;
+
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+
+    *map = (BasecHashMap*)malloc(sizeof(BasecHashMap));
+    if (*map == NULL) return BASEC_HASHMAP_ALLOCATION_FAILURE;
+
+    (*map)->key_size     = key_size;
+    (*map)->value_size   = value_size;
+    (*map)->value_offset = _basec_hashmap_align(
+        key_size,
+        _basec_hashmap_alignment(value_size)
+    );
+    (*map)->length       = 0;
+    (void)basec_hash_random_seed(&(*map)->seed);
+
+    map_result = _basec_hashmap_allocate(
+        *map,
+        _basec_hashmap_table_capacity(capacity)
+    );
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        free(*map);
+        *map = NULL;
+        return map_result;
+    }
+
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Insert an entry, replacing the value if the key is already present
+ * @param map The map to insert into
+ * @param key The key of the entry
+ * @param value The value of the entry, may be NULL when values have no size
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_insert(
+    BasecHashMap* map,
+    const void*   key,
+    const void*   value
+) {
+    if (map == NULL || key == NULL) return BASEC_HASHMAP_NULL_POINTER;
+    if (value == NULL && map->value_size > 0) {
+        return BASEC_HASHMAP_NULL_POINTER;
+    }
+
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+    u64                hash       = _basec_hashmap_hash(map, key);
+    u64                index      = 0;
+    u64                capacity   = map->capacity;
+    u8*                slot       = NULL;
+
+    if (!_basec_hashmap_find(map, key, hash, &index)) {
+        index = _basec_hashmap_find_free(map, hash);
+
+        // Only filling an empty slot uses up growth, deleted ones are reused
+        if (
+            map->growth_left == 0 &&
+            ((const u8*)map->control->data)[index] == _CONTROL_EMPTY
+        ) {
+            // Mostly deleted markers are cleared by rehashing in place
+            if (map->length + 1 > _basec_hashmap_max_length(capacity) / 2) {
+                capacity *= _GROWTH_FACTOR;
+            }
+            map_result = _basec_hashmap_resize(map, capacity);
+            if (map_result != BASEC_HASHMAP_SUCCESS) return map_result;
+            index = _basec_hashmap_find_free(map, hash);
+        }
+
+        if (((const u8*)map->control->data)[index] == _CONTROL_EMPTY) {
+            map->growth_left--;
+        }
+        _basec_hashmap_set_control(map, index, (u8)(hash & 0x7F));
+        (void)memcpy(_basec_hashmap_slot(map, index), key, map->key_size);
+        map->length++;
+    }
+
+    if (map->value_size > 0) {
+        slot = _basec_hashmap_slot(map, index);
+        (void)memcpy(slot + map->value_offset, value, map->value_size);
+    }
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Get the value stored for a key
+ * @param map The map to search
+ * @param key The key to find
+ * @param value_out The value to copy the entry's value into
+ * @return The result of the operation, BASEC_HASHMAP_NOT_FOUND if the key is
+ *         not present
+ */
+BasecHashMapResult basec_hashmap_get(
+    BasecHashMap* map,
+    const void*   key,
+    void*         value_out
+) {
+    if (map == NULL || key == NULL || value_out == NULL) {
+        return BASEC_HASHMAP_NULL_POINTER;
+    }
+
+    u64 index = 0;
+
+    if (!_basec_hashmap_find(map, key, _basec_hashmap_hash(map, key), &index)) {
+        return BASEC_HASHMAP_NOT_FOUND;
+    }
+
+    (void)memcpy(
+        value_out,
+        _basec_hashmap_slot(map, index) + map->value_offset,
+        map->value_size
+    );
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Check if the map contains a key
+ * @param map The map to search
+ * @param key The key to find
+ * @param contains_out Whether the key is present
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_contains(
+    BasecHashMap* map,
+    const void*   key,
+    bool*         contains_out
+) {
+    if (map == NULL || key == NULL || contains_out == NULL) {
+        return BASEC_HASHMAP_NULL_POINTER;
+    }
+
+    u64 index = 0;
+
+    *contains_out = _basec_hashmap_find(
+        map,
+        key,
+        _basec_hashmap_hash(map, key),
+        &index
+    );
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Remove the entry for a key
+ *
+ * A slot can go straight back to empty when every group that covers it
+ * still has another empty slot, as no probe can then have passed over it.
+ * Otherwise it is marked deleted so later probes carry on past it.
+ *
+ * @param map The map to remove from
+ * @param key The key to remove
+ * @return The result of the operation, BASEC_HASHMAP_NOT_FOUND if the key is
+ *         not present
+ */
+BasecHashMapResult basec_hashmap_remove(BasecHashMap* map, const void* key) {
+    if (map == NULL || key == NULL) return BASEC_HASHMAP_NULL_POINTER;
+
+    const u8* control = (const u8*)map->control->data;
+    u64       mask    = map->capacity - 1;
+    u64       index   = 0;
+    u32       before  = 0;
+    u32       after   = 0;
+
+    if (!_basec_hashmap_find(map, key, _basec_hashmap_hash(map, key), &index)) {
+        return BASEC_HASHMAP_NOT_FOUND;
+    }
+
+    before = _basec_hashmap_match(
+        control + ((index - BASEC_HASHMAP_GROUP_SIZE) & mask),
+        _CONTROL_EMPTY
+    );
+    after  = _basec_hashmap_match(control + index, _CONTROL_EMPTY);
+
+    if (
+        before != 0 &&
+        after != 0 &&
+        __builtin_clz(before << 16) + __builtin_ctz(after) <
+        BASEC_HASHMAP_GROUP_SIZE
+    ) {
+        _basec_hashmap_set_control(map, index, _CONTROL_EMPTY);
+        map->growth_left++;
+    } else {
+        _basec_hashmap_set_control(map, index, _CONTROL_DELETED);
+    }
+
+    map->length--;
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Make room for a number of entries so they insert without growing
+ * @param map The map to reserve in
+ * @param count The number of entries the map should hold
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_reserve(BasecHashMap* map, u64 count) {
+    if (map == NULL) return BASEC_HASHMAP_NULL_POINTER;
+
+    u64 capacity = _basec_hashmap_table_capacity(count);
+
+    if (capacity <= map->capacity) return BASEC_HASHMAP_SUCCESS;
+    return _basec_hashmap_resize(map, capacity);
+}
+
+/**
+ * @brief Get the number of entries in the map
+ * @param map The map
+ * @param length_out The number of entries
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_length(BasecHashMap* map, u64* length_out) {
+    if (map == NULL || length_out == NULL) return BASEC_HASHMAP_NULL_POINTER;
+
+    *length_out = map->length;
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Start iterating over the entries of a map
+ * @param map The map to iterate over
+ * @param iterator_out The iterator to initialise
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_iterator(
+    BasecHashMap*         map,
+    BasecHashMapIterator* iterator_out
+) {
+    if (map == NULL || iterator_out == NULL) return BASEC_HASHMAP_NULL_POINTER;
+
+    iterator_out->map   = map;
+    iterator_out->index = 0;
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Get the next entry of a map
+ *
+ * Free slots are skipped a group of control bytes at a time.
+ *
+ * @param iterator The iterator to advance
+ * @param key_out The key of the entry, pointing into the map
+ * @param value_out The value of the entry, pointing into the map, may be
+ *                  NULL
+ * @return The result of the operation, BASEC_HASHMAP_END_OF_MAP when no
+ *         entries remain
+ */
+BasecHashMapResult basec_hashmap_next(
+    BasecHashMapIterator* iterator,
+    void**                key_out,
+    void**                value_out
+) {
+    if (iterator == NULL || iterator->map == NULL || key_out == NULL) {
+        return BASEC_HASHMAP_NULL_POINTER;
+    }
+
+    BasecHashMap* map     = iterator->map;
+    const u8*     control = (const u8*)map->control->data;
+    u64           index   = iterator->index;
+    u32           full    = 0;
+    u8*           slot    = NULL;
+
+    for (; index < map->capacity; index += BASEC_HASHMAP_GROUP_SIZE) {
+        full = ~_basec_hashmap_match_free(control + index) & 0xFFFF;
+        if (map->capacity - index < BASEC_HASHMAP_GROUP_SIZE) {
+            full &= (1U << (map->capacity - index)) - 1;
+        }
+        if (full != 0) break;
+    }
+    if (index >= map->capacity) {
+        iterator->index = map->capacity;
+        return BASEC_HASHMAP_END_OF_MAP;
+    }
+
+    index           += (u64)__builtin_ctz(full);
+    iterator->index  = index + 1;
+    slot             = _basec_hashmap_slot(map, index);
+    *key_out         = slot;
+    if (value_out != NULL) {
+        *value_out = map->value_size > 0 ? slot + map->value_offset : NULL;
+    }
+    return BASEC_HASHMAP_SUCCESS;
+}
+
+/**
+ * @brief Destroy a hash map
+ * @param map The map to destroy
+ * @return The result of the operation
+ */
+BasecHashMapResult basec_hashmap_destroy(BasecHashMap** map) {
+    if (map == NULL || *map == NULL) return BASEC_HASHMAP_NULL_POINTER;
+
+    (void)basec_array_destroy(&(*map)->control);
+    (void)basec_array_destroy(&(*map)->slots);
+    free(*map);
+    *map = NULL;
+
+    return BASEC_HASHMAP_SUCCESS;
+}
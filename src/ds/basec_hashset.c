@@ -0,0 +1,292 @@
+#include "ds/basec_hashset.h"
+
+/**
+ * @brief Convert the result of a hash map operation
+ * @param result The result of the hash map operation
+ * @return The matching result of a hash set operation
+ */
+static BasecHashSetResult _basec_hashset_result(BasecHashMapResult result) {
+    switch (result) {
+        case BASEC_HASHMAP_SUCCESS:
+            return BASEC_HASHSET_SUCCESS;
+        case BASEC_HASHMAP_NULL_POINTER:
+            return BASEC_HASHSET_NULL_POINTER;
+        case BASEC_HASHMAP_INVALID_KEY_SIZE:
+            return BASEC_HASHSET_INVALID_ELEMENT_SIZE;
+        case BASEC_HASHMAP_INVALID_CAPACITY:
+            return BASEC_HASHSET_INVALID_CAPACITY;
+        case BASEC_HASHMAP_NOT_FOUND:
+            return BASEC_HASHSET_NOT_FOUND;
+        case BASEC_HASHMAP_END_OF_MAP:
+            return BASEC_HASHSET_END_OF_SET;
+        default:
+            return BASEC_HASHSET_ALLOCATION_FAILURE;
+    }
+}
+
+/**
+ * @brief Handle the result of a hash set operation
+ * @param result The result of the operation
+ */
+void basec_hashset_handle_result(BasecHashSetResult result) {
+    switch (result) {
+        case BASEC_HASHSET_SUCCESS:
+            break;
+        case BASEC_HASHSET_NULL_POINTER:
+            (void)printf(
+                "[Error][HashSet] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_HASHSET_INVALID_ELEMENT_SIZE:
+            (void)printf(
+                "[Error][HashSet] "
+                "Operation failed due to an invalid element size.\n"
+            );
+            exit(1);
+        case BASEC_HASHSET_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][HashSet] "
+                "Operation failed due to an invalid capacity.\n"
+            );
+            exit(1);
+        case BASEC_HASHSET_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][HashSet] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_HASHSET_NOT_FOUND:
+            (void)printf(
+                "[Error][HashSet] "
+                "Operation failed due to an element not being found.\n"
+            );
+            exit(1);
+        case BASEC_HASHSET_END_OF_SET:
+            (void)printf(
+                "[Error][HashSet] "
+                "Operation failed due to reaching the end of the set.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][HashSet] "
+                "An unknown error occurred during hash set operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a hash set
+ * @param set The set to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_create(
+    BasecHashSet** set,
+    u64            element_size,
+    u64            capacity
+) {
+    if (set == NULL) return BASEC_HASHSET_NULL_POINTER;
+    if (element_size == 0) return BASEC_HASHSET_INVALID_ELEMENT_SIZE;
+    if (capacity == 0) return BASEC_HASHSET_INVALID_CAPACITY;
+
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+
+    *set = (BasecHashSet*)malloc(sizeof(BasecHashSet));
+    if (*set == NULL) return BASEC_HASHSET_ALLOCATION_FAILURE;
+
+    (*set)->map          = NULL;
+    (*set)->element_size = element_size;
+
+    map_result = basec_hashmap_create(&(*set)->map, element_size, 0, capacity);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        free(*set);
+        *set = NULL;
+        return _basec_hashset_result(map_result);
+    }
+
+    return BASEC_HASHSET_SUCCESS;
+}
+
+/**
+ * @brief Insert an element if it is not already present
+ * @param set The set to insert into
+ * @param element The element to insert
+ * @param inserted_out Whether the element was new, may be NULL
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_insert(
+    BasecHashSet* set,
+    const void*   element,
+    bool*         inserted_out
+) {
+    if (set == NULL || element == NULL) return BASEC_HASHSET_NULL_POINTER;
+
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+    u64                length     = set->map->length;
+
+    // Values have no size, so inserting a present element changes nothing
+    map_result = basec_hashmap_insert(set->map, element, NULL);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        return _basec_hashset_result(map_result);
+    }
+
+    if (inserted_out != NULL) *inserted_out = set->map->length != length;
+    return BASEC_HASHSET_SUCCESS;
+}
+
+/**
+ * @brief Check if the set contains an element
+ * @param set The set to search
+ * @param element The element to find
+ * @param contains_out Whether the element is present
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_contains(
+    BasecHashSet* set,
+    const void*   element,
+    bool*         contains_out
+) {
+    if (set == NULL) return BASEC_HASHSET_NULL_POINTER;
+
+    return _basec_hashset_result(
+        basec_hashmap_contains(set->map, element, contains_out)
+    );
+}
+
+/**
+ * @brief Remove an element
+ * @param set The set to remove from
+ * @param element The element to remove
+ * @return The result of the operation, BASEC_HASHSET_NOT_FOUND if the element
+ *         is not present
+ */
+BasecHashSetResult basec_hashset_remove(
+    BasecHashSet* set,
+    const void*   element
+) {
+    if (set == NULL) return BASEC_HASHSET_NULL_POINTER;
+
+    return _basec_hashset_result(basec_hashmap_remove(set->map, element));
+}
+
+/**
+ * @brief Make room for a number of elements so they insert without growing
+ * @param set The set to reserve in
+ * @param count The number of elements the set should hold
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_reserve(BasecHashSet* set, u64 count) {
+    if (set == NULL) return BASEC_HASHSET_NULL_POINTER;
+
+    return _basec_hashset_result(basec_hashmap_reserve(set->map, count));
+}
+
+/**
+ * @brief Get the number of elements in the set
+ * @param set The set
+ * @param length_out The number of elements
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_length(BasecHashSet* set, u64* length_out) {
+    if (set == NULL) return BASEC_HASHSET_NULL_POINTER;
+
+    return _basec_hashset_result(basec_hashmap_length(set->map, length_out));
+}
+
+/**
+ * @brief Start iterating over the elements of a set
+ * @param set The set to iterate over
+ * @param iterator_out The iterator to initialise
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_iterator(
+    BasecHashSet*         set,
+    BasecHashSetIterator* iterator_out
+) {
+    if (set == NULL || iterator_out == NULL) {
+        return BASEC_HASHSET_NULL_POINTER;
+    }
+
+    return _basec_hashset_result(
+        basec_hashmap_iterator(set->map, &iterator_out->iterator)
+    );
+}
+
+/**
+ * @brief Get the next element of a set
+ * @param iterator The iterator to advance
+ * @param element_out The element, pointing into the set
+ * @return The result of the operation, BASEC_HASHSET_END_OF_SET when no
+ *         elements remain
+ */
+BasecHashSetResult basec_hashset_next(
+    BasecHashSetIterator* iterator,
+    void**                element_out
+) {
+    if (iterator == NULL) return BASEC_HASHSET_NULL_POINTER;
+
+    return _basec_hashset_result(
+        basec_hashmap_next(&iterator->iterator, element_out, NULL)
+    );
+}
+
+/**
+ * @brief Remove repeated elements from an array in place, keeping order
+ * @param array The array to remove repeats from
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_array_unique(BasecArray* array) {
+    if (array == NULL) return BASEC_HASHSET_NULL_POINTER;
+    if (array->length < 2) return BASEC_HASHSET_SUCCESS;
+
+    BasecHashSetResult set_result = BASEC_HASHSET_SUCCESS;
+    BasecHashSet*      seen       = NULL;
+    u8*                data       = (u8*)array->data;
+    u64                size       = array->element_size;
+    u64                length     = 0;
+    bool               inserted   = false;
+
+    // Sized for the worst case so the set never grows while deduplicating
+    set_result = basec_hashset_create(&seen, size, array->length);
+    if (set_result != BASEC_HASHSET_SUCCESS) return set_result;
+
+    for (u64 i = 0; i < array->length; i++) {
+        set_result = basec_hashset_insert(seen, data + i * size, &inserted);
+        if (set_result != BASEC_HASHSET_SUCCESS) {
+            (void)basec_hashset_destroy(&seen);
+            return set_result;
+        }
+        if (!inserted) continue;
+
+        if (length != i) {
+            (void)memcpy(data + length * size, data + i * size, size);
+        }
+        length++;
+    }
+
+    (void)basec_hashset_destroy(&seen);
+    array->length = length;
+    if (
+        array->index != NULL &&
+        basec_array_enable_index(array) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_HASHSET_ALLOCATION_FAILURE;
+    return BASEC_HASHSET_SUCCESS;
+}
+
+/**
+ * @brief Destroy a hash set
+ * @param set The set to destroy
+ * @return The result of the operation
+ */
+BasecHashSetResult basec_hashset_destroy(BasecHashSet** set) {
+    if (set == NULL || *set == NULL) return BASEC_HASHSET_NULL_POINTER;
+
+    (void)basec_hashmap_destroy(&(*set)->map);
+    free(*set);
+    *set = NULL;
+    return BASEC_HASHSET_SUCCESS;
+}
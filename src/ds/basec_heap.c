@@ -0,0 +1,387 @@
+#include "ds/basec_heap.h"
+
+/**
+ * @brief Get an element of the heap
+ * @param heap The heap
+ * @param index The index of the element
+ * @return The element
+ */
+static u8* _basec_heap_element(BasecHeap* heap, u64 index) {
+    return (u8*)heap->array->data + index * heap->array->element_size;
+}
+
+/**
+ * @brief Check if an element orders before another
+ * @param heap The heap ordering the elements
+ * @param a The first element
+ * @param b The second element
+ * @return Whether a orders strictly before b
+ */
+static bool _basec_heap_before(BasecHeap* heap, const u8* a, const u8* b) {
+    u64 key_a = 0;
+    u64 key_b = 0;
+
+    if (heap->compare != NULL) return heap->compare(a, b) < 0;
+
+    (void)memcpy(&key_a, a + heap->key_offset, sizeof(u64));
+    (void)memcpy(&key_b, b + heap->key_offset, sizeof(u64));
+    return key_a < key_b;
+}
+
+/**
+ * @brief Move an element up until its parent orders before it
+ *
+ * Parents are moved down into the hole instead of swapping, so every level
+ * costs one copy.
+ *
+ * @param heap The heap
+ * @param index The index of the element
+ */
+static void _basec_heap_sift_up(BasecHeap* heap, u64 index) {
+    u64 size   = heap->array->element_size;
+    u64 parent = 0;
+
+    (void)memcpy(heap->scratch, _basec_heap_element(heap, index), size);
+    while (index > 0) {
+        parent = (index - 1) / heap->arity;
+        if (
+            !_basec_heap_before(
+                heap,
+                heap->scratch,
+                _basec_heap_element(heap, parent)
+            )
+        ) break;
+
+        (void)memcpy(
+            _basec_heap_element(heap, index),
+            _basec_heap_element(heap, parent),
+            size
+        );
+        index = parent;
+    }
+    (void)memcpy(_basec_heap_element(heap, index), heap->scratch, size);
+}
+
+/**
+ * @brief Move an element down until no child orders before it
+ * @param heap The heap
+ * @param index The index of the element
+ */
+static void _basec_heap_sift_down(BasecHeap* heap, u64 index) {
+    u64 size   = heap->array->element_size;
+    u64 length = heap->array->length;
+    u64 first  = 0;
+    u64 last   = 0;
+    u64 best   = 0;
+
+    (void)memcpy(heap->scratch, _basec_heap_element(heap, index), size);
+    while ((first = index * heap->arity + 1) < length) {
+        last = first + heap->arity < length ? first + heap->arity : length;
+        best = first;
+        for (u64 child = first + 1; child < last; child++) {
+            if (
+                _basec_heap_before(
+                    heap,
+                    _basec_heap_element(heap, child),
+                    _basec_heap_element(heap, best)
+                )
+            ) best = child;
+        }
+        if (
+            !_basec_heap_before(
+                heap,
+                _basec_heap_element(heap, best),
+                heap->scratch
+            )
+        ) break;
+
+        (void)memcpy(
+            _basec_heap_element(heap, index),
+            _basec_heap_element(heap, best),
+            size
+        );
+        index = best;
+    }
+    (void)memcpy(_basec_heap_element(heap, index), heap->scratch, size);
+}
+
+/**
+ * @brief Allocate a heap once its ordering has been checked
+ * @param heap The heap to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing
+ * @param compare The comparator, NULL to order by key
+ * @param key_offset The offset of the u64 key in every element
+ * @param arity The number of children of every node
+ * @return The result of the operation
+ */
+static BasecHeapResult _basec_heap_create(
+    BasecHeap**       heap,
+    u64               element_size,
+    u64               capacity,
+    BasecArrayCompare compare,
+    u64               key_offset,
+    u64               arity
+) {
+    if (heap == NULL) return BASEC_HEAP_NULL_POINTER;
+    if (element_size == 0) return BASEC_HEAP_INVALID_ELEMENT_SIZE;
+    if (capacity == 0) return BASEC_HEAP_INVALID_CAPACITY;
+    if (arity < 2 || arity > BASEC_HEAP_MAX_ARITY) {
+        return BASEC_HEAP_INVALID_ARITY;
+    }
+
+    *heap = (BasecHeap*)malloc(sizeof(BasecHeap));
+    if (*heap == NULL) return BASEC_HEAP_ALLOCATION_FAILURE;
+
+    (*heap)->array      = NULL;
+    (*heap)->compare    = compare;
+    (*heap)->key_offset = key_offset;
+    (*heap)->arity      = arity;
+    (*heap)->scratch    = malloc(element_size);
+
+    if (
+        (*heap)->scratch == NULL ||
+        basec_array_create(&(*heap)->array, element_size, capacity) !=
+        BASEC_ARRAY_SUCCESS
+    ) {
+        free((*heap)->scratch);
+        free(*heap);
+        *heap = NULL;
+        return BASEC_HEAP_ALLOCATION_FAILURE;
+    }
+
+    return BASEC_HEAP_SUCCESS;
+}
+
+/**
+ * @brief Handle the result of a heap operation
+ * @param result The result of the operation
+ */
+void basec_heap_handle_result(BasecHeapResult result) {
+    switch (result) {
+        case BASEC_HEAP_SUCCESS:
+            break;
+        case BASEC_HEAP_NULL_POINTER:
+            (void)printf(
+                "[Error][Heap] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_HEAP_INVALID_ELEMENT_SIZE:
+            (void)printf(
+                "[Error][Heap] "
+                "Operation failed due to an invalid element size.\n"
+            );
+            exit(1);
+        case BASEC_HEAP_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][Heap] "
+                "Operation failed due to an invalid capacity.\n"
+            );
+            exit(1);
+        case BASEC_HEAP_INVALID_ARITY:
+            (void)printf(
+                "[Error][Heap] "
+                "Operation failed due to an invalid arity.\n"
+            );
+            exit(1);
+        case BASEC_HEAP_INVALID_KEY_OFFSET:
+            (void)printf(
+                "[Error][Heap] "
+                "Operation failed due to an invalid key offset.\n"
+            );
+            exit(1);
+        case BASEC_HEAP_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][Heap] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_HEAP_EMPTY:
+            (void)printf(
+                "[Error][Heap] "
+                "Operation failed due to an empty heap.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][Heap] "
+                "An unknown error occurred during heap operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a heap ordered by a comparator
+ * @param heap The heap to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing
+ * @param compare The comparator, the element ordering first is popped first
+ * @param arity The number of children of every node
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_create(
+    BasecHeap**       heap,
+    u64               element_size,
+    u64               capacity,
+    BasecArrayCompare compare,
+    u64               arity
+) {
+    if (compare == NULL) return BASEC_HEAP_NULL_POINTER;
+
+    return _basec_heap_create(heap, element_size, capacity, compare, 0, arity);
+}
+
+/**
+ * @brief Create a heap ordered by a u64 key inside every element
+ * @param heap The heap to create
+ * @param element_size The size of the elements
+ * @param capacity The number of elements to hold without growing
+ * @param key_offset The offset of the u64 key in every element
+ * @param arity The number of children of every node
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_create_keyed(
+    BasecHeap** heap,
+    u64         element_size,
+    u64         capacity,
+    u64         key_offset,
+    u64         arity
+) {
+    if (
+        element_size < sizeof(u64) ||
+        key_offset > element_size - sizeof(u64)
+    ) return BASEC_HEAP_INVALID_KEY_OFFSET;
+
+    return _basec_heap_create(
+        heap,
+        element_size,
+        capacity,
+        NULL,
+        key_offset,
+        arity
+    );
+}
+
+/**
+ * @brief Add an element to the heap
+ * @param heap The heap to push to
+ * @param element The element to push
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_push(BasecHeap* heap, const void* element) {
+    if (heap == NULL || element == NULL) return BASEC_HEAP_NULL_POINTER;
+
+    if (
+        basec_array_append(heap->array, (void*)element) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_HEAP_ALLOCATION_FAILURE;
+
+    _basec_heap_sift_up(heap, heap->array->length - 1);
+    return BASEC_HEAP_SUCCESS;
+}
+
+/**
+ * @brief Add every element of an array to the heap
+ * @param heap The heap to push to
+ * @param elements The array of elements, of the heap's element size
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_push_array(BasecHeap* heap, BasecArray* elements) {
+    if (heap == NULL || elements == NULL) return BASEC_HEAP_NULL_POINTER;
+    if (elements->element_size != heap->array->element_size) {
+        return BASEC_HEAP_INVALID_ELEMENT_SIZE;
+    }
+
+    u64 length  = heap->array->length;
+    u64 parents = 0;
+
+    for (u64 i = 0; i < elements->length; i++) {
+        if (
+            basec_array_append(
+                heap->array,
+                (u8*)elements->data + i * elements->element_size
+            ) != BASEC_ARRAY_SUCCESS
+        ) {
+            heap->array->length = length;
+            return BASEC_HEAP_ALLOCATION_FAILURE;
+        }
+    }
+
+    // Sifting down every parent from the last one up is linear in total
+    length  = heap->array->length;
+    parents = length > 1 ? (length - 2) / heap->arity + 1 : 0;
+    for (u64 i = parents; i > 0; i--) _basec_heap_sift_down(heap, i - 1);
+    return BASEC_HEAP_SUCCESS;
+}
+
+/**
+ * @brief Remove the element that orders first
+ * @param heap The heap to pop from
+ * @param element_out The popped element
+ * @return The result of the operation, BASEC_HEAP_EMPTY if the heap is empty
+ */
+BasecHeapResult basec_heap_pop(BasecHeap* heap, void* element_out) {
+    if (heap == NULL || element_out == NULL) return BASEC_HEAP_NULL_POINTER;
+    if (heap->array->length == 0) return BASEC_HEAP_EMPTY;
+
+    u64 size = heap->array->element_size;
+
+    (void)memcpy(element_out, _basec_heap_element(heap, 0), size);
+    heap->array->length--;
+    if (heap->array->length > 0) {
+        (void)memcpy(
+            _basec_heap_element(heap, 0),
+            _basec_heap_element(heap, heap->array->length),
+            size
+        );
+        _basec_heap_sift_down(heap, 0);
+    }
+    return BASEC_HEAP_SUCCESS;
+}
+
+/**
+ * @brief Get the element that orders first without removing it
+ * @param heap The heap
+ * @param element_out The first element
+ * @return The result of the operation, BASEC_HEAP_EMPTY if the heap is empty
+ */
+BasecHeapResult basec_heap_peek(BasecHeap* heap, void* element_out) {
+    if (heap == NULL || element_out == NULL) return BASEC_HEAP_NULL_POINTER;
+    if (heap->array->length == 0) return BASEC_HEAP_EMPTY;
+
+    (void)memcpy(
+        element_out,
+        _basec_heap_element(heap, 0),
+        heap->array->element_size
+    );
+    return BASEC_HEAP_SUCCESS;
+}
+
+/**
+ * @brief Get the number of elements in the heap
+ * @param heap The heap
+ * @param length_out The number of elements
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_length(BasecHeap* heap, u64* length_out) {
+    if (heap == NULL || length_out == NULL) return BASEC_HEAP_NULL_POINTER;
+
+    *length_out = heap->array->length;
+    return BASEC_HEAP_SUCCESS;
+}
+
+/**
+ * @brief Destroy a heap
+ * @param heap The heap to destroy
+ * @return The result of the operation
+ */
+BasecHeapResult basec_heap_destroy(BasecHeap** heap) {
+    if (heap == NULL || *heap == NULL) return BASEC_HEAP_NULL_POINTER;
+
+    (void)basec_array_destroy(&(*heap)->array);
+    free((*heap)->scratch);
+    free(*heap);
+    *heap = NULL;
+    return BASEC_HEAP_SUCCESS;
+}
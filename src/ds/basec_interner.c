@@ -0,0 +1,542 @@
+#include "ds/basec_interner.h"
+
+/**
+ * @brief Get the shard a string belongs to
+ * @param interner The interner
+ * @param string The bytes of the string
+ * @return The shard
+ */
+static BasecInternerShard* _basec_interner_shard(
+    BasecInterner*  interner,
+    BasecStringView string
+) {
+    u64 hash = 0;
+
+    (void)basec_hash_bytes_seeded(
+        string.data,
+        string.length,
+        interner->seed,
+        &hash
+    );
+    return &interner->shards[(hash >> 32) % BASEC_INTERNER_SHARDS];
+}
+
+/**
+ * @brief Find the segment holding an atom and the atom's place in it
+ *
+ * Segment k holds BASEC_INTERNER_FIRST_SEGMENT << k atoms, so offsetting the
+ * atom by the first segment's size makes its highest bit the segment.
+ *
+ * @param atom The atom
+ * @param segment_out The segment of the atom
+ * @param index_out The index of the atom in its segment
+ */
+static void _basec_interner_locate(
+    u64  atom,
+    u64* segment_out,
+    u64* index_out
+) {
+    u64 position = atom + BASEC_INTERNER_FIRST_SEGMENT;
+    u64 segment  = (u64)(
+        __builtin_clzll(BASEC_INTERNER_FIRST_SEGMENT) -
+        __builtin_clzll(position)
+    );
+
+    *segment_out = segment;
+    *index_out   = position - (BASEC_INTERNER_FIRST_SEGMENT << segment);
+}
+
+/**
+ * @brief Copy a string into the blocks and give it the next atom
+ *
+ * Must be called with the string's shard locked for writing, so the same
+ * string is never added twice.
+ *
+ * @param interner The interner
+ * @param string The bytes of the string
+ * @param atom_out The atom of the string
+ * @return The result of the operation
+ */
+static BasecInternerResult _basec_interner_add(
+    BasecInterner*  interner,
+    BasecStringView string,
+    u32*            atom_out
+) {
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecStringView*    views           = NULL;
+    c_str               block           = NULL;
+    u64                 capacity        = BASEC_INTERNER_BLOCK_SIZE;
+    u64                 segment         = 0;
+    u64                 index           = 0;
+
+    if (pthread_mutex_lock(&interner->lock) != 0) {
+        return BASEC_INTERNER_LOCK_FAILURE;
+    }
+
+    _basec_interner_locate(interner->length, &segment, &index);
+    if (segment >= BASEC_INTERNER_SEGMENTS) {
+        interner_result = BASEC_INTERNER_TOO_MANY_ATOMS;
+    }
+
+    if (
+        interner_result == BASEC_INTERNER_SUCCESS &&
+        interner->views[segment] == NULL
+    ) {
+        views = (BasecStringView*)malloc(
+            (BASEC_INTERNER_FIRST_SEGMENT << segment) *
+            sizeof(BasecStringView)
+        );
+        if (views == NULL) {
+            interner_result = BASEC_INTERNER_ALLOCATION_FAILURE;
+        } else {
+            interner->views[segment] = views;
+        }
+    }
+
+    // Blocks are never reallocated, canonical views must not move
+    if (
+        interner_result == BASEC_INTERNER_SUCCESS &&
+        interner->block_length + string.length + 1 > interner->block_capacity
+    ) {
+        if (capacity < string.length + 1) capacity = string.length + 1;
+        block = (c_str)malloc(capacity);
+        if (block == NULL) {
+            interner_result = BASEC_INTERNER_ALLOCATION_FAILURE;
+        } else if (
+            basec_array_append(interner->blocks, &block) !=
+            BASEC_ARRAY_SUCCESS
+        ) {
+            free(block);
+            interner_result = BASEC_INTERNER_ARRAY_FAILURE;
+        } else {
+            interner->block          = block;
+            interner->block_length   = 0;
+            interner->block_capacity = capacity;
+        }
+    }
+
+    if (interner_result == BASEC_INTERNER_SUCCESS) {
+        block = interner->block + interner->block_length;
+        (void)memcpy(block, string.data, string.length);
+        block[string.length]    = '\0';
+        interner->block_length += string.length + 1;
+
+        interner->views[segment][index].data   = block;
+        interner->views[segment][index].length = string.length;
+        *atom_out = (u32)interner->length;
+
+        // Publishes the view to basec_interner_view, which reads unlocked
+        __atomic_store_n(
+            &interner->length,
+            interner->length + 1,
+            __ATOMIC_RELEASE
+        );
+    }
+
+    (void)pthread_mutex_unlock(&interner->lock);
+    return interner_result;
+}
+
+/**
+ * @brief Find the next occurrence of a delimiter in a string
+ * @param string The string to search
+ * @param start The index to start searching from
+ * @param delimiter The delimiter
+ * @param delim_len The length of the delimiter, at least 1
+ * @return The index of the delimiter, the string's length if there is none
+ */
+static u64 _basec_interner_next_delimiter(
+    BasecString* string,
+    u64          start,
+    const c_str  delimiter,
+    u64          delim_len
+) {
+    const c8* found = NULL;
+
+    while (start + delim_len <= string->length) {
+        found = (const c8*)memchr(
+            string->data + start,
+            delimiter[0],
+            string->length - delim_len + 1 - start
+        );
+        if (found == NULL) break;
+
+        start = (u64)(found - string->data);
+        if (memcmp(found, delimiter, delim_len) == 0) return start;
+        start++;
+    }
+    return string->length;
+}
+
+/**
+ * @brief Handle the result of an interner operation
+ * @param result The result of the operation
+ */
+void basec_interner_handle_result(BasecInternerResult result) {
+    switch (result) {
+        case BASEC_INTERNER_SUCCESS:
+            break;
+        case BASEC_INTERNER_NULL_POINTER:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_INTERNER_INVALID_ATOM:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to an invalid atom.\n"
+            );
+            exit(1);
+        case BASEC_INTERNER_INVALID_DELIMITER:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to an empty delimiter.\n"
+            );
+            exit(1);
+        case BASEC_INTERNER_STRING_TOO_LONG:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to a string being too long.\n"
+            );
+            exit(1);
+        case BASEC_INTERNER_TOO_MANY_ATOMS:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to running out of atoms.\n"
+            );
+            exit(1);
+        case BASEC_INTERNER_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_INTERNER_LOCK_FAILURE:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to a lock failure.\n"
+            );
+            exit(1);
+        case BASEC_INTERNER_ARRAY_FAILURE:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to an array failure.\n"
+            );
+            exit(1);
+        case BASEC_INTERNER_NOT_FOUND:
+            (void)printf(
+                "[Error][Interner] "
+                "Operation failed due to a string not being found.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][Interner] "
+                "An unknown error occurred during interner operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create an interner
+ * @param interner The interner to create
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_create(BasecInterner** interner) {
+    if (interner == NULL) return BASEC_INTERNER_NULL_POINTER;
+
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    u64                 shards          = 0;
+
+    *interner = (BasecInterner*)aligned_alloc(
+        BASEC_INTERNER_CACHE_LINE,
+        sizeof(BasecInterner)
+    );
+    if (*interner == NULL) return BASEC_INTERNER_ALLOCATION_FAILURE;
+
+    (void)memset((*interner)->views, 0, sizeof((*interner)->views));
+    (*interner)->blocks         = NULL;
+    (*interner)->block          = NULL;
+    (*interner)->block_length   = 0;
+    (*interner)->block_capacity = 0;
+    (*interner)->length         = 0;
+    (void)basec_hash_random_seed(&(*interner)->seed);
+
+    if (pthread_mutex_init(&(*interner)->lock, NULL) != 0) {
+        free(*interner);
+        *interner = NULL;
+        return BASEC_INTERNER_LOCK_FAILURE;
+    }
+    if (
+        basec_array_create(&(*interner)->blocks, sizeof(c_str), 4) !=
+        BASEC_ARRAY_SUCCESS
+    ) interner_result = BASEC_INTERNER_ARRAY_FAILURE;
+
+    while (
+        interner_result == BASEC_INTERNER_SUCCESS &&
+        shards < BASEC_INTERNER_SHARDS
+    ) {
+        BasecInternerShard* shard = &(*interner)->shards[shards];
+
+        if (
+            basec_strmap_create(&shard->atoms, sizeof(u32), 16) !=
+            BASEC_STRMAP_SUCCESS
+        ) {
+            interner_result = BASEC_INTERNER_ALLOCATION_FAILURE;
+        } else if (pthread_rwlock_init(&shard->lock, NULL) != 0) {
+            (void)basec_strmap_destroy(&shard->atoms);
+            interner_result = BASEC_INTERNER_LOCK_FAILURE;
+        } else {
+            shards++;
+        }
+    }
+
+    if (interner_result != BASEC_INTERNER_SUCCESS) {
+        for (u64 i = 0; i < shards; i++) {
+            (void)basec_strmap_destroy(&(*interner)->shards[i].atoms);
+            (void)pthread_rwlock_destroy(&(*interner)->shards[i].lock);
+        }
+        if ((*interner)->blocks != NULL) {
+            (void)basec_array_destroy(&(*interner)->blocks);
+        }
+        (void)pthread_mutex_destroy(&(*interner)->lock);
+        free(*interner);
+        *interner = NULL;
+        return interner_result;
+    }
+
+    return BASEC_INTERNER_SUCCESS;
+}
+
+/**
+ * @brief Get the atom of a string, adding the string if it is new
+ * @param interner The interner
+ * @param string The bytes of the string
+ * @param atom_out The atom of the string
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_intern(
+    BasecInterner*  interner,
+    BasecStringView string,
+    u32*            atom_out
+) {
+    if (interner == NULL || string.data == NULL || atom_out == NULL) {
+        return BASEC_INTERNER_NULL_POINTER;
+    }
+    if (string.length > U32_MAX) return BASEC_INTERNER_STRING_TOO_LONG;
+
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecStrMapResult   map_result      = BASEC_STRMAP_SUCCESS;
+    BasecInternerShard* shard           = NULL;
+    u32                 atom            = 0;
+
+    shard = _basec_interner_shard(interner, string);
+
+    if (pthread_rwlock_rdlock(&shard->lock) != 0) {
+        return BASEC_INTERNER_LOCK_FAILURE;
+    }
+    map_result = basec_strmap_get(shard->atoms, string, &atom);
+    (void)pthread_rwlock_unlock(&shard->lock);
+    if (map_result == BASEC_STRMAP_SUCCESS) {
+        *atom_out = atom;
+        return BASEC_INTERNER_SUCCESS;
+    }
+
+    // Another thread may have added the string between the two locks
+    if (pthread_rwlock_wrlock(&shard->lock) != 0) {
+        return BASEC_INTERNER_LOCK_FAILURE;
+    }
+    map_result = basec_strmap_get(shard->atoms, string, &atom);
+    if (map_result == BASEC_STRMAP_NOT_FOUND) {
+        interner_result = _basec_interner_add(interner, string, &atom);
+        if (interner_result == BASEC_INTERNER_SUCCESS) {
+            map_result = basec_strmap_insert(shard->atoms, string, &atom);
+            if (map_result != BASEC_STRMAP_SUCCESS) {
+                interner_result = BASEC_INTERNER_ALLOCATION_FAILURE;
+            }
+        }
+    }
+    (void)pthread_rwlock_unlock(&shard->lock);
+    if (interner_result != BASEC_INTERNER_SUCCESS) return interner_result;
+
+    *atom_out = atom;
+    return BASEC_INTERNER_SUCCESS;
+}
+
+/**
+ * @brief Get the atom of a string without adding it
+ * @param interner The interner
+ * @param string The bytes of the string
+ * @param atom_out The atom of the string
+ * @return The result of the operation, BASEC_INTERNER_NOT_FOUND if the string
+ *         was never interned
+ */
+BasecInternerResult basec_interner_find(
+    BasecInterner*  interner,
+    BasecStringView string,
+    u32*            atom_out
+) {
+    if (interner == NULL || string.data == NULL || atom_out == NULL) {
+        return BASEC_INTERNER_NULL_POINTER;
+    }
+
+    BasecStrMapResult   map_result = BASEC_STRMAP_SUCCESS;
+    BasecInternerShard* shard      = NULL;
+
+    shard = _basec_interner_shard(interner, string);
+
+    if (pthread_rwlock_rdlock(&shard->lock) != 0) {
+        return BASEC_INTERNER_LOCK_FAILURE;
+    }
+    map_result = basec_strmap_get(shard->atoms, string, atom_out);
+    (void)pthread_rwlock_unlock(&shard->lock);
+
+    if (map_result != BASEC_STRMAP_SUCCESS) return BASEC_INTERNER_NOT_FOUND;
+    return BASEC_INTERNER_SUCCESS;
+}
+
+/**
+ * @brief Get the canonical copy of an atom's string
+ * @param interner The interner
+ * @param atom The atom
+ * @param view_out The canonical view of the string
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_view(
+    BasecInterner*   interner,
+    u32              atom,
+    BasecStringView* view_out
+) {
+    if (interner == NULL || view_out == NULL) {
+        return BASEC_INTERNER_NULL_POINTER;
+    }
+
+    u64 segment = 0;
+    u64 index   = 0;
+
+    if (atom >= __atomic_load_n(&interner->length, __ATOMIC_ACQUIRE)) {
+        return BASEC_INTERNER_INVALID_ATOM;
+    }
+
+    _basec_interner_locate(atom, &segment, &index);
+    *view_out = interner->views[segment][index];
+    return BASEC_INTERNER_SUCCESS;
+}
+
+/**
+ * @brief Get the number of atoms in the interner
+ * @param interner The interner
+ * @param length_out The number of atoms
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_length(
+    BasecInterner* interner,
+    u64*           length_out
+) {
+    if (interner == NULL || length_out == NULL) {
+        return BASEC_INTERNER_NULL_POINTER;
+    }
+
+    *length_out = __atomic_load_n(&interner->length, __ATOMIC_ACQUIRE);
+    return BASEC_INTERNER_SUCCESS;
+}
+
+/**
+ * @brief Split a string by a delimiter into the atoms of its parts
+ * @param string The string to split
+ * @param delimiter The delimiter to split the string by
+ * @param interner The interner to intern the parts in
+ * @param array_out The array of u32 atoms, replaced if not NULL
+ * @return The result of the operation
+ */
+BasecInternerResult basec_string_split_interned(
+    BasecString*   string,
+    const c_str    delimiter,
+    BasecInterner* interner,
+    BasecArray**   array_out
+) {
+    if (
+        string == NULL ||
+        delimiter == NULL ||
+        interner == NULL ||
+        array_out == NULL
+    ) return BASEC_INTERNER_NULL_POINTER;
+    if (delimiter[0] == '\0') return BASEC_INTERNER_INVALID_DELIMITER;
+
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecArray*         array           = NULL;
+    BasecStringView     part            = {0};
+    u64                 delim_len       = strlen(delimiter);
+    u64                 start           = 0;
+    u64                 end             = 0;
+    u32                 atom            = 0;
+
+    if (
+        basec_array_create(&array, sizeof(u32), 8) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_INTERNER_ARRAY_FAILURE;
+
+    while (interner_result == BASEC_INTERNER_SUCCESS) {
+        end = _basec_interner_next_delimiter(
+            string,
+            start,
+            delimiter,
+            delim_len
+        );
+
+        part.data       = string->data + start;
+        part.length     = end - start;
+        interner_result = basec_interner_intern(interner, part, &atom);
+        if (
+            interner_result == BASEC_INTERNER_SUCCESS &&
+            basec_array_append(array, &atom) != BASEC_ARRAY_SUCCESS
+        ) interner_result = BASEC_INTERNER_ARRAY_FAILURE;
+
+        if (end == string->length) break;
+        start = end + delim_len;
+    }
+
+    if (interner_result != BASEC_INTERNER_SUCCESS) {
+        (void)basec_array_destroy(&array);
+        return interner_result;
+    }
+
+    if (*array_out != NULL) {
+        if (basec_array_destroy(array_out) != BASEC_ARRAY_SUCCESS) {
+            (void)basec_array_destroy(&array);
+            return BASEC_INTERNER_ARRAY_FAILURE;
+        }
+    }
+
+    *array_out = array;
+    return BASEC_INTERNER_SUCCESS;
+}
+
+/**
+ * @brief Destroy an interner and every canonical copy it holds
+ * @param interner The interner to destroy
+ * @return The result of the operation
+ */
+BasecInternerResult basec_interner_destroy(BasecInterner** interner) {
+    if (interner == NULL || *interner == NULL) {
+        return BASEC_INTERNER_NULL_POINTER;
+    }
+
+    for (u64 i = 0; i < BASEC_INTERNER_SHARDS; i++) {
+        (void)basec_strmap_destroy(&(*interner)->shards[i].atoms);
+        (void)pthread_rwlock_destroy(&(*interner)->shards[i].lock);
+    }
+    for (u64 i = 0; i < BASEC_INTERNER_SEGMENTS; i++) {
+        free((*interner)->views[i]);
+    }
+    for (u64 i = 0; i < (*interner)->blocks->length; i++) {
+        free(((c_str*)(*interner)->blocks->data)[i]);
+    }
+    (void)basec_array_destroy(&(*interner)->blocks);
+    (void)pthread_mutex_destroy(&(*interner)->lock);
+
+    free(*interner);
+    *interner = NULL;
+    return BASEC_INTERNER_SUCCESS;
+}
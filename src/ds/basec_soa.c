@@ -0,0 +1,366 @@
+#include "ds/basec_soa.h"
+
+/**
+ * @brief Check that fields are non-empty, lie within a row and do not
+ *        overlap
+ * @param fields The fields of a record
+ * @param field_count The number of fields
+ * @param row_size The size of a record
+ * @return Whether the layout is valid
+ */
+static bool _basec_soa_valid_layout(
+    const BasecSoAField* fields,
+    u64                  field_count,
+    u64                  row_size
+) {
+    for (u64 i = 0; i < field_count; i++) {
+        if (fields[i].size == 0 || fields[i].size > row_size) return false;
+        if (fields[i].offset > row_size - fields[i].size) return false;
+
+        for (u64 j = 0; j < i; j++) {
+            if (
+                fields[i].offset < fields[j].offset + fields[j].size &&
+                fields[j].offset < fields[i].offset + fields[i].size
+            ) return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Handle the result of a SoA operation
+ * @param result The result of the operation
+ */
+void basec_soa_handle_result(BasecSoAResult result) {
+    switch (result) {
+        case BASEC_SOA_SUCCESS:
+            break;
+        case BASEC_SOA_NULL_POINTER:
+            (void)printf(
+                "[Error][SoA] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_SOA_INVALID_LAYOUT:
+            (void)printf(
+                "[Error][SoA] "
+                "Operation failed due to an invalid field layout.\n"
+            );
+            exit(1);
+        case BASEC_SOA_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][SoA] "
+                "Operation failed due to an invalid capacity.\n"
+            );
+            exit(1);
+        case BASEC_SOA_INVALID_FIELD:
+            (void)printf(
+                "[Error][SoA] "
+                "Operation failed due to an invalid field.\n"
+            );
+            exit(1);
+        case BASEC_SOA_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][SoA] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_SOA_OUT_OF_BOUNDS:
+            (void)printf(
+                "[Error][SoA] "
+                "Operation failed due to an out of bounds index.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][SoA] "
+                "An unknown error occurred during SoA operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a SoA from a field layout
+ * @param soa The SoA to create
+ * @param fields The fields of a record, copied into the SoA
+ * @param field_count The number of fields
+ * @param row_size The size of a record, like sizeof of its struct
+ * @param capacity The number of rows to allocate room for
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_create(
+    BasecSoA**           soa,
+    const BasecSoAField* fields,
+    u64                  field_count,
+    u64                  row_size,
+    u64                  capacity
+) {
+    if (soa == NULL || fields == NULL) return BASEC_SOA_NULL_POINTER;
+    if (field_count == 0 || row_size == 0) return BASEC_SOA_INVALID_LAYOUT;
+    if (!_basec_soa_valid_layout(fields, field_count, row_size)) {
+        return BASEC_SOA_INVALID_LAYOUT;
+    }
+    if (capacity == 0) return BASEC_SOA_INVALID_CAPACITY;
+
+    *soa = (BasecSoA*)malloc(sizeof(BasecSoA));
+    if (*soa == NULL) return BASEC_SOA_ALLOCATION_FAILURE;
+
+    (*soa)->columns     = (BasecArray**)calloc(field_count, sizeof(void*));
+    (*soa)->fields      = (BasecSoAField*)malloc(
+        field_count * sizeof(BasecSoAField)
+    );
+    (*soa)->field_count = field_count;
+    (*soa)->row_size    = row_size;
+    (*soa)->length      = 0;
+    if ((*soa)->columns == NULL || (*soa)->fields == NULL) {
+        (void)basec_soa_destroy(soa);
+        return BASEC_SOA_ALLOCATION_FAILURE;
+    }
+
+    (void)memcpy((*soa)->fields, fields, field_count * sizeof(BasecSoAField));
+    for (u64 i = 0; i < field_count; i++) {
+        if (
+            basec_array_create_aligned(
+                &(*soa)->columns[i],
+                fields[i].size,
+                capacity,
+                BASEC_SOA_COLUMN_ALIGNMENT
+            ) != BASEC_ARRAY_SUCCESS
+        ) {
+            (void)basec_soa_destroy(soa);
+            return BASEC_SOA_ALLOCATION_FAILURE;
+        }
+    }
+
+    return BASEC_SOA_SUCCESS;
+}
+
+/**
+ * @brief Append a record, one field to each column
+ * @param soa The SoA to append to
+ * @param row The record, row_size bytes
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_append(BasecSoA* soa, const void* row) {
+    if (soa == NULL || row == NULL) return BASEC_SOA_NULL_POINTER;
+
+    for (u64 i = 0; i < soa->field_count; i++) {
+        if (
+            basec_array_append(
+                soa->columns[i],
+                (u8*)row + soa->fields[i].offset
+            ) != BASEC_ARRAY_SUCCESS
+        ) {
+            // Keep every column at the same length
+            for (u64 j = 0; j < i; j++) soa->columns[j]->length--;
+            return BASEC_SOA_ALLOCATION_FAILURE;
+        }
+    }
+
+    soa->length++;
+    return BASEC_SOA_SUCCESS;
+}
+
+/**
+ * @brief Get a record, gathered from every column
+ * @param soa The SoA
+ * @param index The index of the row
+ * @param row_out The record to fill in, row_size bytes of which only the
+ *                fields are written
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_get(BasecSoA* soa, u64 index, void* row_out) {
+    if (soa == NULL || row_out == NULL) return BASEC_SOA_NULL_POINTER;
+    if (index >= soa->length) return BASEC_SOA_OUT_OF_BOUNDS;
+
+    u64 size = 0;
+
+    for (u64 i = 0; i < soa->field_count; i++) {
+        size = soa->fields[i].size;
+        (void)memcpy(
+            (u8*)row_out + soa->fields[i].offset,
+            (u8*)soa->columns[i]->data + index * size,
+            size
+        );
+    }
+
+    return BASEC_SOA_SUCCESS;
+}
+
+/**
+ * @brief Set a record, scattered into every column
+ * @param soa The SoA
+ * @param index The index of the row
+ * @param row The record, row_size bytes
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_set(BasecSoA* soa, u64 index, const void* row) {
+    if (soa == NULL || row == NULL) return BASEC_SOA_NULL_POINTER;
+    if (index >= soa->length) return BASEC_SOA_OUT_OF_BOUNDS;
+
+    u64 size = 0;
+
+    for (u64 i = 0; i < soa->field_count; i++) {
+        size = soa->fields[i].size;
+        (void)memcpy(
+            (u8*)soa->columns[i]->data + index * size,
+            (const u8*)row + soa->fields[i].offset,
+            size
+        );
+    }
+
+    return BASEC_SOA_SUCCESS;
+}
+
+/**
+ * @brief Get the elements of one column
+ * @param soa The SoA
+ * @param field The index of the field in the layout
+ * @param span_out The span of the column
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_column(
+    BasecSoA*     soa,
+    u64           field,
+    BasecSoASpan* span_out
+) {
+    if (soa == NULL || span_out == NULL) return BASEC_SOA_NULL_POINTER;
+    if (field >= soa->field_count) return BASEC_SOA_INVALID_FIELD;
+
+    span_out->data         = soa->columns[field]->data;
+    span_out->length       = soa->length;
+    span_out->element_size = soa->fields[field].size;
+    return BASEC_SOA_SUCCESS;
+}
+
+/**
+ * @brief Get the number of rows in the SoA
+ * @param soa The SoA
+ * @param length_out The number of rows
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_length(BasecSoA* soa, u64* length_out) {
+    if (soa == NULL || length_out == NULL) return BASEC_SOA_NULL_POINTER;
+
+    *length_out = soa->length;
+    return BASEC_SOA_SUCCESS;
+}
+
+/**
+ * @brief Create a SoA from the records of an array of structs
+ * @param array The array of records
+ * @param fields The fields of a record, copied into the SoA
+ * @param field_count The number of fields
+ * @param soa_out The SoA holding the records
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_from_array(
+    BasecArray*          array,
+    const BasecSoAField* fields,
+    u64                  field_count,
+    BasecSoA**           soa_out
+) {
+    if (array == NULL || soa_out == NULL) return BASEC_SOA_NULL_POINTER;
+
+    BasecSoAResult soa_result = BASEC_SOA_SUCCESS;
+    BasecSoA*      soa        = NULL;
+    const u8*      rows       = (const u8*)array->data;
+    u8*            column     = NULL;
+    u64            offset     = 0;
+    u64            size       = 0;
+
+    soa_result = basec_soa_create(
+        &soa,
+        fields,
+        field_count,
+        array->element_size,
+        array->length > 0 ? array->length : 1
+    );
+    if (soa_result != BASEC_SOA_SUCCESS) return soa_result;
+
+    // One column at a time, so every column is written front to back
+    for (u64 i = 0; i < field_count; i++) {
+        column = (u8*)soa->columns[i]->data;
+        offset = fields[i].offset;
+        size   = fields[i].size;
+        for (u64 row = 0; row < array->length; row++) {
+            (void)memcpy(
+                column + row * size,
+                rows + row * array->element_size + offset,
+                size
+            );
+        }
+        soa->columns[i]->length = array->length;
+    }
+    soa->length = array->length;
+
+    if (*soa_out != NULL) (void)basec_soa_destroy(soa_out);
+    *soa_out = soa;
+    return BASEC_SOA_SUCCESS;
+}
+
+/**
+ * @brief Copy the rows of a SoA into an array of structs
+ * @param soa The SoA to copy
+ * @param array_out The array to store the records in
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_to_array(BasecSoA* soa, BasecArray** array_out) {
+    if (soa == NULL || array_out == NULL) return BASEC_SOA_NULL_POINTER;
+
+    BasecArray* array  = NULL;
+    u8*         rows   = NULL;
+    const u8*   column = NULL;
+    u64         offset = 0;
+    u64         size   = 0;
+
+    if (
+        basec_array_create(
+            &array,
+            soa->row_size,
+            soa->length > 0 ? soa->length : 1
+        ) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_SOA_ALLOCATION_FAILURE;
+
+    rows = (u8*)array->data;
+    (void)memset(rows, 0, soa->length * soa->row_size);
+    for (u64 i = 0; i < soa->field_count; i++) {
+        column = (const u8*)soa->columns[i]->data;
+        offset = soa->fields[i].offset;
+        size   = soa->fields[i].size;
+        for (u64 row = 0; row < soa->length; row++) {
+            (void)memcpy(
+                rows + row * soa->row_size + offset,
+                column + row * size,
+                size
+            );
+        }
+    }
+    array->length = soa->length;
+
+    if (*array_out != NULL) (void)basec_array_destroy(array_out);
+    *array_out = array;
+    return BASEC_SOA_SUCCESS;
+}
+
+/**
+ * @brief Destroy a SoA
+ * @param soa The SoA to destroy
+ * @return The result of the operation
+ */
+BasecSoAResult basec_soa_destroy(BasecSoA** soa) {
+    if (soa == NULL || *soa == NULL) return BASEC_SOA_NULL_POINTER;
+
+    for (u64 i = 0; (*soa)->columns != NULL && i < (*soa)->field_count; i++) {
+        if ((*soa)->columns[i] != NULL) {
+            (void)basec_array_destroy(&(*soa)->columns[i]);
+        }
+    }
+    free((*soa)->columns);
+    free((*soa)->fields);
+    free(*soa);
+    *soa = NULL;
+
+    return BASEC_SOA_SUCCESS;
+}
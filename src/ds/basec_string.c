@@ -16,460 +16,4128 @@ static BasecStringResult _basec_string_grow(
     if (string == NULL) return BASEC_STRING_NULL_POINTER;
     if (new_capacity <= 0) return BASEC_STRING_INVALID_CAPACITY;
 
-    string->data = (char*)realloc(string->data, new_capacity * _GROWTH_FACTOR);
-    if (string->data == NULL) return BASEC_STRING_ALLOCATION_FAILURE;
+    void* data = string->data;
 
+    if (
+        basec_memory_resize(
+            &data,
+            string->capacity + 1,
+            new_capacity + 1,
+            &string->mapped
+        ) != BASEC_MEMORY_SUCCESS
+    ) return BASEC_STRING_ALLOCATION_FAILURE;
+
+    string->data     = (c_str)data;
     string->capacity = new_capacity;
     return BASEC_STRING_SUCCESS;
 }
 
+// Two character decimal representations of 0 to 99
+static const c8 _DIGIT_PAIRS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// Powers of ten that fit in a u64
+static const u64 _POW10[20] = {
+    1ULL,                 10ULL,                 100ULL,
+    1000ULL,              10000ULL,              100000ULL,
+    1000000ULL,           10000000ULL,           100000000ULL,
+    1000000000ULL,        10000000000ULL,        100000000000ULL,
+    1000000000000ULL,     10000000000000ULL,     100000000000000ULL,
+    1000000000000000ULL,  10000000000000000ULL,  100000000000000000ULL,
+    1000000000000000000ULL, 10000000000000000000ULL
+};
+
+// Upper bound on the characters needed to format any f64
+#define _BASEC_STRING_F64_MAX_LENGTH 32
+
+// Upper bound on a printf conversion specification rebuilt by appendf
+#define _BASEC_STRING_FORMAT_SPEC_LENGTH 48
+
+// The lookup UTF-8 validator needs SSSE3, which is checked for at runtime
+#if defined(__SSE2__) && defined(__GNUC__)
+#define _BASEC_STRING_UTF8_SSSE3 1
+#else
+#define _BASEC_STRING_UTF8_SSSE3 0
+#endif
+
+// Normalized significands of 10^k for k = -348, -340, ..., 340
+static const u64 _CACHED_POWERS_F[87] = {
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL
+};
+
+// Binary exponents matching _CACHED_POWERS_F
+static const i16 _CACHED_POWERS_E[87] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980,
+    -954, -927, -901, -874, -847, -821, -794, -768, -741, -715,
+    -688, -661, -635, -608, -582, -555, -529, -502, -475, -449,
+    -422, -396, -369, -343, -316, -289, -263, -236, -210, -183,
+    -157, -130, -103, -77, -50, -24, 3, 30, 56, 83,
+    109, 136, 162, 189, 216, 242, 269, 295, 322, 348,
+    375, 402, 428, 455, 481, 508, 534, 561, 588, 614,
+    641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+    907, 933, 960, 986, 1013, 1039, 1066
+};
+
+// Range of decimal exponents covered by _POWERS_OF_FIVE_128
+#define _BASEC_STRING_POW5_MIN_EXPONENT (-342)
+#define _BASEC_STRING_POW5_MAX_EXPONENT 308
+
+// Most significant decimal digits that always fit in a u64
+#define _BASEC_STRING_U64_SAFE_DIGITS 19
+
+// Bit layout of an f64
+#define _BASEC_STRING_F64_MANTISSA_BITS 52
+#define _BASEC_STRING_F64_EXPONENT_BIAS 1023
+#define _BASEC_STRING_F64_INFINITY      0x7FF0000000000000ULL
+
+// Powers of ten that are exactly representable as an f64
+static const f64 _EXACT_POW10_F64[23] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// Truncated 128 bit significands of 5^q for q = -342, ..., 308 (high, low)
+static const u64 _POWERS_OF_FIVE_128[651][2] = {
+    {0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL},
+    {0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL},
+    {0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL},
+    {0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL},
+    {0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL},
+    {0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL},
+    {0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL},
+    {0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL},
+    {0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL},
+    {0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL},
+    {0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL},
+    {0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL},
+    {0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL},
+    {0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL},
+    {0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL},
+    {0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL},
+    {0x84a57695fe98746dULL, 0x014bb630f7604b57ULL},
+    {0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL},
+    {0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL},
+    {0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL},
+    {0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL},
+    {0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL},
+    {0xfd00b897478238d0ULL, 0x8920b098955522b4ULL},
+    {0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL},
+    {0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL},
+    {0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL},
+    {0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL},
+    {0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL},
+    {0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL},
+    {0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL},
+    {0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL},
+    {0xeba09271e88d976bULL, 0xf7864a44c633682eULL},
+    {0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL},
+    {0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL},
+    {0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL},
+    {0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL},
+    {0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL},
+    {0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL},
+    {0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL},
+    {0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL},
+    {0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL},
+    {0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL},
+    {0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL},
+    {0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL},
+    {0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL},
+    {0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL},
+    {0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL},
+    {0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL},
+    {0xa37fce126597973cULL, 0xe50ff107bab528a0ULL},
+    {0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL},
+    {0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL},
+    {0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL},
+    {0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL},
+    {0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL},
+    {0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL},
+    {0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL},
+    {0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL},
+    {0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL},
+    {0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL},
+    {0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL},
+    {0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL},
+    {0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL},
+    {0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL},
+    {0x91376c36d99995beULL, 0x23100809b9c21fa1ULL},
+    {0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL},
+    {0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL},
+    {0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL},
+    {0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL},
+    {0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL},
+    {0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL},
+    {0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL},
+    {0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL},
+    {0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL},
+    {0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL},
+    {0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL},
+    {0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL},
+    {0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL},
+    {0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL},
+    {0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL},
+    {0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL},
+    {0xc987434744ac874eULL, 0xa327ffb266b56220ULL},
+    {0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL},
+    {0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL},
+    {0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL},
+    {0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL},
+    {0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL},
+    {0xc0314325637a1939ULL, 0xfa911155fefb5308ULL},
+    {0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL},
+    {0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL},
+    {0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL},
+    {0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL},
+    {0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL},
+    {0xb749faed14125d36ULL, 0xcef980ec671f667bULL},
+    {0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL},
+    {0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL},
+    {0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL},
+    {0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL},
+    {0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL},
+    {0xaecc49914078536dULL, 0x58fae9f773886e18ULL},
+    {0xda7f5bf590966848ULL, 0xaf39a475506a899eULL},
+    {0x888f99797a5e012dULL, 0x6d8406c952429603ULL},
+    {0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL},
+    {0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL},
+    {0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL},
+    {0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL},
+    {0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL},
+    {0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL},
+    {0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL},
+    {0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL},
+    {0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL},
+    {0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL},
+    {0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL},
+    {0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL},
+    {0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL},
+    {0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL},
+    {0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL},
+    {0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL},
+    {0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL},
+    {0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL},
+    {0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL},
+    {0xb913179899f68584ULL, 0x28e2557b59846e3fULL},
+    {0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL},
+    {0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL},
+    {0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL},
+    {0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL},
+    {0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL},
+    {0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL},
+    {0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL},
+    {0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL},
+    {0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL},
+    {0xd77485cb25823ac7ULL, 0x7d633293366b828bULL},
+    {0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL},
+    {0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL},
+    {0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL},
+    {0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL},
+    {0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL},
+    {0xcd795be870516656ULL, 0x67902e276c921f8bULL},
+    {0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL},
+    {0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL},
+    {0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL},
+    {0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL},
+    {0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL},
+    {0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL},
+    {0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL},
+    {0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL},
+    {0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL},
+    {0xef340a98172aace4ULL, 0x86fb897116c87c34ULL},
+    {0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL},
+    {0xbae0a846d2195712ULL, 0x8974836059cca109ULL},
+    {0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL},
+    {0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL},
+    {0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL},
+    {0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL},
+    {0x8e938662882af53eULL, 0x547eb47b7282ee9cULL},
+    {0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL},
+    {0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL},
+    {0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL},
+    {0xae0b158b4738705eULL, 0x9624ab50b148d445ULL},
+    {0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL},
+    {0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL},
+    {0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL},
+    {0xd47487cc8470652bULL, 0x7647c3200069671fULL},
+    {0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL},
+    {0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL},
+    {0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL},
+    {0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL},
+    {0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL},
+    {0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL},
+    {0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL},
+    {0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL},
+    {0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL},
+    {0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL},
+    {0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL},
+    {0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL},
+    {0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL},
+    {0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL},
+    {0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL},
+    {0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL},
+    {0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL},
+    {0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL},
+    {0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL},
+    {0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL},
+    {0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL},
+    {0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL},
+    {0x8c974f7383725573ULL, 0x1e414218c73a13fbULL},
+    {0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL},
+    {0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL},
+    {0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL},
+    {0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL},
+    {0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL},
+    {0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL},
+    {0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL},
+    {0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL},
+    {0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL},
+    {0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL},
+    {0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL},
+    {0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL},
+    {0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL},
+    {0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL},
+    {0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL},
+    {0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL},
+    {0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL},
+    {0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL},
+    {0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL},
+    {0xbe89523386091465ULL, 0xf6bbb397f1135823ULL},
+    {0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL},
+    {0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL},
+    {0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL},
+    {0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL},
+    {0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL},
+    {0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL},
+    {0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL},
+    {0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL},
+    {0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL},
+    {0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL},
+    {0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL},
+    {0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL},
+    {0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL},
+    {0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL},
+    {0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL},
+    {0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL},
+    {0x843610cb4bf160cbULL, 0xcedf722a585139baULL},
+    {0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL},
+    {0xce947a3da6a9273eULL, 0x733d226229feea32ULL},
+    {0x811ccc668829b887ULL, 0x0806357d5a3f525fULL},
+    {0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL},
+    {0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL},
+    {0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL},
+    {0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL},
+    {0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL},
+    {0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL},
+    {0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL},
+    {0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL},
+    {0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL},
+    {0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL},
+    {0xbbe226efb628afeaULL, 0x890489f70a55368bULL},
+    {0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL},
+    {0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL},
+    {0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL},
+    {0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL},
+    {0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL},
+    {0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL},
+    {0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL},
+    {0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL},
+    {0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL},
+    {0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL},
+    {0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL},
+    {0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL},
+    {0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL},
+    {0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL},
+    {0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL},
+    {0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL},
+    {0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL},
+    {0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL},
+    {0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL},
+    {0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL},
+    {0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL},
+    {0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL},
+    {0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL},
+    {0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL},
+    {0xc24452da229b021bULL, 0xfbe85badce996168ULL},
+    {0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL},
+    {0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL},
+    {0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL},
+    {0xed246723473e3813ULL, 0x290123e9aab23b68ULL},
+    {0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL},
+    {0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL},
+    {0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL},
+    {0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL},
+    {0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL},
+    {0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL},
+    {0x8d590723948a535fULL, 0x579c487e5a38ad0eULL},
+    {0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL},
+    {0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL},
+    {0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL},
+    {0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL},
+    {0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL},
+    {0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL},
+    {0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL},
+    {0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL},
+    {0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL},
+    {0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL},
+    {0xcdb02555653131b6ULL, 0x3792f412cb06794dULL},
+    {0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL},
+    {0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL},
+    {0xc8de047564d20a8bULL, 0xf245825a5a445275ULL},
+    {0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL},
+    {0x9ced737bb6c4183dULL, 0x55464dd69685606bULL},
+    {0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL},
+    {0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL},
+    {0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL},
+    {0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL},
+    {0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL},
+    {0x95a8637627989aadULL, 0xdde7001379a44aa8ULL},
+    {0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL},
+    {0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL},
+    {0x9226712162ab070dULL, 0xcab3961304ca70e8ULL},
+    {0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL},
+    {0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL},
+    {0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL},
+    {0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL},
+    {0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL},
+    {0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL},
+    {0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL},
+    {0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL},
+    {0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL},
+    {0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL},
+    {0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL},
+    {0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL},
+    {0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL},
+    {0xcfb11ead453994baULL, 0x67de18eda5814af2ULL},
+    {0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL},
+    {0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL},
+    {0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL},
+    {0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL},
+    {0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL},
+    {0xc612062576589ddaULL, 0x95364afe032a819eULL},
+    {0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL},
+    {0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL},
+    {0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL},
+    {0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL},
+    {0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL},
+    {0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL},
+    {0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL},
+    {0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL},
+    {0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL},
+    {0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL},
+    {0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL},
+    {0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL},
+    {0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL},
+    {0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL},
+    {0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL},
+    {0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL},
+    {0x89705f4136b4a597ULL, 0x31680a88f8953031ULL},
+    {0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL},
+    {0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL},
+    {0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL},
+    {0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL},
+    {0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL},
+    {0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL},
+    {0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL},
+    {0xccccccccccccccccULL, 0xcccccccccccccccdULL},
+    {0x8000000000000000ULL, 0x0000000000000000ULL},
+    {0xa000000000000000ULL, 0x0000000000000000ULL},
+    {0xc800000000000000ULL, 0x0000000000000000ULL},
+    {0xfa00000000000000ULL, 0x0000000000000000ULL},
+    {0x9c40000000000000ULL, 0x0000000000000000ULL},
+    {0xc350000000000000ULL, 0x0000000000000000ULL},
+    {0xf424000000000000ULL, 0x0000000000000000ULL},
+    {0x9896800000000000ULL, 0x0000000000000000ULL},
+    {0xbebc200000000000ULL, 0x0000000000000000ULL},
+    {0xee6b280000000000ULL, 0x0000000000000000ULL},
+    {0x9502f90000000000ULL, 0x0000000000000000ULL},
+    {0xba43b74000000000ULL, 0x0000000000000000ULL},
+    {0xe8d4a51000000000ULL, 0x0000000000000000ULL},
+    {0x9184e72a00000000ULL, 0x0000000000000000ULL},
+    {0xb5e620f480000000ULL, 0x0000000000000000ULL},
+    {0xe35fa931a0000000ULL, 0x0000000000000000ULL},
+    {0x8e1bc9bf04000000ULL, 0x0000000000000000ULL},
+    {0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL},
+    {0xde0b6b3a76400000ULL, 0x0000000000000000ULL},
+    {0x8ac7230489e80000ULL, 0x0000000000000000ULL},
+    {0xad78ebc5ac620000ULL, 0x0000000000000000ULL},
+    {0xd8d726b7177a8000ULL, 0x0000000000000000ULL},
+    {0x878678326eac9000ULL, 0x0000000000000000ULL},
+    {0xa968163f0a57b400ULL, 0x0000000000000000ULL},
+    {0xd3c21bcecceda100ULL, 0x0000000000000000ULL},
+    {0x84595161401484a0ULL, 0x0000000000000000ULL},
+    {0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL},
+    {0xcecb8f27f4200f3aULL, 0x0000000000000000ULL},
+    {0x813f3978f8940984ULL, 0x4000000000000000ULL},
+    {0xa18f07d736b90be5ULL, 0x5000000000000000ULL},
+    {0xc9f2c9cd04674edeULL, 0xa400000000000000ULL},
+    {0xfc6f7c4045812296ULL, 0x4d00000000000000ULL},
+    {0x9dc5ada82b70b59dULL, 0xf020000000000000ULL},
+    {0xc5371912364ce305ULL, 0x6c28000000000000ULL},
+    {0xf684df56c3e01bc6ULL, 0xc732000000000000ULL},
+    {0x9a130b963a6c115cULL, 0x3c7f400000000000ULL},
+    {0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL},
+    {0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL},
+    {0x96769950b50d88f4ULL, 0x1314448000000000ULL},
+    {0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL},
+    {0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL},
+    {0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL},
+    {0xb7abc627050305adULL, 0xf14a3d9e40000000ULL},
+    {0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL},
+    {0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL},
+    {0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL},
+    {0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL},
+    {0x8c213d9da502de45ULL, 0x4526f422cc340000ULL},
+    {0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL},
+    {0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL},
+    {0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL},
+    {0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL},
+    {0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL},
+    {0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL},
+    {0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL},
+    {0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL},
+    {0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL},
+    {0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL},
+    {0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL},
+    {0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL},
+    {0x9f4f2726179a2245ULL, 0x01d762422c946590ULL},
+    {0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL},
+    {0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL},
+    {0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL},
+    {0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL},
+    {0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL},
+    {0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL},
+    {0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL},
+    {0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL},
+    {0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL},
+    {0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL},
+    {0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL},
+    {0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL},
+    {0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL},
+    {0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL},
+    {0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL},
+    {0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL},
+    {0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL},
+    {0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL},
+    {0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL},
+    {0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL},
+    {0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL},
+    {0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL},
+    {0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL},
+    {0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL},
+    {0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL},
+    {0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL},
+    {0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL},
+    {0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL},
+    {0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL},
+    {0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL},
+    {0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL},
+    {0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL},
+    {0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL},
+    {0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL},
+    {0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL},
+    {0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL},
+    {0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL},
+    {0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL},
+    {0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL},
+    {0x924d692ca61be758ULL, 0x593c2626705f9c56ULL},
+    {0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL},
+    {0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL},
+    {0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL},
+    {0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL},
+    {0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL},
+    {0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL},
+    {0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL},
+    {0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL},
+    {0x884134fe908658b2ULL, 0x3109058d147fdcddULL},
+    {0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL},
+    {0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL},
+    {0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL},
+    {0xa6539930bf6bff45ULL, 0x84db8346b786151cULL},
+    {0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL},
+    {0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL},
+    {0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL},
+    {0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL},
+    {0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL},
+    {0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL},
+    {0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL},
+    {0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL},
+    {0x9ae757596946075fULL, 0x3375788de9b06958ULL},
+    {0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL},
+    {0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL},
+    {0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL},
+    {0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL},
+    {0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL},
+    {0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL},
+    {0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL},
+    {0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL},
+    {0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL},
+    {0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL},
+    {0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL},
+    {0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL},
+    {0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL},
+    {0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL},
+    {0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL},
+    {0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL},
+    {0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL},
+    {0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL},
+    {0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL},
+    {0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL},
+    {0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL},
+    {0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL},
+    {0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL},
+    {0x802221226be55a64ULL, 0xc2494954da2c9789ULL},
+    {0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL},
+    {0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL},
+    {0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL},
+    {0x9c69a97284b578d7ULL, 0xff2a760414536efbULL},
+    {0xc38413cf25e2d70dULL, 0xfef5138519684abaULL},
+    {0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL},
+    {0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL},
+    {0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL},
+    {0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL},
+    {0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL},
+    {0xba756174393d88dfULL, 0x94f971119aeef9e4ULL},
+    {0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL},
+    {0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL},
+    {0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL},
+    {0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL},
+    {0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL},
+    {0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL},
+    {0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL},
+    {0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL},
+    {0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL},
+    {0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL},
+    {0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL},
+    {0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL},
+    {0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL},
+    {0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL},
+    {0xa59bc234db398c25ULL, 0x43fab9837e699095ULL},
+    {0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL},
+    {0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL},
+    {0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL},
+    {0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL},
+    {0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL},
+    {0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL},
+    {0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL},
+    {0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL},
+    {0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL},
+    {0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL},
+    {0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL},
+    {0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL},
+    {0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL},
+    {0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL},
+    {0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL},
+    {0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL},
+    {0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL},
+    {0x8fa475791a569d10ULL, 0xf96e017d694487bcULL},
+    {0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL},
+    {0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL},
+    {0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL},
+    {0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL},
+    {0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL},
+    {0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL},
+    {0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL},
+    {0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL},
+    {0x85c7056562757456ULL, 0xf6872d5667844e49ULL},
+    {0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL},
+    {0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL},
+    {0x82a45b450226b39cULL, 0xecc0024661173473ULL},
+    {0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL},
+    {0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL},
+    {0xff290242c83396ceULL, 0x7e67047175a15271ULL},
+    {0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL},
+    {0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL},
+    {0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL},
+    {0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL},
+    {0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL},
+    {0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL},
+    {0x98165af37b2153deULL, 0xc3727a337a8b704aULL},
+    {0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL},
+    {0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL},
+    {0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL},
+    {0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL},
+    {0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL},
+    {0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL},
+    {0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL},
+    {0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL},
+    {0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL},
+    {0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL},
+    {0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL},
+    {0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL},
+    {0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL},
+    {0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL},
+    {0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL},
+    {0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL},
+    {0xd31045a8341ca07cULL, 0x1ede48111209a050ULL},
+    {0x83ea2b892091e44dULL, 0x934aed0aab460432ULL},
+    {0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL},
+    {0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL},
+    {0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL},
+    {0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL},
+    {0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL},
+    {0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL},
+    {0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL},
+    {0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL},
+    {0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL},
+    {0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL},
+    {0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL},
+    {0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL},
+    {0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL},
+    {0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL},
+    {0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL},
+    {0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL},
+    {0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL},
+    {0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL},
+    {0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL},
+    {0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL},
+    {0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL},
+    {0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL},
+    {0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL},
+    {0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL},
+    {0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL},
+    {0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL},
+    {0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL},
+    {0x8533285c936b35deULL, 0xd53a88958f87275fULL},
+    {0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL},
+    {0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL},
+    {0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL},
+    {0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL},
+    {0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL},
+    {0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL},
+    {0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL},
+    {0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL},
+    {0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL},
+    {0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL},
+    {0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL},
+    {0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL},
+    {0x976e41088617ca01ULL, 0xd5be0503e085d813ULL},
+    {0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL},
+    {0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL},
+    {0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL},
+    {0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL},
+    {0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL},
+    {0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL},
+    {0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL},
+    {0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL},
+    {0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL},
+    {0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL},
+    {0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL},
+    {0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL},
+    {0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL},
+    {0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL},
+    {0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL},
+    {0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL},
+    {0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL},
+    {0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL},
+    {0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL},
+    {0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL},
+    {0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL},
+    {0xa0555e361951c366ULL, 0xd7e105bcc332621fULL},
+    {0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL},
+    {0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL},
+    {0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL},
+    {0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL},
+    {0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL},
+    {0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL},
+    {0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL},
+    {0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL},
+    {0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL},
+    {0xbaa718e68396cffdULL, 0xd30560258f54e6baULL},
+    {0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL},
+    {0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL},
+    {0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL},
+    {0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL},
+    {0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL},
+};
+
+/**
+ * @brief A floating point number with a 64 bit significand, f * 2^e
+ */
+typedef struct {
+    u64 f;
+    i32 e;
+} _BasecDiyFp;
+
+/**
+ * @brief Ensure a string has room for additional characters
+ * @param string The string to reserve space in
+ * @param additional The number of characters to reserve
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_string_reserve(
+    BasecString* string,
+    u64          additional
+) {
+    u64 new_capacity = 0;
+
+    if (string == NULL) return BASEC_STRING_NULL_POINTER;
+    if (string->length + additional < string->capacity) {
+        return BASEC_STRING_SUCCESS;
+    }
+
+    // Grow geometrically so that repeated small appends stay amortised O(1)
+    new_capacity = string->capacity * _GROWTH_FACTOR;
+    if (new_capacity <= string->length + additional) {
+        new_capacity = string->length + additional + 1;
+    }
+
+    return _basec_string_grow(string, new_capacity);
+}
+
+/**
+ * @brief Count the decimal digits of a number
+ * @param value The number to count the digits of
+ * @return The number of digits
+ */
+static u8 _basec_count_digits(u64 value) {
+    u8 digits = 1;
+
+    while (digits < 20 && value >= _POW10[digits]) digits++;
+    return digits;
+}
+
+/**
+ * @brief Write the decimal digits of a number so that they end at end
+ * @param end One past the position of the last digit
+ * @param value The number to write
+ */
+static void _basec_write_digits(c8* end, u64 value) {
+    u64 pair = 0;
+
+    while (value >= 100) {
+        pair   = (value % 100) * 2;
+        value /= 100;
+        *--end = _DIGIT_PAIRS[pair + 1];
+        *--end = _DIGIT_PAIRS[pair];
+    }
+
+    if (value >= 10) {
+        pair   = value * 2;
+        *--end = _DIGIT_PAIRS[pair + 1];
+        *--end = _DIGIT_PAIRS[pair];
+    } else {
+        *--end = (c8)('0' + value);
+    }
+}
+
+/**
+ * @brief Multiply two DiyFps, rounding the 128 bit product to 64 bits
+ * @param x The first factor
+ * @param y The second factor
+ * @return The product
+ */
+static _BasecDiyFp _basec_diy_fp_multiply(_BasecDiyFp x, _BasecDiyFp y) {
+    const u64   mask_32 = 0xFFFFFFFFULL;
+    u64         a       = x.f >> 32;
+    u64         b       = x.f & mask_32;
+    u64         c       = y.f >> 32;
+    u64         d       = y.f & mask_32;
+    u64         ac      = a * c;
+    u64         bc      = b * c;
+    u64         ad      = a * d;
+    u64         bd      = b * d;
+    u64         mid     = (bd >> 32) + (ad & mask_32) + (bc & mask_32);
+    _BasecDiyFp product = {0};
+
+    mid += 1ULL << 31;
+    product.f = ac + (ad >> 32) + (bc >> 32) + (mid >> 32);
+    product.e = x.e + y.e + 64;
+
+    return product;
+}
+
+/**
+ * @brief Shift a DiyFp so the top bit of its significand is set
+ * @param x The DiyFp to normalize
+ * @return The normalized DiyFp
+ */
+static _BasecDiyFp _basec_diy_fp_normalize(_BasecDiyFp x) {
+    i32 shift = __builtin_clzll(x.f);
+
+    x.f <<= shift;
+    x.e  -= shift;
+    return x;
+}
+
+/**
+ * @brief Nudge the last generated digit towards the exact value (Grisu2)
+ * @param buffer The generated digits
+ * @param length The number of generated digits
+ * @param delta The width of the rounding interval
+ * @param rest The remainder below the last digit
+ * @param ten_kappa The weight of the last digit
+ * @param wp_w The distance from the upper bound to the exact value
+ */
+static void _basec_grisu_round(
+    c8* buffer,
+    i32 length,
+    u64 delta,
+    u64 rest,
+    u64 ten_kappa,
+    u64 wp_w
+) {
+    while (
+        rest < wp_w && delta - rest >= ten_kappa &&
+        (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w)
+    ) {
+        buffer[length - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+/**
+ * @brief Generate the shortest digits inside the rounding interval (Grisu2)
+ * @param w The scaled value
+ * @param mp The scaled upper bound of the rounding interval
+ * @param delta The width of the rounding interval
+ * @param buffer The buffer to write the digits to
+ * @param length_out The number of digits written
+ * @param k The decimal exponent, adjusted by the digits generated
+ */
+static void _basec_grisu_digit_gen(
+    _BasecDiyFp w,
+    _BasecDiyFp mp,
+    u64         delta,
+    c8*         buffer,
+    i32*        length_out,
+    i32*        k
+) {
+    i32 one_e  = -mp.e;
+    u64 one_f  = 1ULL << one_e;
+    u64 wp_w   = mp.f - w.f;
+    u32 p1     = (u32)(mp.f >> one_e);
+    u64 p2     = mp.f & (one_f - 1);
+    i32 kappa  = _basec_count_digits(p1);
+    i32 length = 0;
+    u32 digit  = 0;
+    u64 rest   = 0;
+
+    while (kappa > 0) {
+        digit = p1 / (u32)_POW10[kappa - 1];
+        p1   %= (u32)_POW10[kappa - 1];
+        if (digit != 0 || length != 0) buffer[length++] = (c8)('0' + digit);
+        kappa--;
+
+        rest = ((u64)p1 << one_e) + p2;
+        if (rest <= delta) {
+            *k += kappa;
+            _basec_grisu_round(
+                buffer,
+                length,
+                delta,
+                rest,
+                _POW10[kappa] << one_e,
+                wp_w
+            );
+            *length_out = length;
+            return;
+        }
+    }
+
+    while (true) {
+        p2    *= 10;
+        delta *= 10;
+        digit  = (u32)(p2 >> one_e);
+        if (digit != 0 || length != 0) buffer[length++] = (c8)('0' + digit);
+        p2 &= one_f - 1;
+        kappa--;
+
+        if (p2 < delta) {
+            *k += kappa;
+            _basec_grisu_round(
+                buffer,
+                length,
+                delta,
+                p2,
+                one_f,
+                -kappa < 20 ? wp_w * _POW10[-kappa] : 0
+            );
+            *length_out = length;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Generate the shortest digits that round trip to a double (Grisu2)
+ * @param value The positive, finite, non-zero value
+ * @param buffer The buffer to write the digits to
+ * @param length_out The number of digits written
+ * @param k_out The decimal exponent, value ~= digits * 10^k
+ */
+static void _basec_grisu2(f64 value, c8* buffer, i32* length_out, i32* k_out) {
+    const u64   hidden_bit = 0x0010000000000000ULL;
+    u64         bits       = 0;
+    _BasecDiyFp v          = {0};
+    _BasecDiyFp plus       = {0};
+    _BasecDiyFp minus      = {0};
+    _BasecDiyFp cached     = {0};
+    _BasecDiyFp w          = {0};
+    f64         dk         = 0;
+    i32         k          = 0;
+    u32         index      = 0;
+
+    (void)memcpy(&bits, &value, sizeof(bits));
+    if ((bits >> 52) & 0x7FF) {
+        v.f = (bits & (hidden_bit - 1)) + hidden_bit;
+        v.e = (i32)((bits >> 52) & 0x7FF) - 1075;
+    } else {
+        v.f = bits & (hidden_bit - 1);
+        v.e = -1074;
+    }
+
+    // Boundaries halfway to the neighbouring doubles, sharing one exponent
+    plus.f = (v.f << 1) + 1;
+    plus.e = v.e - 1;
+    while (!(plus.f & (hidden_bit << 1))) {
+        plus.f <<= 1;
+        plus.e--;
+    }
+    plus.f <<= 10;
+    plus.e  -= 10;
+
+    if (v.f == hidden_bit) {
+        minus.f = (v.f << 2) - 1;
+        minus.e = v.e - 2;
+    } else {
+        minus.f = (v.f << 1) - 1;
+        minus.e = v.e - 1;
+    }
+    minus.f <<= minus.e - plus.e;
+    minus.e   = plus.e;
+
+    // Pick a cached power of ten that brings the exponent into [-60, -32]
+    dk = (-61 - plus.e) * 0.30102999566398114 + 347;
+    k  = (i32)dk;
+    if (dk - k > 0.0) k++;
+    index    = (u32)((k >> 3) + 1);
+    *k_out   = -(-348 + (i32)(index << 3));
+    cached.f = _CACHED_POWERS_F[index];
+    cached.e = _CACHED_POWERS_E[index];
+
+    w     = _basec_diy_fp_multiply(_basec_diy_fp_normalize(v), cached);
+    plus  = _basec_diy_fp_multiply(plus, cached);
+    minus = _basec_diy_fp_multiply(minus, cached);
+    minus.f++;
+    plus.f--;
+
+    _basec_grisu_digit_gen(
+        w,
+        plus,
+        plus.f - minus.f,
+        buffer,
+        length_out,
+        k_out
+    );
+}
+
+/**
+ * @brief Format a double with the shortest digits that round trip
+ * @param value The value to format
+ * @param buffer The buffer to format into, at least
+ *               _BASEC_STRING_F64_MAX_LENGTH characters
+ * @return The number of characters written
+ */
+static u64 _basec_format_f64(f64 value, c8* buffer) {
+    u64 bits     = 0;
+    c8* start    = buffer;
+    i32 length   = 0;
+    i32 k        = 0;
+    i32 kk       = 0;
+    i32 offset   = 0;
+    i32 exponent = 0;
+
+    (void)memcpy(&bits, &value, sizeof(bits));
+    if (bits >> 63) *buffer++ = '-';
+
+    if (((bits >> 52) & 0x7FF) == 0x7FF) {
+        if (bits & 0x000FFFFFFFFFFFFFULL) {
+            (void)memcpy(start, "nan", 3);
+            return 3;
+        }
+        (void)memcpy(buffer, "inf", 3);
+        return (u64)(buffer - start) + 3;
+    }
+
+    if ((bits & 0x7FFFFFFFFFFFFFFFULL) == 0) {
+        *buffer = '0';
+        return (u64)(buffer - start) + 1;
+    }
+
+    _basec_grisu2(value < 0 ? -value : value, buffer, &length, &k);
+    kk = length + k;
+
+    if (k >= 0 && kk <= 21) {
+        // 1234e7 -> 12340000000
+        (void)memset(buffer + length, '0', (u64)(kk - length));
+        return (u64)(buffer - start) + (u64)kk;
+    }
+
+    if (kk > 0 && kk <= 21) {
+        // 1234e-2 -> 12.34
+        (void)memmove(buffer + kk + 1, buffer + kk, (u64)(length - kk));
+        buffer[kk] = '.';
+        return (u64)(buffer - start) + (u64)length + 1;
+    }
+
+    if (kk > -6 && kk <= 0) {
+        // 1234e-6 -> 0.001234
+        offset = 2 - kk;
+        (void)memmove(buffer + offset, buffer, (u64)length);
+        buffer[0] = '0';
+        buffer[1] = '.';
+        (void)memset(buffer + 2, '0', (u64)(offset - 2));
+        return (u64)(buffer - start) + (u64)(length + offset);
+    }
+
+    if (length == 1) {
+        // 1e30
+        buffer += 1;
+    } else {
+        // 1234e30 -> 1.234e33
+        (void)memmove(buffer + 2, buffer + 1, (u64)(length - 1));
+        buffer[1] = '.';
+        buffer   += length + 1;
+    }
+
+    *buffer++ = 'e';
+    exponent  = kk - 1;
+    if (exponent < 0) {
+        *buffer++ = '-';
+        exponent  = -exponent;
+    }
+    length = _basec_count_digits((u64)exponent);
+    _basec_write_digits(buffer + length, (u64)exponent);
+
+    return (u64)(buffer - start) + (u64)length;
+}
+
+/**
+ * @brief Count the hexadecimal digits of a number
+ * @param value The number to count the digits of
+ * @return The number of digits
+ */
+static u8 _basec_count_hex_digits(u64 value) {
+    return (u8)((67 - __builtin_clzll(value | 1)) / 4);
+}
+
+/**
+ * @brief Write the lowercase hexadecimal digits of a number ending at end
+ * @param end One past where the last digit is written
+ * @param value The number to write
+ * @param digits The number of digits to write
+ */
+static void _basec_write_hex_digits(c8* end, u64 value, u8 digits) {
+    for (u8 i = 0; i < digits; i++) {
+        *--end  = "0123456789abcdef"[value & 0xF];
+        value >>= 4;
+    }
+}
+
+/**
+ * @brief Where basec_string_appendf writes its output
+ *
+ * Writes past available are dropped but still counted in length, so one
+ * pass both formats and measures.
+ */
+typedef struct {
+    c8* data;
+    u64 length;
+    u64 available;
+} _BasecFormatSink;
+
+/**
+ * @brief Check whether the sink has room for more characters
+ * @param sink The sink to check
+ * @param length The number of characters to add
+ * @return Whether the characters fit
+ */
+static bool _basec_sink_fits(_BasecFormatSink* sink, u64 length) {
+    return sink->length + length <= sink->available;
+}
+
+/**
+ * @brief Write characters to a format sink
+ * @param sink The sink to write to
+ * @param data The characters to write
+ * @param length The number of characters
+ */
+static void _basec_sink_write(
+    _BasecFormatSink* sink,
+    const c8*         data,
+    u64               length
+) {
+    if (_basec_sink_fits(sink, length)) {
+        (void)memcpy(sink->data + sink->length, data, length);
+    }
+    sink->length += length;
+}
+
+/**
+ * @brief Write an unsigned integer to a format sink
+ * @param sink The sink to write to
+ * @param value The value to write
+ */
+static void _basec_sink_write_u64(_BasecFormatSink* sink, u64 value) {
+    u8 digits = _basec_count_digits(value);
+
+    if (_basec_sink_fits(sink, digits)) {
+        _basec_write_digits(sink->data + sink->length + digits, value);
+    }
+    sink->length += digits;
+}
+
+/**
+ * @brief Write a signed integer to a format sink
+ * @param sink The sink to write to
+ * @param value The value to write
+ */
+static void _basec_sink_write_i64(_BasecFormatSink* sink, i64 value) {
+    u64 magnitude = (u64)value;
+
+    if (value < 0) {
+        _basec_sink_write(sink, "-", 1);
+        magnitude = 0 - magnitude;
+    }
+    _basec_sink_write_u64(sink, magnitude);
+}
+
+/**
+ * @brief Write an unsigned integer in lowercase hexadecimal to a format sink
+ * @param sink The sink to write to
+ * @param value The value to write
+ */
+static void _basec_sink_write_hex(_BasecFormatSink* sink, u64 value) {
+    u8 digits = _basec_count_hex_digits(value);
+
+    if (_basec_sink_fits(sink, digits)) {
+        _basec_write_hex_digits(
+            sink->data + sink->length + digits,
+            value,
+            digits
+        );
+    }
+    sink->length += digits;
+}
+
+/**
+ * @brief Write a double like printf's %f, when that can be done exactly
+ *
+ * Below 2^33 an f64 is spaced closer than 10^-6, so when its shortest digits
+ * need at most six decimals, padding them with zeros is exactly what %f
+ * prints.
+ *
+ * @param sink The sink to write to
+ * @param value The value to write
+ * @return Whether the value was written
+ */
+static bool _basec_sink_write_fixed(_BasecFormatSink* sink, f64 value) {
+    c8        buffer[_BASEC_STRING_F64_MAX_LENGTH];
+    u64       length   = 0;
+    const c8* point    = NULL;
+    u64       decimals = 0;
+
+    if (!(value > -8589934592.0 && value < 8589934592.0)) return false;
+
+    length = _basec_format_f64(value, buffer);
+    if (memchr(buffer, 'e', length) != NULL) return false;
+
+    point = (const c8*)memchr(buffer, '.', length);
+    if (point != NULL) decimals = length - (u64)(point - buffer) - 1;
+    if (decimals > 6) return false;
+
+    _basec_sink_write(sink, buffer, length);
+    if (point == NULL) _basec_sink_write(sink, ".", 1);
+    _basec_sink_write(sink, "000000", 6 - decimals);
+    return true;
+}
+
+/**
+ * @brief Format one value with vsnprintf straight into a format sink
+ * @param sink The sink to write to
+ * @param spec The printf conversion specification
+ * @param ... The value to format
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_sink_write_printf(
+    _BasecFormatSink* sink,
+    const c8*         spec,
+    ...
+) {
+    va_list args;
+    i32     written = 0;
+
+    va_start(args, spec);
+    if (sink->length <= sink->available) {
+        written = vsnprintf(
+            sink->data + sink->length,
+            sink->available - sink->length + 1,
+            spec,
+            args
+        );
+    } else {
+        written = vsnprintf(NULL, 0, spec, args);
+    }
+    va_end(args);
+
+    if (written < 0) return BASEC_STRING_FORMAT_FAILURE;
+    sink->length += (u64)written;
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Write a BasecString* argument to a format sink (%S)
+ * @param sink The sink to write to
+ * @param args The arguments to take the string from
+ */
+static void _basec_format_string(_BasecFormatSink* sink, va_list* args) {
+    BasecString* string = va_arg(*args, BasecString*);
+
+    if (string == NULL) {
+        _basec_sink_write(sink, "(null)", 6);
+    } else {
+        _basec_sink_write(sink, string->data, string->length);
+    }
+}
+
+/**
+ * @brief Write a BasecStringView argument to a format sink (%V)
+ * @param sink The sink to write to
+ * @param args The arguments to take the view from
+ */
+static void _basec_format_view(_BasecFormatSink* sink, va_list* args) {
+    BasecStringView view = va_arg(*args, BasecStringView);
+
+    _basec_sink_write(sink, view.data, view.length);
+}
+
+/**
+ * @brief A conversion appendf understands beyond those of printf
+ */
+typedef struct {
+    c8   conversion;
+    void (*format)(_BasecFormatSink* sink, va_list* args);
+} _BasecFormatExtension;
+
+// Extra conversions of basec_string_appendf, add new types here
+#define _BASEC_STRING_FORMAT_EXTENSIONS 2
+static const _BasecFormatExtension _FORMAT_EXTENSIONS[] = {
+    {'S', _basec_format_string},
+    {'V', _basec_format_view},
+};
+
+/**
+ * @brief Length modifiers of a printf conversion specification
+ */
+typedef enum {
+    _BASEC_FORMAT_LENGTH_NONE,
+    _BASEC_FORMAT_LENGTH_HH,
+    _BASEC_FORMAT_LENGTH_H,
+    _BASEC_FORMAT_LENGTH_L,
+    _BASEC_FORMAT_LENGTH_LL,
+    _BASEC_FORMAT_LENGTH_J,
+    _BASEC_FORMAT_LENGTH_Z,
+    _BASEC_FORMAT_LENGTH_T,
+    _BASEC_FORMAT_LENGTH_LONG_DOUBLE,
+} _BasecFormatLength;
+
+/**
+ * @brief Read the length modifier of a conversion specification
+ * @param format The format, advanced past the modifier
+ * @return The length modifier
+ */
+static _BasecFormatLength _basec_format_length(const c8** format) {
+    const c8* spec = *format;
+
+    switch (*spec) {
+        case 'h':
+            *format += spec[1] == 'h' ? 2 : 1;
+            return spec[1] == 'h' ? _BASEC_FORMAT_LENGTH_HH
+                                  : _BASEC_FORMAT_LENGTH_H;
+        case 'l':
+            *format += spec[1] == 'l' ? 2 : 1;
+            return spec[1] == 'l' ? _BASEC_FORMAT_LENGTH_LL
+                                  : _BASEC_FORMAT_LENGTH_L;
+        case 'j':
+            *format += 1;
+            return _BASEC_FORMAT_LENGTH_J;
+        case 'z':
+            *format += 1;
+            return _BASEC_FORMAT_LENGTH_Z;
+        case 't':
+            *format += 1;
+            return _BASEC_FORMAT_LENGTH_T;
+        case 'L':
+            *format += 1;
+            return _BASEC_FORMAT_LENGTH_LONG_DOUBLE;
+        default:
+            return _BASEC_FORMAT_LENGTH_NONE;
+    }
+}
+
+/**
+ * @brief Format a conversion without flags, width or precision directly
+ * @param sink The sink to write to
+ * @param conversion The conversion character
+ * @param length The length modifier
+ * @param args The arguments to take the value from
+ * @return Whether the conversion was handled, otherwise nothing is consumed
+ */
+static bool _basec_format_fast(
+    _BasecFormatSink*  sink,
+    c8                 conversion,
+    _BasecFormatLength length,
+    va_list*           args
+) {
+    const c8* str            = NULL;
+    c8        c              = 0;
+    f64       value          = 0.0;
+    u64       unsigned_value = 0;
+
+    for (u64 i = 0; i < _BASEC_STRING_FORMAT_EXTENSIONS; i++) {
+        if (_FORMAT_EXTENSIONS[i].conversion == conversion) {
+            _FORMAT_EXTENSIONS[i].format(sink, args);
+            return true;
+        }
+    }
+
+    if (
+        length != _BASEC_FORMAT_LENGTH_NONE &&
+        length != _BASEC_FORMAT_LENGTH_L &&
+        length != _BASEC_FORMAT_LENGTH_LL &&
+        length != _BASEC_FORMAT_LENGTH_Z
+    ) return false;
+
+    switch (conversion) {
+        case 'd':
+        case 'i':
+            if (length == _BASEC_FORMAT_LENGTH_NONE) {
+                _basec_sink_write_i64(sink, va_arg(*args, int));
+            } else if (length == _BASEC_FORMAT_LENGTH_L) {
+                _basec_sink_write_i64(sink, va_arg(*args, long));
+            } else if (length == _BASEC_FORMAT_LENGTH_LL) {
+                _basec_sink_write_i64(sink, va_arg(*args, long long));
+            } else {
+                _basec_sink_write_i64(sink, va_arg(*args, ssize_t));
+            }
+            return true;
+        case 'u':
+        case 'x':
+            if (length == _BASEC_FORMAT_LENGTH_NONE) {
+                unsigned_value = va_arg(*args, unsigned int);
+            } else if (length == _BASEC_FORMAT_LENGTH_L) {
+                unsigned_value = va_arg(*args, unsigned long);
+            } else if (length == _BASEC_FORMAT_LENGTH_LL) {
+                unsigned_value = va_arg(*args, unsigned long long);
+            } else {
+                unsigned_value = va_arg(*args, size_t);
+            }
+
+            if (conversion == 'u') {
+                _basec_sink_write_u64(sink, unsigned_value);
+            } else {
+                _basec_sink_write_hex(sink, unsigned_value);
+            }
+            return true;
+        default:
+            break;
+    }
+
+    if (length != _BASEC_FORMAT_LENGTH_NONE) return false;
+
+    switch (conversion) {
+        case 's':
+            str = va_arg(*args, const c8*);
+            if (str == NULL) str = "(null)";
+            _basec_sink_write(sink, str, strlen(str));
+            return true;
+        case 'c':
+            c = (c8)va_arg(*args, int);
+            _basec_sink_write(sink, &c, 1);
+            return true;
+        case 'f':
+            value = va_arg(*args, f64);
+            if (!_basec_sink_write_fixed(sink, value)) {
+                (void)_basec_sink_write_printf(sink, "%f", value);
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Format a value with printf for a rebuilt conversion specification
+ * @param sink The sink to write to
+ * @param spec The conversion specification, without any '*'
+ * @param conversion The conversion character
+ * @param length The length modifier
+ * @param args The arguments to take the value from
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_format_printf(
+    _BasecFormatSink*  sink,
+    const c8*          spec,
+    c8                 conversion,
+    _BasecFormatLength length,
+    va_list*           args
+) {
+    switch (conversion) {
+        case 'd':
+        case 'i':
+            switch (length) {
+                case _BASEC_FORMAT_LENGTH_L:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, long)
+                    );
+                case _BASEC_FORMAT_LENGTH_LL:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, long long)
+                    );
+                case _BASEC_FORMAT_LENGTH_J:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, intmax_t)
+                    );
+                case _BASEC_FORMAT_LENGTH_Z:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, ssize_t)
+                    );
+                case _BASEC_FORMAT_LENGTH_T:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, ptrdiff_t)
+                    );
+                case _BASEC_FORMAT_LENGTH_LONG_DOUBLE:
+                    return BASEC_STRING_FORMAT_FAILURE;
+                default:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, int)
+                    );
+            }
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            switch (length) {
+                case _BASEC_FORMAT_LENGTH_L:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, unsigned long)
+                    );
+                case _BASEC_FORMAT_LENGTH_LL:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, unsigned long long)
+                    );
+                case _BASEC_FORMAT_LENGTH_J:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, uintmax_t)
+                    );
+                case _BASEC_FORMAT_LENGTH_Z:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, size_t)
+                    );
+                case _BASEC_FORMAT_LENGTH_T:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, ptrdiff_t)
+                    );
+                case _BASEC_FORMAT_LENGTH_LONG_DOUBLE:
+                    return BASEC_STRING_FORMAT_FAILURE;
+                default:
+                    return _basec_sink_write_printf(
+                        sink,
+                        spec,
+                        va_arg(*args, unsigned int)
+                    );
+            }
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (length == _BASEC_FORMAT_LENGTH_LONG_DOUBLE) {
+                return _basec_sink_write_printf(
+                    sink,
+                    spec,
+                    va_arg(*args, long double)
+                );
+            }
+            return _basec_sink_write_printf(sink, spec, va_arg(*args, f64));
+        case 'c':
+            return _basec_sink_write_printf(sink, spec, va_arg(*args, int));
+        case 's':
+            return _basec_sink_write_printf(sink, spec, va_arg(*args, c_str));
+        case 'p':
+            return _basec_sink_write_printf(sink, spec, va_arg(*args, void*));
+        default:
+            return BASEC_STRING_FORMAT_FAILURE;
+    }
+}
+
+/**
+ * @brief Format one conversion specification into a sink
+ *
+ * Plain conversions are written directly, anything with flags, a width or a
+ * precision is rebuilt with '*' replaced by its argument and handed to
+ * vsnprintf.
+ *
+ * @param sink The sink to write to
+ * @param format The format, starting after the '%' and advanced past the
+ *               specification
+ * @param args The arguments to take the values from
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_format_spec(
+    _BasecFormatSink* sink,
+    const c8**        format,
+    va_list*          args
+) {
+    const c8*          flags      = *format;
+    const c8*          spec       = *format;
+    const c8*          flags_end  = NULL;
+    const c8*          modifier   = NULL;
+    c8                 rebuilt[_BASEC_STRING_FORMAT_SPEC_LENGTH];
+    i32                used       = 0;
+    i32                width      = 0;
+    i32                precision  = -1;
+    bool               has_width  = false;
+    bool               left_align = false;
+    _BasecFormatLength length     = _BASEC_FORMAT_LENGTH_NONE;
+    c8                 conversion = 0;
+
+    while (*spec != '\0' && strchr("-+ #0", *spec) != NULL) spec++;
+    flags_end = spec;
+    if (flags_end - flags > 5) return BASEC_STRING_FORMAT_FAILURE;
+
+    if (*spec == '*') {
+        width     = va_arg(*args, int);
+        has_width = true;
+        if (width < 0) {
+            left_align = true;
+            width      = width == INT32_MIN ? INT32_MAX : -width;
+        }
+        spec++;
+    } else {
+        for (; *spec >= '0' && *spec <= '9'; spec++) {
+            if (width > 100000) return BASEC_STRING_FORMAT_FAILURE;
+            width     = width * 10 + (*spec - '0');
+            has_width = true;
+        }
+    }
+
+    if (*spec == '.') {
+        spec++;
+        if (*spec == '*') {
+            precision = va_arg(*args, int);
+            spec++;
+        } else {
+            for (precision = 0; *spec >= '0' && *spec <= '9'; spec++) {
+                if (precision > 100000) return BASEC_STRING_FORMAT_FAILURE;
+                precision = precision * 10 + (*spec - '0');
+            }
+        }
+    }
+
+    modifier   = spec;
+    length     = _basec_format_length(&spec);
+    conversion = *spec;
+    if (conversion == '\0') return BASEC_STRING_FORMAT_FAILURE;
+    *format = spec + 1;
+
+    if (conversion == '%') {
+        _basec_sink_write(sink, "%", 1);
+        return BASEC_STRING_SUCCESS;
+    }
+
+    if (
+        modifier == flags &&
+        _basec_format_fast(sink, conversion, length, args)
+    ) return BASEC_STRING_SUCCESS;
+
+    used = snprintf(
+        rebuilt,
+        sizeof(rebuilt),
+        "%%%.*s%s",
+        (i32)(flags_end - flags),
+        flags,
+        left_align ? "-" : ""
+    );
+    if (has_width) {
+        used += snprintf(rebuilt + used, sizeof(rebuilt) - used, "%d", width);
+    }
+    if (precision >= 0) {
+        used += snprintf(
+            rebuilt + used,
+            sizeof(rebuilt) - used,
+            ".%d",
+            precision
+        );
+    }
+    (void)snprintf(
+        rebuilt + used,
+        sizeof(rebuilt) - used,
+        "%.*s%c",
+        (i32)(spec - modifier),
+        modifier,
+        conversion
+    );
+
+    return _basec_format_printf(sink, rebuilt, conversion, length, args);
+}
+
+/**
+ * @brief Format a whole format string into a sink
+ * @param sink The sink to write to
+ * @param format The printf style format
+ * @param args The arguments of the format
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_format(
+    _BasecFormatSink* sink,
+    const c8*         format,
+    va_list*          args
+) {
+    BasecStringResult result  = BASEC_STRING_SUCCESS;
+    const c8*         percent = NULL;
+
+    while (*format != '\0') {
+        percent = strchr(format, '%');
+        if (percent == NULL) {
+            _basec_sink_write(sink, format, strlen(format));
+            break;
+        }
+
+        _basec_sink_write(sink, format, (u64)(percent - format));
+        format = percent + 1;
+
+        result = _basec_format_spec(sink, &format, args);
+        if (result != BASEC_STRING_SUCCESS) return result;
+    }
+
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Decode one UTF-8 sequence
+ * @param data The first byte of the sequence
+ * @param length The number of bytes available
+ * @param codepoint_out The decoded codepoint
+ * @return The length of the sequence, 0 if it is not valid UTF-8
+ */
+static u8 _basec_utf8_decode(const u8* data, u64 length, u32* codepoint_out) {
+    u8  lead       = data[0];
+    u8  size       = 0;
+    u8  min_second = 0x80;
+    u8  max_second = 0xBF;
+    u32 codepoint  = 0;
+
+    if (lead < 0x80) {
+        *codepoint_out = lead;
+        return 1;
+    }
+
+    // Rejects continuation bytes, overlong leads, surrogates and > U+10FFFF
+    if (lead < 0xC2) {
+        return 0;
+    } else if (lead < 0xE0) {
+        size      = 2;
+        codepoint = lead & 0x1F;
+    } else if (lead < 0xF0) {
+        size      = 3;
+        codepoint = lead & 0x0F;
+        if (lead == 0xE0) min_second = 0xA0;
+        if (lead == 0xED) max_second = 0x9F;
+    } else if (lead < 0xF5) {
+        size      = 4;
+        codepoint = lead & 0x07;
+        if (lead == 0xF0) min_second = 0x90;
+        if (lead == 0xF4) max_second = 0x8F;
+    } else {
+        return 0;
+    }
+
+    if (length < size) return 0;
+    if (data[1] < min_second || data[1] > max_second) return 0;
+    codepoint = (codepoint << 6) | (data[1] & 0x3F);
+
+    for (u8 i = 2; i < size; i++) {
+        if ((data[i] & 0xC0) != 0x80) return 0;
+        codepoint = (codepoint << 6) | (data[i] & 0x3F);
+    }
+
+    *codepoint_out = codepoint;
+    return size;
+}
+
+/**
+ * @brief Validate UTF-8 one sequence at a time, skipping ASCII runs
+ * @param data The bytes to validate
+ * @param length The number of bytes
+ * @return Whether the bytes are valid UTF-8
+ */
+static bool _basec_utf8_validate_scalar(const u8* data, u64 length) {
+    u64 offset    = 0;
+    u64 chunk     = 0;
+    u32 codepoint = 0;
+    u8  size      = 0;
+
+    while (offset < length) {
+        if (length - offset >= 8) {
+            (void)memcpy(&chunk, data + offset, sizeof(chunk));
+            if ((chunk & 0x8080808080808080ULL) == 0) {
+                offset += 8;
+                continue;
+            }
+        }
+
+        size = _basec_utf8_decode(data + offset, length - offset, &codepoint);
+        if (size == 0) return false;
+        offset += size;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Count the bytes of a u64 that are not UTF-8 continuation bytes
+ * @param chunk Eight bytes
+ * @return The number of bytes that start a codepoint
+ */
+static u64 _basec_utf8_count_starts(u64 chunk) {
+    u64 continuations = chunk & ~(chunk << 1) & 0x8080808080808080ULL;
+
+    return 8 - (u64)__builtin_popcountll(continuations);
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Find the bytes of a block that are not UTF-8 continuation bytes
+ * @param data The 16 bytes of the block
+ * @return A bit per byte, set when the byte starts a codepoint
+ */
+static u32 _basec_utf8_starts_sse2(const u8* data) {
+    __m128i block = _mm_loadu_si128((const __m128i*)data);
+
+    // Continuation bytes 0x80-0xBF are exactly the signed bytes <= -65
+    return (u32)_mm_movemask_epi8(_mm_cmpgt_epi8(block, _mm_set1_epi8(-65)));
+}
+#endif
+
+#if _BASEC_STRING_UTF8_SSSE3
+// Error flags of the lookup validator, set for the two bytes that make them
+#define _BASEC_UTF8_TOO_SHORT      (1 << 0)
+#define _BASEC_UTF8_TOO_LONG       (1 << 1)
+#define _BASEC_UTF8_OVERLONG_3     (1 << 2)
+#define _BASEC_UTF8_TOO_LARGE      (1 << 3)
+#define _BASEC_UTF8_SURROGATE      (1 << 4)
+#define _BASEC_UTF8_OVERLONG_2     (1 << 5)
+#define _BASEC_UTF8_TOO_LARGE_1000 (1 << 6)
+#define _BASEC_UTF8_OVERLONG_4     (1 << 6)
+#define _BASEC_UTF8_TWO_CONTS      (1 << 7)
+#define _BASEC_UTF8_CARRY          \
+    (_BASEC_UTF8_TOO_SHORT | _BASEC_UTF8_TOO_LONG | _BASEC_UTF8_TWO_CONTS)
+
+// Errors possible given the high nibble of the first byte of a pair
+static const u8 _UTF8_BYTE_1_HIGH[16] = {
+    _BASEC_UTF8_TOO_LONG, _BASEC_UTF8_TOO_LONG,
+    _BASEC_UTF8_TOO_LONG, _BASEC_UTF8_TOO_LONG,
+    _BASEC_UTF8_TOO_LONG, _BASEC_UTF8_TOO_LONG,
+    _BASEC_UTF8_TOO_LONG, _BASEC_UTF8_TOO_LONG,
+    _BASEC_UTF8_TWO_CONTS, _BASEC_UTF8_TWO_CONTS,
+    _BASEC_UTF8_TWO_CONTS, _BASEC_UTF8_TWO_CONTS,
+    _BASEC_UTF8_TOO_SHORT | _BASEC_UTF8_OVERLONG_2,
+    _BASEC_UTF8_TOO_SHORT,
+    _BASEC_UTF8_TOO_SHORT | _BASEC_UTF8_OVERLONG_3 | _BASEC_UTF8_SURROGATE,
+    _BASEC_UTF8_TOO_SHORT | _BASEC_UTF8_TOO_LARGE |
+        _BASEC_UTF8_TOO_LARGE_1000 | _BASEC_UTF8_OVERLONG_4,
+};
+
+// Errors possible given the low nibble of the first byte of a pair
+static const u8 _UTF8_BYTE_1_LOW[16] = {
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_OVERLONG_3 | _BASEC_UTF8_OVERLONG_2 |
+        _BASEC_UTF8_OVERLONG_4,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_OVERLONG_2,
+    _BASEC_UTF8_CARRY,
+    _BASEC_UTF8_CARRY,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000 |
+        _BASEC_UTF8_SURROGATE,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+    _BASEC_UTF8_CARRY | _BASEC_UTF8_TOO_LARGE | _BASEC_UTF8_TOO_LARGE_1000,
+};
+
+// Errors possible given the high nibble of the second byte of a pair
+static const u8 _UTF8_BYTE_2_HIGH[16] = {
+    _BASEC_UTF8_TOO_SHORT, _BASEC_UTF8_TOO_SHORT,
+    _BASEC_UTF8_TOO_SHORT, _BASEC_UTF8_TOO_SHORT,
+    _BASEC_UTF8_TOO_SHORT, _BASEC_UTF8_TOO_SHORT,
+    _BASEC_UTF8_TOO_SHORT, _BASEC_UTF8_TOO_SHORT,
+    _BASEC_UTF8_TOO_LONG | _BASEC_UTF8_OVERLONG_2 | _BASEC_UTF8_TWO_CONTS |
+        _BASEC_UTF8_OVERLONG_3 | _BASEC_UTF8_TOO_LARGE_1000 |
+        _BASEC_UTF8_OVERLONG_4,
+    _BASEC_UTF8_TOO_LONG | _BASEC_UTF8_OVERLONG_2 | _BASEC_UTF8_TWO_CONTS |
+        _BASEC_UTF8_OVERLONG_3 | _BASEC_UTF8_TOO_LARGE,
+    _BASEC_UTF8_TOO_LONG | _BASEC_UTF8_OVERLONG_2 | _BASEC_UTF8_TWO_CONTS |
+        _BASEC_UTF8_SURROGATE | _BASEC_UTF8_TOO_LARGE,
+    _BASEC_UTF8_TOO_LONG | _BASEC_UTF8_OVERLONG_2 | _BASEC_UTF8_TWO_CONTS |
+        _BASEC_UTF8_SURROGATE | _BASEC_UTF8_TOO_LARGE,
+    _BASEC_UTF8_TOO_SHORT, _BASEC_UTF8_TOO_SHORT,
+    _BASEC_UTF8_TOO_SHORT, _BASEC_UTF8_TOO_SHORT,
+};
+
+// Largest final bytes of a block that do not leave a sequence unfinished
+static const u8 _UTF8_INCOMPLETE_MAX[16] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+};
+
+/**
+ * @brief The state of the lookup validator between blocks
+ */
+typedef struct {
+    __m128i error;
+    __m128i previous;
+    __m128i incomplete;
+} _BasecUtf8State;
+
+/**
+ * @brief Check one 16 byte block with the lookup validator
+ *
+ * Every pair of neighbouring bytes is classified with three nibble lookups
+ * whose intersection is the set of errors the pair makes. Three and four byte
+ * sequences are then checked to have exactly the continuations they need.
+ *
+ * @param state The validator state
+ * @param input The block to check
+ */
+__attribute__((target("ssse3")))
+static void _basec_utf8_check_block(_BasecUtf8State* state, __m128i input) {
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i       prev1  = {0};
+    __m128i       prev2  = {0};
+    __m128i       prev3  = {0};
+    __m128i       lookup = {0};
+    __m128i       must23 = {0};
+
+    // A block of ASCII can't finish a sequence left open by the last block
+    if (_mm_movemask_epi8(input) == 0) {
+        state->error      = _mm_or_si128(state->error, state->incomplete);
+        state->incomplete = _mm_setzero_si128();
+        state->previous   = input;
+        return;
+    }
+
+    prev1 = _mm_alignr_epi8(input, state->previous, 15);
+    prev2 = _mm_alignr_epi8(input, state->previous, 14);
+    prev3 = _mm_alignr_epi8(input, state->previous, 13);
+
+    lookup = _mm_and_si128(
+        _mm_and_si128(
+            _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i*)_UTF8_BYTE_1_HIGH),
+                _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)
+            ),
+            _mm_shuffle_epi8(
+                _mm_loadu_si128((const __m128i*)_UTF8_BYTE_1_LOW),
+                _mm_and_si128(prev1, nibble)
+            )
+        ),
+        _mm_shuffle_epi8(
+            _mm_loadu_si128((const __m128i*)_UTF8_BYTE_2_HIGH),
+            _mm_and_si128(_mm_srli_epi16(input, 4), nibble)
+        )
+    );
+
+    // Bytes two or three after a 3 or 4 byte lead must be continuations
+    must23 = _mm_and_si128(
+        _mm_or_si128(
+            _mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+            _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80))
+        ),
+        _mm_set1_epi8((c8)0x80)
+    );
+
+    state->error      = _mm_or_si128(
+        state->error,
+        _mm_xor_si128(must23, lookup)
+    );
+    state->incomplete = _mm_subs_epu8(
+        input,
+        _mm_loadu_si128((const __m128i*)_UTF8_INCOMPLETE_MAX)
+    );
+    state->previous   = input;
+}
+
+/**
+ * @brief Validate UTF-8 16 bytes at a time with the lookup algorithm
+ * @param data The bytes to validate
+ * @param length The number of bytes
+ * @return Whether the bytes are valid UTF-8
+ */
+__attribute__((target("ssse3")))
+static bool _basec_utf8_validate_ssse3(const u8* data, u64 length) {
+    _BasecUtf8State state  = {0};
+    u8              tail[16];
+    u64             offset = 0;
+
+    state.error      = _mm_setzero_si128();
+    state.previous   = _mm_setzero_si128();
+    state.incomplete = _mm_setzero_si128();
+
+    for (; offset + 16 <= length; offset += 16) {
+        _basec_utf8_check_block(
+            &state,
+            _mm_loadu_si128((const __m128i*)(data + offset))
+        );
+    }
+
+    // Pad the tail with ASCII, which also flags a sequence left open
+    if (offset < length) {
+        (void)memset(tail, 0, sizeof(tail));
+        (void)memcpy(tail, data + offset, length - offset);
+        _basec_utf8_check_block(&state, _mm_loadu_si128((const __m128i*)tail));
+    }
+    state.error = _mm_or_si128(state.error, state.incomplete);
+
+    return _mm_movemask_epi8(
+        _mm_cmpeq_epi8(state.error, _mm_setzero_si128())
+    ) == 0xFFFF;
+}
+#endif
+
+/**
+ * @brief Convert an ASCII letter to lowercase, leaving other bytes alone
+ * @param c The character to convert
+ * @return The lowercase character
+ */
+static c8 _basec_ascii_to_lower(c8 c) {
+    return (c8)(c + ((u8)(c - 'A') < 26 ? 0x20 : 0));
+}
+
+/**
+ * @brief Check whether a byte is ASCII whitespace
+ * @param c The character to check
+ * @return Whether the character is a space, \t, \n, \v, \f or \r
+ */
+static bool _basec_ascii_is_space(c8 c) {
+    return c == ' ' || (u8)(c - '\t') < 5;
+}
+
+/**
+ * @brief Compare two runs of characters, ignoring ASCII case
+ * @param a The first characters
+ * @param b The second characters
+ * @param length The number of characters to compare
+ * @return Whether the characters are equal
+ */
+static bool _basec_equals_icase(const c8* a, const c8* b, u64 length) {
+    for (u64 i = 0; i < length; i++) {
+        if (_basec_ascii_to_lower(a[i]) != _basec_ascii_to_lower(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Flip the case bit of every byte between first and last
+ *
+ * Upper and lowercase ASCII letters differ only in bit 0x20, so the same
+ * toggle converts either way.
+ *
+ * @param data The characters to convert in place
+ * @param length The number of characters
+ * @param first The first character to convert
+ * @param last The last character to convert
+ */
+static void _basec_ascii_toggle_case(c8* data, u64 length, c8 first, c8 last) {
+    u64 offset = 0;
+
+#if defined(__SSE2__)
+    const __m128i below = _mm_set1_epi8((c8)(first - 1));
+    const __m128i above = _mm_set1_epi8((c8)(last + 1));
+    const __m128i flip  = _mm_set1_epi8(0x20);
+    __m128i       block = {0};
+    __m128i       mask  = {0};
+
+    // Bytes >= 0x80 are negative as signed bytes so never fall in the range
+    for (; offset + 16 <= length; offset += 16) {
+        block = _mm_loadu_si128((const __m128i*)(data + offset));
+        mask  = _mm_and_si128(
+            _mm_cmpgt_epi8(block, below),
+            _mm_cmpgt_epi8(above, block)
+        );
+        _mm_storeu_si128(
+            (__m128i*)(data + offset),
+            _mm_xor_si128(block, _mm_and_si128(mask, flip))
+        );
+    }
+#endif
+
+    for (; offset < length; offset++) {
+        if (data[offset] >= first && data[offset] <= last) {
+            data[offset] ^= 0x20;
+        }
+    }
+}
+
+#if defined(__SSE2__)
+/**
+ * @brief Find the whitespace bytes of a 16 byte block
+ * @param data The 16 bytes of the block
+ * @return A bit per byte, set when the byte is ASCII whitespace
+ */
+static u32 _basec_ascii_spaces_sse2(const c8* data) {
+    __m128i block   = _mm_loadu_si128((const __m128i*)data);
+    __m128i control = _mm_sub_epi8(block, _mm_set1_epi8('\t'));
+
+    // \t to \r are the bytes whose distance from \t is at most 4 unsigned
+    return (u32)_mm_movemask_epi8(
+        _mm_or_si128(
+            _mm_cmpeq_epi8(block, _mm_set1_epi8(' ')),
+            _mm_cmpeq_epi8(_mm_min_epu8(control, _mm_set1_epi8(4)), control)
+        )
+    );
+}
+#endif
+
+/**
+ * @brief Find a needle in a haystack, ignoring ASCII case
+ *
+ * Candidates are found 16 positions at a time by comparing both the first
+ * and the last byte of the needle, then confirmed with a full comparison.
+ * Letters are folded by setting bit 0x20, which matches exactly the two
+ * cases of a letter.
+ *
+ * @param haystack The characters to search
+ * @param haystack_length The number of characters to search
+ * @param needle The characters to find
+ * @param needle_length The number of characters to find
+ * @param index_out The index of the first match
+ * @return Whether the needle was found
+ */
+static bool _basec_search_icase(
+    const c8* haystack,
+    u64       haystack_length,
+    const c8* needle,
+    u64       needle_length,
+    u64*      index_out
+) {
+    c8  first  = 0;
+    c8  last   = 0;
+    u64 offset = 0;
+
+    if (needle_length == 0) {
+        *index_out = 0;
+        return true;
+    }
+    if (needle_length > haystack_length) return false;
+
+    first = _basec_ascii_to_lower(needle[0]);
+    last  = _basec_ascii_to_lower(needle[needle_length - 1]);
+
+#if defined(__SSE2__)
+    const __m128i first_fold = _mm_set1_epi8(
+        (c8)((u8)(first - 'a') < 26 ? 0x20 : 0)
+    );
+    const __m128i last_fold  = _mm_set1_epi8(
+        (c8)((u8)(last - 'a') < 26 ? 0x20 : 0)
+    );
+    const __m128i first_byte = _mm_set1_epi8(first);
+    const __m128i last_byte  = _mm_set1_epi8(last);
+    const c8*     tail       = haystack + needle_length - 1;
+    __m128i       heads      = {0};
+    __m128i       tails      = {0};
+    u32           matches    = 0;
+    u32           bit        = 0;
+
+    for (; offset + needle_length - 1 + 16 <= haystack_length; offset += 16) {
+        heads   = _mm_loadu_si128((const __m128i*)(haystack + offset));
+        tails   = _mm_loadu_si128((const __m128i*)(tail + offset));
+        matches = (u32)_mm_movemask_epi8(
+            _mm_and_si128(
+                _mm_cmpeq_epi8(_mm_or_si128(heads, first_fold), first_byte),
+                _mm_cmpeq_epi8(_mm_or_si128(tails, last_fold), last_byte)
+            )
+        );
+
+        while (matches != 0) {
+            bit = (u32)__builtin_ctz(matches);
+            if (
+                _basec_equals_icase(
+                    haystack + offset + bit + 1,
+                    needle + 1,
+                    needle_length - 1
+                )
+            ) {
+                *index_out = offset + bit;
+                return true;
+            }
+            matches &= matches - 1;
+        }
+    }
+#endif
+
+    for (; offset + needle_length <= haystack_length; offset++) {
+        if (
+            _basec_ascii_to_lower(haystack[offset]) == first &&
+            _basec_equals_icase(
+                haystack + offset + 1,
+                needle + 1,
+                needle_length - 1
+            )
+        ) {
+            *index_out = offset;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Multiply two u64s into a 128 bit product
+ * @param x The first factor
+ * @param y The second factor
+ * @param high_out The upper 64 bits of the product
+ * @param low_out The lower 64 bits of the product
+ */
+static void _basec_multiply_128(u64 x, u64 y, u64* high_out, u64* low_out) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 u128;
+
+    u128 product = (u128)x * y;
+
+    *high_out = (u64)(product >> 64);
+    *low_out  = (u64)product;
+#else
+    const u64 mask_32 = 0xFFFFFFFFULL;
+    u64       a       = x >> 32;
+    u64       b       = x & mask_32;
+    u64       c       = y >> 32;
+    u64       d       = y & mask_32;
+    u64       mid     = ((b * d) >> 32) + ((a * d) & mask_32) +
+                        ((b * c) & mask_32);
+
+    *high_out = a * c + ((a * d) >> 32) + ((b * c) >> 32) + (mid >> 32);
+    *low_out  = (mid << 32) | ((b * d) & mask_32);
+#endif
+}
+
+/**
+ * @brief Load 8 characters as a little endian u64
+ * @param data The characters to load
+ * @return The loaded characters
+ */
+static u64 _basec_load_8_chars(const c8* data) {
+    u64 chunk = 0;
+
+    (void)memcpy(&chunk, data, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    chunk = __builtin_bswap64(chunk);
+#endif
+    return chunk;
+}
+
+/**
+ * @brief Check whether 8 characters loaded into a u64 are all digits
+ * @param chunk The loaded characters
+ * @return Whether every character is between '0' and '9'
+ */
+static bool _basec_is_8_digits(u64 chunk) {
+    return (
+        ((chunk + 0x4646464646464646ULL) | (chunk - 0x3030303030303030ULL)) &
+        0x8080808080808080ULL
+    ) == 0;
+}
+
+/**
+ * @brief Convert 8 digits loaded into a u64 to their value (SWAR)
+ *
+ * Neighbouring digits are combined into pairs, then quads, then the full
+ * eight digits with three multiplications instead of eight.
+ *
+ * @param chunk The loaded digits
+ * @return The value of the digits
+ */
+static u64 _basec_parse_8_digits(u64 chunk) {
+    const u64 mask = 0x000000FF000000FFULL;
+    const u64 mul1 = 0x000F424000000064ULL; // 100 + (1000000 << 32)
+    const u64 mul2 = 0x0000271000000001ULL; // 1 + (10000 << 32)
+
+    chunk -= 0x3030303030303030ULL;
+    chunk  = (chunk * 10) + (chunk >> 8);
+    chunk  = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+    return chunk;
+}
+
+/**
+ * @brief Parse a run of characters that must all be digits into a u64
+ * @param data The first character
+ * @param end One past the last character
+ * @param value_out The parsed value
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_parse_u64_digits(
+    const c8* data,
+    const c8* end,
+    u64*      value_out
+) {
+    u64  value    = 0;
+    u64  chunk    = 0;
+    u64  digit    = 0;
+    bool overflow = false;
+
+    if (data == end) return BASEC_STRING_PARSE_FAILURE;
+
+    while (end - data >= 8) {
+        chunk = _basec_load_8_chars(data);
+        if (!_basec_is_8_digits(chunk)) return BASEC_STRING_PARSE_FAILURE;
+
+        overflow |= __builtin_mul_overflow(value, 100000000ULL, &value);
+        overflow |= __builtin_add_overflow(
+            value,
+            _basec_parse_8_digits(chunk),
+            &value
+        );
+        data += 8;
+    }
+
+    for (; data < end; data++) {
+        digit = (u64)(u8)(*data - '0');
+        if (digit > 9) return BASEC_STRING_PARSE_FAILURE;
+
+        overflow |= __builtin_mul_overflow(value, 10ULL, &value);
+        overflow |= __builtin_add_overflow(value, digit, &value);
+    }
+
+    if (overflow) return BASEC_STRING_OUT_OF_RANGE;
+
+    *value_out = value;
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief The significant digits of a decimal number being parsed
+ */
+typedef struct {
+    u64  mantissa;
+    u32  digits;
+    bool truncated;
+} _BasecDecimal;
+
+/**
+ * @brief Accumulate a run of digits into a decimal mantissa
+ *
+ * Only the first 19 significant digits are kept. Digits past that are
+ * counted in dropped_out, and mark the decimal as truncated unless they are
+ * zero.
+ *
+ * @param data The first character of the run
+ * @param end One past the last character that may be read
+ * @param decimal The decimal to accumulate into
+ * @param dropped_out The number of digits that were not kept
+ * @return One past the last digit of the run
+ */
+static const c8* _basec_accumulate_digits(
+    const c8*      data,
+    const c8*      end,
+    _BasecDecimal* decimal,
+    i64*           dropped_out
+) {
+    u64 chunk = 0;
+    u64 digit = 0;
+
+    while (
+        end - data >= 8 &&
+        decimal->digits + 8 <= _BASEC_STRING_U64_SAFE_DIGITS
+    ) {
+        chunk = _basec_load_8_chars(data);
+        if (!_basec_is_8_digits(chunk)) break;
+
+        decimal->mantissa = decimal->mantissa * 100000000ULL +
+                            _basec_parse_8_digits(chunk);
+        if (decimal->digits > 0) {
+            decimal->digits += 8;
+        } else if (decimal->mantissa != 0) {
+            decimal->digits = _basec_count_digits(decimal->mantissa);
+        }
+        data += 8;
+    }
+
+    for (; data < end; data++) {
+        digit = (u64)(u8)(*data - '0');
+        if (digit > 9) break;
+
+        if (decimal->digits < _BASEC_STRING_U64_SAFE_DIGITS) {
+            decimal->mantissa = decimal->mantissa * 10 + digit;
+            if (decimal->mantissa != 0) decimal->digits++;
+        } else {
+            (*dropped_out)++;
+            if (digit != 0) decimal->truncated = true;
+        }
+    }
+
+    return data;
+}
+
+/**
+ * @brief Check whether characters match a lowercase word, ignoring case
+ * @param data The first character
+ * @param end One past the last character
+ * @param word The lowercase word to compare against
+ * @return Whether the characters are exactly the word
+ */
+static bool _basec_equals_ignore_case(
+    const c8* data,
+    const c8* end,
+    const c_str word
+) {
+    u64 length = strlen(word);
+
+    if ((u64)(end - data) != length) return false;
+    for (u64 i = 0; i < length; i++) {
+        if (_basec_ascii_to_lower(data[i]) != word[i]) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Convert a decimal mantissa and exponent to f64 bits (Eisel-Lemire)
+ *
+ * Multiplies the mantissa by a truncated 128 bit power of five, which gives
+ * the correctly rounded result unless the truncation leaves the rounding
+ * direction ambiguous.
+ *
+ * @param mantissa The decimal mantissa, not zero
+ * @param exponent The decimal exponent
+ * @param bits_out The bits of the positive f64 closest to the number
+ * @return Whether the result is known to be correctly rounded
+ */
+static bool _basec_eisel_lemire(u64 mantissa, i64 exponent, u64* bits_out) {
+    const u64* power          = NULL;
+    u64        high           = 0;
+    u64        low            = 0;
+    u64        second_high    = 0;
+    u64        second_low     = 0;
+    u64        upper_bit      = 0;
+    u64        shift          = 0;
+    i64        leading_zeroes = 0;
+    i64        power2         = 0;
+
+    if (exponent < _BASEC_STRING_POW5_MIN_EXPONENT) {
+        *bits_out = 0;
+        return true;
+    }
+    if (exponent > _BASEC_STRING_POW5_MAX_EXPONENT) {
+        *bits_out = _BASEC_STRING_F64_INFINITY;
+        return true;
+    }
+
+    leading_zeroes  = __builtin_clzll(mantissa);
+    mantissa      <<= leading_zeroes;
+
+    // 55 bits are enough to round, only refine when they may be off by one
+    power = _POWERS_OF_FIVE_128[exponent - _BASEC_STRING_POW5_MIN_EXPONENT];
+    _basec_multiply_128(mantissa, power[0], &high, &low);
+    if ((high & 0x1FF) == 0x1FF) {
+        _basec_multiply_128(mantissa, power[1], &second_high, &second_low);
+        low += second_high;
+        if (second_high > low) high++;
+    }
+    if (low == 0xFFFFFFFFFFFFFFFFULL && (exponent < -27 || exponent > 55)) {
+        return false;
+    }
+
+    upper_bit = high >> 63;
+    shift     = upper_bit + 64 - _BASEC_STRING_F64_MANTISSA_BITS - 3;
+    mantissa  = high >> shift;
+
+    // floor(log2(10^exponent)) + 63, without a division
+    power2 = (((152170 + 65536) * exponent) >> 16) + 63 +
+             (i64)upper_bit - leading_zeroes + _BASEC_STRING_F64_EXPONENT_BIAS;
+
+    if (power2 <= 0) {
+        // Subnormal
+        if (-power2 + 1 >= 64) {
+            *bits_out = 0;
+            return true;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa  += mantissa & 1;
+        mantissa >>= 1;
+
+        // Rounding up to the smallest normal number sets the exponent bit
+        *bits_out = mantissa;
+        return true;
+    }
+
+    // Exactly halfway between two doubles, round to even
+    if (
+        low <= 1 && exponent >= -4 && exponent <= 23 &&
+        (mantissa & 3) == 1 && (mantissa << shift) == high
+    ) {
+        mantissa &= ~1ULL;
+    }
+
+    mantissa  += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << _BASEC_STRING_F64_MANTISSA_BITS)) {
+        mantissa = 1ULL << _BASEC_STRING_F64_MANTISSA_BITS;
+        power2++;
+    }
+    mantissa &= ~(1ULL << _BASEC_STRING_F64_MANTISSA_BITS);
+
+    if (power2 >= 0x7FF) {
+        *bits_out = _BASEC_STRING_F64_INFINITY;
+        return true;
+    }
+
+    *bits_out = mantissa | ((u64)power2 << _BASEC_STRING_F64_MANTISSA_BITS);
+    return true;
+}
+
+/**
+ * @brief Parse an f64 with strtod, for the rare inputs the fast path rejects
+ *
+ * The '.' is swapped for the locale's decimal point so the result does not
+ * depend on the current locale.
+ *
+ * @param data The first character of the number, after the sign
+ * @param length The number of characters
+ * @param bits_out The bits of the parsed positive f64
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_parse_f64_slow(
+    const c8* data,
+    u64       length,
+    u64*      bits_out
+) {
+    c_str buffer        = NULL;
+    c8    decimal_point = localeconv()->decimal_point[0];
+    f64   value         = 0.0;
+
+    buffer = (c_str)malloc(length + 1);
+    if (buffer == NULL) return BASEC_STRING_ALLOCATION_FAILURE;
+
+    (void)memcpy(buffer, data, length);
+    buffer[length] = '\0';
+    for (u64 i = 0; i < length; i++) {
+        if (buffer[i] == '.') buffer[i] = decimal_point;
+    }
+
+    value = strtod(buffer, NULL);
+    free(buffer);
+
+    (void)memcpy(bits_out, &value, sizeof(*bits_out));
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Parse an unsigned decimal number into f64 bits
+ *
+ * Short inputs with small exponents are computed exactly in floating point
+ * (Clinger's fast path), the rest go through Eisel-Lemire, and only the
+ * inputs it can't decide fall back to strtod.
+ *
+ * @param start The first character of the number, after the sign
+ * @param end One past the last character
+ * @param bits_out The bits of the parsed positive f64
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_parse_f64_bits(
+    const c8* start,
+    const c8* end,
+    u64*      bits_out
+) {
+    BasecStringResult result         = BASEC_STRING_SUCCESS;
+    const c8*         data           = start;
+    const c8*         run            = NULL;
+    _BasecDecimal     decimal        = {0};
+    i64               dropped        = 0;
+    i64               exponent       = 0;
+    i64               exponent_value = 0;
+    bool              has_digits     = false;
+    bool              exponent_sign  = false;
+    u64               bits           = 0;
+    u64               bits_upper     = 0;
+    f64               value          = 0.0;
+
+    // Integer part, digits past the 19th only scale the value
+    run         = data;
+    data        = _basec_accumulate_digits(data, end, &decimal, &dropped);
+    has_digits  = data != run;
+    exponent   += dropped;
+
+    // Fraction part, every kept digit divides the value by ten
+    if (data < end && *data == '.') {
+        data++;
+        run         = data;
+        dropped     = 0;
+        data        = _basec_accumulate_digits(data, end, &decimal, &dropped);
+        has_digits |= data != run;
+        exponent   -= (i64)(data - run) - dropped;
+    }
+    if (!has_digits) return BASEC_STRING_PARSE_FAILURE;
+
+    if (data < end && (*data == 'e' || *data == 'E')) {
+        data++;
+        if (data < end && (*data == '-' || *data == '+')) {
+            exponent_sign = *data == '-';
+            data++;
+        }
+        if (data == end) return BASEC_STRING_PARSE_FAILURE;
+
+        for (; data < end && *data >= '0' && *data <= '9'; data++) {
+            // Anything this large is already zero or infinity
+            if (exponent_value < 100000) {
+                exponent_value = exponent_value * 10 + (*data - '0');
+            }
+        }
+        exponent += exponent_sign ? -exponent_value : exponent_value;
+    }
+    if (data != end) return BASEC_STRING_PARSE_FAILURE;
+
+    if (decimal.mantissa == 0) {
+        bits = 0;
+    } else if (
+        !decimal.truncated &&
+        exponent >= -22 && exponent <= 22 &&
+        decimal.mantissa <= (1ULL << 53)
+    ) {
+        // Both operands are exact, so one rounding gives the right answer
+        value = (f64)decimal.mantissa;
+        if (exponent < 0) {
+            value /= _EXACT_POW10_F64[-exponent];
+        } else {
+            value *= _EXACT_POW10_F64[exponent];
+        }
+        (void)memcpy(&bits, &value, sizeof(bits));
+    } else if (
+        _basec_eisel_lemire(decimal.mantissa, exponent, &bits) &&
+        (
+            !decimal.truncated ||
+            (
+                _basec_eisel_lemire(
+                    decimal.mantissa + 1,
+                    exponent,
+                    &bits_upper
+                ) &&
+                bits == bits_upper
+            )
+        )
+    ) {
+        // The dropped digits can't change the rounding
+    } else {
+        result = _basec_parse_f64_slow(start, (u64)(end - start), &bits);
+        if (result != BASEC_STRING_SUCCESS) return result;
+    }
+
+    if (bits == _BASEC_STRING_F64_INFINITY) return BASEC_STRING_OUT_OF_RANGE;
+
+    *bits_out = bits;
+    return BASEC_STRING_SUCCESS;
+
+}
+
+/**
+ * @brief Parse a u64 into an untyped array element
+ * @param view The view to parse
+ * @param value_out The element to store the value in
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_parse_u64_element(
+    BasecStringView view,
+    void*           value_out
+) {
+    return basec_string_parse_u64(view, (u64*)value_out);
+}
+
+/**
+ * @brief Parse an i64 into an untyped array element
+ * @param view The view to parse
+ * @param value_out The element to store the value in
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_parse_i64_element(
+    BasecStringView view,
+    void*           value_out
+) {
+    return basec_string_parse_i64(view, (i64*)value_out);
+}
+
+/**
+ * @brief Parse an f64 into an untyped array element
+ * @param view The view to parse
+ * @param value_out The element to store the value in
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_parse_f64_element(
+    BasecStringView view,
+    void*           value_out
+) {
+    return basec_string_parse_f64(view, (f64*)value_out);
+}
+
+/**
+ * @brief Parse every string of an array into a typed array
+ * @param strings The array of BasecString* to parse
+ * @param element_size The size of a parsed value
+ * @param parse The function that parses one value
+ * @param values_out The array to store the values in
+ * @param index_out The index of the string that failed to parse, may be NULL
+ * @return The result of the operation
+ */
+static BasecStringResult _basec_strings_parse(
+    BasecArray*  strings,
+    u64          element_size,
+    BasecStringResult (*parse)(BasecStringView, void*),
+    BasecArray** values_out,
+    u64*         index_out
+) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecArray*       values        = NULL;
+    BasecString*      string        = NULL;
+    BasecStringView   view          = {0};
+
+    if (strings == NULL || values_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    if (
+        basec_array_create(
+            &values,
+            element_size,
+            strings->length > 0 ? strings->length : 1
+        ) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_STRING_ARRAY_FAILURE;
+
+    for (u64 i = 0; i < strings->length; i++) {
+        string = ((BasecString**)strings->data)[i];
+        if (string == NULL) {
+            string_result = BASEC_STRING_NULL_POINTER;
+        } else {
+            view.data     = string->data;
+            view.length   = string->length;
+            string_result = parse(
+                view,
+                (u8*)values->data + i * element_size
+            );
+        }
+
+        if (string_result != BASEC_STRING_SUCCESS) {
+            if (index_out != NULL) *index_out = i;
+            (void)basec_array_destroy(&values);
+            return string_result;
+        }
+    }
+    values->length = strings->length;
+
+    if (*values_out != NULL) {
+        if (basec_array_destroy(values_out) != BASEC_ARRAY_SUCCESS) {
+            (void)basec_array_destroy(&values);
+            return BASEC_STRING_ARRAY_FAILURE;
+        }
+    }
+
+    *values_out = values;
+    return BASEC_STRING_SUCCESS;
+}
+/**
+ * @brief Handle the result of a string operation
+ * @param result The result of the string operation to handle
+ */
+void basec_string_handle_result(BasecStringResult result) {
+    switch (result) {
+        case BASEC_STRING_SUCCESS:
+            break;
+        case BASEC_STRING_NULL_POINTER:
+            (void)printf(
+                "[Error][String] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_STRING_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][String] "
+                "Invalid capacity provided to string operation.\n"
+            );
+            exit(1);
+        case BASEC_STRING_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][String] "
+                "Memory allocation failed "
+                "while attempting to create or manipulate the string.\n"
+            );
+            exit(1);
+        case BASEC_STRING_MEMOP_FAILURE:
+            (void)printf(
+                "[Error][String] "
+                "A memory operation failed, "
+                "indicating potential corruption or access issues.\n"
+            );
+            exit(1);
+        case BASEC_STRING_ARRAY_FAILURE:
+            (void)printf(
+                "[Error][String] An array operation failed.\n"
+            );
+            exit(1);
+        case BASEC_STRING_IO_FAILURE:
+            (void)printf(
+                "[Error][String] A file operation failed.\n"
+            );
+            exit(1);
+        case BASEC_STRING_PARSE_FAILURE:
+            (void)printf(
+                "[Error][String] The string is not a valid number.\n"
+            );
+            exit(1);
+        case BASEC_STRING_OUT_OF_RANGE:
+            (void)printf(
+                "[Error][String] A value is out of range.\n"
+            );
+            exit(1);
+        case BASEC_STRING_FORMAT_FAILURE:
+            (void)printf(
+                "[Error][String] The format string is invalid.\n"
+            );
+            exit(1);
+        case BASEC_STRING_INVALID_UTF8:
+            (void)printf(
+                "[Error][String] The string is not valid UTF-8.\n"
+            );
+            exit(1);
+        case BASEC_STRING_END_OF_STRING:
+            (void)printf(
+                "[Error][String] The end of the string was reached.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][String] "
+                "An unknown error occurred during string operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a new string
+ * @param string The string to create
+ * @param str The c_str to create the string from
+ * @param capacity The capacity of the string
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_create(
+    BasecString** string,
+    const c_str   str,
+    u64           capacity
+) {
+    if (string == NULL || str == NULL) return BASEC_STRING_NULL_POINTER;
+    if (capacity <= 0) return BASEC_STRING_INVALID_CAPACITY;
+
+    void* data = NULL;
+
+    *string = (BasecString*)malloc(sizeof(BasecString));
+    if (*string == NULL) return BASEC_STRING_ALLOCATION_FAILURE;
+
+    (*string)->length = strlen(str);
+    if ((*string)->length > capacity) {
+        capacity = (*string)->length * _GROWTH_FACTOR;
+    }
+
+    if (
+        basec_memory_allocate(
+            &data,
+            capacity + 1,
+            &(*string)->mapped
+        ) != BASEC_MEMORY_SUCCESS
+    ) {
+        free(*string);
+        return BASEC_STRING_ALLOCATION_FAILURE;
+    }
+    (*string)->data     = (c_str)data;
+    (*string)->capacity = capacity;
+
+    if (strncpy((*string)->data, str, (*string)->length) == NULL) {
+        (void)basec_string_destroy(string);
+        return BASEC_STRING_MEMOP_FAILURE;
+    }
+
+    (*string)->data[(*string)->length] = '\0';
+
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Get the string as a c_str
+ * @param string The string to get
+ * @param str_out The c_str to store the string in
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_c_str(BasecString* string, c_str* str_out) {
+    if (string == NULL || str_out == NULL) return BASEC_STRING_NULL_POINTER;
+
+    *str_out = string->data;
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Get the length of the string
+ * @param string The string to get the length of
+ * @param length_out The length of the string
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_length(BasecString* string, u64* length_out) {
+    if (string == NULL || length_out == NULL) return BASEC_STRING_NULL_POINTER;
+
+    *length_out = string->length;
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Get the capacity of the string
+ * @param string The string to get the capacity of
+ * @param capacity_out The capacity of the string
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_capacity(
+    BasecString* string,
+    u64*         capacity_out
+) {
+    if (string == NULL || capacity_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    *capacity_out = string->capacity;
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Prepend a string to the string
+ * @param string The string to prepend to
+ * @param prepend_str The string to prepend
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_prepend(
+    BasecString* string,
+    const c_str  prepend_str
+) {
+    if (string == NULL || prepend_str == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    u64               prepend_len = strlen(prepend_str);
+    u64               new_len     = string->length + prepend_len;
+    BasecStringResult result      = BASEC_STRING_SUCCESS;
+
+    if (new_len > string->capacity) {
+        result = _basec_string_grow(string, new_len);
+        if (result != BASEC_STRING_SUCCESS) return result;
+    }
+    
+    if (memmove(
+        string->data + prepend_len,
+        string->data,
+        string->length
+    ) == NULL) return BASEC_STRING_MEMOP_FAILURE;
+
+    if (memcpy(
+        string->data,
+        prepend_str,
+        prepend_len
+    ) == NULL) return BASEC_STRING_MEMOP_FAILURE;
+
+    string->length = new_len;
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Append a string to the string
+ * @param string The string to append to
+ * @param append_str The string to append
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_append(
+    BasecString* string,
+    const c_str  append_str
+) {
+    if (string == NULL || append_str == NULL) return BASEC_STRING_NULL_POINTER;
+
+    u64               append_len = strlen(append_str);
+    u64               new_len    = string->length + append_len;
+    BasecStringResult result     = BASEC_STRING_SUCCESS;
+
+    if (new_len >= string->capacity) {
+        result = _basec_string_grow(string, new_len);
+        if (result != BASEC_STRING_SUCCESS) return result;
+    }
+
+    if (strncpy(
+        string->data + string->length,
+        append_str,
+        append_len
+    ) == NULL) return BASEC_STRING_MEMOP_FAILURE;
+    string->data[new_len] = '\0';
+
+    string->length = new_len;
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Push a string to the string (same as append)
+ * @param string The string to push to
+ * @param push_str The string to push
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_push(
+    BasecString* string,
+    const c_str  push_str
+) {
+    if (string == NULL || push_str == NULL) return BASEC_STRING_NULL_POINTER;
+    return basec_string_append(string, push_str);
+}
+
+/**
+ * @brief Check if string contains substring
+ * @param string The string to find the substring in
+ * @param substr The substring to find
+ * @param contains_out The boolean to store the result in
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_contains(
+    BasecString* string,
+    const c_str  substr,
+    bool*        contains_out
+) {
+    if (string == NULL || substr == NULL || contains_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    char* substr_ptr = strstr(string->data, substr);
+    *contains_out = substr_ptr != NULL;
+
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Find a substring in the string
+ * @param string The string to find the substring in
+ * @param substr The substring to find
+ * @param index_out The index of the substring
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_find(
+    BasecString* string,
+    const c_str  substr,
+    u64*         index_out
+) {
+    if (string == NULL || substr == NULL || index_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    char* substr_ptr = strstr(string->data, substr);
+    if (substr_ptr == NULL) return BASEC_STRING_NOT_FOUND;
+
+    *index_out = (u64)(substr_ptr - string->data);
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Check if string contains substring, ignoring ASCII case
+ * @param string The string to find the substring in
+ * @param substr The substring to find
+ * @param contains_out The boolean to store the result in
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_contains_icase(
+    BasecString* string,
+    const c_str  substr,
+    bool*        contains_out
+) {
+    if (string == NULL || substr == NULL || contains_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    u64 index = 0;
+
+    *contains_out = _basec_search_icase(
+        string->data,
+        string->length,
+        substr,
+        strlen(substr),
+        &index
+    );
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Find a substring in the string, ignoring ASCII case
+ * @param string The string to find the substring in
+ * @param substr The substring to find
+ * @param index_out The index of the substring
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_find_icase(
+    BasecString* string,
+    const c_str  substr,
+    u64*         index_out
+) {
+    if (string == NULL || substr == NULL || index_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    if (
+        !_basec_search_icase(
+            string->data,
+            string->length,
+            substr,
+            strlen(substr),
+            index_out
+        )
+    ) return BASEC_STRING_NOT_FOUND;
+
+    return BASEC_STRING_SUCCESS;
+}
+
+/** 
+ * @brief Find all instances of a substring in the string
+ * @param string The string to find the substrings in
+ * @param substr The substring to find
+ * @param array_out The array to store the indices in
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_find_all(
+    BasecString* string,
+    const c_str  substr,
+    BasecArray** array_out
+) {
+    if (string == NULL || substr == NULL || array_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    BasecArrayResult array_result;
+    u64              substr_len;
+
+    if (*array_out == NULL) {
+        array_result = basec_array_create(
+            array_out,
+            sizeof(u64),
+            2
+        );
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            return BASEC_STRING_ARRAY_FAILURE;
+        }
+    }
+
+    substr_len = strlen(substr);
+    for (u64 i = 0; i < string->length - substr_len + 1; i++) {
+        if (strncmp(string->data + i, substr, substr_len) == 0) {
+            array_result = basec_array_append(*array_out, &i);
+            if (array_result != BASEC_ARRAY_SUCCESS) {
+                (void)basec_array_destroy(array_out);
+                return BASEC_STRING_ARRAY_FAILURE;
+            }
+        }
+    }
+
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Replace a substring in the string
+ * @param string The string to replace the substring in
+ * @param find The substring to find
+ * @param replace The string to replace the substring with
+ * @param result_out The result of the operation
+ */
+BasecStringResult basec_string_replace(
+    BasecString*  string,
+    const c_str   find,
+    const c_str   replace,
+    BasecString** result_out
+) {
+    if (
+            string  == NULL || find       == NULL || 
+            replace == NULL || result_out == NULL
+    ) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    c_str             str           = NULL;
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      new_string    = NULL;
+    u64               find_len      = 0;
+    u64               substr_start  = 0;
+
+    str = (c_str)malloc(string->length + 1);
+    if (str == NULL) return BASEC_STRING_ALLOCATION_FAILURE;
+
+    if (strncpy(str, string->data, string->length) == NULL) {
+        return BASEC_STRING_MEMOP_FAILURE;
+    }
+    str[string->length] = '\0';
+
+    string_result = basec_string_create(&new_string, "", string->length);
+    if (string_result != BASEC_STRING_SUCCESS) return string_result;
+
+    find_len = strlen(find);
+    for (u64 i = 0; i < string->length - find_len + 1; i++) {
+        if (strncmp(str + i, find, find_len) == 0) {
+            c8 substr[i - substr_start + 1];
+            strncpy(substr, str + substr_start, i - substr_start);
+            substr[i - substr_start] = '\0';
+
+            string_result = basec_string_append(new_string, substr);
+            if (string_result != BASEC_STRING_SUCCESS) return string_result;
+
+            string_result = basec_string_append(new_string, replace);
+            if (string_result != BASEC_STRING_SUCCESS) return string_result;
+
+            substr_start = i + find_len;
+            i += find_len - 1;
+        }
+    }
+    
+    string_result = basec_string_append(new_string, str + substr_start);
+    if (string_result != BASEC_STRING_SUCCESS) return string_result;
+
+    if (*result_out != NULL) {
+        string_result = basec_string_destroy(result_out);
+        if (string_result != BASEC_STRING_SUCCESS) return string_result;
+    }
+    *result_out = new_string;
+
+    free(str);
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Split a string into an array of strings
+ * @param string The string to split
+ * @param delimiter The delimiter to split the string by
+ * @param array_out The array to store the split strings in
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_split(
+    BasecString* string,
+    const c_str  delimiter,
+    BasecArray** array_out
+) {
+    if (string == NULL || delimiter == NULL || array_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    BasecArrayResult  array_result  = BASEC_ARRAY_SUCCESS;
+    BasecArray*       array         = NULL;
+    u64               delim_len     = 0;
+    u64               substr_start  = 0;
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      substring     = NULL;
+
+    array_result = basec_array_create(
+        &array,
+        sizeof(BasecString*),
+        2
+    );
+    if (array_result != BASEC_ARRAY_SUCCESS) return BASEC_STRING_ARRAY_FAILURE;
+
+    delim_len = strlen(delimiter);
+    for (u64 i = 0; i < string->length - delim_len + 1; i++) {
+        if (strncmp(string->data + i, delimiter, delim_len) == 0) {
+            c8 substr[i - substr_start + 1];
+            strncpy(substr, string->data + substr_start, i - substr_start);
+            substr[i - substr_start] = '\0';
+
+            string_result = basec_string_create(
+                &substring,
+                substr,
+                i - substr_start + 1
+            );
+            if (string_result != BASEC_STRING_SUCCESS) return string_result;
+
+            array_result = basec_array_append(array, &substring);
+            if (array_result != BASEC_ARRAY_SUCCESS) {
+                return BASEC_STRING_ARRAY_FAILURE;
+            }
+
+            substr_start = i + delim_len;
+            i += delim_len - 1;
+        }
+    }
+
+    string_result = basec_string_create(
+        &substring,
+        string->data + substr_start,
+        string->length - substr_start + 1
+    );
+    if (string_result != BASEC_STRING_SUCCESS) return string_result;
+
+    array_result = basec_array_append(array, &substring);
+    if (array_result != BASEC_ARRAY_SUCCESS) return BASEC_STRING_ARRAY_FAILURE;
+
+    if (*array_out != NULL) {
+        array_result = basec_array_destroy(array_out);
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            return BASEC_STRING_ARRAY_FAILURE;
+        }
+    }
+
+    *array_out = array;
+    return BASEC_STRING_SUCCESS;
+}
+
 /**
- * @brief Handle the result of a string operation
- * @param result The result of the string operation to handle
+ * @brief Append an unsigned integer to the string
+ * @param string The string to append to
+ * @param value The value to append
+ * @return The result of the operation
  */
-void basec_string_handle_result(BasecStringResult result) {
-    switch (result) {
-        case BASEC_STRING_SUCCESS:
-            break;
-        case BASEC_STRING_NULL_POINTER:
-            (void)printf(
-                "[Error][String] "
-                "Operation failed due to a null pointer reference.\n"
-            );
-            exit(1);
-        case BASEC_STRING_INVALID_CAPACITY:
-            (void)printf(
-                "[Error][String] "
-                "Invalid capacity provided to string operation.\n"
-            );
-            exit(1);
-        case BASEC_STRING_ALLOCATION_FAILURE:
-            (void)printf(
-                "[Error][String] "
-                "Memory allocation failed "
-                "while attempting to create or manipulate the string.\n"
-            );
-            exit(1);
-        case BASEC_STRING_MEMOP_FAILURE:
-            (void)printf(
-                "[Error][String] "
-                "A memory operation failed, "
-                "indicating potential corruption or access issues.\n"
-            );
-            exit(1);
-        case BASEC_STRING_ARRAY_FAILURE:
-            (void)printf(
-                "[Error][String] An array operation failed.\n"
-            );
-            exit(1);
-        default:
-            (void)printf(
-                "[Error][String] "
-                "An unknown error occurred during string operation.\n"
-            );
-            exit(1);
+BasecStringResult basec_string_append_u64(BasecString* string, u64 value) {
+    if (string == NULL) return BASEC_STRING_NULL_POINTER;
+
+    BasecStringResult result = BASEC_STRING_SUCCESS;
+    u8                digits = _basec_count_digits(value);
+
+    result = _basec_string_reserve(string, digits);
+    if (result != BASEC_STRING_SUCCESS) return result;
+
+    string->length += digits;
+    _basec_write_digits(string->data + string->length, value);
+    string->data[string->length] = '\0';
+
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Append a signed integer to the string
+ * @param string The string to append to
+ * @param value The value to append
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_append_i64(BasecString* string, i64 value) {
+    if (string == NULL) return BASEC_STRING_NULL_POINTER;
+
+    BasecStringResult result    = BASEC_STRING_SUCCESS;
+    u64               magnitude = (u64)value;
+
+    if (value < 0) {
+        result = _basec_string_reserve(string, 1);
+        if (result != BASEC_STRING_SUCCESS) return result;
+
+        string->data[string->length++] = '-';
+        magnitude = 0 - magnitude;
     }
+
+    return basec_string_append_u64(string, magnitude);
 }
 
 /**
- * @brief Create a new string
- * @param string The string to create
- * @param str The c_str to create the string from
- * @param capacity The capacity of the string
+ * @brief Append a double to the string
+ * @param string The string to append to
+ * @param value The value to append
  * @return The result of the operation
  */
-BasecStringResult basec_string_create(
-    BasecString** string,
-    const c_str   str,
-    u64           capacity
+BasecStringResult basec_string_append_f64(BasecString* string, f64 value) {
+    if (string == NULL) return BASEC_STRING_NULL_POINTER;
+
+    BasecStringResult result = BASEC_STRING_SUCCESS;
+
+    result = _basec_string_reserve(string, _BASEC_STRING_F64_MAX_LENGTH);
+    if (result != BASEC_STRING_SUCCESS) return result;
+
+    string->length += _basec_format_f64(value, string->data + string->length);
+    string->data[string->length] = '\0';
+
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Append an unsigned integer to the string in lowercase hexadecimal
+ * @param string The string to append to
+ * @param value The value to append
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_append_hex(BasecString* string, u64 value) {
+    if (string == NULL) return BASEC_STRING_NULL_POINTER;
+
+    BasecStringResult result = BASEC_STRING_SUCCESS;
+    u8                digits = _basec_count_hex_digits(value);
+
+    result = _basec_string_reserve(string, digits);
+    if (result != BASEC_STRING_SUCCESS) return result;
+
+    string->length += digits;
+    _basec_write_hex_digits(string->data + string->length, value, digits);
+    string->data[string->length] = '\0';
+
+    return BASEC_STRING_SUCCESS;
+}
+
+/**
+ * @brief Append printf style formatted text to the string
+ * @param string The string to append to
+ * @param format The printf style format
+ * @param ... The arguments of the format
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_appendf(
+    BasecString* string,
+    const c_str  format,
+    ...
 ) {
-    if (string == NULL || str == NULL) return BASEC_STRING_NULL_POINTER;
-    if (capacity <= 0) return BASEC_STRING_INVALID_CAPACITY;
+    BasecStringResult result = BASEC_STRING_SUCCESS;
+    va_list           args;
 
-    *string = (BasecString*)malloc(sizeof(BasecString));
-    if (*string == NULL) return BASEC_STRING_ALLOCATION_FAILURE;
+    va_start(args, format);
+    result = basec_string_vappendf(string, format, args);
+    va_end(args);
 
-    (*string)->length = strlen(str);
-    if ((*string)->length > capacity) {
-        capacity = (*string)->length * _GROWTH_FACTOR;
+    return result;
+}
+
+/**
+ * @brief Append printf style formatted text to the string from a va_list
+ * @param string The string to append to
+ * @param format The printf style format
+ * @param args The arguments of the format
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_vappendf(
+    BasecString* string,
+    const c_str  format,
+    va_list      args
+) {
+    if (string == NULL || format == NULL) return BASEC_STRING_NULL_POINTER;
+
+    BasecStringResult result = BASEC_STRING_SUCCESS;
+    _BasecFormatSink  sink   = {0};
+    va_list           first;
+    va_list           retry;
+
+    va_copy(first, args);
+    va_copy(retry, args);
+
+    sink.data      = string->data + string->length;
+    sink.available = string->capacity > string->length + 1
+                   ? string->capacity - string->length - 1
+                   : 0;
+    result = _basec_format(&sink, format, &first);
+
+    // Too long for the spare capacity, grow once to the measured length
+    if (result == BASEC_STRING_SUCCESS && sink.length > sink.available) {
+        result = _basec_string_reserve(string, sink.length);
+        if (result == BASEC_STRING_SUCCESS) {
+            sink.data      = string->data + string->length;
+            sink.length    = 0;
+            sink.available = string->capacity - string->length - 1;
+            result         = _basec_format(&sink, format, &retry);
+        }
     }
 
-    (*string)->data = (c_str)malloc(capacity + 1);
-    if ((*string)->data == NULL) {
-        free(*string);
-        return BASEC_STRING_ALLOCATION_FAILURE;
+    va_end(first);
+    va_end(retry);
+
+    if (result == BASEC_STRING_SUCCESS) string->length += sink.length;
+    string->data[string->length] = '\0';
+
+    return result;
+}
+
+/**
+ * @brief Parse a view as an unsigned integer
+ * @param view The view to parse
+ * @param value_out The parsed value
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_parse_u64(BasecStringView view, u64* value_out) {
+    const c8* data = view.data;
+    const c8* end  = view.data + view.length;
+
+    if (view.data == NULL || value_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
     }
 
-    if (strncpy((*string)->data, str, (*string)->length) == NULL) {
-        free((*string)->data);
-        free(*string);
-        return BASEC_STRING_MEMOP_FAILURE;
+    if (data < end && *data == '+') data++;
+    return _basec_parse_u64_digits(data, end, value_out);
+}
+
+/**
+ * @brief Parse a view as a signed integer
+ * @param view The view to parse
+ * @param value_out The parsed value
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_parse_i64(BasecStringView view, i64* value_out) {
+    BasecStringResult result    = BASEC_STRING_SUCCESS;
+    const c8*         data      = view.data;
+    const c8*         end       = view.data + view.length;
+    bool              negative  = false;
+    u64               magnitude = 0;
+
+    if (view.data == NULL || value_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
     }
 
-    (*string)->data[(*string)->length] = '\0';
-    (*string)->capacity = capacity;
+    if (data < end && (*data == '-' || *data == '+')) {
+        negative = *data == '-';
+        data++;
+    }
+
+    result = _basec_parse_u64_digits(data, end, &magnitude);
+    if (result != BASEC_STRING_SUCCESS) return result;
+
+    if (negative) {
+        if (magnitude > (u64)INT64_MAX + 1) return BASEC_STRING_OUT_OF_RANGE;
+        *value_out = magnitude == (u64)INT64_MAX + 1 ? INT64_MIN
+                                                     : -(i64)magnitude;
+    } else {
+        if (magnitude > (u64)INT64_MAX) return BASEC_STRING_OUT_OF_RANGE;
+        *value_out = (i64)magnitude;
+    }
 
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Get the string as a c_str
- * @param string The string to get
- * @param str_out The c_str to store the string in
+ * @brief Parse a view as a double
+ * @param view The view to parse
+ * @param value_out The parsed value
  * @return The result of the operation
  */
-BasecStringResult basec_string_c_str(BasecString* string, c_str* str_out) {
-    if (string == NULL || str_out == NULL) return BASEC_STRING_NULL_POINTER;
+BasecStringResult basec_string_parse_f64(BasecStringView view, f64* value_out) {
+    BasecStringResult result   = BASEC_STRING_SUCCESS;
+    const c8*         data     = view.data;
+    const c8*         end      = view.data + view.length;
+    bool              negative = false;
+    u64               bits     = 0;
 
-    *str_out = string->data;
+    if (view.data == NULL || value_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+    if (data < end && (*data == '-' || *data == '+')) {
+        negative = *data == '-';
+        data++;
+    }
+
+    if (
+        _basec_equals_ignore_case(data, end, "inf") ||
+        _basec_equals_ignore_case(data, end, "infinity")
+    ) {
+        bits = _BASEC_STRING_F64_INFINITY;
+    } else if (_basec_equals_ignore_case(data, end, "nan")) {
+        bits = _BASEC_STRING_F64_INFINITY | (1ULL << 51);
+    } else {
+        result = _basec_parse_f64_bits(data, end, &bits);
+        if (result != BASEC_STRING_SUCCESS) return result;
+    }
+
+    if (negative) bits |= 1ULL << 63;
+    (void)memcpy(value_out, &bits, sizeof(bits));
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Get the length of the string
- * @param string The string to get the length of
- * @param length_out The length of the string
+ * @brief Parse every string of an array as an unsigned integer
+ * @param strings The array of BasecString* to parse, e.g. from a split
+ * @param values_out The array of u64 to store the values in
+ * @param index_out The index of the string that failed to parse, may be NULL
  * @return The result of the operation
  */
-BasecStringResult basec_string_length(BasecString* string, u64* length_out) {
-    if (string == NULL || length_out == NULL) return BASEC_STRING_NULL_POINTER;
+BasecStringResult basec_strings_parse_u64(
+    BasecArray*  strings,
+    BasecArray** values_out,
+    u64*         index_out
+) {
+    return _basec_strings_parse(
+        strings,
+        sizeof(u64),
+        _basec_parse_u64_element,
+        values_out,
+        index_out
+    );
+}
 
-    *length_out = string->length;
+/**
+ * @brief Parse every string of an array as a signed integer
+ * @param strings The array of BasecString* to parse, e.g. from a split
+ * @param values_out The array of i64 to store the values in
+ * @param index_out The index of the string that failed to parse, may be NULL
+ * @return The result of the operation
+ */
+BasecStringResult basec_strings_parse_i64(
+    BasecArray*  strings,
+    BasecArray** values_out,
+    u64*         index_out
+) {
+    return _basec_strings_parse(
+        strings,
+        sizeof(i64),
+        _basec_parse_i64_element,
+        values_out,
+        index_out
+    );
+}
+
+/**
+ * @brief Parse every string of an array as a double
+ * @param strings The array of BasecString* to parse, e.g. from a split
+ * @param values_out The array of f64 to store the values in
+ * @param index_out The index of the string that failed to parse, may be NULL
+ * @return The result of the operation
+ */
+BasecStringResult basec_strings_parse_f64(
+    BasecArray*  strings,
+    BasecArray** values_out,
+    u64*         index_out
+) {
+    return _basec_strings_parse(
+        strings,
+        sizeof(f64),
+        _basec_parse_f64_element,
+        values_out,
+        index_out
+    );
+}
+
+/**
+ * @brief Check whether a view is valid UTF-8
+ * @param view The view to check
+ * @param valid_out Whether the view is valid UTF-8
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_utf8_validate(
+    BasecStringView view,
+    bool*           valid_out
+) {
+    if (view.data == NULL || valid_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
+
+#if _BASEC_STRING_UTF8_SSSE3
+    if (__builtin_cpu_supports("ssse3")) {
+        *valid_out = _basec_utf8_validate_ssse3(
+            (const u8*)view.data,
+            view.length
+        );
+        return BASEC_STRING_SUCCESS;
+    }
+#endif
+
+    *valid_out = _basec_utf8_validate_scalar(
+        (const u8*)view.data,
+        view.length
+    );
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Get the capacity of the string
- * @param string The string to get the capacity of
- * @param capacity_out The capacity of the string
+ * @brief Count the codepoints of a UTF-8 view
+ * @param view The view to count the codepoints of
+ * @param length_out The number of codepoints
  * @return The result of the operation
  */
-BasecStringResult basec_string_capacity(
-    BasecString* string,
-    u64*         capacity_out
+BasecStringResult basec_string_utf8_length(
+    BasecStringView view,
+    u64*            length_out
 ) {
-    if (string == NULL || capacity_out == NULL) {
+    if (view.data == NULL || length_out == NULL) {
         return BASEC_STRING_NULL_POINTER;
     }
 
-    *capacity_out = string->capacity;
+    const u8* data   = (const u8*)view.data;
+    u64       length = 0;
+    u64       offset = 0;
+    u64       chunk  = 0;
+
+#if defined(__SSE2__)
+    for (; offset + 16 <= view.length; offset += 16) {
+        length += (u64)__builtin_popcount(
+            _basec_utf8_starts_sse2(data + offset)
+        );
+    }
+#endif
+
+    for (; offset + 8 <= view.length; offset += 8) {
+        (void)memcpy(&chunk, data + offset, sizeof(chunk));
+        length += _basec_utf8_count_starts(chunk);
+    }
+
+    for (; offset < view.length; offset++) {
+        length += (data[offset] & 0xC0) != 0x80;
+    }
+
+    *length_out = length;
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Prepend a string to the string
- * @param string The string to prepend to
- * @param prepend_str The string to prepend
+ * @brief Find the byte offset of a codepoint in a UTF-8 view
+ * @param view The view to search
+ * @param index The index of the codepoint
+ * @param offset_out The byte offset the codepoint starts at
  * @return The result of the operation
  */
-BasecStringResult basec_string_prepend(
-    BasecString* string,
-    const c_str  prepend_str
+BasecStringResult basec_string_utf8_index(
+    BasecStringView view,
+    u64             index,
+    u64*            offset_out
 ) {
-    if (string == NULL || prepend_str == NULL) {
+    if (view.data == NULL || offset_out == NULL) {
         return BASEC_STRING_NULL_POINTER;
     }
 
-    u64               prepend_len = strlen(prepend_str);
-    u64               new_len     = string->length + prepend_len;
-    BasecStringResult result      = BASEC_STRING_SUCCESS;
+    const u8* data   = (const u8*)view.data;
+    u64       offset = 0;
 
-    if (new_len > string->capacity) {
-        result = _basec_string_grow(string, new_len);
-        if (result != BASEC_STRING_SUCCESS) return result;
+#if defined(__SSE2__)
+    u32       starts = 0;
+    u64       count  = 0;
+
+    // Skip whole blocks by their codepoint count, only the last is walked
+    for (; offset + 16 <= view.length; offset += 16) {
+        starts = _basec_utf8_starts_sse2(data + offset);
+        count  = (u64)__builtin_popcount(starts);
+        if (index < count) {
+            for (; index > 0; index--) starts &= starts - 1;
+            *offset_out = offset + (u64)__builtin_ctz(starts);
+            return BASEC_STRING_SUCCESS;
+        }
+        index -= count;
     }
-    
-    if (memmove(
-        string->data + prepend_len,
-        string->data,
-        string->length
-    ) == NULL) return BASEC_STRING_MEMOP_FAILURE;
+#endif
+
+    for (; offset < view.length; offset++) {
+        if ((data[offset] & 0xC0) == 0x80) continue;
+        if (index == 0) {
+            *offset_out = offset;
+            return BASEC_STRING_SUCCESS;
+        }
+        index--;
+    }
+
+    return BASEC_STRING_OUT_OF_RANGE;
+}
 
-    if (memcpy(
-        string->data,
-        prepend_str,
-        prepend_len
-    ) == NULL) return BASEC_STRING_MEMOP_FAILURE;
+/**
+ * @brief Create an iterator over the codepoints of a UTF-8 view
+ * @param view The view to iterate over
+ * @param iterator_out The iterator to initialize
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_utf8_iterator(
+    BasecStringView          view,
+    BasecStringUtf8Iterator* iterator_out
+) {
+    if (view.data == NULL || iterator_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
 
-    string->length = new_len;
+    iterator_out->view   = view;
+    iterator_out->offset = 0;
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Append a string to the string
- * @param string The string to append to
- * @param append_str The string to append
+ * @brief Decode the next codepoint of an iterator
+ * @param iterator The iterator to advance
+ * @param codepoint_out The decoded codepoint
  * @return The result of the operation
  */
-BasecStringResult basec_string_append(
-    BasecString* string,
-    const c_str  append_str
+BasecStringResult basec_string_utf8_next(
+    BasecStringUtf8Iterator* iterator,
+    u32*                     codepoint_out
 ) {
-    if (string == NULL || append_str == NULL) return BASEC_STRING_NULL_POINTER;
+    if (iterator == NULL || codepoint_out == NULL) {
+        return BASEC_STRING_NULL_POINTER;
+    }
 
-    u64               append_len = strlen(append_str);
-    u64               new_len    = string->length + append_len;
-    BasecStringResult result     = BASEC_STRING_SUCCESS;
+    const u8* data = (const u8*)iterator->view.data + iterator->offset;
+    u64       left = iterator->view.length - iterator->offset;
+    u8        size = 0;
 
-    if (new_len >= string->capacity) {
-        result = _basec_string_grow(string, new_len);
-        if (result != BASEC_STRING_SUCCESS) return result;
+    if (left == 0) return BASEC_STRING_END_OF_STRING;
+
+    if (*data < 0x80) {
+        *codepoint_out = *data;
+        iterator->offset++;
+        return BASEC_STRING_SUCCESS;
     }
 
-    if (strncpy(
-        string->data + string->length,
-        append_str,
-        append_len
-    ) == NULL) return BASEC_STRING_MEMOP_FAILURE;
-    string->data[new_len] = '\0';
+    size = _basec_utf8_decode(data, left, codepoint_out);
+    if (size == 0) {
+        iterator->offset++;
+        return BASEC_STRING_INVALID_UTF8;
+    }
 
-    string->length = new_len;
+    iterator->offset += size;
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Push a string to the string (same as append)
- * @param string The string to push to
- * @param push_str The string to push
+ * @brief Get a view of the whole string
+ * @param string The string to view
+ * @param view_out The view of the string
  * @return The result of the operation
  */
-BasecStringResult basec_string_push(
-    BasecString* string,
-    const c_str  push_str
+BasecStringResult basec_string_view(
+    BasecString*     string,
+    BasecStringView* view_out
 ) {
-    if (string == NULL || push_str == NULL) return BASEC_STRING_NULL_POINTER;
-    return basec_string_append(string, push_str);
+    if (string == NULL || view_out == NULL) return BASEC_STRING_NULL_POINTER;
+
+    view_out->data   = string->data;
+    view_out->length = string->length;
+    return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Check if string contains substring
- * @param string The string to find the substring in
- * @param substr The substring to find
- * @param contains_out The boolean to store the result in
+ * @brief Convert the ASCII letters of the string to lowercase in place
+ * @param string The string to convert
  * @return The result of the operation
  */
-BasecStringResult basec_string_contains(
-    BasecString* string,
-    const c_str  substr,
-    bool*        contains_out
-) {
-    if (string == NULL || substr == NULL || contains_out == NULL) {
-        return BASEC_STRING_NULL_POINTER;
-    }
+BasecStringResult basec_string_to_lower(BasecString* string) {
+    if (string == NULL) return BASEC_STRING_NULL_POINTER;
 
-    char* substr_ptr = strstr(string->data, substr);
-    *contains_out = substr_ptr != NULL;
+    _basec_ascii_toggle_case(string->data, string->length, 'A', 'Z');
+    return BASEC_STRING_SUCCESS;
+}
 
+/**
+ * @brief Convert the ASCII letters of the string to uppercase in place
+ * @param string The string to convert
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_to_upper(BasecString* string) {
+    if (string == NULL) return BASEC_STRING_NULL_POINTER;
+
+    _basec_ascii_toggle_case(string->data, string->length, 'a', 'z');
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Find a substring in the string
- * @param string The string to find the substring in
- * @param substr The substring to find
- * @param index_out The index of the substring
+ * @brief Trim leading ASCII whitespace from a view
+ * @param view The view to trim
+ * @param view_out The trimmed view
  * @return The result of the operation
  */
-BasecStringResult basec_string_find(
-    BasecString* string,
-    const c_str  substr,
-    u64*         index_out
+BasecStringResult basec_string_trim_start(
+    BasecStringView  view,
+    BasecStringView* view_out
 ) {
-    if (string == NULL || substr == NULL || index_out == NULL) {
+    if (view.data == NULL || view_out == NULL) {
         return BASEC_STRING_NULL_POINTER;
     }
 
-    char* substr_ptr = strstr(string->data, substr);
-    if (substr_ptr == NULL) return BASEC_STRING_NOT_FOUND;
+    u64 offset = 0;
 
-    *index_out = (u64)(substr_ptr - string->data);
+#if defined(__SSE2__)
+    u32 spaces = 0;
+
+    for (; offset + 16 <= view.length; offset += 16) {
+        spaces = _basec_ascii_spaces_sse2(view.data + offset);
+        if (spaces != 0xFFFF) {
+            offset += (u64)__builtin_ctz(~spaces);
+            break;
+        }
+    }
+#endif
+
+    while (offset < view.length && _basec_ascii_is_space(view.data[offset])) {
+        offset++;
+    }
+
+    view_out->data   = view.data + offset;
+    view_out->length = view.length - offset;
     return BASEC_STRING_SUCCESS;
 }
 
-/** 
- * @brief Find all instances of a substring in the string
- * @param string The string to find the substrings in
- * @param substr The substring to find
- * @param array_out The array to store the indices in
+/**
+ * @brief Trim trailing ASCII whitespace from a view
+ * @param view The view to trim
+ * @param view_out The trimmed view
  * @return The result of the operation
  */
-BasecStringResult basec_string_find_all(
-    BasecString* string,
-    const c_str  substr,
-    BasecArray** array_out
+BasecStringResult basec_string_trim_end(
+    BasecStringView  view,
+    BasecStringView* view_out
 ) {
-    if (string == NULL || substr == NULL || array_out == NULL) {
+    if (view.data == NULL || view_out == NULL) {
         return BASEC_STRING_NULL_POINTER;
     }
 
-    BasecArrayResult array_result;
-    u64              substr_len;
+    u64 length = view.length;
 
-    if (*array_out == NULL) {
-        array_result = basec_array_create(
-            array_out,
-            sizeof(u64),
-            2
-        );
-        if (array_result != BASEC_ARRAY_SUCCESS) {
-            return BASEC_STRING_ARRAY_FAILURE;
+#if defined(__SSE2__)
+    u32 spaces = 0;
+
+    for (; length >= 16; length -= 16) {
+        spaces = _basec_ascii_spaces_sse2(view.data + length - 16);
+        if (spaces != 0xFFFF) {
+            length -= (u64)__builtin_clz(~spaces << 16);
+            break;
         }
     }
+#endif
 
-    substr_len = strlen(substr);
-    for (u64 i = 0; i < string->length - substr_len + 1; i++) {
-        if (strncmp(string->data + i, substr, substr_len) == 0) {
-            array_result = basec_array_append(*array_out, &i);
-            if (array_result != BASEC_ARRAY_SUCCESS) {
-                (void)basec_array_destroy(array_out);
-                return BASEC_STRING_ARRAY_FAILURE;
-            }
-        }
+    while (length > 0 && _basec_ascii_is_space(view.data[length - 1])) {
+        length--;
     }
 
+    view_out->data   = view.data;
+    view_out->length = length;
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Replace a substring in the string
- * @param string The string to replace the substring in
- * @param find The substring to find
- * @param replace The string to replace the substring with
- * @param result_out The result of the operation
+ * @brief Trim leading and trailing ASCII whitespace from a view
+ * @param view The view to trim
+ * @param view_out The trimmed view
+ * @return The result of the operation
  */
-BasecStringResult basec_string_replace(
-    BasecString*  string,
-    const c_str   find,
-    const c_str   replace,
-    BasecString** result_out
+BasecStringResult basec_string_trim(
+    BasecStringView  view,
+    BasecStringView* view_out
 ) {
-    if (
-            string  == NULL || find       == NULL || 
-            replace == NULL || result_out == NULL
-    ) {
-        return BASEC_STRING_NULL_POINTER;
-    }
+    BasecStringResult result = BASEC_STRING_SUCCESS;
 
-    c_str             str           = NULL;
-    BasecStringResult string_result = BASEC_STRING_SUCCESS;
-    BasecString*      new_string    = NULL;
-    u64               find_len      = 0;
-    u64               substr_start  = 0;
+    result = basec_string_trim_start(view, view_out);
+    if (result != BASEC_STRING_SUCCESS) return result;
 
-    str = (c_str)malloc(string->length + 1);
-    if (str == NULL) return BASEC_STRING_ALLOCATION_FAILURE;
+    return basec_string_trim_end(*view_out, view_out);
+}
 
-    if (strncpy(str, string->data, string->length) == NULL) {
-        return BASEC_STRING_MEMOP_FAILURE;
-    }
-    str[string->length] = '\0';
+/**
+ * @brief Hash the contents of the string
+ * @param string The string to hash
+ * @param hash_out The hash of the string
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_hash(BasecString* string, u64* hash_out) {
+    if (string == NULL || hash_out == NULL) return BASEC_STRING_NULL_POINTER;
 
-    string_result = basec_string_create(&new_string, "", string->length);
-    if (string_result != BASEC_STRING_SUCCESS) return string_result;
+    (void)basec_hash_bytes(string->data, string->length, hash_out);
+    return BASEC_STRING_SUCCESS;
+}
 
-    find_len = strlen(find);
-    for (u64 i = 0; i < string->length - find_len + 1; i++) {
-        if (strncmp(str + i, find, find_len) == 0) {
-            c8 substr[i - substr_start + 1];
-            strncpy(substr, str + substr_start, i - substr_start);
-            substr[i - substr_start] = '\0';
+/**
+ * @brief Map a file into memory as a read-only view
+ * @param path The path of the file to map
+ * @param view_out The view to store the mapped file in
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_map_file(
+    const c_str      path,
+    BasecStringView* view_out
+) {
+    if (path == NULL || view_out == NULL) return BASEC_STRING_NULL_POINTER;
 
-            string_result = basec_string_append(new_string, substr);
-            if (string_result != BASEC_STRING_SUCCESS) return string_result;
+    i32         fd        = -1;
+    struct stat file_stat = {0};
+    void*       mapping   = NULL;
 
-            string_result = basec_string_append(new_string, replace);
-            if (string_result != BASEC_STRING_SUCCESS) return string_result;
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return BASEC_STRING_IO_FAILURE;
 
-            substr_start = i + find_len;
-            i += find_len - 1;
-        }
+    if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+        (void)close(fd);
+        return BASEC_STRING_IO_FAILURE;
     }
-    
-    string_result = basec_string_append(new_string, str + substr_start);
-    if (string_result != BASEC_STRING_SUCCESS) return string_result;
 
-    if (*result_out != NULL) {
-        string_result = basec_string_destroy(result_out);
-        if (string_result != BASEC_STRING_SUCCESS) return string_result;
+    // mmap rejects zero length mappings, an empty file is an empty view
+    if (file_stat.st_size == 0) {
+        (void)close(fd);
+        view_out->data   = "";
+        view_out->length = 0;
+        return BASEC_STRING_SUCCESS;
     }
-    *result_out = new_string;
 
-    free(str);
+    mapping = mmap(
+        NULL,
+        (u64)file_stat.st_size,
+        PROT_READ,
+        MAP_PRIVATE,
+        fd,
+        0
+    );
+    (void)close(fd);
+    if (mapping == MAP_FAILED) return BASEC_STRING_IO_FAILURE;
+
+    // Hints only, the mapping is valid whether or not the kernel honours them
+    (void)madvise(mapping, (u64)file_stat.st_size, MADV_SEQUENTIAL);
+#ifdef MADV_HUGEPAGE
+    (void)madvise(mapping, (u64)file_stat.st_size, MADV_HUGEPAGE);
+#endif
+
+    view_out->data   = (c_str)mapping;
+    view_out->length = (u64)file_stat.st_size;
+
     return BASEC_STRING_SUCCESS;
 }
 
 /**
- * @brief Split a string into an array of strings
- * @param string The string to split
- * @param delimiter The delimiter to split the string by
- * @param array_out The array to store the split strings in
+ * @brief Unmap a view created by basec_string_map_file
+ * @param view The view to unmap
  * @return The result of the operation
  */
-BasecStringResult basec_string_split(
-    BasecString* string,
-    const c_str  delimiter,
-    BasecArray** array_out
-) {
-    if (string == NULL || delimiter == NULL || array_out == NULL) {
-        return BASEC_STRING_NULL_POINTER;
+BasecStringResult basec_string_unmap_file(BasecStringView* view) {
+    if (view == NULL || view->data == NULL) return BASEC_STRING_NULL_POINTER;
+
+    if (view->length > 0 && munmap(view->data, view->length) != 0) {
+        return BASEC_STRING_IO_FAILURE;
     }
 
-    BasecArrayResult  array_result  = BASEC_ARRAY_SUCCESS;
-    BasecArray*       array         = NULL;
-    u64               delim_len     = 0;
-    u64               substr_start  = 0;
-    BasecStringResult string_result = BASEC_STRING_SUCCESS;
-    BasecString*      substring     = NULL;
+    view->data   = NULL;
+    view->length = 0;
 
-    array_result = basec_array_create(
-        &array,
-        sizeof(BasecString*),
-        2
-    );
-    if (array_result != BASEC_ARRAY_SUCCESS) return BASEC_STRING_ARRAY_FAILURE;
+    return BASEC_STRING_SUCCESS;
+}
 
-    delim_len = strlen(delimiter);
-    for (u64 i = 0; i < string->length - delim_len + 1; i++) {
-        if (strncmp(string->data + i, delimiter, delim_len) == 0) {
-            c8 substr[i - substr_start + 1];
-            strncpy(substr, string->data + substr_start, i - substr_start);
-            substr[i - substr_start] = '\0';
+/**
+ * @brief Read a file directly into a string
+ * @param path The path of the file to read
+ * @param string_out The string to read the file into
+ * @return The result of the operation
+ */
+BasecStringResult basec_string_read_file(
+    const c_str   path,
+    BasecString** string_out
+) {
+    if (path == NULL || string_out == NULL) return BASEC_STRING_NULL_POINTER;
 
-            string_result = basec_string_create(
-                &substring,
-                substr,
-                i - substr_start + 1
-            );
-            if (string_result != BASEC_STRING_SUCCESS) return string_result;
+    i32               fd            = -1;
+    struct stat       file_stat     = {0};
+    u64               file_size     = 0;
+    u64               total_read    = 0;
+    ssize_t           bytes_read    = 0;
+    BasecString*      string        = *string_out;
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    void*             data          = NULL;
 
-            array_result = basec_array_append(array, &substring);
-            if (array_result != BASEC_ARRAY_SUCCESS) {
-                return BASEC_STRING_ARRAY_FAILURE;
-            }
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return BASEC_STRING_IO_FAILURE;
 
-            substr_start = i + delim_len;
-            i += delim_len - 1;
-        }
+    if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+        (void)close(fd);
+        return BASEC_STRING_IO_FAILURE;
     }
+    file_size = (u64)file_stat.st_size;
 
-    string_result = basec_string_create(
-        &substring,
-        string->data + substr_start,
-        string->length - substr_start + 1
-    );
-    if (string_result != BASEC_STRING_SUCCESS) return string_result;
+    if (string == NULL) {
+        string = (BasecString*)malloc(sizeof(BasecString));
+        if (string == NULL) {
+            (void)close(fd);
+            return BASEC_STRING_ALLOCATION_FAILURE;
+        }
 
-    array_result = basec_array_append(array, &substring);
-    if (array_result != BASEC_ARRAY_SUCCESS) return BASEC_STRING_ARRAY_FAILURE;
+        string->capacity = file_size > 0 ? file_size : 1;
+        string->length   = 0;
+        if (
+            basec_memory_allocate(
+                &data,
+                string->capacity + 1,
+                &string->mapped
+            ) != BASEC_MEMORY_SUCCESS
+        ) {
+            free(string);
+            (void)close(fd);
+            return BASEC_STRING_ALLOCATION_FAILURE;
+        }
+        string->data = (c_str)data;
+    } else if (file_size > string->capacity) {
+        string_result = _basec_string_grow(string, file_size);
+        if (string_result != BASEC_STRING_SUCCESS) {
+            (void)close(fd);
+            return string_result;
+        }
+    }
 
-    if (*array_out != NULL) {
-        array_result = basec_array_destroy(array_out);
-        if (array_result != BASEC_ARRAY_SUCCESS) {
-            return BASEC_STRING_ARRAY_FAILURE;
+    while (total_read < file_size) {
+        bytes_read = read(fd, string->data + total_read, file_size - total_read);
+        if (bytes_read == 0) break;
+        if (bytes_read < 0) {
+            (void)close(fd);
+            if (*string_out == NULL) (void)basec_string_destroy(&string);
+            return BASEC_STRING_IO_FAILURE;
         }
+
+        total_read += (u64)bytes_read;
     }
+    (void)close(fd);
 
-    *array_out = array;
+    string->data[total_read] = '\0';
+    string->length = total_read;
+
+    *string_out = string;
     return BASEC_STRING_SUCCESS;
 }
 
@@ -480,7 +4148,13 @@ BasecStringResult basec_string_split(
 BasecStringResult basec_string_destroy(BasecString** string) {
     if (string == NULL || *string == NULL) return BASEC_STRING_NULL_POINTER;
 
-    free((*string)->data);
+    void* data = (*string)->data;
+
+    (void)basec_memory_release(
+        &data,
+        (*string)->capacity + 1,
+        (*string)->mapped
+    );
     free(*string);
     *string = NULL;
 
@@ -0,0 +1,745 @@
+#include "ds/basec_strmap.h"
+
+static const u8 _CONTROL_EMPTY   = 0x80;
+static const u8 _CONTROL_DELETED = 0xFE;
+static const u8 _GROWTH_FACTOR   = 2;
+
+/**
+ * @brief Get the number of entries a table can hold before it must grow
+ * @param capacity The number of slots of the table
+ * @return The number of entries
+ */
+static u64 _basec_strmap_max_length(u64 capacity) {
+    return capacity - capacity / 8;
+}
+
+/**
+ * @brief Get the number of slots needed to hold a number of entries
+ * @param count The number of entries
+ * @return The number of slots, a power of two of at least one group
+ */
+static u64 _basec_strmap_table_capacity(u64 count) {
+    u64 capacity = BASEC_STRMAP_GROUP_SIZE;
+
+    while (_basec_strmap_max_length(capacity) < count) {
+        capacity *= _GROWTH_FACTOR;
+    }
+    return capacity;
+}
+
+/**
+ * @brief Find the control bytes of a group equal to a byte
+ * @param group The 16 control bytes of the group
+ * @param byte The byte to match
+ * @return A bit per control byte, set when it matches
+ */
+static u32 _basec_strmap_match(const u8* group, u8 byte) {
+#if defined(__SSE2__)
+    return (u32)_mm_movemask_epi8(
+        _mm_cmpeq_epi8(
+            _mm_loadu_si128((const __m128i*)group),
+            _mm_set1_epi8((c8)byte)
+        )
+    );
+#else
+    u32 mask = 0;
+
+    for (u32 i = 0; i < BASEC_STRMAP_GROUP_SIZE; i++) {
+        if (group[i] == byte) mask |= 1U << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Find the control bytes of a group that are empty or deleted
+ * @param group The 16 control bytes of the group
+ * @return A bit per control byte, set when its slot is free
+ */
+static u32 _basec_strmap_match_free(const u8* group) {
+#if defined(__SSE2__)
+    return (u32)_mm_movemask_epi8(
+        _mm_loadu_si128((const __m128i*)group)
+    );
+#else
+    u32 mask = 0;
+
+    for (u32 i = 0; i < BASEC_STRMAP_GROUP_SIZE; i++) {
+        if (group[i] & 0x80) mask |= 1U << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Get the key at the start of a slot
+ * @param map The map holding the slot
+ * @param index The index of the slot
+ * @return The key of the slot
+ */
+static BasecStrMapKey* _basec_strmap_key(BasecStrMap* map, u64 index) {
+    return (BasecStrMapKey*)(
+        (u8*)map->slots->data + index * map->slots->element_size
+    );
+}
+
+/**
+ * @brief Get the bytes of a key, wherever they are stored
+ * @param map The map holding the key
+ * @param key The key
+ * @return The first byte of the key
+ */
+static c_str _basec_strmap_key_data(BasecStrMap* map, BasecStrMapKey* key) {
+    u64 offset = 0;
+
+    if (key->length <= BASEC_STRMAP_INLINE_SIZE) return key->bytes;
+
+    (void)memcpy(&offset, key->bytes, sizeof(offset));
+    return map->arena + offset;
+}
+
+/**
+ * @brief Set the control byte of a slot, keeping the mirrored group in sync
+ * @param map The map holding the slot
+ * @param index The index of the slot
+ * @param byte The new control byte
+ */
+static void _basec_strmap_set_control(BasecStrMap* map, u64 index, u8 byte) {
+    u8* control = (u8*)map->control->data;
+
+    control[index] = byte;
+    if (index < BASEC_STRMAP_GROUP_SIZE) control[map->capacity + index] = byte;
+}
+
+/**
+ * @brief Find the slot holding a key
+ *
+ * Only slots whose cached hash and length both match have their bytes
+ * compared.
+ *
+ * @param map The map to search
+ * @param view The key to find
+ * @param hash The hash of the key
+ * @param index_out The index of the slot holding the key
+ * @return Whether the key was found
+ */
+static bool _basec_strmap_find(
+    BasecStrMap*    map,
+    BasecStringView view,
+    u64             hash,
+    u64*            index_out
+) {
+    const u8*       control  = (const u8*)map->control->data;
+    u64             mask     = map->capacity - 1;
+    u64             position = (hash >> 7) & mask;
+    u64             stride   = 0;
+    u64             index    = 0;
+    u32             matches  = 0;
+    BasecStrMapKey* key      = NULL;
+
+    while (true) {
+        matches = _basec_strmap_match(control + position, (u8)(hash & 0x7F));
+        while (matches != 0) {
+            index = (position + (u64)__builtin_ctz(matches)) & mask;
+            key   = _basec_strmap_key(map, index);
+            if (
+                key->hash == hash &&
+                key->length == view.length &&
+                memcmp(
+                    _basec_strmap_key_data(map, key),
+                    view.data,
+                    view.length
+                ) == 0
+            ) {
+                *index_out = index;
+                return true;
+            }
+            matches &= matches - 1;
+        }
+
+        if (_basec_strmap_match(control + position, _CONTROL_EMPTY) != 0) {
+            return false;
+        }
+
+        stride   += BASEC_STRMAP_GROUP_SIZE;
+        position  = (position + stride) & mask;
+        if (stride > map->capacity) return false;
+    }
+}
+
+/**
+ * @brief Find the first free slot in the probe sequence of a hash
+ * @param map The map to search
+ * @param hash The hash to probe for
+ * @return The index of the free slot
+ */
+static u64 _basec_strmap_find_free(BasecStrMap* map, u64 hash) {
+    const u8* control  = (const u8*)map->control->data;
+    u64       mask     = map->capacity - 1;
+    u64       position = (hash >> 7) & mask;
+    u64       stride   = 0;
+    u32       matches  = 0;
+
+    while ((matches = _basec_strmap_match_free(control + position)) == 0) {
+        stride   += BASEC_STRMAP_GROUP_SIZE;
+        position  = (position + stride) & mask;
+    }
+    return (position + (u64)__builtin_ctz(matches)) & mask;
+}
+
+/**
+ * @brief Copy a long key into the arena
+ * @param map The map owning the arena
+ * @param data The bytes of the key
+ * @param length The number of bytes
+ * @param offset_out The offset of the copy in the arena
+ * @return The result of the operation
+ */
+static BasecStrMapResult _basec_strmap_arena_push(
+    BasecStrMap* map,
+    const c8*    data,
+    u64          length,
+    u64*         offset_out
+) {
+    u64   capacity = map->arena_capacity * _GROWTH_FACTOR;
+    c_str arena    = NULL;
+
+    if (map->arena_length + length > map->arena_capacity) {
+        if (capacity < map->arena_length + length) {
+            capacity = map->arena_length + length;
+        }
+        arena = (c_str)realloc(map->arena, capacity);
+        if (arena == NULL) return BASEC_STRMAP_ALLOCATION_FAILURE;
+
+        map->arena          = arena;
+        map->arena_capacity = capacity;
+    }
+
+    (void)memcpy(map->arena + map->arena_length, data, length);
+    *offset_out        = map->arena_length;
+    map->arena_length += length;
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Allocate an empty table for the map
+ * @param map The map to allocate the table for
+ * @param capacity The number of slots, a power of two of at least one group
+ * @return The result of the operation
+ */
+static BasecStrMapResult _basec_strmap_allocate(
+    BasecStrMap* map,
+    u64          capacity
+) {
+    BasecArray* control   = NULL;
+    BasecArray* slots     = NULL;
+    u64         slot_size = map->value_offset + map->value_size;
+
+    // Round slots up so every key header stays 8 byte aligned
+    slot_size = (slot_size + 7) & ~(u64)7;
+
+    if (
+        basec_array_create(
+            &control,
+            sizeof(u8),
+            capacity + BASEC_STRMAP_GROUP_SIZE
+        ) != BASEC_ARRAY_SUCCESS ||
+        basec_array_create(&slots, slot_size, capacity) != BASEC_ARRAY_SUCCESS
+    ) {
+        if (control != NULL) (void)basec_array_destroy(&control);
+        return BASEC_STRMAP_ALLOCATION_FAILURE;
+    }
+
+    (void)memset(
+        control->data,
+        _CONTROL_EMPTY,
+        capacity + BASEC_STRMAP_GROUP_SIZE
+    );
+    control->length = capacity + BASEC_STRMAP_GROUP_SIZE;
+    slots->length   = capacity;
+
+    map->control     = control;
+    map->slots       = slots;
+    map->capacity    = capacity;
+    map->growth_left = _basec_strmap_max_length(capacity) - map->length;
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Move every entry into a new table
+ *
+ * Cached hashes place entries without rehashing their keys. Long keys are
+ * copied into a fresh arena, which drops the bytes of removed keys.
+ *
+ * @param map The map to resize
+ * @param capacity The number of slots of the new table
+ * @return The result of the operation
+ */
+static BasecStrMapResult _basec_strmap_resize(BasecStrMap* map, u64 capacity) {
+    BasecStrMapResult map_result   = BASEC_STRMAP_SUCCESS;
+    BasecArray*       old_control  = map->control;
+    BasecArray*       old_slots    = map->slots;
+    u64               old_capacity = map->capacity;
+    c_str             old_arena    = map->arena;
+    const u8*         control      = (const u8*)old_control->data;
+    BasecStrMapKey*   key          = NULL;
+    c_str             arena        = NULL;
+    u64               arena_length = 0;
+    u64               offset       = 0;
+    u64               index        = 0;
+
+    for (u64 i = 0; i < old_capacity; i++) {
+        key = (BasecStrMapKey*)(
+            (u8*)old_slots->data + i * old_slots->element_size
+        );
+        if (!(control[i] & 0x80) && key->length > BASEC_STRMAP_INLINE_SIZE) {
+            arena_length += key->length;
+        }
+    }
+    if (arena_length > 0) {
+        arena = (c_str)malloc(arena_length);
+        if (arena == NULL) return BASEC_STRMAP_ALLOCATION_FAILURE;
+    }
+
+    map_result = _basec_strmap_allocate(map, capacity);
+    if (map_result != BASEC_STRMAP_SUCCESS) {
+        free(arena);
+        return map_result;
+    }
+
+    map->arena          = arena;
+    map->arena_length   = 0;
+    map->arena_capacity = arena_length;
+    map->arena_unused   = 0;
+    for (u64 i = 0; i < old_capacity; i++) {
+        if (control[i] & 0x80) continue;
+
+        key   = (BasecStrMapKey*)(
+            (u8*)old_slots->data + i * old_slots->element_size
+        );
+        index = _basec_strmap_find_free(map, key->hash);
+        _basec_strmap_set_control(map, index, (u8)(key->hash & 0x7F));
+        (void)memcpy(
+            _basec_strmap_key(map, index),
+            key,
+            old_slots->element_size
+        );
+
+        if (key->length > BASEC_STRMAP_INLINE_SIZE) {
+            (void)memcpy(&offset, key->bytes, sizeof(offset));
+            (void)memcpy(
+                map->arena + map->arena_length,
+                old_arena + offset,
+                key->length
+            );
+            (void)memcpy(
+                _basec_strmap_key(map, index)->bytes,
+                &map->arena_length,
+                sizeof(map->arena_length)
+            );
+            map->arena_length += key->length;
+        }
+    }
+
+    free(old_arena);
+    (void)basec_array_destroy(&old_control);
+    (void)basec_array_destroy(&old_slots);
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Handle the result of a string map operation
+ * @param result The result of the operation
+ */
+void basec_strmap_handle_result(BasecStrMapResult result) {
+    switch (result) {
+        case BASEC_STRMAP_SUCCESS:
+            break;
+        case BASEC_STRMAP_NULL_POINTER:
+            (void)printf(
+                "[Error][StrMap] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_STRMAP_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][StrMap] "
+                "Operation failed due to an invalid capacity.\n"
+            );
+            exit(1);
+        case BASEC_STRMAP_KEY_TOO_LONG:
+            (void)printf(
+                "[Error][StrMap] "
+                "Operation failed due to a key being too long.\n"
+            );
+            exit(1);
+        case BASEC_STRMAP_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][StrMap] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_STRMAP_NOT_FOUND:
+            (void)printf(
+                "[Error][StrMap] "
+                "Operation failed due to a key not being found.\n"
+            );
+            exit(1);
+        case BASEC_STRMAP_END_OF_MAP:
+            (void)printf(
+                "[Error][StrMap] "
+                "Operation failed due to reaching the end of the map.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][StrMap] "
+                "An unknown error occurred during string map operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Create a string map
+ * @param map The map to create
+ * @param value_size The size of the values, 0 to store keys only
+ * @param capacity The number of entries to hold without growing
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_create(
+    BasecStrMap** map,
+    u64           value_size,
+    u64           capacity
+) {
+    if (map == NULL) return BASEC_STRMAP_NULL_POINTER;
+    if (capacity == 0) return BASEC_STRMAP_INVALID_CAPACITY;
+
+    BasecStrMapResult map_result = BASEC_STRMAP_SUCCESS;
+
+    *map = (BasecStrMap*)malloc(sizeof(BasecStrMap));
+    if (*map == NULL) return BASEC_STRMAP_ALLOCATION_FAILURE;
+
+    (*map)->arena          = NULL;
+    (*map)->arena_length   = 0;
+    (*map)->arena_capacity = 0;
+    (*map)->arena_unused   = 0;
+    (*map)->value_size     = value_size;
+    (*map)->value_offset   = sizeof(BasecStrMapKey);
+    (*map)->length         = 0;
+    (void)basec_hash_random_seed(&(*map)->seed);
+
+    map_result = _basec_strmap_allocate(
+        *map,
+        _basec_strmap_table_capacity(capacity)
+    );
+    if (map_result != BASEC_STRMAP_SUCCESS) {
+        free(*map);
+        *map = NULL;
+        return map_result;
+    }
+
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Insert an entry, replacing the value if the key is already present
+ * @param map The map to insert into
+ * @param key The key of the entry
+ * @param value The value of the entry, may be NULL when values have no size
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_insert(
+    BasecStrMap*    map,
+    BasecStringView key,
+    const void*     value
+) {
+    if (map == NULL || key.data == NULL) return BASEC_STRMAP_NULL_POINTER;
+    if (value == NULL && map->value_size > 0) {
+        return BASEC_STRMAP_NULL_POINTER;
+    }
+    if (key.length > U32_MAX) return BASEC_STRMAP_KEY_TOO_LONG;
+
+    BasecStrMapResult map_result = BASEC_STRMAP_SUCCESS;
+    BasecStrMapKey*   slot_key   = NULL;
+    u64               hash       = 0;
+    u64               index      = 0;
+    u64               offset     = 0;
+    u64               capacity   = map->capacity;
+
+    (void)basec_hash_bytes_seeded(key.data, key.length, map->seed, &hash);
+    if (!_basec_strmap_find(map, key, hash, &index)) {
+        index = _basec_strmap_find_free(map, hash);
+        if (
+            map->growth_left == 0 &&
+            ((const u8*)map->control->data)[index] == _CONTROL_EMPTY
+        ) {
+            if (map->length + 1 > _basec_strmap_max_length(capacity) / 2) {
+                capacity *= _GROWTH_FACTOR;
+            }
+            map_result = _basec_strmap_resize(map, capacity);
+            if (map_result != BASEC_STRMAP_SUCCESS) return map_result;
+            index = _basec_strmap_find_free(map, hash);
+        }
+
+        // The arena is only touched after resizing, which rebuilds it
+        if (key.length > BASEC_STRMAP_INLINE_SIZE) {
+            if (map->arena_unused > map->arena_length / 2) {
+                map_result = _basec_strmap_resize(map, map->capacity);
+                if (map_result != BASEC_STRMAP_SUCCESS) return map_result;
+                index = _basec_strmap_find_free(map, hash);
+            }
+            map_result = _basec_strmap_arena_push(
+                map,
+                key.data,
+                key.length,
+                &offset
+            );
+            if (map_result != BASEC_STRMAP_SUCCESS) return map_result;
+        }
+
+        slot_key         = _basec_strmap_key(map, index);
+        slot_key->hash   = hash;
+        slot_key->length = (u32)key.length;
+        if (key.length > BASEC_STRMAP_INLINE_SIZE) {
+            (void)memcpy(slot_key->bytes, &offset, sizeof(offset));
+        } else {
+            (void)memcpy(slot_key->bytes, key.data, key.length);
+        }
+
+        if (((const u8*)map->control->data)[index] == _CONTROL_EMPTY) {
+            map->growth_left--;
+        }
+        _basec_strmap_set_control(map, index, (u8)(hash & 0x7F));
+        map->length++;
+    }
+
+    if (map->value_size > 0) {
+        (void)memcpy(
+            (u8*)_basec_strmap_key(map, index) + map->value_offset,
+            value,
+            map->value_size
+        );
+    }
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Get the value stored for a key
+ * @param map The map to search
+ * @param key The key to find
+ * @param value_out The value to copy the entry's value into
+ * @return The result of the operation, BASEC_STRMAP_NOT_FOUND if the key is
+ *         not present
+ */
+BasecStrMapResult basec_strmap_get(
+    BasecStrMap*    map,
+    BasecStringView key,
+    void*           value_out
+) {
+    if (map == NULL || key.data == NULL || value_out == NULL) {
+        return BASEC_STRMAP_NULL_POINTER;
+    }
+
+    u64 hash  = 0;
+    u64 index = 0;
+
+    (void)basec_hash_bytes_seeded(key.data, key.length, map->seed, &hash);
+    if (!_basec_strmap_find(map, key, hash, &index)) {
+        return BASEC_STRMAP_NOT_FOUND;
+    }
+
+    (void)memcpy(
+        value_out,
+        (u8*)_basec_strmap_key(map, index) + map->value_offset,
+        map->value_size
+    );
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Check if the map contains a key
+ * @param map The map to search
+ * @param key The key to find
+ * @param contains_out Whether the key is present
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_contains(
+    BasecStrMap*    map,
+    BasecStringView key,
+    bool*           contains_out
+) {
+    if (map == NULL || key.data == NULL || contains_out == NULL) {
+        return BASEC_STRMAP_NULL_POINTER;
+    }
+
+    u64 hash  = 0;
+    u64 index = 0;
+
+    (void)basec_hash_bytes_seeded(key.data, key.length, map->seed, &hash);
+    *contains_out = _basec_strmap_find(map, key, hash, &index);
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Remove the entry for a key
+ *
+ * The bytes of a long key stay in the arena until the table is next
+ * resized, which happens once over half of the arena is unused.
+ *
+ * @param map The map to remove from
+ * @param key The key to remove
+ * @return The result of the operation, BASEC_STRMAP_NOT_FOUND if the key is
+ *         not present
+ */
+BasecStrMapResult basec_strmap_remove(BasecStrMap* map, BasecStringView key) {
+    if (map == NULL || key.data == NULL) return BASEC_STRMAP_NULL_POINTER;
+
+    const u8* control = (const u8*)map->control->data;
+    u64       mask    = map->capacity - 1;
+    u64       hash    = 0;
+    u64       index   = 0;
+    u32       before  = 0;
+    u32       after   = 0;
+
+    (void)basec_hash_bytes_seeded(key.data, key.length, map->seed, &hash);
+    if (!_basec_strmap_find(map, key, hash, &index)) {
+        return BASEC_STRMAP_NOT_FOUND;
+    }
+
+    before = _basec_strmap_match(
+        control + ((index - BASEC_STRMAP_GROUP_SIZE) & mask),
+        _CONTROL_EMPTY
+    );
+    after  = _basec_strmap_match(control + index, _CONTROL_EMPTY);
+
+    if (
+        before != 0 &&
+        after != 0 &&
+        __builtin_clz(before << 16) + __builtin_ctz(after) <
+        BASEC_STRMAP_GROUP_SIZE
+    ) {
+        _basec_strmap_set_control(map, index, _CONTROL_EMPTY);
+        map->growth_left++;
+    } else {
+        _basec_strmap_set_control(map, index, _CONTROL_DELETED);
+    }
+
+    if (_basec_strmap_key(map, index)->length > BASEC_STRMAP_INLINE_SIZE) {
+        map->arena_unused += _basec_strmap_key(map, index)->length;
+    }
+    map->length--;
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Make room for a number of entries so they insert without growing
+ * @param map The map to reserve in
+ * @param count The number of entries the map should hold
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_reserve(BasecStrMap* map, u64 count) {
+    if (map == NULL) return BASEC_STRMAP_NULL_POINTER;
+
+    u64 capacity = _basec_strmap_table_capacity(count);
+
+    if (capacity <= map->capacity) return BASEC_STRMAP_SUCCESS;
+    return _basec_strmap_resize(map, capacity);
+}
+
+/**
+ * @brief Get the number of entries in the map
+ * @param map The map
+ * @param length_out The number of entries
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_length(BasecStrMap* map, u64* length_out) {
+    if (map == NULL || length_out == NULL) return BASEC_STRMAP_NULL_POINTER;
+
+    *length_out = map->length;
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Start iterating over the entries of a map
+ * @param map The map to iterate over
+ * @param iterator_out The iterator to initialise
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_iterator(
+    BasecStrMap*         map,
+    BasecStrMapIterator* iterator_out
+) {
+    if (map == NULL || iterator_out == NULL) return BASEC_STRMAP_NULL_POINTER;
+
+    iterator_out->map   = map;
+    iterator_out->index = 0;
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Get the next entry of a map
+ * @param iterator The iterator to advance
+ * @param key_out The key of the entry, a view into the map that is valid
+ *                until the map is next modified
+ * @param value_out The value of the entry, pointing into the map, may be
+ *                  NULL
+ * @return The result of the operation, BASEC_STRMAP_END_OF_MAP when no
+ *         entries remain
+ */
+BasecStrMapResult basec_strmap_next(
+    BasecStrMapIterator* iterator,
+    BasecStringView*     key_out,
+    void**               value_out
+) {
+    if (iterator == NULL || iterator->map == NULL || key_out == NULL) {
+        return BASEC_STRMAP_NULL_POINTER;
+    }
+
+    BasecStrMap*    map     = iterator->map;
+    const u8*       control = (const u8*)map->control->data;
+    u64             index   = iterator->index;
+    u32             full    = 0;
+    BasecStrMapKey* key     = NULL;
+
+    for (; index < map->capacity; index += BASEC_STRMAP_GROUP_SIZE) {
+        full = ~_basec_strmap_match_free(control + index) & 0xFFFF;
+        if (map->capacity - index < BASEC_STRMAP_GROUP_SIZE) {
+            full &= (1U << (map->capacity - index)) - 1;
+        }
+        if (full != 0) break;
+    }
+    if (index >= map->capacity) {
+        iterator->index = map->capacity;
+        return BASEC_STRMAP_END_OF_MAP;
+    }
+
+    index           += (u64)__builtin_ctz(full);
+    iterator->index  = index + 1;
+    key              = _basec_strmap_key(map, index);
+    key_out->data    = _basec_strmap_key_data(map, key);
+    key_out->length  = key->length;
+    if (value_out != NULL) {
+        *value_out = map->value_size > 0
+            ? (u8*)key + map->value_offset
+            : NULL;
+    }
+    return BASEC_STRMAP_SUCCESS;
+}
+
+/**
+ * @brief Destroy a string map
+ * @param map The map to destroy
+ * @return The result of the operation
+ */
+BasecStrMapResult basec_strmap_destroy(BasecStrMap** map) {
+    if (map == NULL || *map == NULL) return BASEC_STRMAP_NULL_POINTER;
+
+    free((*map)->arena);
+    (void)basec_array_destroy(&(*map)->control);
+    (void)basec_array_destroy(&(*map)->slots);
+    free(*map);
+    *map = NULL;
+
+    return BASEC_STRMAP_SUCCESS;
+}
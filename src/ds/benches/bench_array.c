@@ -0,0 +1,404 @@
+#include "ds/benches/bench_array.h"
+
+#define _BENCH_ARRAY_LOOKUPS      100000
+#define _BENCH_ARRAY_PAR_LENGTH   4194304
+#define _BENCH_ARRAY_SORT_LENGTH  1048576
+#define _BENCH_ARRAY_MAX_WORKERS  8
+#define _BENCH_ARRAY_TABLE_LENGTH 67108864
+#define _BENCH_ARRAY_TABLE_READS  4194304
+
+/**
+ * @brief Time finding elements in an array, scanning or through its index
+ * @param count The number of elements
+ * @param indexed Whether to enable the array's index first
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_array_finds(u64 count, bool indexed) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecArray*     array      = NULL;
+    u64             element    = 0;
+    u64             index      = 0;
+    u64             checksum   = 0;
+    c8              name[64];
+
+    if (
+        basec_array_create(&array, sizeof(u64), count) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+    if (indexed && basec_array_enable_index(array) != BASEC_ARRAY_SUCCESS) {
+        (void)basec_array_destroy(&array);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    for (u64 i = 0; i < count; i++) {
+        element = i * 0x9E3779B97F4A7C15ULL;
+        (void)basec_array_append(array, &element);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_ARRAY_LOOKUPS; i++) {
+        element = ((i * 7919) % count) * 0x9E3779B97F4A7C15ULL;
+        (void)basec_array_find(array, &element, &index);
+        checksum += index;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    (void)basec_array_destroy(&array);
+
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    (void)snprintf(
+        name,
+        sizeof(name),
+        "basec_array_find%s (%lu elements)",
+        indexed ? " indexed" : "",
+        (unsigned long)count
+    );
+    return basec_bench_print(name, _BENCH_ARRAY_LOOKUPS, 0, elapsed_ns);
+}
+
+/**
+ * @brief Add a u64 element to an accumulator
+ * @param accumulator The u64 accumulator
+ * @param element The u64 element
+ * @param context Unused
+ */
+static void _bench_array_add(
+    void*       accumulator,
+    const void* element,
+    void*       context
+) {
+    (void)context;
+    *(u64*)accumulator += *(const u64*)element;
+}
+
+/**
+ * @brief Time a reduce or an inclusive scan of u64 elements
+ * @param scan Whether to scan instead of reduce
+ * @param parallel Whether to run on the shared pool instead of a serial loop
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_array_par(bool scan, bool parallel) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecArray*     array      = NULL;
+    BasecJobs*      jobs       = NULL;
+    u64*            elements   = NULL;
+    u64             zero       = 0;
+    u64             sum        = 0;
+    c8              name[64];
+
+    if (
+        basec_array_create(&array, sizeof(u64), _BENCH_ARRAY_PAR_LENGTH) !=
+        BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+    elements      = (u64*)array->data;
+    array->length = _BENCH_ARRAY_PAR_LENGTH;
+    for (u64 i = 0; i < _BENCH_ARRAY_PAR_LENGTH; i++) elements[i] = i;
+
+    // Start the shared pool outside the timed region
+    if (parallel) basec_jobs_handle_result(basec_jobs_shared(&jobs));
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    if (parallel && scan) {
+        basec_array_handle_result(
+            basec_array_par_inclusive_scan(array, _bench_array_add, NULL, jobs)
+        );
+    } else if (parallel) {
+        basec_array_handle_result(
+            basec_array_par_reduce(
+                array,
+                &zero,
+                _bench_array_add,
+                NULL,
+                jobs,
+                &sum
+            )
+        );
+    } else if (scan) {
+        for (u64 i = 1; i < _BENCH_ARRAY_PAR_LENGTH; i++) {
+            _bench_array_add(&elements[i], &elements[i - 1], NULL);
+        }
+    } else {
+        for (u64 i = 0; i < _BENCH_ARRAY_PAR_LENGTH; i++) {
+            _bench_array_add(&sum, &elements[i], NULL);
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (scan) sum = elements[_BENCH_ARRAY_PAR_LENGTH - 1];
+    (void)basec_array_destroy(&array);
+    if (
+        sum != (u64)_BENCH_ARRAY_PAR_LENGTH * (_BENCH_ARRAY_PAR_LENGTH - 1) / 2
+    ) return BASEC_BENCH_RUN_FAILURE;
+
+    (void)snprintf(
+        name,
+        sizeof(name),
+        "%s%s",
+        parallel ? "basec_array_par_" : "serial ",
+        scan ? "inclusive_scan" : "reduce"
+    );
+    return basec_bench_print(
+        name,
+        _BENCH_ARRAY_PAR_LENGTH,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Order two u64 elements
+ * @param a The first element
+ * @param b The second element
+ * @return Negative if a is smaller, positive if b is, 0 if equal
+ */
+static i32 _bench_array_compare_u64(const void* a, const void* b) {
+    u64 left  = *(const u64*)a;
+    u64 right = *(const u64*)b;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Time sorting random u64 elements
+ * @param workers The number of workers, 0 for basec_array_sort
+ * @param radix Whether to radix sort instead of merge sort
+ * @param scratch The scratch array reused across sorts
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_array_sort(
+    u64         workers,
+    bool        radix,
+    BasecArray* scratch
+) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecArray*     array      = NULL;
+    BasecJobs*      jobs       = NULL;
+    u64*            elements   = NULL;
+    u64             state      = 0x9E3779B97F4A7C15ULL;
+    bool            ordered    = true;
+    c8              name[64];
+
+    if (
+        basec_array_create(&array, sizeof(u64), _BENCH_ARRAY_SORT_LENGTH) !=
+        BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+    if (
+        workers > 0 &&
+        basec_jobs_create(&jobs, workers) != BASEC_JOBS_SUCCESS
+    ) {
+        (void)basec_array_destroy(&array);
+        return BASEC_BENCH_RUN_FAILURE;
+    }
+
+    elements      = (u64*)array->data;
+    array->length = _BENCH_ARRAY_SORT_LENGTH;
+    for (u64 i = 0; i < _BENCH_ARRAY_SORT_LENGTH; i++) {
+        state      ^= state << 13;
+        state      ^= state >> 7;
+        state      ^= state << 17;
+        elements[i] = state;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    if (workers == 0) {
+        basec_array_handle_result(
+            basec_array_sort(array, _bench_array_compare_u64)
+        );
+    } else if (radix) {
+        basec_array_handle_result(
+            basec_array_par_radix_sort(array, 0, scratch, jobs)
+        );
+    } else {
+        basec_array_handle_result(
+            basec_array_par_sort(
+                array,
+                _bench_array_compare_u64,
+                scratch,
+                jobs
+            )
+        );
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    for (u64 i = 1; i < _BENCH_ARRAY_SORT_LENGTH; i++) {
+        if (elements[i - 1] > elements[i]) ordered = false;
+    }
+    if (jobs != NULL) (void)basec_jobs_destroy(&jobs);
+    (void)basec_array_destroy(&array);
+    if (!ordered) return BASEC_BENCH_RUN_FAILURE;
+
+    if (workers == 0) {
+        (void)snprintf(name, sizeof(name), "basec_array_sort");
+    } else {
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "basec_array_par_%s, %lu workers",
+            radix ? "radix_sort" : "sort",
+            (unsigned long)workers
+        );
+    }
+    return basec_bench_print(
+        name,
+        _BENCH_ARRAY_SORT_LENGTH,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Time random reads from a 512 MB array, with or without huge pages
+ * @param huge_pages Whether to ask for huge pages before filling the array
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_array_random_reads(bool huge_pages) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecArray*     array      = NULL;
+    u64             state      = 0x9E3779B97F4A7C15ULL;
+    u64             checksum   = 0;
+
+    if (
+        basec_array_create(
+            &array,
+            sizeof(u64),
+            _BENCH_ARRAY_TABLE_LENGTH
+        ) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    // Advised before the first write, so page faults can map huge pages
+    if (huge_pages) (void)basec_array_advise_huge_pages(array);
+    for (u64 i = 0; i < _BENCH_ARRAY_TABLE_LENGTH; i++) {
+        (void)basec_array_append(array, &i);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_ARRAY_TABLE_READS; i++) {
+        state    ^= state << 13;
+        state    ^= state >> 7;
+        state    ^= state << 17;
+        checksum += ((u64*)array->data)[state % _BENCH_ARRAY_TABLE_LENGTH];
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    (void)basec_array_destroy(&array);
+
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        huge_pages ? "random reads, 512 MB, huge pages" :
+                     "random reads, 512 MB",
+        _BENCH_ARRAY_TABLE_READS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark basec_array_find with and without an index, for growing
+ *        numbers of elements
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_array_find_indexed(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    u64              counts[3]    = {16, 256, 4096};
+
+    for (u64 i = 0; i < 3 && bench_result == BASEC_BENCH_SUCCESS; i++) {
+        bench_result = _bench_array_finds(counts[i], false);
+        if (bench_result == BASEC_BENCH_SUCCESS) {
+            bench_result = _bench_array_finds(counts[i], true);
+        }
+    }
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark parallel reduces and scans against serial loops on the
+ *        shared pool
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_array_par(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = _bench_array_par(false, false);
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = _bench_array_par(false, true);
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = _bench_array_par(true, false);
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = _bench_array_par(true, true);
+    }
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark parallel merge and radix sorts from 1 to 8 workers
+ *        against basec_array_sort
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_array_par_sort(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      scratch      = NULL;
+
+    if (
+        basec_array_create(&scratch, sizeof(u64), _BENCH_ARRAY_SORT_LENGTH) !=
+        BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    bench_result = _bench_array_sort(0, false, scratch);
+    for (
+        u64 workers = 1;
+        bench_result == BASEC_BENCH_SUCCESS &&
+        workers <= _BENCH_ARRAY_MAX_WORKERS;
+        workers *= 2
+    ) bench_result = _bench_array_sort(workers, false, scratch);
+    for (
+        u64 workers = 1;
+        bench_result == BASEC_BENCH_SUCCESS &&
+        workers <= _BENCH_ARRAY_MAX_WORKERS;
+        workers *= 2
+    ) bench_result = _bench_array_sort(workers, true, scratch);
+
+    (void)basec_array_destroy(&scratch);
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark random reads from a large array with and without
+ *        transparent huge pages
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_array_huge_pages(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = _bench_array_random_reads(false);
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = _bench_array_random_reads(true);
+    }
+    return bench_result;
+}
+
+/**
+ * @brief Run the Array benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_array_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("Array");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_array_find_indexed();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_array_par();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_array_par_sort();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_array_huge_pages();
+    }
+
+    return bench_result;
+}
@@ -0,0 +1,367 @@
+#include "ds/benches/bench_chunked_array.h"
+
+#define _BENCH_CHUNKED_ARRAY_ELEMENTS 16777216
+#define _BENCH_CHUNKED_ARRAY_SAMPLES  4194304
+#define _BENCH_CHUNKED_ARRAY_CAPACITY 1024
+#define _BENCH_CHUNKED_ARRAY_BLOCK    65536
+
+/**
+ * @brief Compare two latencies for qsort
+ * @param a The first latency
+ * @param b The second latency
+ * @return Negative if a is lower, positive if b is, 0 if equal
+ */
+static i32 _bench_chunked_array_compare(const void* a, const void* b) {
+    u64 left  = *(const u64*)a;
+    u64 right = *(const u64*)b;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Append counting elements to a BasecArray or a BasecChunkedArray
+ * @param chunked Whether to fill a BasecChunkedArray
+ * @param count The number of elements to append
+ * @param latencies_out The time of every append, NULL to not time them
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_chunked_array_fill(
+    bool chunked,
+    u64  count,
+    u64* latencies_out
+) {
+    BasecBenchTimer    timer        = {0};
+    BasecBenchResult   bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*        array        = NULL;
+    BasecChunkedArray* blocks       = NULL;
+    bool               appended     = true;
+
+    if (
+        basec_array_create(
+            &array,
+            sizeof(u64),
+            _BENCH_CHUNKED_ARRAY_CAPACITY
+        ) != BASEC_ARRAY_SUCCESS ||
+        basec_chunked_array_create(
+            &blocks,
+            sizeof(u64),
+            _BENCH_CHUNKED_ARRAY_BLOCK
+        ) != BASEC_CHUNKED_ARRAY_SUCCESS
+    ) bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; bench_result == BASEC_BENCH_SUCCESS && i < count; i++) {
+        if (latencies_out != NULL) {
+            basec_bench_handle_result(basec_bench_timer_start(&timer));
+        }
+        if (chunked) {
+            appended = basec_chunked_array_append(blocks, &i) ==
+                       BASEC_CHUNKED_ARRAY_SUCCESS;
+        } else {
+            appended = basec_array_append(array, &i) == BASEC_ARRAY_SUCCESS;
+        }
+        if (latencies_out != NULL) {
+            basec_bench_handle_result(
+                basec_bench_timer_stop(&timer, &latencies_out[i])
+            );
+        }
+        if (!appended) bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    if (array != NULL) (void)basec_array_destroy(&array);
+    if (blocks != NULL) (void)basec_chunked_array_destroy(&blocks);
+    return bench_result;
+}
+
+/**
+ * @brief Read a size in KB from /proc/self/status
+ * @param field The name of the field, with its colon
+ * @param kb_out The size
+ * @return Whether the field was found
+ */
+static bool _bench_chunked_array_status_kb(c_str field, u64* kb_out) {
+    FILE* status = fopen("/proc/self/status", "r");
+    c8    line[128];
+    bool  found  = false;
+
+    if (status == NULL) return false;
+    while (!found && fgets(line, sizeof(line), status) != NULL) {
+        if (strncmp(line, field, strlen(field)) != 0) continue;
+        found = sscanf(line + strlen(field), "%lu", (unsigned long*)kb_out) ==
+                1;
+    }
+    (void)fclose(status);
+    return found;
+}
+
+/**
+ * @brief Measure how far filling an array raises the resident memory
+ *
+ * Every fill runs in its own child, which hands the memory malloc kept
+ * from earlier benchmarks back first so reusing it cannot hide the growth.
+ * The child resets its peak through /proc/self/clear_refs and sends its
+ * rise back through a pipe.
+ *
+ * @param chunked Whether to fill a BasecChunkedArray
+ * @param count The number of elements to append
+ * @param rise_kb_out The rise of the peak above the starting memory in KB,
+ *                    U64_MAX if the kernel cannot reset the peak
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_chunked_array_peak(
+    bool chunked,
+    u64  count,
+    u64* rise_kb_out
+) {
+    FILE* clear    = NULL;
+    pid_t child    = 0;
+    i32   status   = 0;
+    i32   fds[2]   = {0};
+    u64   start_kb = 0;
+    u64   peak_kb  = 0;
+    u64   rise_kb  = U64_MAX;
+
+    if (pipe(fds) != 0) return BASEC_BENCH_RUN_FAILURE;
+    child = fork();
+    if (child == 0) {
+        // Freed memory malloc still holds would be reused without faulting
+        (void)close(fds[0]);
+        (void)malloc_trim(0);
+        clear = fopen("/proc/self/clear_refs", "w");
+        if (
+            clear != NULL &&
+            fputs("5", clear) >= 0 &&
+            fclose(clear) == 0 &&
+            _bench_chunked_array_status_kb("VmRSS:", &start_kb) &&
+            _bench_chunked_array_fill(chunked, count, NULL) ==
+            BASEC_BENCH_SUCCESS &&
+            _bench_chunked_array_status_kb("VmHWM:", &peak_kb)
+        ) rise_kb = peak_kb - start_kb;
+        _exit(write(fds[1], &rise_kb, sizeof(rise_kb)) == sizeof(rise_kb));
+    }
+    (void)close(fds[1]);
+
+    if (
+        child < 0 ||
+        read(fds[0], &rise_kb, sizeof(rise_kb)) != sizeof(rise_kb)
+    ) rise_kb = U64_MAX;
+    (void)close(fds[0]);
+    if (child > 0) (void)waitpid(child, &status, 0);
+    if (child < 0) return BASEC_BENCH_RUN_FAILURE;
+
+    *rise_kb_out = rise_kb;
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Benchmark appending to BasecArray and BasecChunkedArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_chunked_array_append(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    bench_result = _bench_chunked_array_fill(
+        false,
+        _BENCH_CHUNKED_ARRAY_ELEMENTS,
+        NULL
+    );
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = basec_bench_print(
+        "basec_array_append",
+        _BENCH_CHUNKED_ARRAY_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    bench_result = _bench_chunked_array_fill(
+        true,
+        _BENCH_CHUNKED_ARRAY_ELEMENTS,
+        NULL
+    );
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_chunked_array_append",
+        _BENCH_CHUNKED_ARRAY_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark the slowest appends to BasecArray and BasecChunkedArray
+ *
+ * Every append is timed on its own. A BasecArray append that grows
+ * reallocates, which may copy every element, while a BasecChunkedArray
+ * append at most allocates one block.
+ *
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_chunked_array_append_tail(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    u64*             latencies    = NULL;
+    c8               name[64];
+
+    latencies = (u64*)malloc(_BENCH_CHUNKED_ARRAY_SAMPLES * sizeof(u64));
+    if (latencies == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 chunked = 0; chunked < 2; chunked++) {
+        if (bench_result != BASEC_BENCH_SUCCESS) break;
+        bench_result = _bench_chunked_array_fill(
+            chunked == 1,
+            _BENCH_CHUNKED_ARRAY_SAMPLES,
+            latencies
+        );
+        if (bench_result != BASEC_BENCH_SUCCESS) break;
+
+        qsort(
+            latencies,
+            _BENCH_CHUNKED_ARRAY_SAMPLES,
+            sizeof(u64),
+            _bench_chunked_array_compare
+        );
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "%s p99.99",
+            chunked == 1 ? "basec_chunked_array_append" : "basec_array_append"
+        );
+        bench_result = basec_bench_print(
+            name,
+            1,
+            0,
+            latencies[_BENCH_CHUNKED_ARRAY_SAMPLES / 10000 * 9999]
+        );
+        if (bench_result != BASEC_BENCH_SUCCESS) break;
+
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "%s max",
+            chunked == 1 ? "basec_chunked_array_append" : "basec_array_append"
+        );
+        bench_result = basec_bench_print(
+            name,
+            1,
+            0,
+            latencies[_BENCH_CHUNKED_ARRAY_SAMPLES - 1]
+        );
+    }
+
+    free(latencies);
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark the peak memory of filling BasecArray and
+ *        BasecChunkedArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_chunked_array_peak_rss(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    u64              rise_kb      = 0;
+
+    for (u64 chunked = 0; chunked < 2; chunked++) {
+        bench_result = _bench_chunked_array_peak(
+            chunked == 1,
+            _BENCH_CHUNKED_ARRAY_ELEMENTS,
+            &rise_kb
+        );
+        if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+        // The elements take 128 MB, anything above that is growth overhead
+        if (rise_kb == U64_MAX) {
+            (void)printf(
+                "  %-40s unsupported\n",
+                chunked == 1 ? "basec_chunked_array_append peak RSS" :
+                               "basec_array_append peak RSS"
+            );
+            continue;
+        }
+        (void)printf(
+            "  %-40s %14.1f MB\n",
+            chunked == 1 ? "basec_chunked_array_append peak RSS" :
+                           "basec_array_append peak RSS",
+            (f64)rise_kb / 1024.0
+        );
+    }
+
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Benchmark flattening a BasecChunkedArray into a BasecArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_chunked_array_flatten(void) {
+    BasecBenchTimer    timer        = {0};
+    u64                elapsed_ns   = 0;
+    BasecBenchResult   bench_result = BASEC_BENCH_SUCCESS;
+    BasecChunkedArray* blocks       = NULL;
+    BasecArray*        flat         = NULL;
+
+    if (
+        basec_chunked_array_create(
+            &blocks,
+            sizeof(u64),
+            _BENCH_CHUNKED_ARRAY_BLOCK
+        ) != BASEC_CHUNKED_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_CHUNKED_ARRAY_SAMPLES; i++) {
+        (void)basec_chunked_array_append(blocks, &i);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    if (
+        basec_array_flatten(blocks, &flat) != BASEC_CHUNKED_ARRAY_SUCCESS
+    ) bench_result = BASEC_BENCH_RUN_FAILURE;
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (
+        bench_result == BASEC_BENCH_SUCCESS &&
+        ((u64*)flat->data)[_BENCH_CHUNKED_ARRAY_SAMPLES - 1] !=
+        _BENCH_CHUNKED_ARRAY_SAMPLES - 1
+    ) bench_result = BASEC_BENCH_RUN_FAILURE;
+    if (flat != NULL) (void)basec_array_destroy(&flat);
+    (void)basec_chunked_array_destroy(&blocks);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_array_flatten",
+        _BENCH_CHUNKED_ARRAY_SAMPLES,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Run the ChunkedArray benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_chunked_array_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("ChunkedArray");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_chunked_array_append();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_chunked_array_append_tail();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_chunked_array_peak_rss();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_chunked_array_flatten();
+    }
+
+    return bench_result;
+}
@@ -0,0 +1,165 @@
+#include "ds/benches/bench_deque.h"
+
+#define _BENCH_DEQUE_QUEUED    4096
+#define _BENCH_DEQUE_ARRAY_OPS 100000
+#define _BENCH_DEQUE_OPS       10000000
+#define _BENCH_DEQUE_BATCH     64
+
+/**
+ * @brief Benchmark a FIFO on BasecArray, removing from the front
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_deque_array_fifo(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      queue        = NULL;
+    u64              element      = 0;
+    u64              sum          = 0;
+
+    if (
+        basec_array_create(&queue, sizeof(u64), _BENCH_DEQUE_QUEUED + 1) !=
+        BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_DEQUE_QUEUED; i++) {
+        (void)basec_array_append(queue, &i);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_DEQUE_ARRAY_OPS; i++) {
+        element = _BENCH_DEQUE_QUEUED + i;
+        (void)basec_array_append(queue, &element);
+        (void)basec_array_remove(queue, 0, &element);
+        sum += element;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    // Every element is dequeued in the order it was queued
+    if (sum != (u64)_BENCH_DEQUE_ARRAY_OPS * (_BENCH_DEQUE_ARRAY_OPS - 1) / 2) {
+        bench_result = BASEC_BENCH_RUN_FAILURE;
+    }
+    (void)basec_array_destroy(&queue);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_array remove(0) FIFO (4096 queued)",
+        _BENCH_DEQUE_ARRAY_OPS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark a FIFO on BasecDeque, one element at a time
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_deque_fifo(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecDeque*      queue        = NULL;
+    u64              element      = 0;
+    u64              sum          = 0;
+
+    if (
+        basec_deque_create(&queue, sizeof(u64), _BENCH_DEQUE_QUEUED + 1) !=
+        BASEC_DEQUE_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_DEQUE_QUEUED; i++) {
+        (void)basec_deque_push_back(queue, &i);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_DEQUE_OPS; i++) {
+        element = _BENCH_DEQUE_QUEUED + i;
+        (void)basec_deque_push_back(queue, &element);
+        (void)basec_deque_pop_front(queue, &element);
+        sum += element;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (sum != (u64)_BENCH_DEQUE_OPS * (_BENCH_DEQUE_OPS - 1) / 2) {
+        bench_result = BASEC_BENCH_RUN_FAILURE;
+    }
+    (void)basec_deque_destroy(&queue);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_deque FIFO (4096 queued)",
+        _BENCH_DEQUE_OPS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark a FIFO on BasecDeque, 64 elements at a time
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_deque_fifo_bulk(void) {
+    BasecBenchTimer  timer                     = {0};
+    u64              elapsed_ns                = 0;
+    BasecBenchResult bench_result              = BASEC_BENCH_SUCCESS;
+    BasecDeque*      queue                     = NULL;
+    u64              batch[_BENCH_DEQUE_BATCH] = {0};
+    u64              sum                       = 0;
+
+    if (
+        basec_deque_create(
+            &queue,
+            sizeof(u64),
+            _BENCH_DEQUE_QUEUED + _BENCH_DEQUE_BATCH
+        ) != BASEC_DEQUE_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_DEQUE_QUEUED; i++) {
+        (void)basec_deque_push_back(queue, &i);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_DEQUE_OPS; i += _BENCH_DEQUE_BATCH) {
+        for (u64 j = 0; j < _BENCH_DEQUE_BATCH; j++) {
+            batch[j] = _BENCH_DEQUE_QUEUED + i + j;
+        }
+        (void)basec_deque_push_back_n(queue, batch, _BENCH_DEQUE_BATCH);
+        (void)basec_deque_pop_front_n(queue, batch, _BENCH_DEQUE_BATCH);
+        for (u64 j = 0; j < _BENCH_DEQUE_BATCH; j++) sum += batch[j];
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (sum != (u64)_BENCH_DEQUE_OPS * (_BENCH_DEQUE_OPS - 1) / 2) {
+        bench_result = BASEC_BENCH_RUN_FAILURE;
+    }
+    (void)basec_deque_destroy(&queue);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_deque FIFO, 64 per call (4096 queued)",
+        _BENCH_DEQUE_OPS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Run the Deque benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_deque_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("Deque");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_deque_array_fifo();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_deque_fifo();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_deque_fifo_bulk();
+    }
+
+    return bench_result;
+}
@@ -0,0 +1,213 @@
+#include "ds/benches/bench_hashmap.h"
+
+#define _BENCH_HASHMAP_KEYS    1000000
+#define _BENCH_HASHMAP_LOOKUPS 100000
+
+/**
+ * @brief Spread a counter into a key, so keys arrive in no particular order
+ * @param i The counter
+ * @return The key
+ */
+static u64 _bench_hashmap_key(u64 i) {
+    return i * 0x9E3779B97F4A7C15ULL;
+}
+
+/**
+ * @brief Benchmark inserting keys into a hash map
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashmap_insert(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecHashMap*   map        = NULL;
+    u64             key        = 0;
+
+    if (
+        basec_hashmap_create(&map, sizeof(u64), sizeof(u64), 16) !=
+        BASEC_HASHMAP_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_HASHMAP_KEYS; i++) {
+        key = _bench_hashmap_key(i);
+        (void)basec_hashmap_insert(map, &key, &i);
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (map->length != _BENCH_HASHMAP_KEYS) {
+        (void)basec_hashmap_destroy(&map);
+        return BASEC_BENCH_RUN_FAILURE;
+    }
+    (void)basec_hashmap_destroy(&map);
+    return basec_bench_print(
+        "basec_hashmap_insert",
+        _BENCH_HASHMAP_KEYS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark looking up keys in a hash map
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashmap_get(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecHashMap*   map        = NULL;
+    u64             key        = 0;
+    u64             value      = 0;
+    u64             checksum   = 0;
+
+    if (
+        basec_hashmap_create(
+            &map,
+            sizeof(u64),
+            sizeof(u64),
+            _BENCH_HASHMAP_KEYS
+        ) != BASEC_HASHMAP_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+    for (u64 i = 0; i < _BENCH_HASHMAP_KEYS; i++) {
+        key = _bench_hashmap_key(i);
+        (void)basec_hashmap_insert(map, &key, &i);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_HASHMAP_KEYS; i++) {
+        key = _bench_hashmap_key((i * 7919) % _BENCH_HASHMAP_KEYS);
+        if (basec_hashmap_get(map, &key, &value) == BASEC_HASHMAP_SUCCESS) {
+            checksum += value;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_hashmap_destroy(&map);
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "basec_hashmap_get",
+        _BENCH_HASHMAP_KEYS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Time looking up keys in an array and in a hash map holding them
+ * @param count The number of keys
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_hashmap_lookups(u64 count) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      array        = NULL;
+    BasecHashMap*    map          = NULL;
+    u64              key          = 0;
+    u64              index        = 0;
+    u64              checksum     = 0;
+    c8               name[64];
+
+    if (
+        basec_array_create(&array, sizeof(u64), count) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+    if (
+        basec_hashmap_create(&map, sizeof(u64), sizeof(u64), count) !=
+        BASEC_HASHMAP_SUCCESS
+    ) {
+        (void)basec_array_destroy(&array);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    for (u64 i = 0; i < count; i++) {
+        key = _bench_hashmap_key(i);
+        (void)basec_array_append(array, &key);
+        (void)basec_hashmap_insert(map, &key, &i);
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_HASHMAP_LOOKUPS; i++) {
+        key = _bench_hashmap_key((i * 7919) % count);
+        (void)basec_array_find(array, &key, &index);
+        checksum += index;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    (void)snprintf(
+        name,
+        sizeof(name),
+        "basec_array_find (%lu keys)",
+        (unsigned long)count
+    );
+    bench_result = basec_bench_print(
+        name,
+        _BENCH_HASHMAP_LOOKUPS,
+        0,
+        elapsed_ns
+    );
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        basec_bench_handle_result(basec_bench_timer_start(&timer));
+        for (u64 i = 0; i < _BENCH_HASHMAP_LOOKUPS; i++) {
+            key = _bench_hashmap_key((i * 7919) % count);
+            (void)basec_hashmap_get(map, &key, &index);
+            checksum -= index;
+        }
+        basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "basec_hashmap_get (%lu keys)",
+            (unsigned long)count
+        );
+        bench_result = basec_bench_print(
+            name,
+            _BENCH_HASHMAP_LOOKUPS,
+            0,
+            elapsed_ns
+        );
+    }
+
+    (void)basec_array_destroy(&array);
+    (void)basec_hashmap_destroy(&map);
+
+    // Both lookups find the same indices, so the checksum cancels out
+    if (bench_result == BASEC_BENCH_SUCCESS && checksum != 0) {
+        return BASEC_BENCH_RUN_FAILURE;
+    }
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark lookups with basec_array_find against a hash map, for
+ *        growing numbers of keys
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashmap_versus_array_find(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    u64              counts[3]    = {16, 256, 4096};
+
+    for (u64 i = 0; i < 3 && bench_result == BASEC_BENCH_SUCCESS; i++) {
+        bench_result = _bench_hashmap_lookups(counts[i]);
+    }
+    return bench_result;
+}
+
+/**
+ * @brief Run the HashMap benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_hashmap_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("HashMap");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_hashmap_insert();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_hashmap_get();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_hashmap_versus_array_find();
+    }
+
+    return bench_result;
+}
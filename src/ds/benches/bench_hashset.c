@@ -0,0 +1,196 @@
+#include "ds/benches/bench_hashset.h"
+
+#define _BENCH_HASHSET_IDS       1000000
+#define _BENCH_HASHSET_DISTINCT  250000
+#define _BENCH_HASHSET_QUADRATIC 4096
+
+/**
+ * @brief Order two u64 elements
+ * @param a The first element
+ * @param b The second element
+ * @return Negative if a is smaller, positive if b is, 0 if equal
+ */
+static i32 _bench_hashset_compare_u64(const void* a, const void* b) {
+    u64 left  = *(const u64*)a;
+    u64 right = *(const u64*)b;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Create an array of ids where every id appears several times
+ * @param count The number of ids
+ * @param distinct The number of distinct ids
+ * @param array_out The array of ids
+ * @return The result of the operation
+ */
+static BasecBenchResult _bench_hashset_ids(
+    u64          count,
+    u64          distinct,
+    BasecArray** array_out
+) {
+    u64 id = 0;
+
+    if (
+        basec_array_create(array_out, sizeof(u64), count) !=
+        BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < count; i++) {
+        id = ((i * 7919) % distinct) * 0x9E3779B97F4A7C15ULL;
+        (void)basec_array_append(*array_out, &id);
+    }
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Remove repeats by checking every element against those kept so far
+ * @param array The array to remove repeats from
+ */
+static void _bench_hashset_unique_contains(BasecArray* array) {
+    BasecArray* kept     = NULL;
+    u64         id       = 0;
+    bool        contains = false;
+
+    if (
+        basec_array_create(&kept, sizeof(u64), array->length) !=
+        BASEC_ARRAY_SUCCESS
+    ) return;
+
+    for (u64 i = 0; i < array->length; i++) {
+        (void)basec_array_get(array, i, &id);
+        (void)basec_array_contains(kept, &id, &contains);
+        if (!contains) (void)basec_array_append(kept, &id);
+    }
+
+    (void)memcpy(array->data, kept->data, kept->length * sizeof(u64));
+    array->length = kept->length;
+    (void)basec_array_destroy(&kept);
+}
+
+/**
+ * @brief Benchmark removing repeats with basec_array_contains in a loop
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashset_unique_contains(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      array        = NULL;
+
+    bench_result = _bench_hashset_ids(
+        _BENCH_HASHSET_QUADRATIC,
+        _BENCH_HASHSET_QUADRATIC / 4,
+        &array
+    );
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    _bench_hashset_unique_contains(array);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (array->length != _BENCH_HASHSET_QUADRATIC / 4) {
+        bench_result = BASEC_BENCH_RUN_FAILURE;
+    }
+    (void)basec_array_destroy(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_array_contains loop (4096 ids)",
+        _BENCH_HASHSET_QUADRATIC,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark removing repeats with a hash set
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashset_unique(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      array        = NULL;
+
+    bench_result = _bench_hashset_ids(
+        _BENCH_HASHSET_IDS,
+        _BENCH_HASHSET_DISTINCT,
+        &array
+    );
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    (void)basec_array_unique(array);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (array->length != _BENCH_HASHSET_DISTINCT) {
+        bench_result = BASEC_BENCH_RUN_FAILURE;
+    }
+    (void)basec_array_destroy(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_array_unique (1M ids)",
+        _BENCH_HASHSET_IDS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark removing repeats by sorting first
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hashset_unique_sorted(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      array        = NULL;
+
+    bench_result = _bench_hashset_ids(
+        _BENCH_HASHSET_IDS,
+        _BENCH_HASHSET_DISTINCT,
+        &array
+    );
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    (void)basec_array_sort(array, &_bench_hashset_compare_u64);
+    (void)basec_array_unique_sorted(array);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (array->length != _BENCH_HASHSET_DISTINCT) {
+        bench_result = BASEC_BENCH_RUN_FAILURE;
+    }
+    (void)basec_array_destroy(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_array_sort + unique_sorted (1M ids)",
+        _BENCH_HASHSET_IDS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Run the HashSet benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_hashset_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("HashSet");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_hashset_unique_contains();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_hashset_unique();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_hashset_unique_sorted();
+    }
+
+    return bench_result;
+}
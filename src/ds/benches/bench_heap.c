@@ -0,0 +1,250 @@
+#include "ds/benches/bench_heap.h"
+
+#define _BENCH_HEAP_ELEMENTS 1000000
+#define _BENCH_HEAP_TOP      100
+
+/**
+ * @brief Order two u64 elements
+ * @param a The first element
+ * @param b The second element
+ * @return Negative if a is smaller, positive if b is, 0 if equal
+ */
+static i32 _bench_heap_compare_u64(const void* a, const void* b) {
+    u64 left  = *(const u64*)a;
+    u64 right = *(const u64*)b;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Create an array of scrambled u64 keys
+ * @param array_out The array of keys
+ * @return The result of the operation
+ */
+static BasecBenchResult _bench_heap_keys(BasecArray** array_out) {
+    u64 key = 0;
+
+    if (
+        basec_array_create(array_out, sizeof(u64), _BENCH_HEAP_ELEMENTS) !=
+        BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_HEAP_ELEMENTS; i++) {
+        key = i * 0x9E3779B97F4A7C15ULL;
+        (void)basec_array_append(*array_out, &key);
+    }
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Benchmark pushing every key to a heap and popping them all
+ * @param name The name of the benchmark
+ * @param arity The number of children of every node
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_heap_push_pop(c_str name, u64 arity) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      keys         = NULL;
+    BasecHeap*       heap         = NULL;
+    u64              key          = 0;
+    u64              previous     = 0;
+
+    bench_result = _bench_heap_keys(&keys);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    if (
+        basec_heap_create_keyed(
+            &heap,
+            sizeof(u64),
+            _BENCH_HEAP_ELEMENTS,
+            0,
+            arity
+        ) != BASEC_HEAP_SUCCESS
+    ) {
+        (void)basec_array_destroy(&keys);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < keys->length; i++) {
+        (void)basec_heap_push(heap, (u64*)keys->data + i);
+    }
+    for (u64 i = 0; i < keys->length; i++) {
+        (void)basec_heap_pop(heap, &key);
+        if (key < previous) bench_result = BASEC_BENCH_RUN_FAILURE;
+        previous = key;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_heap_destroy(&heap);
+    (void)basec_array_destroy(&keys);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        name,
+        _BENCH_HEAP_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark pushing and popping 1M keys with a binary heap
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_push_pop_binary(void) {
+    return _bench_heap_push_pop(
+        "basec_heap push + pop, binary (1M keys)",
+        BASEC_HEAP_BINARY
+    );
+}
+
+/**
+ * @brief Benchmark pushing and popping 1M keys with a 4-ary heap
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_push_pop_quaternary(void) {
+    return _bench_heap_push_pop(
+        "basec_heap push + pop, 4-ary (1M keys)",
+        BASEC_HEAP_QUATERNARY
+    );
+}
+
+/**
+ * @brief Benchmark building a heap from an array of keys at once
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_push_array(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      keys         = NULL;
+    BasecHeap*       heap         = NULL;
+
+    bench_result = _bench_heap_keys(&keys);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    if (
+        basec_heap_create_keyed(
+            &heap,
+            sizeof(u64),
+            _BENCH_HEAP_ELEMENTS,
+            0,
+            BASEC_HEAP_QUATERNARY
+        ) != BASEC_HEAP_SUCCESS
+    ) {
+        (void)basec_array_destroy(&keys);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    if (basec_heap_push_array(heap, keys) != BASEC_HEAP_SUCCESS) {
+        bench_result = BASEC_BENCH_RUN_FAILURE;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_heap_destroy(&heap);
+    (void)basec_array_destroy(&keys);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_heap_push_array, 4-ary (1M keys)",
+        _BENCH_HEAP_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark finding the 100 smallest keys with a full sort
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_sort_top(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      keys         = NULL;
+
+    bench_result = _bench_heap_keys(&keys);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    (void)basec_array_sort(keys, &_bench_heap_compare_u64);
+    keys->length = _BENCH_HEAP_TOP;
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_array_destroy(&keys);
+
+    return basec_bench_print(
+        "basec_array_sort, first 100 (1M keys)",
+        _BENCH_HEAP_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark finding the 100 smallest keys with basec_array_top_k
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_heap_top_k(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      keys         = NULL;
+    BasecArray*      top          = NULL;
+
+    bench_result = _bench_heap_keys(&keys);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    if (
+        basec_array_top_k(
+            keys,
+            _BENCH_HEAP_TOP,
+            &_bench_heap_compare_u64,
+            &top
+        ) != BASEC_ARRAY_SUCCESS
+    ) bench_result = BASEC_BENCH_RUN_FAILURE;
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (top != NULL) (void)basec_array_destroy(&top);
+    (void)basec_array_destroy(&keys);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_array_top_k, k = 100 (1M keys)",
+        _BENCH_HEAP_ELEMENTS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Run the Heap benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_heap_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("Heap");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_heap_push_pop_binary();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_heap_push_pop_quaternary();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_heap_push_array();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_heap_sort_top();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_heap_top_k();
+    }
+
+    return bench_result;
+}
@@ -0,0 +1,113 @@
+#include "ds/benches/bench_interner.h"
+
+#define _BENCH_INTERNER_TOKENS     100000
+#define _BENCH_INTERNER_DISTINCT   50
+#define _BENCH_INTERNER_ITERATIONS 10
+
+/**
+ * @brief Create a line of comma separated tags with few distinct values
+ * @param string_out The line
+ * @return The result of the operation
+ */
+static BasecBenchResult _bench_interner_create_line(BasecString** string_out) {
+    c8 tag[32];
+
+    if (
+        basec_string_create(string_out, "", _BENCH_INTERNER_TOKENS * 16) !=
+        BASEC_STRING_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_INTERNER_TOKENS; i++) {
+        (void)snprintf(
+            tag,
+            sizeof(tag),
+            i == 0 ? "tag-%lu" : ",tag-%lu",
+            (unsigned long)((i * 7919) % _BENCH_INTERNER_DISTINCT)
+        );
+        if (basec_string_append(*string_out, tag) != BASEC_STRING_SUCCESS) {
+            (void)basec_string_destroy(string_out);
+            return BASEC_BENCH_ALLOCATION_FAILURE;
+        }
+    }
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Benchmark splitting into heap strings against splitting into atoms
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_interner_versus_split(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecString*     string       = NULL;
+    BasecArray*      parts        = NULL;
+    BasecInterner*   interner     = NULL;
+    BasecString*     part         = NULL;
+    u64              length       = 0;
+
+    bench_result = _bench_interner_create_line(&string);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_INTERNER_ITERATIONS; i++) {
+        (void)basec_string_split(string, ",", &parts);
+        for (u64 j = 0; parts != NULL && j < parts->length; j++) {
+            part = ((BasecString**)parts->data)[j];
+            (void)basec_string_destroy(&part);
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    if (parts != NULL) {
+        length = parts->length;
+        (void)basec_array_destroy(&parts);
+    }
+    bench_result = basec_bench_print(
+        "basec_string_split",
+        _BENCH_INTERNER_TOKENS * _BENCH_INTERNER_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+
+    if (
+        bench_result == BASEC_BENCH_SUCCESS &&
+        basec_interner_create(&interner) != BASEC_INTERNER_SUCCESS
+    ) bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        basec_bench_handle_result(basec_bench_timer_start(&timer));
+        for (u64 i = 0; i < _BENCH_INTERNER_ITERATIONS; i++) {
+            (void)basec_string_split_interned(string, ",", interner, &parts);
+        }
+        basec_bench_handle_result(
+            basec_bench_timer_stop(&timer, &elapsed_ns)
+        );
+        bench_result = basec_bench_print(
+            "basec_string_split_interned",
+            _BENCH_INTERNER_TOKENS * _BENCH_INTERNER_ITERATIONS,
+            0,
+            elapsed_ns
+        );
+        if (parts == NULL || parts->length != length) {
+            bench_result = BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+
+    if (parts != NULL) (void)basec_array_destroy(&parts);
+    if (interner != NULL) (void)basec_interner_destroy(&interner);
+    (void)basec_string_destroy(&string);
+    return bench_result;
+}
+
+/**
+ * @brief Run the Interner benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_interner_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("Interner");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return bench_interner_versus_split();
+}
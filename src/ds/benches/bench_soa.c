@@ -0,0 +1,256 @@
+#include "ds/benches/bench_soa.h"
+
+#define _BENCH_SOA_ROWS     4194304
+#define _BENCH_SOA_SCANS    8
+#define _BENCH_SOA_CAPACITY 1024
+
+/**
+ * @struct _BenchSoARecord
+ * @brief A 64 byte record, a key and a payload scans do not read
+ */
+typedef struct {
+    u64 key;
+    u64 payload[7];
+} _BenchSoARecord;
+
+static const BasecSoAField _FIELDS[2] = {
+    BASEC_SOA_FIELD(_BenchSoARecord, key),
+    BASEC_SOA_FIELD(_BenchSoARecord, payload),
+};
+
+/**
+ * @brief Fill an array with records
+ * @param array_out The array of records
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_soa_records(BasecArray** array_out) {
+    _BenchSoARecord record = {0};
+
+    if (
+        basec_array_create(
+            array_out,
+            sizeof(_BenchSoARecord),
+            _BENCH_SOA_ROWS
+        ) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_SOA_ROWS; i++) {
+        record.key        = i;
+        record.payload[0] = i * 3;
+        (void)basec_array_append(*array_out, &record);
+    }
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Benchmark appending records to a BasecArray and a BasecSoA
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_soa_append(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      array        = NULL;
+    BasecSoA*        soa          = NULL;
+    _BenchSoARecord  record       = {0};
+
+    if (
+        basec_array_create(
+            &array,
+            sizeof(_BenchSoARecord),
+            _BENCH_SOA_CAPACITY
+        ) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_SOA_ROWS; i++) {
+        record.key = i;
+        if (basec_array_append(array, &record) != BASEC_ARRAY_SUCCESS) {
+            bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+            break;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    (void)basec_array_destroy(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = basec_bench_print(
+        "basec_array_append (64 byte records)",
+        _BENCH_SOA_ROWS,
+        sizeof(_BenchSoARecord),
+        elapsed_ns
+    );
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    if (
+        basec_soa_create(
+            &soa,
+            _FIELDS,
+            2,
+            sizeof(_BenchSoARecord),
+            _BENCH_SOA_CAPACITY
+        ) != BASEC_SOA_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_SOA_ROWS; i++) {
+        record.key = i;
+        if (basec_soa_append(soa, &record) != BASEC_SOA_SUCCESS) {
+            bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+            break;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    (void)basec_soa_destroy(&soa);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_soa_append (64 byte records)",
+        _BENCH_SOA_ROWS,
+        sizeof(_BenchSoARecord),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark summing one field of every record, in a BasecArray of
+ *        records and in a BasecSoA column
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_soa_scan(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      array        = NULL;
+    BasecSoA*        soa          = NULL;
+    BasecSoASpan     keys         = {0};
+    _BenchSoARecord* records      = NULL;
+    const u64*       column       = NULL;
+    u64              aos_sum      = 0;
+    u64              soa_sum      = 0;
+
+    bench_result = _bench_soa_records(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+    if (
+        basec_soa_from_array(array, _FIELDS, 2, &soa) != BASEC_SOA_SUCCESS ||
+        basec_soa_column(soa, 0, &keys) != BASEC_SOA_SUCCESS
+    ) {
+        if (soa != NULL) (void)basec_soa_destroy(&soa);
+        (void)basec_array_destroy(&array);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    // Every record brings its whole cache line in for 8 bytes
+    records = (_BenchSoARecord*)array->data;
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 scan = 0; scan < _BENCH_SOA_SCANS; scan++) {
+        for (u64 i = 0; i < array->length; i++) aos_sum += records[i].key;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    bench_result = basec_bench_print(
+        "sum one field, basec_array of records",
+        _BENCH_SOA_ROWS * _BENCH_SOA_SCANS,
+        sizeof(u64),
+        elapsed_ns
+    );
+
+    column = (const u64*)keys.data;
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 scan = 0; scan < _BENCH_SOA_SCANS; scan++) {
+        for (u64 i = 0; i < keys.length; i++) soa_sum += column[i];
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_soa_destroy(&soa);
+    (void)basec_array_destroy(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+    if (aos_sum != soa_sum) return BASEC_BENCH_RUN_FAILURE;
+
+    return basec_bench_print(
+        "sum one field, basec_soa column",
+        _BENCH_SOA_ROWS * _BENCH_SOA_SCANS,
+        sizeof(u64),
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark converting records between a BasecArray and a BasecSoA
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_soa_convert(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              from_ns      = 0;
+    u64              to_ns        = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      array        = NULL;
+    BasecArray*      copy         = NULL;
+    BasecSoA*        soa          = NULL;
+
+    bench_result = _bench_soa_records(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    if (
+        basec_soa_from_array(array, _FIELDS, 2, &soa) != BASEC_SOA_SUCCESS
+    ) bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &from_ns));
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        basec_bench_handle_result(basec_bench_timer_start(&timer));
+        if (
+            basec_soa_to_array(soa, &copy) != BASEC_SOA_SUCCESS
+        ) bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+        basec_bench_handle_result(basec_bench_timer_stop(&timer, &to_ns));
+    }
+    if (
+        bench_result == BASEC_BENCH_SUCCESS &&
+        memcmp(
+            copy->data,
+            array->data,
+            _BENCH_SOA_ROWS * sizeof(_BenchSoARecord)
+        ) != 0
+    ) bench_result = BASEC_BENCH_RUN_FAILURE;
+
+    if (soa != NULL) (void)basec_soa_destroy(&soa);
+    if (copy != NULL) (void)basec_array_destroy(&copy);
+    (void)basec_array_destroy(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = basec_bench_print(
+        "basec_soa_from_array",
+        _BENCH_SOA_ROWS,
+        sizeof(_BenchSoARecord),
+        from_ns
+    );
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_soa_to_array",
+        _BENCH_SOA_ROWS,
+        sizeof(_BenchSoARecord),
+        to_ns
+    );
+}
+
+/**
+ * @brief Run the SoA benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_soa_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("SoA");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_soa_append();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_soa_scan();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_soa_convert();
+    }
+
+    return bench_result;
+}
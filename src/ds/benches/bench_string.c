@@ -0,0 +1,889 @@
+#include "ds/benches/bench_string.h"
+
+#define _BENCH_STRING_FILE_PATH         "/tmp/basec_bench_string_file.txt"
+#define _BENCH_STRING_FILE_SIZE         (64ULL * 1024 * 1024)
+#define _BENCH_STRING_FILE_ITERATIONS   10
+#define _BENCH_STRING_FORMAT_ITERATIONS 1000000
+#define _BENCH_STRING_NUMBER_LENGTH     32
+#define _BENCH_STRING_UTF8_SIZE         (64ULL * 1024 * 1024)
+#define _BENCH_STRING_UTF8_ITERATIONS   10
+
+/**
+ * @brief Create the file used by the file loading benchmarks
+ * @return The result of the operation
+ */
+static BasecBenchResult _bench_string_create_file(void) {
+    FILE* file = NULL;
+    c8    line[64];
+
+    file = fopen(_BENCH_STRING_FILE_PATH, "w");
+    if (file == NULL) return BASEC_BENCH_RUN_FAILURE;
+
+    for (u64 i = 0; i < sizeof(line) - 1; i++) line[i] = 'a' + (i % 26);
+    line[sizeof(line) - 1] = '\n';
+
+    for (u64 i = 0; i < _BENCH_STRING_FILE_SIZE / sizeof(line); i++) {
+        if (fwrite(line, 1, sizeof(line), file) != sizeof(line)) {
+            (void)fclose(file);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+
+    (void)fclose(file);
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Create the numbers used by the parsing benchmarks
+ * @param floats Whether to format doubles instead of integers
+ * @param numbers_out The null terminated numbers, _BENCH_STRING_NUMBER_LENGTH
+ *                    characters apart
+ * @return The result of the operation
+ */
+static BasecBenchResult _bench_string_create_numbers(
+    bool   floats,
+    c_str* numbers_out
+) {
+    c_str numbers = NULL;
+
+    numbers = (c_str)malloc(
+        _BENCH_STRING_FORMAT_ITERATIONS * _BENCH_STRING_NUMBER_LENGTH
+    );
+    if (numbers == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        if (floats) {
+            (void)snprintf(
+                numbers + i * _BENCH_STRING_NUMBER_LENGTH,
+                _BENCH_STRING_NUMBER_LENGTH,
+                "%.17g",
+                (f64)i / 7.0
+            );
+        } else {
+            (void)snprintf(
+                numbers + i * _BENCH_STRING_NUMBER_LENGTH,
+                _BENCH_STRING_NUMBER_LENGTH,
+                "%lu",
+                (unsigned long)(i * 2654435761ULL)
+            );
+        }
+    }
+
+    *numbers_out = numbers;
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Create the mixed ASCII and multi-byte text used by the UTF-8
+ *        benchmarks
+ * @param view_out The view of the text, to be freed by the caller
+ * @return The result of the operation
+ */
+static BasecBenchResult _bench_string_create_utf8(BasecStringView* view_out) {
+    const c8 line[] = "request h\xC3\xA9llo w\xC3\xB6rld \xE2\x82\xAC 42 "
+                      "\xF0\x9F\x98\x80 status=ok took=12ms\n";
+    c_str    text   = NULL;
+    u64      size   = sizeof(line) - 1;
+
+    text = (c_str)malloc(_BENCH_STRING_UTF8_SIZE);
+    if (text == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; i + size <= _BENCH_STRING_UTF8_SIZE; i += size) {
+        (void)memcpy(text + i, line, size);
+    }
+
+    view_out->data   = text;
+    view_out->length = _BENCH_STRING_UTF8_SIZE / size * size;
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Create a string holding the text used by the UTF-8 benchmarks
+ * @param string_out The string to create
+ * @return The result of the operation
+ */
+static BasecBenchResult _bench_string_create_text(BasecString** string_out) {
+    BasecBenchResult  bench_result  = BASEC_BENCH_SUCCESS;
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecStringView   view          = {0};
+
+    bench_result = _bench_string_create_utf8(&view);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    // The text never fills the whole buffer, so there is room to terminate it
+    view.data[view.length] = '\0';
+    string_result          = basec_string_create(
+        string_out,
+        view.data,
+        view.length + 1
+    );
+    free(view.data);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Benchmark loading a file with fread followed by basec_string_create
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_read_then_copy(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecString*    string     = NULL;
+    FILE*           file       = NULL;
+    c_str           buffer     = NULL;
+    u64             bytes_read = 0;
+
+    buffer = (c_str)malloc(_BENCH_STRING_FILE_SIZE + 1);
+    if (buffer == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FILE_ITERATIONS; i++) {
+        file = fopen(_BENCH_STRING_FILE_PATH, "r");
+        if (file == NULL) {
+            free(buffer);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+
+        bytes_read = fread(buffer, 1, _BENCH_STRING_FILE_SIZE, file);
+        buffer[bytes_read] = '\0';
+        (void)fclose(file);
+
+        if (basec_string_create(&string, buffer, bytes_read + 1) !=
+            BASEC_STRING_SUCCESS) {
+            free(buffer);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+        (void)basec_string_destroy(&string);
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(buffer);
+    return basec_bench_print(
+        "fread + basec_string_create",
+        _BENCH_STRING_FILE_ITERATIONS,
+        _BENCH_STRING_FILE_SIZE,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark loading a file with basec_string_read_file
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_read_file(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecString*    string     = NULL;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FILE_ITERATIONS; i++) {
+        if (basec_string_read_file(_BENCH_STRING_FILE_PATH, &string) !=
+            BASEC_STRING_SUCCESS) return BASEC_BENCH_RUN_FAILURE;
+        (void)basec_string_destroy(&string);
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    return basec_bench_print(
+        "basec_string_read_file",
+        _BENCH_STRING_FILE_ITERATIONS,
+        _BENCH_STRING_FILE_SIZE,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark loading a file with basec_string_map_file
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_map_file(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecStringView view       = {0};
+    u64             checksum   = 0;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FILE_ITERATIONS; i++) {
+        if (basec_string_map_file(_BENCH_STRING_FILE_PATH, &view) !=
+            BASEC_STRING_SUCCESS) return BASEC_BENCH_RUN_FAILURE;
+
+        // Touch every page so the mapping cost is actually paid
+        for (u64 j = 0; j < view.length; j += 4096) checksum += view.data[j];
+
+        (void)basec_string_unmap_file(&view);
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "basec_string_map_file",
+        _BENCH_STRING_FILE_ITERATIONS,
+        _BENCH_STRING_FILE_SIZE,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark formatting integers with snprintf and basec_string_append
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_snprintf_u64(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecString*    string     = NULL;
+    c8              buffer[32];
+
+    if (basec_string_create(&string, "", 1) != BASEC_STRING_SUCCESS) {
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        (void)snprintf(buffer, sizeof(buffer), "%lu", (unsigned long)(i * 2654435761ULL));
+        if (basec_string_append(string, buffer) != BASEC_STRING_SUCCESS) {
+            (void)basec_string_destroy(&string);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_destroy(&string);
+    return basec_bench_print(
+        "snprintf + basec_string_append (u64)",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark formatting integers with basec_string_append_u64
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_append_u64(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecString*    string     = NULL;
+
+    if (basec_string_create(&string, "", 1) != BASEC_STRING_SUCCESS) {
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        if (basec_string_append_u64(string, i * 2654435761ULL) !=
+            BASEC_STRING_SUCCESS) {
+            (void)basec_string_destroy(&string);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_destroy(&string);
+    return basec_bench_print(
+        "basec_string_append_u64",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark formatting doubles with snprintf and basec_string_append
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_snprintf_f64(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecString*    string     = NULL;
+    c8              buffer[32];
+
+    if (basec_string_create(&string, "", 1) != BASEC_STRING_SUCCESS) {
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        (void)snprintf(buffer, sizeof(buffer), "%.17g", (f64)i / 7.0);
+        if (basec_string_append(string, buffer) != BASEC_STRING_SUCCESS) {
+            (void)basec_string_destroy(&string);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_destroy(&string);
+    return basec_bench_print(
+        "snprintf + basec_string_append (f64)",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark formatting doubles with basec_string_append_f64
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_append_f64(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecString*    string     = NULL;
+
+    if (basec_string_create(&string, "", 1) != BASEC_STRING_SUCCESS) {
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        if (basec_string_append_f64(string, (f64)i / 7.0) !=
+            BASEC_STRING_SUCCESS) {
+            (void)basec_string_destroy(&string);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_destroy(&string);
+    return basec_bench_print(
+        "basec_string_append_f64",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark formatting log lines with snprintf and basec_string_append
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_snprintf_line(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecString*    string     = NULL;
+    c8              buffer[128];
+
+    if (basec_string_create(&string, "", 1) != BASEC_STRING_SUCCESS) {
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        (void)snprintf(
+            buffer,
+            sizeof(buffer),
+            "%s id=%lu status=%d took=%f\n",
+            "request",
+            (unsigned long)i,
+            200,
+            (f64)(i % 1000) / 8.0
+        );
+        if (basec_string_append(string, buffer) != BASEC_STRING_SUCCESS) {
+            (void)basec_string_destroy(&string);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_destroy(&string);
+    return basec_bench_print(
+        "snprintf + basec_string_append (line)",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark formatting log lines with basec_string_appendf
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_appendf(void) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    BasecString*    string     = NULL;
+
+    if (basec_string_create(&string, "", 1) != BASEC_STRING_SUCCESS) {
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        if (
+            basec_string_appendf(
+                string,
+                "%s id=%lu status=%d took=%f\n",
+                "request",
+                (unsigned long)i,
+                200,
+                (f64)(i % 1000) / 8.0
+            ) != BASEC_STRING_SUCCESS
+        ) {
+            (void)basec_string_destroy(&string);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_destroy(&string);
+    return basec_bench_print(
+        "basec_string_appendf",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark parsing integers with strtoull
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_strtoull(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    c_str            numbers      = NULL;
+    u64              checksum     = 0;
+
+    bench_result = _bench_string_create_numbers(false, &numbers);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        checksum += strtoull(
+            numbers + i * _BENCH_STRING_NUMBER_LENGTH,
+            NULL,
+            10
+        );
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(numbers);
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "strtoull",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark parsing integers with basec_string_parse_u64
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_parse_u64(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    c_str            numbers      = NULL;
+    BasecStringView  view         = {0};
+    u64              value        = 0;
+    u64              checksum     = 0;
+
+    bench_result = _bench_string_create_numbers(false, &numbers);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        view.data   = numbers + i * _BENCH_STRING_NUMBER_LENGTH;
+        view.length = strlen(view.data);
+        if (basec_string_parse_u64(view, &value) != BASEC_STRING_SUCCESS) {
+            free(numbers);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+        checksum += value;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(numbers);
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "basec_string_parse_u64",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark parsing doubles with strtod
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_strtod(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    c_str            numbers      = NULL;
+    f64              checksum     = 0.0;
+
+    bench_result = _bench_string_create_numbers(true, &numbers);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        checksum += strtod(numbers + i * _BENCH_STRING_NUMBER_LENGTH, NULL);
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(numbers);
+    if (checksum == 0.0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "strtod",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark parsing doubles with basec_string_parse_f64
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_parse_f64(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    c_str            numbers      = NULL;
+    BasecStringView  view         = {0};
+    f64              value        = 0.0;
+    f64              checksum     = 0.0;
+
+    bench_result = _bench_string_create_numbers(true, &numbers);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_FORMAT_ITERATIONS; i++) {
+        view.data   = numbers + i * _BENCH_STRING_NUMBER_LENGTH;
+        view.length = strlen(view.data);
+        if (basec_string_parse_f64(view, &value) != BASEC_STRING_SUCCESS) {
+            free(numbers);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+        checksum += value;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(numbers);
+    if (checksum == 0.0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "basec_string_parse_f64",
+        _BENCH_STRING_FORMAT_ITERATIONS,
+        0,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark decoding UTF-8 text one codepoint at a time
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_utf8_next(void) {
+    BasecBenchTimer         timer        = {0};
+    u64                     elapsed_ns   = 0;
+    BasecBenchResult        bench_result = BASEC_BENCH_SUCCESS;
+    BasecStringView         view         = {0};
+    BasecStringUtf8Iterator iterator     = {0};
+    u32                     codepoint    = 0;
+    u64                     checksum     = 0;
+
+    bench_result = _bench_string_create_utf8(&view);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_UTF8_ITERATIONS; i++) {
+        (void)basec_string_utf8_iterator(view, &iterator);
+        while (
+            basec_string_utf8_next(&iterator, &codepoint) ==
+            BASEC_STRING_SUCCESS
+        ) checksum += codepoint;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(view.data);
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "basec_string_utf8_next",
+        _BENCH_STRING_UTF8_ITERATIONS,
+        view.length,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark validating UTF-8 text with basec_string_utf8_validate
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_utf8_validate(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecStringView  view         = {0};
+    bool             valid        = false;
+
+    bench_result = _bench_string_create_utf8(&view);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_UTF8_ITERATIONS; i++) {
+        if (
+            basec_string_utf8_validate(view, &valid) != BASEC_STRING_SUCCESS ||
+            !valid
+        ) {
+            free(view.data);
+            return BASEC_BENCH_RUN_FAILURE;
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(view.data);
+    return basec_bench_print(
+        "basec_string_utf8_validate",
+        _BENCH_STRING_UTF8_ITERATIONS,
+        view.length,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark counting UTF-8 codepoints with basec_string_utf8_length
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_utf8_length(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecStringView  view         = {0};
+    u64              length       = 0;
+    u64              checksum     = 0;
+
+    bench_result = _bench_string_create_utf8(&view);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_UTF8_ITERATIONS; i++) {
+        (void)basec_string_utf8_length(view, &length);
+        checksum += length;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(view.data);
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "basec_string_utf8_length",
+        _BENCH_STRING_UTF8_ITERATIONS,
+        view.length,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark lowercasing text one byte at a time with tolower
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_tolower(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecStringView  view         = {0};
+
+    bench_result = _bench_string_create_utf8(&view);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_UTF8_ITERATIONS; i++) {
+        for (u64 j = 0; j < view.length; j++) {
+            view.data[j] = (c8)tolower((u8)view.data[j]);
+        }
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    free(view.data);
+    return basec_bench_print(
+        "tolower",
+        _BENCH_STRING_UTF8_ITERATIONS,
+        view.length,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark lowercasing text with basec_string_to_lower
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_to_lower(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecString*     string       = NULL;
+    u64              length       = 0;
+
+    bench_result = _bench_string_create_text(&string);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_UTF8_ITERATIONS; i++) {
+        (void)basec_string_to_lower(string);
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_length(string, &length);
+    (void)basec_string_destroy(&string);
+    return basec_bench_print(
+        "basec_string_to_lower",
+        _BENCH_STRING_UTF8_ITERATIONS,
+        length,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark searching for a missing needle with basec_string_find
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_find(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecString*     string       = NULL;
+    u64              length       = 0;
+    u64              index        = 0;
+    u64              misses       = 0;
+
+    bench_result = _bench_string_create_text(&string);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_UTF8_ITERATIONS; i++) {
+        if (
+            basec_string_find(string, "status=failed", &index) ==
+            BASEC_STRING_NOT_FOUND
+        ) misses++;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_length(string, &length);
+    (void)basec_string_destroy(&string);
+    if (misses != _BENCH_STRING_UTF8_ITERATIONS) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "basec_string_find",
+        _BENCH_STRING_UTF8_ITERATIONS,
+        length,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark searching for a missing needle with
+ *        basec_string_find_icase
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_string_find_icase(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecString*     string       = NULL;
+    u64              length       = 0;
+    u64              index        = 0;
+    u64              misses       = 0;
+
+    bench_result = _bench_string_create_text(&string);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRING_UTF8_ITERATIONS; i++) {
+        if (
+            basec_string_find_icase(string, "STATUS=FAILED", &index) ==
+            BASEC_STRING_NOT_FOUND
+        ) misses++;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_string_length(string, &length);
+    (void)basec_string_destroy(&string);
+    if (misses != _BENCH_STRING_UTF8_ITERATIONS) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        "basec_string_find_icase",
+        _BENCH_STRING_UTF8_ITERATIONS,
+        length,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Run the String benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_string_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("String");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = _bench_string_create_file();
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_string_read_then_copy();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_read_file();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_map_file();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_snprintf_u64();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_append_u64();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_snprintf_f64();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_append_f64();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_snprintf_line();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_appendf();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_strtoull();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_parse_u64();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_strtod();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_parse_f64();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_utf8_next();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_utf8_validate();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_utf8_length();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_tolower();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_to_lower();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_find();
+    }
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_string_find_icase();
+    }
+
+    (void)remove(_BENCH_STRING_FILE_PATH);
+    return bench_result;
+}
@@ -0,0 +1,146 @@
+#include "ds/benches/bench_strmap.h"
+
+#define _BENCH_STRMAP_KEYS   500000
+#define _BENCH_STRMAP_STRIDE 48
+
+/**
+ * @brief Format the keys used by the benchmarks into one buffer
+ * @param format The format of the keys, taking the key's counter
+ * @param keys_out The buffer of keys, _BENCH_STRMAP_STRIDE bytes apart
+ * @param lengths_out The lengths of the keys
+ * @return The result of the operation
+ */
+static BasecBenchResult _bench_strmap_keys(
+    c_str  format,
+    c_str* keys_out,
+    u64**  lengths_out
+) {
+    c_str keys    = (c_str)malloc(_BENCH_STRMAP_KEYS * _BENCH_STRMAP_STRIDE);
+    u64*  lengths = (u64*)malloc(_BENCH_STRMAP_KEYS * sizeof(u64));
+
+    if (keys == NULL || lengths == NULL) {
+        free(keys);
+        free(lengths);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    for (u64 i = 0; i < _BENCH_STRMAP_KEYS; i++) {
+        lengths[i] = (u64)snprintf(
+            keys + i * _BENCH_STRMAP_STRIDE,
+            _BENCH_STRMAP_STRIDE,
+            format,
+            (unsigned long)(i * 2654435761ULL)
+        );
+    }
+
+    *keys_out    = keys;
+    *lengths_out = lengths;
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Time inserting and then looking up keys in a string map
+ * @param format The format of the keys, taking the key's counter
+ * @param label The label to print after the benchmark names
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_strmap_keys_run(c_str format, c_str label) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecStrMap*     map          = NULL;
+    BasecStringView  key          = {0};
+    c_str            keys         = NULL;
+    u64*             lengths      = NULL;
+    u64              value        = 0;
+    u64              checksum     = 0;
+    c8               name[64];
+
+    bench_result = _bench_strmap_keys(format, &keys, &lengths);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+    if (
+        basec_strmap_create(&map, sizeof(u64), 16) != BASEC_STRMAP_SUCCESS
+    ) {
+        free(keys);
+        free(lengths);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_STRMAP_KEYS; i++) {
+        key.data   = keys + i * _BENCH_STRMAP_STRIDE;
+        key.length = lengths[i];
+        (void)basec_strmap_insert(map, key, &i);
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    (void)snprintf(name, sizeof(name), "basec_strmap_insert (%s)", label);
+    bench_result = basec_bench_print(name, _BENCH_STRMAP_KEYS, 0, elapsed_ns);
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        basec_bench_handle_result(basec_bench_timer_start(&timer));
+        for (u64 i = 0; i < _BENCH_STRMAP_KEYS; i++) {
+            u64 index = (i * 7919) % _BENCH_STRMAP_KEYS;
+
+            key.data   = keys + index * _BENCH_STRMAP_STRIDE;
+            key.length = lengths[index];
+            if (basec_strmap_get(map, key, &value) == BASEC_STRMAP_SUCCESS) {
+                checksum += value;
+            }
+        }
+        basec_bench_handle_result(
+            basec_bench_timer_stop(&timer, &elapsed_ns)
+        );
+        (void)snprintf(name, sizeof(name), "basec_strmap_get (%s)", label);
+        bench_result = basec_bench_print(
+            name,
+            _BENCH_STRMAP_KEYS,
+            0,
+            elapsed_ns
+        );
+    }
+
+    (void)basec_strmap_destroy(&map);
+    free(keys);
+    free(lengths);
+    if (bench_result == BASEC_BENCH_SUCCESS && checksum == 0) {
+        return BASEC_BENCH_RUN_FAILURE;
+    }
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark a string map with keys short enough to be stored inline
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_strmap_short_keys(void) {
+    return _bench_strmap_keys_run("user:%lu", "inline keys");
+}
+
+/**
+ * @brief Benchmark a string map with keys that are stored in the arena
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_strmap_long_keys(void) {
+    return _bench_strmap_keys_run(
+        "/api/v1/accounts/%lu/settings",
+        "arena keys"
+    );
+}
+
+/**
+ * @brief Run the StrMap benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_strmap_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("StrMap");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_strmap_short_keys();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_strmap_long_keys();
+    }
+
+    return bench_result;
+}
@@ -1018,6 +1018,1070 @@ bool test_array_find_all(c_str fail_message) {
     return true;
 }
 
+/**
+ * @brief Test hashing an element of an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_hash_element(c_str fail_message) {
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array        = NULL;
+    u64              element      = 0;
+    u64              hash         = 0;
+    u64              expected     = 0;
+
+    array_result = basec_array_create(&array, sizeof(u64), 4);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (element = 1; element <= 3; element++) {
+        (void)basec_array_append(array, &element);
+    }
+
+    element = 2;
+    (void)basec_hash_bytes(&element, sizeof(element), &expected);
+    array_result = basec_array_hash_element(array, 1, &hash);
+    if (array_result != BASEC_ARRAY_SUCCESS || hash != expected) {
+        (void)strncpy(
+            fail_message,
+            "Element hash does not match the hash of its bytes",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_array_hash_element(array, 3, &hash);
+    if (array_result != BASEC_ARRAY_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Hashing out of bounds succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_array_destroy(&array);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Array destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Order two u32 elements
+ * @param a The first element
+ * @param b The second element
+ * @return Negative if a is smaller, positive if b is, 0 if equal
+ */
+static i32 _test_array_compare_u32(const void* a, const void* b) {
+    u32 left  = *(const u32*)a;
+    u32 right = *(const u32*)b;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Test sorting an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_sort(c_str fail_message) {
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array        = NULL;
+    u32              elements[]   = {5, 3, 9, 1, 3, 7};
+    u32              sorted[]     = {1, 3, 3, 5, 7, 9};
+
+    array_result = basec_array_create(&array, sizeof(u32), 6);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create array for sort test",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 6; i++) (void)basec_array_append(array, &elements[i]);
+
+    array_result = basec_array_sort(array, &_test_array_compare_u32);
+    if (
+        array_result != BASEC_ARRAY_SUCCESS ||
+        memcmp(array->data, sorted, sizeof(sorted)) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Sorted elements are incorrect",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_array_sort(array, NULL);
+    (void)basec_array_destroy(&array);
+    if (array_result != BASEC_ARRAY_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Sorting without a comparator succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test removing repeats from a sorted array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_unique_sorted(c_str fail_message) {
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array        = NULL;
+    u32              elements[]   = {1, 1, 2, 3, 3, 3, 8};
+    u32              unique[]     = {1, 2, 3, 8};
+
+    array_result = basec_array_create(&array, sizeof(u32), 7);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create array for unique_sorted test",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 7; i++) (void)basec_array_append(array, &elements[i]);
+
+    array_result = basec_array_unique_sorted(array);
+    if (
+        array_result != BASEC_ARRAY_SUCCESS ||
+        array->length != 4 ||
+        memcmp(array->data, unique, sizeof(unique)) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Unique elements are incorrect",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    (void)basec_array_destroy(&array);
+    return true;
+}
+
+/**
+ * @brief Test removing elements from an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_remove(c_str fail_message) {
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array        = NULL;
+    u32              elements[]   = {10, 20, 30, 40, 50};
+    u32              removed      = 0;
+    u32              expected[]   = {10, 50, 40};
+
+    array_result = basec_array_create(&array, sizeof(u32), 5);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create array for remove test",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 5; i++) (void)basec_array_append(array, &elements[i]);
+
+    // {10, 20, 30, 40, 50} -> {10, 30, 40, 50} -> {10, 50, 40}
+    array_result = basec_array_remove(array, 1, &removed);
+    if (array_result != BASEC_ARRAY_SUCCESS || removed != 20) {
+        (void)strncpy(
+            fail_message,
+            "Removed element is incorrect",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_array_swap_remove(array, 1, &removed);
+    if (
+        array_result != BASEC_ARRAY_SUCCESS ||
+        removed != 30 ||
+        array->length != 3 ||
+        memcmp(array->data, expected, sizeof(expected)) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Elements after removal are incorrect",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_array_remove(array, 3, NULL);
+    (void)basec_array_destroy(&array);
+    if (array_result != BASEC_ARRAY_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Removing out of bounds index succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test finding elements through an array's hash index
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_index(c_str fail_message) {
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array        = NULL;
+    BasecArray*      indices      = NULL;
+    u64              element      = 0;
+    u64              index        = 0;
+    bool             contains     = false;
+
+    array_result = basec_array_create(&array, sizeof(u64), 4);
+    if (array_result == BASEC_ARRAY_SUCCESS) {
+        array_result = basec_array_enable_index(array);
+    }
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create indexed array",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (array != NULL) (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    // Elements are i % 100, so each value appears 10 times
+    for (u64 i = 0; i < 1000; i++) {
+        element = i % 100;
+        (void)basec_array_append(array, &element);
+    }
+
+    element      = 42;
+    array_result = basec_array_find_all(array, &element, &indices);
+    if (
+        array_result != BASEC_ARRAY_SUCCESS ||
+        indices->length != 10 ||
+        ((u64*)indices->data)[0] != 42 ||
+        ((u64*)indices->data)[9] != 942
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Indexed find_all returned incorrect indices",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (indices != NULL) (void)basec_array_destroy(&indices);
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+    (void)basec_array_destroy(&indices);
+
+    // Every change goes through the index: 42 only remains at index 542
+    element = 7;
+    for (u64 i = 0; i < 5; i++) {
+        (void)basec_array_set(array, i * 100 + 42, &element);
+    }
+    (void)basec_array_remove(array, 642, NULL);
+    (void)basec_array_swap_remove(array, 741, NULL);
+    while (array->length > 800) (void)basec_array_pop(array, &element);
+
+    element      = 42;
+    array_result = basec_array_find(array, &element, &index);
+    if (array_result != BASEC_ARRAY_SUCCESS || index != 542) {
+        (void)strncpy(
+            fail_message,
+            "Indexed find returned an incorrect index",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    element = 99;
+    (void)basec_array_set(array, 542, &element);
+    element = 42;
+    (void)basec_array_contains(array, &element, &contains);
+    array_result = basec_array_find(array, &element, &index);
+    if (contains || array_result != BASEC_ARRAY_NOT_FOUND) {
+        (void)strncpy(
+            fail_message,
+            "Indexed array still finds an overwritten element",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_array_disable_index(array);
+    if (array_result != BASEC_ARRAY_SUCCESS || array->index != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to disable array index",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    (void)basec_array_destroy(&array);
+    return true;
+}
+
+/**
+ * @brief Test placing the nth element of an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_nth_element(c_str fail_message) {
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array        = NULL;
+    u32*             data         = NULL;
+    u32              element      = 0;
+
+    array_result = basec_array_create(&array, sizeof(u32), 100);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create array for nth_element test",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // A permutation of 0 to 99, so the nth element is n
+    for (u32 i = 0; i < 100; i++) {
+        element = (i * 37) % 100;
+        (void)basec_array_append(array, &element);
+    }
+
+    array_result = basec_array_nth_element(array, 42, &_test_array_compare_u32);
+    data         = (u32*)array->data;
+    if (array_result != BASEC_ARRAY_SUCCESS || data[42] != 42) {
+        (void)strncpy(
+            fail_message,
+            "Nth element is incorrect",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    for (u64 i = 0; i < 100; i++) {
+        if ((i < 42 && data[i] >= 42) || (i > 42 && data[i] <= 42)) {
+            (void)strncpy(
+                fail_message,
+                "Elements are not partitioned around the nth element",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_array_destroy(&array);
+            return false;
+        }
+    }
+
+    array_result = basec_array_nth_element(
+        array,
+        100,
+        &_test_array_compare_u32
+    );
+    if (array_result != BASEC_ARRAY_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Placing an element past the end did not fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    (void)basec_array_destroy(&array);
+    return true;
+}
+
+/**
+ * @brief Test copying the first elements of an array in order
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_top_k(c_str fail_message) {
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array        = NULL;
+    BasecArray*      top          = NULL;
+    u32              elements[]   = {50, 7, 31, 7, 99, 2, 64, 18, 40, 5};
+    u32              expected[]   = {2, 5, 7, 7};
+
+    array_result = basec_array_create(&array, sizeof(u32), 10);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create array for top_k test",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 10; i++) (void)basec_array_append(array, &elements[i]);
+
+    array_result = basec_array_top_k(array, 4, &_test_array_compare_u32, &top);
+    if (
+        array_result != BASEC_ARRAY_SUCCESS ||
+        top->length != 4 ||
+        memcmp(top->data, expected, sizeof(expected)) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Top elements are incorrect",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        if (top != NULL) (void)basec_array_destroy(&top);
+        return false;
+    }
+
+    if (memcmp(array->data, elements, sizeof(elements)) != 0) {
+        (void)strncpy(
+            fail_message,
+            "Selecting the top elements changed the array",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        (void)basec_array_destroy(&top);
+        return false;
+    }
+
+    (void)basec_array_destroy(&array);
+    (void)basec_array_destroy(&top);
+    return true;
+}
+
+#define _TEST_ARRAY_PAR_LENGTH 100000
+
+/**
+ * @struct _TestArrayRun
+ * @brief A run of consecutive indices, for checking the order of combines
+ */
+typedef struct {
+    u64  first;
+    u64  last;
+    bool empty;
+    bool ordered;
+} _TestArrayRun;
+
+/**
+ * @struct _TestArrayKeyed
+ * @brief An element sorted by its key, remembering where it started
+ */
+typedef struct {
+    u64 sequence;
+    u64 key;
+} _TestArrayKeyed;
+
+/**
+ * @brief Double an element and add its index
+ * @param element The u64 element
+ * @param index The index of the element
+ * @param context Unused
+ */
+static void _test_array_double(void* element, u64 index, void* context) {
+    (void)context;
+    *(u64*)element = *(u64*)element * 2 + index;
+}
+
+/**
+ * @brief Turn a u64 element into a run of one index
+ * @param element The u64 element
+ * @param element_out The _TestArrayRun of the element
+ * @param context Unused
+ */
+static void _test_array_to_run(
+    const void* element,
+    void*       element_out,
+    void*       context
+) {
+    _TestArrayRun* run = (_TestArrayRun*)element_out;
+
+    (void)context;
+    run->first   = *(const u64*)element;
+    run->last    = run->first;
+    run->empty   = false;
+    run->ordered = true;
+}
+
+/**
+ * @brief Append a run to another, which stays ordered only if the runs
+ *        are adjacent
+ * @param accumulator The _TestArrayRun to append to
+ * @param element The _TestArrayRun to append
+ * @param context Unused
+ */
+static void _test_array_join_runs(
+    void*       accumulator,
+    const void* element,
+    void*       context
+) {
+    _TestArrayRun*       run  = (_TestArrayRun*)accumulator;
+    const _TestArrayRun* next = (const _TestArrayRun*)element;
+
+    (void)context;
+    if (next->empty) return;
+    if (run->empty) {
+        *run = *next;
+        return;
+    }
+    run->ordered = run->ordered && next->ordered &&
+                   run->last + 1 == next->first;
+    run->last    = next->last;
+}
+
+/**
+ * @brief Add a u64 element to an accumulator
+ * @param accumulator The u64 accumulator
+ * @param element The u64 element
+ * @param context Unused
+ */
+static void _test_array_add_u64(
+    void*       accumulator,
+    const void* element,
+    void*       context
+) {
+    (void)context;
+    *(u64*)accumulator += *(const u64*)element;
+}
+
+/**
+ * @brief Create an array of the u64 elements 0 to length - 1
+ * @param length The number of elements
+ * @return The array
+ */
+static BasecArray* _test_array_counting(u64 length) {
+    BasecArray* array = NULL;
+
+    basec_array_handle_result(
+        basec_array_create(&array, sizeof(u64), length > 0 ? length : 1)
+    );
+    for (u64 i = 0; i < length; i++) ((u64*)array->data)[i] = i;
+    array->length = length;
+    return array;
+}
+
+/**
+ * @brief Test visiting every element of an array in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_for_each(c_str fail_message) {
+    BasecJobs*  jobs  = NULL;
+    BasecArray* large = _test_array_counting(_TEST_ARRAY_PAR_LENGTH);
+    BasecArray* small = _test_array_counting(10);
+    bool        equal = true;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 3));
+    basec_array_handle_result(
+        basec_array_par_for_each(large, _test_array_double, NULL, jobs)
+    );
+    basec_array_handle_result(
+        basec_array_par_for_each(small, _test_array_double, NULL, NULL)
+    );
+
+    for (u64 i = 0; i < _TEST_ARRAY_PAR_LENGTH; i++) {
+        if (((u64*)large->data)[i] != 3 * i) equal = false;
+    }
+    for (u64 i = 0; i < 10; i++) {
+        if (((u64*)small->data)[i] != 3 * i) equal = false;
+    }
+
+    (void)basec_jobs_destroy(&jobs);
+    (void)basec_array_destroy(&large);
+    (void)basec_array_destroy(&small);
+    if (!equal) {
+        (void)strncpy(
+            fail_message,
+            "Parallel for each did not visit every element once",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test mapping an array into an output array in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_map(c_str fail_message) {
+    BasecJobs*     jobs   = NULL;
+    BasecArray*    array  = _test_array_counting(_TEST_ARRAY_PAR_LENGTH);
+    BasecArray*    mapped = NULL;
+    _TestArrayRun* runs   = NULL;
+    bool           equal  = true;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 3));
+    basec_array_handle_result(
+        basec_array_par_map(
+            array,
+            sizeof(_TestArrayRun),
+            _test_array_to_run,
+            NULL,
+            jobs,
+            &mapped
+        )
+    );
+
+    runs = (_TestArrayRun*)mapped->data;
+    if (
+        mapped->length != _TEST_ARRAY_PAR_LENGTH ||
+        mapped->element_size != sizeof(_TestArrayRun)
+    ) equal = false;
+    for (u64 i = 0; equal && i < _TEST_ARRAY_PAR_LENGTH; i++) {
+        if (runs[i].first != i || runs[i].empty) equal = false;
+    }
+
+    (void)basec_jobs_destroy(&jobs);
+    (void)basec_array_destroy(&array);
+    (void)basec_array_destroy(&mapped);
+    if (!equal) {
+        (void)strncpy(
+            fail_message,
+            "Parallel map did not fill in every output element",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test reducing an array in parallel with an associative combiner
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_reduce(c_str fail_message) {
+    BasecJobs*    jobs     = NULL;
+    BasecArray*   array    = _test_array_counting(_TEST_ARRAY_PAR_LENGTH);
+    BasecArray*   runs     = NULL;
+    BasecArray*   empty    = _test_array_counting(0);
+    _TestArrayRun identity = { 0, 0, true, true };
+    _TestArrayRun run      = {0};
+    u64           zero     = 0;
+    u64           sum      = 1;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 3));
+    basec_array_handle_result(
+        basec_array_par_map(
+            array,
+            sizeof(_TestArrayRun),
+            _test_array_to_run,
+            NULL,
+            jobs,
+            &runs
+        )
+    );
+
+    // Joining runs only stays ordered if chunks are combined in order
+    basec_array_handle_result(
+        basec_array_par_reduce(
+            runs,
+            &identity,
+            _test_array_join_runs,
+            NULL,
+            jobs,
+            &run
+        )
+    );
+    basec_array_handle_result(
+        basec_array_par_reduce(
+            empty,
+            &zero,
+            _test_array_add_u64,
+            NULL,
+            jobs,
+            &sum
+        )
+    );
+
+    (void)basec_jobs_destroy(&jobs);
+    (void)basec_array_destroy(&array);
+    (void)basec_array_destroy(&runs);
+    (void)basec_array_destroy(&empty);
+    if (
+        run.empty ||
+        !run.ordered ||
+        run.first != 0 ||
+        run.last != _TEST_ARRAY_PAR_LENGTH - 1 ||
+        sum != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Parallel reduce did not combine the elements in order",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test an inclusive scan of an array in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_inclusive_scan(c_str fail_message) {
+    BasecJobs*  jobs  = NULL;
+    BasecArray* large = _test_array_counting(_TEST_ARRAY_PAR_LENGTH);
+    BasecArray* small = _test_array_counting(10);
+    bool        equal = true;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 3));
+    basec_array_handle_result(
+        basec_array_par_inclusive_scan(large, _test_array_add_u64, NULL, jobs)
+    );
+    basec_array_handle_result(
+        basec_array_par_inclusive_scan(small, _test_array_add_u64, NULL, NULL)
+    );
+
+    for (u64 i = 0; i < _TEST_ARRAY_PAR_LENGTH; i++) {
+        if (((u64*)large->data)[i] != i * (i + 1) / 2) equal = false;
+    }
+    for (u64 i = 0; i < 10; i++) {
+        if (((u64*)small->data)[i] != i * (i + 1) / 2) equal = false;
+    }
+
+    (void)basec_jobs_destroy(&jobs);
+    (void)basec_array_destroy(&large);
+    (void)basec_array_destroy(&small);
+    if (!equal) {
+        (void)strncpy(
+            fail_message,
+            "Parallel inclusive scan computed the wrong prefixes",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test sorting an array in parallel with a comparator
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_sort(c_str fail_message) {
+    BasecJobs*  jobs    = NULL;
+    BasecArray* array   = NULL;
+    BasecArray* scratch = NULL;
+    u32*        values  = NULL;
+    u64         sum     = 0;
+    u64         sorted  = 0;
+    bool        ordered = true;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 3));
+    basec_array_handle_result(
+        basec_array_create(&array, sizeof(u32), _TEST_ARRAY_PAR_LENGTH)
+    );
+    basec_array_handle_result(basec_array_create(&scratch, sizeof(u32), 1));
+
+    // Sort twice, so the second sort reuses the grown scratch array
+    for (u64 round = 0; round < 2; round++) {
+        values        = (u32*)array->data;
+        array->length = _TEST_ARRAY_PAR_LENGTH;
+        sum           = 0;
+        sorted        = 0;
+        for (u64 i = 0; i < _TEST_ARRAY_PAR_LENGTH; i++) {
+            values[i] = (u32)((i * 2654435761u + round) % 1000003);
+            sum      += values[i];
+        }
+
+        basec_array_handle_result(
+            basec_array_par_sort(array, _test_array_compare_u32, scratch, jobs)
+        );
+        for (u64 i = 0; i < _TEST_ARRAY_PAR_LENGTH; i++) {
+            if (i > 0 && values[i - 1] > values[i]) ordered = false;
+            sorted += values[i];
+        }
+        if (sorted != sum) ordered = false;
+    }
+
+    if (
+        !ordered ||
+        scratch->capacity < _TEST_ARRAY_PAR_LENGTH ||
+        scratch->length != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Parallel sort did not sort the array",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        (void)basec_array_destroy(&array);
+        (void)basec_array_destroy(&scratch);
+        return false;
+    }
+
+    if (
+        basec_array_par_sort(array, NULL, NULL, jobs) !=
+        BASEC_ARRAY_NULL_POINTER
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Parallel sort accepted a null comparator",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        (void)basec_array_destroy(&array);
+        (void)basec_array_destroy(&scratch);
+        return false;
+    }
+
+    (void)basec_jobs_destroy(&jobs);
+    (void)basec_array_destroy(&array);
+    (void)basec_array_destroy(&scratch);
+    return true;
+}
+
+/**
+ * @brief Test sorting an array by a u64 key in parallel
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_par_radix_sort(c_str fail_message) {
+    BasecJobs*       jobs     = NULL;
+    BasecArray*      array    = NULL;
+    _TestArrayKeyed* elements = NULL;
+    _TestArrayKeyed  element  = {0};
+    bool             stable   = true;
+
+    basec_jobs_handle_result(basec_jobs_create(&jobs, 3));
+    basec_array_handle_result(
+        basec_array_create(
+            &array,
+            sizeof(_TestArrayKeyed),
+            _TEST_ARRAY_PAR_LENGTH
+        )
+    );
+
+    // Few distinct keys, so many elements share one and must keep their order
+    for (u64 i = 0; i < _TEST_ARRAY_PAR_LENGTH; i++) {
+        element.sequence = i;
+        element.key      = ((i * 2654435761u) % 1021) << 20;
+        basec_array_handle_result(basec_array_append(array, &element));
+    }
+
+    basec_array_handle_result(
+        basec_array_par_radix_sort(
+            array,
+            sizeof(u64),
+            NULL,
+            jobs
+        )
+    );
+    elements = (_TestArrayKeyed*)array->data;
+    for (u64 i = 1; i < _TEST_ARRAY_PAR_LENGTH; i++) {
+        if (
+            elements[i - 1].key > elements[i].key ||
+            (
+                elements[i - 1].key == elements[i].key &&
+                elements[i - 1].sequence > elements[i].sequence
+            )
+        ) stable = false;
+    }
+
+    if (
+        !stable ||
+        basec_array_par_radix_sort(array, 9, NULL, jobs) !=
+        BASEC_ARRAY_INVALID_KEY_OFFSET
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Parallel radix sort did not sort the array stably",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_jobs_destroy(&jobs);
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    (void)basec_jobs_destroy(&jobs);
+    (void)basec_array_destroy(&array);
+    return true;
+}
+
+/**
+ * @brief Test that aligned arrays stay aligned as they grow
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_create_aligned(c_str fail_message) {
+    BasecArrayResult array_result  = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array         = NULL;
+    u64              alignments[2] = {64, 4096};
+    u64              element[8]    = {0};
+    u64              count         = 0;
+    bool             aligned       = true;
+    bool             matched       = true;
+
+    // 64 byte elements, grown from the heap into a mapping
+    count = BASEC_MEMORY_MAP_THRESHOLD / sizeof(element) * 2;
+    for (u64 a = 0; a < 2; a++) {
+        array_result = basec_array_create_aligned(
+            &array,
+            sizeof(element),
+            3,
+            alignments[a]
+        );
+        if (array_result != BASEC_ARRAY_SUCCESS) break;
+
+        for (u64 i = 0; i < count; i++) {
+            element[0]   = i;
+            array_result = basec_array_append(array, element);
+            if (array_result != BASEC_ARRAY_SUCCESS) break;
+            aligned = aligned && (uintptr_t)array->data % alignments[a] == 0;
+        }
+        for (u64 i = 0; i < array->length; i++) {
+            matched = matched && ((u64*)array->data)[i * 8] == i;
+        }
+        if (array->length != count || !array->mapped) matched = false;
+        (void)basec_array_destroy(&array);
+        if (array_result != BASEC_ARRAY_SUCCESS) break;
+    }
+    if (array_result != BASEC_ARRAY_SUCCESS || !aligned || !matched) {
+        (void)strncpy(
+            fail_message,
+            "Aligned array lost its alignment or elements while growing",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_array_create_aligned(&array, sizeof(u64), 4, 48);
+    if (array_result != BASEC_ARRAY_INVALID_ALIGNMENT || array != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Creating array with alignment 48 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_array_create_aligned(
+        &array,
+        sizeof(u64),
+        4,
+        (u64)sysconf(_SC_PAGESIZE) * 2
+    );
+    if (array_result != BASEC_ARRAY_INVALID_ALIGNMENT || array != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Creating array aligned past a page succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test asking for huge pages before and after an array is mapped
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_advise_huge_pages(c_str fail_message) {
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      small        = NULL;
+    BasecArray*      large        = NULL;
+    u64              count        = BASEC_MEMORY_MAP_THRESHOLD / sizeof(u64);
+    bool             matched      = true;
+
+    array_result = basec_array_create(&small, sizeof(u64), 16);
+    if (array_result == BASEC_ARRAY_SUCCESS) {
+        array_result = basec_array_create(&large, sizeof(u64), count);
+    }
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (small != NULL) (void)basec_array_destroy(&small);
+        return false;
+    }
+
+    // The small array takes the advice once it grows into a mapping
+    (void)basec_array_advise_huge_pages(small);
+    (void)basec_array_advise_huge_pages(large);
+    for (u64 i = 0; i < count * 2; i++) {
+        (void)basec_array_append(small, &i);
+        (void)basec_array_append(large, &i);
+    }
+    for (u64 i = 0; i < count * 2; i++) {
+        matched = matched && ((u64*)small->data)[i] == i;
+        matched = matched && ((u64*)large->data)[i] == i;
+    }
+    if (
+        !small->huge_pages ||
+        !small->mapped ||
+        !large->mapped ||
+        small->length != count * 2 ||
+        !matched
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Array with huge pages lost elements while growing",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&small);
+        (void)basec_array_destroy(&large);
+        return false;
+    }
+    (void)basec_array_destroy(&small);
+    (void)basec_array_destroy(&large);
+
+    array_result = basec_array_advise_huge_pages(NULL);
+    if (array_result != BASEC_ARRAY_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Advising a NULL array succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
 /**
  * @brief Test the destruction of an array
  * @param fail_message The message to display if the test fails
@@ -1037,120 +2101,465 @@ bool test_array_destroy(c_str fail_message) {
         return false;
     }
     
-    array_result = basec_array_destroy(&array);
-    if (array_result != BASEC_ARRAY_SUCCESS) {
-        (void)strncpy(
-            fail_message,
-            "Failed to destroy array",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
-        return false;
+    array_result = basec_array_destroy(&array);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to destroy array",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_array_destroy(&array);
+    if (array_result != BASEC_ARRAY_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Double destroying array succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    
+    array_result = basec_array_destroy(NULL);
+    if (array_result != BASEC_ARRAY_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying NULL array succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Test the destruction of an array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result             = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test             = NULL;
+    BasecTest*       append_test             = NULL;
+    BasecTest*       push_test               = NULL;
+    BasecTest*       pop_test                = NULL;
+    BasecTest*       get_test                = NULL;
+    BasecTest*       set_test                = NULL;
+    BasecTest*       contains_test           = NULL;
+    BasecTest*       find_test               = NULL;
+    BasecTest*       find_all_test           = NULL;
+    BasecTest*       hash_element_test       = NULL;
+    BasecTest*       sort_test               = NULL;
+    BasecTest*       unique_sorted_test      = NULL;
+    BasecTest*       remove_test             = NULL;
+    BasecTest*       index_test              = NULL;
+    BasecTest*       nth_element_test        = NULL;
+    BasecTest*       top_k_test              = NULL;
+    BasecTest*       par_for_each_test       = NULL;
+    BasecTest*       par_map_test            = NULL;
+    BasecTest*       par_reduce_test         = NULL;
+    BasecTest*       par_inclusive_scan_test = NULL;
+    BasecTest*       par_sort_test           = NULL;
+    BasecTest*       par_radix_sort_test     = NULL;
+    BasecTest*       create_aligned_test     = NULL;
+    BasecTest*       huge_pages_test         = NULL;
+    BasecTest*       destroy_test            = NULL;
+    BasecTestModule* array_module            = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_array_create",
+        "Test the creation of an array",
+        &test_array_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &append_test,
+        "test_array_append",
+        "Test the appending of an element to an array",
+        &test_array_append
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &push_test,
+        "test_array_push",
+        "Test the pushing of an element to an array",
+        &test_array_push
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &pop_test,
+        "test_array_pop",
+        "Test the popping of an element from an array",
+        &test_array_pop
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &get_test,
+        "test_array_get",
+        "Test the getting of an element from an array",
+        &test_array_get
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &set_test,
+        "test_array_set",
+        "Test the setting of an element in an array",
+        &test_array_set
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &contains_test,
+        "test_array_contains",
+        "Test the checking of an element in an array",
+        &test_array_contains
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &find_test,
+        "test_array_find",
+        "Test the finding of an element in an array",
+        &test_array_find
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &find_all_test,
+        "test_array_find_all",
+        "Test the finding of all occurrences of an element in an array",
+        &test_array_find_all
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &hash_element_test,
+        "test_array_hash_element",
+        "Test hashing an element of an array",
+        &test_array_hash_element
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &sort_test,
+        "test_array_sort",
+        "Test sorting an array",
+        &test_array_sort
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &unique_sorted_test,
+        "test_array_unique_sorted",
+        "Test removing repeats from a sorted array",
+        &test_array_unique_sorted
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &remove_test,
+        "test_array_remove",
+        "Test removing elements from an array",
+        &test_array_remove
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        return test_result;
     }
-
-    array_result = basec_array_destroy(&array);
-    if (array_result != BASEC_ARRAY_NULL_POINTER) {
-        (void)strncpy(
-            fail_message,
-            "Double destroying array succeeded, expected failure",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
-        return false;
+    
+    test_result = basec_test_create(
+        &index_test,
+        "test_array_index",
+        "Test finding elements through an array's hash index",
+        &test_array_index
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        return test_result;
     }
     
-    array_result = basec_array_destroy(NULL);
-    if (array_result != BASEC_ARRAY_NULL_POINTER) {
-        (void)strncpy(
-            fail_message,
-            "Destroying NULL array succeeded, expected failure",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
-        return false;
+    test_result = basec_test_create(
+        &nth_element_test,
+        "test_array_nth_element",
+        "Test placing the nth element of an array",
+        &test_array_nth_element
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        return test_result;
     }
-    return true;
-}
-
-/**
- * @brief Test the destruction of an array
- * @param fail_message The message to display if the test fails
- * @return The result of the test
- */
-BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
-    BasecTestResult  test_result   = BASEC_TEST_SUCCESS;
-    BasecTest*       create_test   = NULL;
-    BasecTest*       append_test   = NULL;
-    BasecTest*       push_test     = NULL;
-    BasecTest*       pop_test      = NULL;
-    BasecTest*       get_test      = NULL;
-    BasecTest*       set_test      = NULL;
-    BasecTest*       contains_test = NULL;
-    BasecTest*       find_test     = NULL;
-    BasecTest*       find_all_test = NULL;
-    BasecTest*       destroy_test  = NULL;
-    BasecTestModule* array_module  = NULL;
-
+    
     test_result = basec_test_create(
-        &create_test,
-        "test_array_create",
-        "Test the creation of an array",
-        &test_array_create
+        &top_k_test,
+        "test_array_top_k",
+        "Test copying the first elements of an array in order",
+        &test_array_top_k
     );
-    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        return test_result;
+    }
     
     test_result = basec_test_create(
-        &append_test,
-        "test_array_append",
-        "Test the appending of an element to an array",
-        &test_array_append
+        &par_for_each_test,
+        "test_array_par_for_each",
+        "Test visiting every element of an array in parallel",
+        &test_array_par_for_each
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &push_test,
-        "test_array_push",
-        "Test the pushing of an element to an array",
-        &test_array_push
+        &par_map_test,
+        "test_array_par_map",
+        "Test mapping an array into an output array in parallel",
+        &test_array_par_map
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &pop_test,
-        "test_array_pop",
-        "Test the popping of an element from an array",
-        &test_array_pop
+        &par_reduce_test,
+        "test_array_par_reduce",
+        "Test reducing an array in parallel with an associative combiner",
+        &test_array_par_reduce
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
         (void)basec_test_destroy(&append_test);
         (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &get_test,
-        "test_array_get",
-        "Test the getting of an element from an array",
-        &test_array_get
+        &par_inclusive_scan_test,
+        "test_array_par_inclusive_scan",
+        "Test an inclusive scan of an array in parallel",
+        &test_array_par_inclusive_scan
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
         (void)basec_test_destroy(&append_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &set_test,
-        "test_array_set",
-        "Test the setting of an element in an array",
-        &test_array_set
+        &par_sort_test,
+        "test_array_par_sort",
+        "Test sorting an array in parallel with a comparator",
+        &test_array_par_sort
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1158,14 +2567,29 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&pop_test);
         (void)basec_test_destroy(&get_test);
+        (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &contains_test,
-        "test_array_contains",
-        "Test the checking of an element in an array",
-        &test_array_contains
+        &par_radix_sort_test,
+        "test_array_par_radix_sort",
+        "Test sorting an array by a u64 key in parallel",
+        &test_array_par_radix_sort
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1174,14 +2598,29 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&pop_test);
         (void)basec_test_destroy(&get_test);
         (void)basec_test_destroy(&set_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &find_test,
-        "test_array_find",
-        "Test the finding of an element in an array",
-        &test_array_find
+        &create_aligned_test,
+        "test_array_create_aligned",
+        "Test that aligned arrays stay aligned as they grow",
+        &test_array_create_aligned
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1191,14 +2630,29 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&get_test);
         (void)basec_test_destroy(&set_test);
         (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &find_all_test,
-        "test_array_find_all",
-        "Test the finding of all occurrences of an element in an array",
-        &test_array_find_all
+        &huge_pages_test,
+        "test_array_advise_huge_pages",
+        "Test asking for huge pages before and after an array is mapped",
+        &test_array_advise_huge_pages
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1209,6 +2663,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&set_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
         return test_result;
     }
     
@@ -1228,6 +2697,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         return test_result;
     }
 
@@ -1245,6 +2729,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         return test_result;
     }
@@ -1260,6 +2759,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
@@ -1275,6 +2789,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
@@ -1289,6 +2818,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
@@ -1302,6 +2846,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
@@ -1314,6 +2873,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
@@ -1325,6 +2899,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
@@ -1335,6 +2924,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
@@ -1344,6 +2948,21 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
@@ -1352,11 +2971,251 @@ BasecTestResult test_array_add_tests(BasecTestSuite* test_suite) {
     test_result = basec_test_module_add_test(array_module, find_all_test);
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_module_destroy(&array_module);
         return test_result;
     }
-
+    
+    test_result = basec_test_module_add_test(array_module, hash_element_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&hash_element_test);
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, sort_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&sort_test);
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, unique_sorted_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&unique_sorted_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, remove_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, index_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&index_test);
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, nth_element_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&nth_element_test);
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, top_k_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&top_k_test);
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, par_for_each_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&par_for_each_test);
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, par_map_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&par_map_test);
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, par_reduce_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&par_reduce_test);
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, par_inclusive_scan_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&par_inclusive_scan_test);
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, par_sort_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&par_sort_test);
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, par_radix_sort_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&par_radix_sort_test);
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, create_aligned_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_aligned_test);
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(array_module, huge_pages_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&huge_pages_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&array_module);
+        return test_result;
+    }
+    
     test_result = basec_test_module_add_test(array_module, destroy_test);
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&destroy_test);
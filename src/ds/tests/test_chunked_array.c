@@ -0,0 +1,527 @@
+#include "ds/tests/test_chunked_array.h"
+
+/**
+ * @brief Test the creation of chunked arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_create(c_str fail_message) {
+    BasecChunkedArrayResult array_result = BASEC_CHUNKED_ARRAY_SUCCESS;
+    BasecChunkedArray*      array        = NULL;
+
+    array_result = basec_chunked_array_create(&array, sizeof(u64), 1000);
+    if (
+        array_result != BASEC_CHUNKED_ARRAY_SUCCESS ||
+        array->block_capacity != 1024 ||
+        array->block_shift != 10 ||
+        array->length != 0 ||
+        array->blocks->length != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Chunked array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (array != NULL) (void)basec_chunked_array_destroy(&array);
+        return false;
+    }
+    (void)basec_chunked_array_destroy(&array);
+
+    array_result = basec_chunked_array_create(&array, 0, 16);
+    if (array_result != BASEC_CHUNKED_ARRAY_INVALID_ELEMENT_SIZE) {
+        (void)strncpy(
+            fail_message,
+            "Creating array with element size 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_chunked_array_create(&array, sizeof(u64), 0);
+    if (array_result != BASEC_CHUNKED_ARRAY_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Creating array with block capacity 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test appending and getting elements across blocks
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_append(c_str fail_message) {
+    BasecChunkedArrayResult array_result = BASEC_CHUNKED_ARRAY_SUCCESS;
+    BasecChunkedArray*      array        = NULL;
+    u64                     element      = 0;
+    void*                   first        = NULL;
+    void*                   address      = NULL;
+    bool                    matched      = true;
+
+    array_result = basec_chunked_array_create(&array, sizeof(u64), 8);
+    if (array_result != BASEC_CHUNKED_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Chunked array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)basec_chunked_array_append(array, &element);
+    (void)basec_chunked_array_at(array, 0, &first);
+    for (u64 i = 1; i < 100; i++) {
+        array_result = basec_chunked_array_append(array, &i);
+        if (array_result != BASEC_CHUNKED_ARRAY_SUCCESS) break;
+    }
+    for (u64 i = 0; i < 100; i++) {
+        if (array_result != BASEC_CHUNKED_ARRAY_SUCCESS) break;
+        array_result = basec_chunked_array_get(array, i, &element);
+        matched      = matched && element == i;
+    }
+    (void)basec_chunked_array_at(array, 0, &address);
+    if (
+        array_result != BASEC_CHUNKED_ARRAY_SUCCESS ||
+        !matched ||
+        array->length != 100 ||
+        array->blocks->length != 13 ||
+        address != first
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Appending across blocks failed or moved elements",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_chunked_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_chunked_array_get(array, 100, &element);
+    (void)basec_chunked_array_destroy(&array);
+    if (array_result != BASEC_CHUNKED_ARRAY_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Getting past the end succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test appending batches that span several blocks
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_append_n(c_str fail_message) {
+    BasecChunkedArrayResult array_result  = BASEC_CHUNKED_ARRAY_SUCCESS;
+    BasecChunkedArray*      array         = NULL;
+    u32                     elements[100] = {0};
+    u32                     element       = 0;
+    bool                    matched       = true;
+
+    for (u32 i = 0; i < 100; i++) elements[i] = i;
+    array_result = basec_chunked_array_create(&array, sizeof(u32), 16);
+    if (array_result != BASEC_CHUNKED_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Chunked array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // 3 + 100 elements start mid block and end mid block
+    array_result = basec_chunked_array_append_n(array, elements, 3);
+    if (array_result == BASEC_CHUNKED_ARRAY_SUCCESS) {
+        array_result = basec_chunked_array_append_n(array, elements, 100);
+    }
+    for (u64 i = 0; i < 103; i++) {
+        if (array_result != BASEC_CHUNKED_ARRAY_SUCCESS) break;
+        array_result = basec_chunked_array_get(array, i, &element);
+        matched      = matched && element == (i < 3 ? i : i - 3);
+    }
+    if (
+        array_result != BASEC_CHUNKED_ARRAY_SUCCESS ||
+        !matched ||
+        array->length != 103 ||
+        array->blocks->length != 7
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Appending batches across blocks failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_chunked_array_destroy(&array);
+        return false;
+    }
+    (void)basec_chunked_array_destroy(&array);
+
+    return true;
+}
+
+/**
+ * @brief Test setting, popping and clearing elements
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_pop(c_str fail_message) {
+    BasecChunkedArrayResult array_result = BASEC_CHUNKED_ARRAY_SUCCESS;
+    BasecChunkedArray*      array        = NULL;
+    u64                     element      = 0;
+    u64                     length       = 0;
+    bool                    matched      = true;
+
+    array_result = basec_chunked_array_create(&array, sizeof(u64), 4);
+    if (array_result != BASEC_CHUNKED_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Chunked array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 10; i++) (void)basec_chunked_array_append(array, &i);
+    for (u64 i = 0; i < 10; i++) {
+        element = i * 10;
+        (void)basec_chunked_array_set(array, i, &element);
+    }
+    for (u64 i = 10; i > 0; i--) {
+        array_result = basec_chunked_array_pop(array, &element);
+        matched      = matched && element == (i - 1) * 10;
+    }
+    array_result = basec_chunked_array_pop(array, &element);
+    if (array_result != BASEC_CHUNKED_ARRAY_EMPTY || !matched) {
+        (void)strncpy(
+            fail_message,
+            "Setting and popping elements failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_chunked_array_destroy(&array);
+        return false;
+    }
+
+    // Emptied blocks are reused instead of allocating new ones
+    for (u64 i = 0; i < 12; i++) (void)basec_chunked_array_append(array, &i);
+    (void)basec_chunked_array_clear(array);
+    for (u64 i = 0; i < 12; i++) (void)basec_chunked_array_append(array, &i);
+    (void)basec_chunked_array_length(array, &length);
+    if (length != 12 || array->blocks->length != 3) {
+        (void)strncpy(
+            fail_message,
+            "Appending after clearing did not reuse the blocks",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_chunked_array_destroy(&array);
+        return false;
+    }
+
+    array_result = basec_chunked_array_set(array, 12, &element);
+    (void)basec_chunked_array_destroy(&array);
+    if (array_result != BASEC_CHUNKED_ARRAY_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Setting past the end succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test copying a chunked array into a contiguous array
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_flatten(c_str fail_message) {
+    BasecChunkedArrayResult array_result = BASEC_CHUNKED_ARRAY_SUCCESS;
+    BasecChunkedArray*      array        = NULL;
+    BasecArray*             flat         = NULL;
+    bool                    matched      = true;
+
+    array_result = basec_chunked_array_create(&array, sizeof(u64), 16);
+    if (array_result != BASEC_CHUNKED_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Chunked array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_array_flatten(array, &flat);
+    if (
+        array_result != BASEC_CHUNKED_ARRAY_SUCCESS ||
+        flat->length != 0 ||
+        flat->element_size != sizeof(u64)
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Flattening an empty chunked array failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (flat != NULL) (void)basec_array_destroy(&flat);
+        (void)basec_chunked_array_destroy(&array);
+        return false;
+    }
+
+    // The flattened array replaces the one already in array_out
+    for (u64 i = 0; i < 1000; i++) (void)basec_chunked_array_append(array, &i);
+    array_result = basec_array_flatten(array, &flat);
+    for (u64 i = 0; flat != NULL && i < flat->length; i++) {
+        matched = matched && ((u64*)flat->data)[i] == i;
+    }
+    if (
+        array_result != BASEC_CHUNKED_ARRAY_SUCCESS ||
+        flat->length != 1000 ||
+        array->length != 1000 ||
+        !matched
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Flattened array did not hold the elements in order",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (flat != NULL) (void)basec_array_destroy(&flat);
+        (void)basec_chunked_array_destroy(&array);
+        return false;
+    }
+    (void)basec_array_destroy(&flat);
+    (void)basec_chunked_array_destroy(&array);
+
+    return true;
+}
+
+/**
+ * @brief Test the destruction of chunked arrays
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_chunked_array_destroy(c_str fail_message) {
+    BasecChunkedArrayResult array_result = BASEC_CHUNKED_ARRAY_SUCCESS;
+    BasecChunkedArray*      array        = NULL;
+
+    (void)basec_chunked_array_create(&array, sizeof(u64), 4);
+    for (u64 i = 0; i < 100; i++) (void)basec_chunked_array_append(array, &i);
+
+    array_result = basec_chunked_array_destroy(&array);
+    if (array_result != BASEC_CHUNKED_ARRAY_SUCCESS || array != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Chunked array destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_chunked_array_destroy(&array);
+    if (array_result != BASEC_CHUNKED_ARRAY_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying a destroyed array succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add ChunkedArray tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_chunked_array_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result          = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test          = NULL;
+    BasecTest*       append_test          = NULL;
+    BasecTest*       append_n_test        = NULL;
+    BasecTest*       pop_test             = NULL;
+    BasecTest*       flatten_test         = NULL;
+    BasecTest*       destroy_test         = NULL;
+    BasecTestModule* chunked_array_module = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_chunked_array_create",
+        "Test the creation of chunked arrays",
+        &test_chunked_array_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &append_test,
+        "test_chunked_array_append",
+        "Test appending and getting elements across blocks",
+        &test_chunked_array_append
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &append_n_test,
+        "test_chunked_array_append_n",
+        "Test appending batches that span several blocks",
+        &test_chunked_array_append_n
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &pop_test,
+        "test_chunked_array_pop",
+        "Test setting, popping and clearing elements",
+        &test_chunked_array_pop
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_n_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &flatten_test,
+        "test_chunked_array_flatten",
+        "Test copying a chunked array into a contiguous array",
+        &test_chunked_array_flatten
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_n_test);
+        (void)basec_test_destroy(&pop_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_chunked_array_destroy",
+        "Test the destruction of chunked arrays",
+        &test_chunked_array_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_n_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&flatten_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &chunked_array_module,
+        "ChunkedArray"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_n_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&flatten_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(
+        chunked_array_module,
+        create_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_n_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&flatten_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&chunked_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        chunked_array_module,
+        append_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_n_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&flatten_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&chunked_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        chunked_array_module,
+        append_n_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&append_n_test);
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&flatten_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&chunked_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        chunked_array_module,
+        pop_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&pop_test);
+        (void)basec_test_destroy(&flatten_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&chunked_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        chunked_array_module,
+        flatten_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&flatten_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&chunked_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        chunked_array_module,
+        destroy_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&chunked_array_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(
+        test_suite,
+        chunked_array_module
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&chunked_array_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
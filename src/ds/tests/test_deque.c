@@ -0,0 +1,449 @@
+#include "ds/tests/test_deque.h"
+
+/**
+ * @brief Test the creation of a deque
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_create(c_str fail_message) {
+    BasecDequeResult deque_result = BASEC_DEQUE_SUCCESS;
+    BasecDeque*      deque        = NULL;
+
+    deque_result = basec_deque_create(&deque, sizeof(u32), 10);
+    if (deque_result != BASEC_DEQUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Deque creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (
+        deque->element_size != sizeof(u32) ||
+        deque->capacity != 16 ||
+        deque->length != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Deque fields do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_deque_destroy(&deque);
+        return false;
+    }
+    (void)basec_deque_destroy(&deque);
+
+    deque_result = basec_deque_create(&deque, 0, 10);
+    if (deque_result != BASEC_DEQUE_INVALID_ELEMENT_SIZE) {
+        (void)strncpy(
+            fail_message,
+            "Creating deque with element size 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    deque_result = basec_deque_create(&deque, sizeof(u32), 0);
+    if (deque_result != BASEC_DEQUE_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Creating deque with capacity 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test pushing and popping at both ends of a deque
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_push_pop(c_str fail_message) {
+    BasecDequeResult deque_result = BASEC_DEQUE_SUCCESS;
+    BasecDeque*      deque        = NULL;
+    u32              element      = 0;
+
+    deque_result = basec_deque_create(&deque, sizeof(u32), 4);
+    if (deque_result != BASEC_DEQUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Deque creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // Pushing to the front wraps head around before the deque grows
+    for (u32 i = 0; i < 50; i++) {
+        element = 100 + i;
+        (void)basec_deque_push_back(deque, &element);
+        element = 99 - i;
+        (void)basec_deque_push_front(deque, &element);
+    }
+
+    for (u32 i = 0; i < 50; i++) {
+        deque_result = basec_deque_pop_front(deque, &element);
+        if (deque_result != BASEC_DEQUE_SUCCESS || element != 50 + i) {
+            (void)strncpy(
+                fail_message,
+                "Elements popped from the front are incorrect",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_deque_destroy(&deque);
+            return false;
+        }
+
+        deque_result = basec_deque_pop_back(deque, &element);
+        if (deque_result != BASEC_DEQUE_SUCCESS || element != 149 - i) {
+            (void)strncpy(
+                fail_message,
+                "Elements popped from the back are incorrect",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_deque_destroy(&deque);
+            return false;
+        }
+    }
+
+    deque_result = basec_deque_pop_front(deque, &element);
+    if (deque_result != BASEC_DEQUE_EMPTY) {
+        (void)strncpy(
+            fail_message,
+            "Popping from an empty deque succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_deque_destroy(&deque);
+        return false;
+    }
+
+    (void)basec_deque_destroy(&deque);
+    return true;
+}
+
+/**
+ * @brief Test pushing and popping several elements of a deque at once
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_bulk(c_str fail_message) {
+    BasecDequeResult deque_result = BASEC_DEQUE_SUCCESS;
+    BasecDeque*      deque        = NULL;
+    u32              elements[20] = {0};
+    u32              popped[20]   = {0};
+    u32              element      = 0;
+
+    deque_result = basec_deque_create(&deque, sizeof(u32), 16);
+    if (deque_result != BASEC_DEQUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Deque creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u32 i = 0; i < 20; i++) elements[i] = i;
+
+    // Move head to the middle, so the next push wraps and then grows
+    (void)basec_deque_push_back_n(deque, elements, 10);
+    (void)basec_deque_pop_front_n(deque, NULL, 10);
+    (void)basec_deque_push_back_n(deque, elements, 12);
+    deque_result = basec_deque_push_back_n(deque, elements + 12, 8);
+    if (deque_result != BASEC_DEQUE_SUCCESS || deque->length != 20) {
+        (void)strncpy(
+            fail_message,
+            "Failed to push elements to deque",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_deque_destroy(&deque);
+        return false;
+    }
+
+    for (u64 i = 0; i < 20; i++) {
+        (void)basec_deque_get(deque, i, &element);
+        if (element != i) {
+            (void)strncpy(
+                fail_message,
+                "Elements are out of order after growing",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_deque_destroy(&deque);
+            return false;
+        }
+    }
+
+    deque_result = basec_deque_pop_front_n(deque, popped, 20);
+    if (
+        deque_result != BASEC_DEQUE_SUCCESS ||
+        deque->length != 0 ||
+        memcmp(popped, elements, sizeof(elements)) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Elements popped from deque are incorrect",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_deque_destroy(&deque);
+        return false;
+    }
+
+    deque_result = basec_deque_pop_front_n(deque, popped, 1);
+    if (deque_result != BASEC_DEQUE_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Popping past the back of the deque succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_deque_destroy(&deque);
+        return false;
+    }
+
+    (void)basec_deque_destroy(&deque);
+    return true;
+}
+
+/**
+ * @brief Test viewing the elements of a deque as two segments
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_segments(c_str fail_message) {
+    BasecDequeResult   deque_result = BASEC_DEQUE_SUCCESS;
+    BasecDeque*        deque        = NULL;
+    BasecDequeSegments segments     = {0};
+    u32                elements[8]  = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    deque_result = basec_deque_create(&deque, sizeof(u32), 8);
+    if (deque_result != BASEC_DEQUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Deque creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)basec_deque_push_back_n(deque, elements, 4);
+    (void)basec_deque_segments(deque, &segments);
+    if (
+        segments.first_length != 4 ||
+        segments.second != NULL ||
+        segments.second_length != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Unwrapped deque is not a single segment",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_deque_destroy(&deque);
+        return false;
+    }
+
+    // Head at 3 with 7 elements leaves 5 before the end of the ring
+    (void)basec_deque_pop_front_n(deque, NULL, 3);
+    (void)basec_deque_push_back_n(deque, elements + 4, 4);
+    (void)basec_deque_push_back_n(deque, elements, 2);
+    (void)basec_deque_segments(deque, &segments);
+    if (
+        segments.first_length != 5 ||
+        segments.second_length != 2 ||
+        memcmp(segments.first, (u32[]){3, 4, 5, 6, 7}, 5 * sizeof(u32)) != 0 ||
+        memcmp(segments.second, (u32[]){0, 1}, 2 * sizeof(u32)) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Wrapped deque segments are incorrect",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_deque_destroy(&deque);
+        return false;
+    }
+
+    (void)basec_deque_destroy(&deque);
+    return true;
+}
+
+/**
+ * @brief Test the destruction of a deque
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_deque_destroy(c_str fail_message) {
+    BasecDequeResult deque_result = BASEC_DEQUE_SUCCESS;
+    BasecDeque*      deque        = NULL;
+
+    deque_result = basec_deque_create(&deque, sizeof(u32), 8);
+    if (deque_result != BASEC_DEQUE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Deque creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    deque_result = basec_deque_destroy(&deque);
+    if (deque_result != BASEC_DEQUE_SUCCESS || deque != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Deque destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    deque_result = basec_deque_destroy(&deque);
+    if (deque_result != BASEC_DEQUE_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying a destroyed deque succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add Deque tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_deque_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result   = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test   = NULL;
+    BasecTest*       push_pop_test = NULL;
+    BasecTest*       bulk_test     = NULL;
+    BasecTest*       segments_test = NULL;
+    BasecTest*       destroy_test  = NULL;
+    BasecTestModule* deque_module  = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_deque_create",
+        "Test the creation of a deque",
+        &test_deque_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &push_pop_test,
+        "test_deque_push_pop",
+        "Test pushing and popping at both ends of a deque",
+        &test_deque_push_pop
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &bulk_test,
+        "test_deque_bulk",
+        "Test pushing and popping several elements of a deque at once",
+        &test_deque_bulk
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &segments_test,
+        "test_deque_segments",
+        "Test viewing the elements of a deque as two segments",
+        &test_deque_segments
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&bulk_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_deque_destroy",
+        "Test the destruction of a deque",
+        &test_deque_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&bulk_test);
+        (void)basec_test_destroy(&segments_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &deque_module,
+        "Deque"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&bulk_test);
+        (void)basec_test_destroy(&segments_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(deque_module, create_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&bulk_test);
+        (void)basec_test_destroy(&segments_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&deque_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(deque_module, push_pop_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&bulk_test);
+        (void)basec_test_destroy(&segments_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&deque_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(deque_module, bulk_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&bulk_test);
+        (void)basec_test_destroy(&segments_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&deque_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(deque_module, segments_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&segments_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&deque_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(deque_module, destroy_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&deque_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, deque_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&deque_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,602 @@
+#include "ds/tests/test_hashmap.h"
+
+/**
+ * @brief Test the creation of a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_create(c_str fail_message) {
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+    BasecHashMap*      map        = NULL;
+
+    map_result = basec_hashmap_create(&map, sizeof(u64), sizeof(u32), 100);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (
+        map->length != 0 ||
+        map->capacity < 100 ||
+        (map->capacity & (map->capacity - 1)) != 0 ||
+        map->value_offset != sizeof(u64)
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Hash map fields do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+    (void)basec_hashmap_destroy(&map);
+
+    map_result = basec_hashmap_create(&map, 0, sizeof(u32), 100);
+    if (map_result != BASEC_HASHMAP_INVALID_KEY_SIZE) {
+        (void)strncpy(
+            fail_message,
+            "Creating hash map with no key size succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    map_result = basec_hashmap_create(&map, sizeof(u64), sizeof(u32), 0);
+    if (map_result != BASEC_HASHMAP_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Creating hash map with no capacity succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    map_result = basec_hashmap_create(NULL, sizeof(u64), sizeof(u32), 100);
+    if (map_result != BASEC_HASHMAP_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Creating hash map with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test inserting entries into a hash map and getting them back
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_insert(c_str fail_message) {
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+    BasecHashMap*      map        = NULL;
+    u64                value      = 0;
+
+    map_result = basec_hashmap_create(&map, sizeof(u64), sizeof(u64), 1);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // Enough entries to grow the table several times
+    for (u64 key = 0; key < 1000; key++) {
+        value      = key * key;
+        map_result = basec_hashmap_insert(map, &key, &value);
+        if (map_result != BASEC_HASHMAP_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "Hash map insertion failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_hashmap_destroy(&map);
+            return false;
+        }
+    }
+
+    for (u64 key = 0; key < 1000; key++) {
+        map_result = basec_hashmap_get(map, &key, &value);
+        if (map_result != BASEC_HASHMAP_SUCCESS || value != key * key) {
+            (void)strncpy(
+                fail_message,
+                "Value does not match expected value",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_hashmap_destroy(&map);
+            return false;
+        }
+    }
+
+    value      = 7;
+    map_result = basec_hashmap_insert(map, &(u64){10}, &value);
+    if (map_result == BASEC_HASHMAP_SUCCESS) {
+        map_result = basec_hashmap_get(map, &(u64){10}, &value);
+    }
+    if (
+        map_result != BASEC_HASHMAP_SUCCESS ||
+        value != 7 ||
+        map->length != 1000
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Inserting an existing key did not replace its value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    map_result = basec_hashmap_get(map, &(u64){1000}, &value);
+    if (map_result != BASEC_HASHMAP_NOT_FOUND) {
+        (void)strncpy(
+            fail_message,
+            "Found a key that was never inserted",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    map_result = basec_hashmap_insert(map, &(u64){1}, NULL);
+    if (map_result != BASEC_HASHMAP_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Inserting with NULL value succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    map_result = basec_hashmap_destroy(&map);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash map destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test removing entries from a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_remove(c_str fail_message) {
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+    BasecHashMap*      map        = NULL;
+    bool               contains   = false;
+    u64                capacity   = 0;
+
+    map_result = basec_hashmap_create(&map, sizeof(u32), 0, 64);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    capacity = map->capacity;
+
+    // Churning through many keys must reuse deleted slots, not grow the table
+    for (u32 key = 0; key < 10000; key++) {
+        map_result = basec_hashmap_insert(map, &key, NULL);
+        if (map_result == BASEC_HASHMAP_SUCCESS && key >= 32) {
+            map_result = basec_hashmap_remove(map, &(u32){key - 32});
+        }
+        if (map_result != BASEC_HASHMAP_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "Inserting and removing keys failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_hashmap_destroy(&map);
+            return false;
+        }
+    }
+
+    if (map->length != 32 || map->capacity != capacity) {
+        (void)strncpy(
+            fail_message,
+            "Hash map size does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    (void)basec_hashmap_contains(map, &(u32){9967}, &contains);
+    if (contains) {
+        (void)strncpy(
+            fail_message,
+            "Hash map contains a removed key",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    (void)basec_hashmap_contains(map, &(u32){9968}, &contains);
+    if (!contains) {
+        (void)strncpy(
+            fail_message,
+            "Hash map does not contain an existing key",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    map_result = basec_hashmap_remove(map, &(u32){0});
+    if (map_result != BASEC_HASHMAP_NOT_FOUND) {
+        (void)strncpy(
+            fail_message,
+            "Removing a missing key succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    map_result = basec_hashmap_destroy(&map);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash map destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test reserving room in a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_reserve(c_str fail_message) {
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+    BasecHashMap*      map        = NULL;
+    u64                capacity   = 0;
+    u64                value      = 0;
+
+    map_result = basec_hashmap_create(&map, sizeof(u64), sizeof(u64), 1);
+    if (map_result == BASEC_HASHMAP_SUCCESS) {
+        map_result = basec_hashmap_insert(map, &(u64){5}, &(u64){25});
+    }
+    if (map_result == BASEC_HASHMAP_SUCCESS) {
+        map_result = basec_hashmap_reserve(map, 5000);
+    }
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Reserving room in hash map failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (map != NULL) (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    capacity = map->capacity;
+    for (u64 key = 0; key < 5000; key++) {
+        (void)basec_hashmap_insert(map, &key, &key);
+    }
+    if (map->capacity != capacity) {
+        (void)strncpy(
+            fail_message,
+            "Hash map grew after reserving room",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    map_result = basec_hashmap_get(map, &(u64){4999}, &value);
+    if (map_result != BASEC_HASHMAP_SUCCESS || value != 4999) {
+        (void)strncpy(
+            fail_message,
+            "Value does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    (void)basec_hashmap_destroy(&map);
+    return true;
+}
+
+/**
+ * @brief Test iterating over the entries of a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_iterator(c_str fail_message) {
+    BasecHashMapResult   map_result = BASEC_HASHMAP_SUCCESS;
+    BasecHashMap*        map        = NULL;
+    BasecHashMapIterator iterator   = {0};
+    void*                key        = NULL;
+    void*                value      = NULL;
+    u64                  key_sum    = 0;
+    u64                  count      = 0;
+
+    map_result = basec_hashmap_create(&map, sizeof(u64), sizeof(u64), 16);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 1; i <= 100; i++) {
+        (void)basec_hashmap_insert(map, &i, &(u64){i * 2});
+    }
+    (void)basec_hashmap_remove(map, &(u64){50});
+
+    (void)basec_hashmap_iterator(map, &iterator);
+    while (
+        (map_result = basec_hashmap_next(&iterator, &key, &value)) ==
+        BASEC_HASHMAP_SUCCESS
+    ) {
+        if (*(u64*)value != *(u64*)key * 2) break;
+        key_sum += *(u64*)key;
+        count++;
+    }
+
+    if (
+        map_result != BASEC_HASHMAP_END_OF_MAP ||
+        count != 99 ||
+        key_sum != 5050 - 50
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Iterated entries do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    map_result = basec_hashmap_next(&iterator, &key, &value);
+    if (map_result != BASEC_HASHMAP_END_OF_MAP) {
+        (void)strncpy(
+            fail_message,
+            "Iterator continued past the end of the map",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashmap_destroy(&map);
+        return false;
+    }
+
+    (void)basec_hashmap_destroy(&map);
+    return true;
+}
+
+/**
+ * @brief Test the destruction of a hash map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashmap_destroy(c_str fail_message) {
+    BasecHashMapResult map_result = BASEC_HASHMAP_SUCCESS;
+    BasecHashMap*      map        = NULL;
+
+    map_result = basec_hashmap_create(&map, sizeof(u64), sizeof(u64), 16);
+    if (map_result != BASEC_HASHMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    map_result = basec_hashmap_destroy(&map);
+    if (map_result != BASEC_HASHMAP_SUCCESS || map != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Hash map destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    map_result = basec_hashmap_destroy(&map);
+    if (map_result != BASEC_HASHMAP_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying NULL hash map succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add HashMap tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+
+BasecTestResult test_hashmap_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result    = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test    = NULL;
+    BasecTest*       insert_test    = NULL;
+    BasecTest*       remove_test    = NULL;
+    BasecTest*       reserve_test   = NULL;
+    BasecTest*       iterator_test  = NULL;
+    BasecTest*       destroy_test   = NULL;
+    BasecTestModule* hashmap_module = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_hashmap_create",
+        "Test the creation of a hash map",
+        &test_hashmap_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &insert_test,
+        "test_hashmap_insert",
+        "Test inserting entries into a hash map and getting them back",
+        &test_hashmap_insert
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &remove_test,
+        "test_hashmap_remove",
+        "Test removing entries from a hash map",
+        &test_hashmap_remove
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &reserve_test,
+        "test_hashmap_reserve",
+        "Test reserving room in a hash map",
+        &test_hashmap_reserve
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &iterator_test,
+        "test_hashmap_iterator",
+        "Test iterating over the entries of a hash map",
+        &test_hashmap_iterator
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&reserve_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_hashmap_destroy",
+        "Test the destruction of a hash map",
+        &test_hashmap_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&reserve_test);
+        (void)basec_test_destroy(&iterator_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &hashmap_module,
+        "HashMap"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&reserve_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(hashmap_module, create_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&reserve_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashmap_module, insert_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&reserve_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashmap_module, remove_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&reserve_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashmap_module, reserve_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reserve_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashmap_module, iterator_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashmap_module, destroy_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, hashmap_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&hashmap_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
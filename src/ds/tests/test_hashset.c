@@ -0,0 +1,466 @@
+#include "ds/tests/test_hashset.h"
+
+/**
+ * @brief Test the creation of a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_create(c_str fail_message) {
+    BasecHashSetResult set_result = BASEC_HASHSET_SUCCESS;
+    BasecHashSet*      set        = NULL;
+
+    set_result = basec_hashset_create(&set, sizeof(u64), 100);
+    if (set_result != BASEC_HASHSET_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash set creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (set->element_size != sizeof(u64) || set->map->length != 0) {
+        (void)strncpy(
+            fail_message,
+            "Hash set fields do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashset_destroy(&set);
+        return false;
+    }
+    (void)basec_hashset_destroy(&set);
+
+    set_result = basec_hashset_create(&set, 0, 100);
+    if (set_result != BASEC_HASHSET_INVALID_ELEMENT_SIZE) {
+        (void)strncpy(
+            fail_message,
+            "Creating hash set with element size 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    set_result = basec_hashset_create(NULL, sizeof(u64), 100);
+    if (set_result != BASEC_HASHSET_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Creating hash set with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test inserting elements into a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_insert(c_str fail_message) {
+    BasecHashSetResult set_result = BASEC_HASHSET_SUCCESS;
+    BasecHashSet*      set        = NULL;
+    u64                element    = 0;
+    u64                length     = 0;
+    bool               inserted   = false;
+    bool               contains   = false;
+
+    set_result = basec_hashset_create(&set, sizeof(u64), 1);
+    if (set_result != BASEC_HASHSET_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash set creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // Every element is inserted twice, only the first insertion is new
+    for (u64 i = 0; i < 2000; i++) {
+        element    = i / 2;
+        set_result = basec_hashset_insert(set, &element, &inserted);
+        if (set_result != BASEC_HASHSET_SUCCESS || inserted != (i % 2 == 0)) {
+            (void)strncpy(
+                fail_message,
+                "Hash set insertion did not report new elements",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_hashset_destroy(&set);
+            return false;
+        }
+    }
+
+    element = 999;
+    (void)basec_hashset_contains(set, &element, &contains);
+    (void)basec_hashset_length(set, &length);
+    if (!contains || length != 1000) {
+        (void)strncpy(
+            fail_message,
+            "Hash set contents do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashset_destroy(&set);
+        return false;
+    }
+
+    element = 1000;
+    (void)basec_hashset_contains(set, &element, &contains);
+    (void)basec_hashset_destroy(&set);
+    if (contains) {
+        (void)strncpy(
+            fail_message,
+            "Hash set contains an element that was never inserted",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test removing elements from a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_remove(c_str fail_message) {
+    BasecHashSetResult set_result = BASEC_HASHSET_SUCCESS;
+    BasecHashSet*      set        = NULL;
+    u32                element    = 7;
+    bool               contains   = true;
+
+    set_result = basec_hashset_create(&set, sizeof(u32), 16);
+    if (set_result != BASEC_HASHSET_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash set creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)basec_hashset_insert(set, &element, NULL);
+    set_result = basec_hashset_remove(set, &element);
+    (void)basec_hashset_contains(set, &element, &contains);
+    if (set_result != BASEC_HASHSET_SUCCESS || contains) {
+        (void)strncpy(
+            fail_message,
+            "Hash set removal failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_hashset_destroy(&set);
+        return false;
+    }
+
+    set_result = basec_hashset_remove(set, &element);
+    (void)basec_hashset_destroy(&set);
+    if (set_result != BASEC_HASHSET_NOT_FOUND) {
+        (void)strncpy(
+            fail_message,
+            "Removing a missing element succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test iterating over the elements of a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_iterator(c_str fail_message) {
+    BasecHashSetResult   set_result = BASEC_HASHSET_SUCCESS;
+    BasecHashSet*        set        = NULL;
+    BasecHashSetIterator iterator   = {0};
+    void*                element    = NULL;
+    u64                  found      = 0;
+
+    set_result = basec_hashset_create(&set, sizeof(u8), 16);
+    if (set_result != BASEC_HASHSET_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash set creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u8 i = 0; i < 40; i++) (void)basec_hashset_insert(set, &i, NULL);
+
+    (void)basec_hashset_iterator(set, &iterator);
+    while (
+        (set_result = basec_hashset_next(&iterator, &element)) ==
+        BASEC_HASHSET_SUCCESS
+    ) {
+        found |= 1ULL << *(u8*)element;
+    }
+    (void)basec_hashset_destroy(&set);
+
+    if (set_result != BASEC_HASHSET_END_OF_SET || found != (1ULL << 40) - 1) {
+        (void)strncpy(
+            fail_message,
+            "Iterated elements do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test removing repeats from an array while keeping its order
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_array_unique(c_str fail_message) {
+    BasecHashSetResult set_result = BASEC_HASHSET_SUCCESS;
+    BasecArray*        array      = NULL;
+    u64                elements[] = {42, 7, 42, 3, 7, 7, 9, 3};
+    u64                unique[]   = {42, 7, 3, 9};
+
+    if (
+        basec_array_create(&array, sizeof(u64), 8) != BASEC_ARRAY_SUCCESS
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create array for unique test",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 8; i++) (void)basec_array_append(array, &elements[i]);
+
+    set_result = basec_array_unique(array);
+    if (
+        set_result != BASEC_HASHSET_SUCCESS ||
+        array->length != 4 ||
+        memcmp(array->data, unique, sizeof(unique)) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Unique elements are incorrect or out of order",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    (void)basec_array_destroy(&array);
+    return true;
+}
+
+/**
+ * @brief Test the destruction of a hash set
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hashset_destroy(c_str fail_message) {
+    BasecHashSetResult set_result = BASEC_HASHSET_SUCCESS;
+    BasecHashSet*      set        = NULL;
+
+    set_result = basec_hashset_create(&set, sizeof(u64), 16);
+    if (set_result != BASEC_HASHSET_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hash set creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    set_result = basec_hashset_destroy(&set);
+    if (set_result != BASEC_HASHSET_SUCCESS || set != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Hash set destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    set_result = basec_hashset_destroy(&set);
+    if (set_result != BASEC_HASHSET_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying NULL hash set succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add HashSet tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_hashset_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result       = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test       = NULL;
+    BasecTest*       insert_test       = NULL;
+    BasecTest*       remove_test       = NULL;
+    BasecTest*       iterator_test     = NULL;
+    BasecTest*       array_unique_test = NULL;
+    BasecTest*       destroy_test      = NULL;
+    BasecTestModule* hashset_module    = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_hashset_create",
+        "Test the creation of a hash set",
+        &test_hashset_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &insert_test,
+        "test_hashset_insert",
+        "Test inserting elements into a hash set",
+        &test_hashset_insert
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &remove_test,
+        "test_hashset_remove",
+        "Test removing elements from a hash set",
+        &test_hashset_remove
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &iterator_test,
+        "test_hashset_iterator",
+        "Test iterating over the elements of a hash set",
+        &test_hashset_iterator
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &array_unique_test,
+        "test_array_unique",
+        "Test removing repeats from an array while keeping its order",
+        &test_array_unique
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_hashset_destroy",
+        "Test the destruction of a hash set",
+        &test_hashset_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&array_unique_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &hashset_module,
+        "HashSet"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&array_unique_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(hashset_module, create_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&array_unique_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashset_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashset_module, insert_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&array_unique_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashset_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashset_module, remove_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&array_unique_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashset_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashset_module, iterator_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&array_unique_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashset_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashset_module, array_unique_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&array_unique_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashset_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hashset_module, destroy_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&hashset_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, hashset_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&hashset_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
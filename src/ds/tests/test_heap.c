@@ -0,0 +1,564 @@
+#include "ds/tests/test_heap.h"
+
+/**
+ * @brief Compare two u64 elements
+ * @param a The first element
+ * @param b The second element
+ * @return Negative if a is smaller, positive if b is, 0 if equal
+ */
+static i32 _test_heap_compare_u64(const void* a, const void* b) {
+    u64 left  = *(const u64*)a;
+    u64 right = *(const u64*)b;
+
+    return (left > right) - (left < right);
+}
+
+/**
+ * @brief Test the creation of a heap
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_create(c_str fail_message) {
+    BasecHeapResult heap_result = BASEC_HEAP_SUCCESS;
+    BasecHeap*      heap        = NULL;
+
+    heap_result = basec_heap_create(
+        &heap,
+        sizeof(u64),
+        16,
+        &_test_heap_compare_u64,
+        BASEC_HEAP_QUATERNARY
+    );
+    if (heap_result != BASEC_HEAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Heap creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (
+        heap->arity != BASEC_HEAP_QUATERNARY ||
+        heap->array->element_size != sizeof(u64) ||
+        heap->array->length != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Heap fields do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_heap_destroy(&heap);
+        return false;
+    }
+    (void)basec_heap_destroy(&heap);
+
+    heap_result = basec_heap_create(
+        &heap,
+        sizeof(u64),
+        16,
+        &_test_heap_compare_u64,
+        1
+    );
+    if (heap_result != BASEC_HEAP_INVALID_ARITY) {
+        (void)strncpy(
+            fail_message,
+            "Creating heap with arity 1 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    heap_result = basec_heap_create_keyed(
+        &heap,
+        sizeof(u64),
+        16,
+        4,
+        BASEC_HEAP_BINARY
+    );
+    if (heap_result != BASEC_HEAP_INVALID_KEY_OFFSET) {
+        (void)strncpy(
+            fail_message,
+            "Creating heap with key past the element succeeded",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test pushing and popping elements of binary and 4-ary heaps
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_push_pop(c_str fail_message) {
+    BasecHeapResult heap_result = BASEC_HEAP_SUCCESS;
+    BasecHeap*      heap        = NULL;
+    u64             arities[]   = {BASEC_HEAP_BINARY, BASEC_HEAP_QUATERNARY};
+    u64             element     = 0;
+
+    for (u64 a = 0; a < 2; a++) {
+        heap_result = basec_heap_create(
+            &heap,
+            sizeof(u64),
+            1,
+            &_test_heap_compare_u64,
+            arities[a]
+        );
+        if (heap_result != BASEC_HEAP_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "Heap creation failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            return false;
+        }
+
+        // A permutation of 0 to 999 with every value pushed twice
+        for (u64 i = 0; i < 2000; i++) {
+            element = (i * 389) % 1000;
+            heap_result = basec_heap_push(heap, &element);
+            if (heap_result != BASEC_HEAP_SUCCESS) {
+                (void)strncpy(
+                    fail_message,
+                    "Failed to push element to heap",
+                    BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+                );
+                (void)basec_heap_destroy(&heap);
+                return false;
+            }
+        }
+
+        for (u64 i = 0; i < 2000; i++) {
+            heap_result = basec_heap_pop(heap, &element);
+            if (heap_result != BASEC_HEAP_SUCCESS || element != i / 2) {
+                (void)strncpy(
+                    fail_message,
+                    "Popped elements are not in order",
+                    BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+                );
+                (void)basec_heap_destroy(&heap);
+                return false;
+            }
+        }
+
+        heap_result = basec_heap_pop(heap, &element);
+        if (heap_result != BASEC_HEAP_EMPTY) {
+            (void)strncpy(
+                fail_message,
+                "Popping from an empty heap succeeded, but should fail",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_heap_destroy(&heap);
+            return false;
+        }
+
+        (void)basec_heap_destroy(&heap);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test ordering a heap by a key inside its elements
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_keyed(c_str fail_message) {
+    BasecHeapResult heap_result = BASEC_HEAP_SUCCESS;
+    BasecHeap*      heap        = NULL;
+    u64             element[2]  = {0, 0};
+
+    heap_result = basec_heap_create_keyed(
+        &heap,
+        sizeof(element),
+        8,
+        sizeof(u64),
+        BASEC_HEAP_QUATERNARY
+    );
+    if (heap_result != BASEC_HEAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Keyed heap creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // The payload counts up while the key counts down
+    for (u64 i = 0; i < 100; i++) {
+        element[0] = i;
+        element[1] = 100 - i;
+        (void)basec_heap_push(heap, element);
+    }
+
+    for (u64 i = 0; i < 100; i++) {
+        heap_result = basec_heap_pop(heap, element);
+        if (
+            heap_result != BASEC_HEAP_SUCCESS ||
+            element[0] != 99 - i ||
+            element[1] != i + 1
+        ) {
+            (void)strncpy(
+                fail_message,
+                "Keyed elements are not popped in key order",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_heap_destroy(&heap);
+            return false;
+        }
+    }
+
+    (void)basec_heap_destroy(&heap);
+    return true;
+}
+
+/**
+ * @brief Test building a heap from an array of elements
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_push_array(c_str fail_message) {
+    BasecHeapResult  heap_result  = BASEC_HEAP_SUCCESS;
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecHeap*       heap         = NULL;
+    BasecArray*      elements     = NULL;
+    u64              element      = 0;
+    u64              length       = 0;
+
+    heap_result = basec_heap_create(
+        &heap,
+        sizeof(u64),
+        4,
+        &_test_heap_compare_u64,
+        BASEC_HEAP_QUATERNARY
+    );
+    array_result = basec_array_create(&elements, sizeof(u64), 500);
+    if (
+        heap_result != BASEC_HEAP_SUCCESS ||
+        array_result != BASEC_ARRAY_SUCCESS
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create heap for push_array test",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (heap != NULL) (void)basec_heap_destroy(&heap);
+        if (elements != NULL) (void)basec_array_destroy(&elements);
+        return false;
+    }
+
+    // Elements already in the heap must stay ordered with the new ones
+    element = 250;
+    (void)basec_heap_push(heap, &element);
+    for (u64 i = 0; i < 500; i++) {
+        element = (i * 211) % 500;
+        (void)basec_array_append(elements, &element);
+    }
+
+    heap_result = basec_heap_push_array(heap, elements);
+    (void)basec_heap_length(heap, &length);
+    if (heap_result != BASEC_HEAP_SUCCESS || length != 501) {
+        (void)strncpy(
+            fail_message,
+            "Failed to push array to heap",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_heap_destroy(&heap);
+        (void)basec_array_destroy(&elements);
+        return false;
+    }
+
+    for (u64 i = 0; i < 501; i++) {
+        (void)basec_heap_pop(heap, &element);
+        if (element != (i <= 250 ? i : i - 1)) {
+            (void)strncpy(
+                fail_message,
+                "Elements pushed from an array are not popped in order",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_heap_destroy(&heap);
+            (void)basec_array_destroy(&elements);
+            return false;
+        }
+    }
+
+    (void)basec_heap_destroy(&heap);
+    (void)basec_array_destroy(&elements);
+    return true;
+}
+
+/**
+ * @brief Test peeking at the first element of a heap
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_peek(c_str fail_message) {
+    BasecHeapResult heap_result = BASEC_HEAP_SUCCESS;
+    BasecHeap*      heap        = NULL;
+    u64             elements[]  = {42, 17, 99, 3, 58};
+    u64             element     = 0;
+    u64             length      = 0;
+
+    heap_result = basec_heap_create(
+        &heap,
+        sizeof(u64),
+        8,
+        &_test_heap_compare_u64,
+        BASEC_HEAP_BINARY
+    );
+    if (heap_result != BASEC_HEAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Heap creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    heap_result = basec_heap_peek(heap, &element);
+    if (heap_result != BASEC_HEAP_EMPTY) {
+        (void)strncpy(
+            fail_message,
+            "Peeking at an empty heap succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_heap_destroy(&heap);
+        return false;
+    }
+
+    for (u64 i = 0; i < 5; i++) (void)basec_heap_push(heap, &elements[i]);
+
+    heap_result = basec_heap_peek(heap, &element);
+    (void)basec_heap_length(heap, &length);
+    if (heap_result != BASEC_HEAP_SUCCESS || element != 3 || length != 5) {
+        (void)strncpy(
+            fail_message,
+            "Peeked element is incorrect or was removed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_heap_destroy(&heap);
+        return false;
+    }
+
+    (void)basec_heap_destroy(&heap);
+    return true;
+}
+
+/**
+ * @brief Test the destruction of a heap
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_heap_destroy(c_str fail_message) {
+    BasecHeapResult heap_result = BASEC_HEAP_SUCCESS;
+    BasecHeap*      heap        = NULL;
+
+    heap_result = basec_heap_create(
+        &heap,
+        sizeof(u64),
+        16,
+        &_test_heap_compare_u64,
+        BASEC_HEAP_BINARY
+    );
+    if (heap_result != BASEC_HEAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Heap creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    heap_result = basec_heap_destroy(&heap);
+    if (heap_result != BASEC_HEAP_SUCCESS || heap != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Heap destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    heap_result = basec_heap_destroy(&heap);
+    if (heap_result != BASEC_HEAP_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying a destroyed heap succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add Heap tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_heap_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result     = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test     = NULL;
+    BasecTest*       push_pop_test   = NULL;
+    BasecTest*       keyed_test      = NULL;
+    BasecTest*       push_array_test = NULL;
+    BasecTest*       peek_test       = NULL;
+    BasecTest*       destroy_test    = NULL;
+    BasecTestModule* heap_module     = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_heap_create",
+        "Test the creation of a heap",
+        &test_heap_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &push_pop_test,
+        "test_heap_push_pop",
+        "Test pushing and popping elements of binary and 4-ary heaps",
+        &test_heap_push_pop
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &keyed_test,
+        "test_heap_keyed",
+        "Test ordering a heap by a key inside its elements",
+        &test_heap_keyed
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &push_array_test,
+        "test_heap_push_array",
+        "Test building a heap from an array of elements",
+        &test_heap_push_array
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&keyed_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &peek_test,
+        "test_heap_peek",
+        "Test peeking at the first element of a heap",
+        &test_heap_peek
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&keyed_test);
+        (void)basec_test_destroy(&push_array_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_heap_destroy",
+        "Test the destruction of a heap",
+        &test_heap_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&keyed_test);
+        (void)basec_test_destroy(&push_array_test);
+        (void)basec_test_destroy(&peek_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &heap_module,
+        "Heap"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&keyed_test);
+        (void)basec_test_destroy(&push_array_test);
+        (void)basec_test_destroy(&peek_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(heap_module, create_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&keyed_test);
+        (void)basec_test_destroy(&push_array_test);
+        (void)basec_test_destroy(&peek_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&heap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(heap_module, push_pop_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&push_pop_test);
+        (void)basec_test_destroy(&keyed_test);
+        (void)basec_test_destroy(&push_array_test);
+        (void)basec_test_destroy(&peek_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&heap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(heap_module, keyed_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&keyed_test);
+        (void)basec_test_destroy(&push_array_test);
+        (void)basec_test_destroy(&peek_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&heap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(heap_module, push_array_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&push_array_test);
+        (void)basec_test_destroy(&peek_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&heap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(heap_module, peek_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&peek_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&heap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(heap_module, destroy_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&heap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, heap_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&heap_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
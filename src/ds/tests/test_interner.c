@@ -0,0 +1,577 @@
+#include "ds/tests/test_interner.h"
+
+/**
+ * @brief Test the creation of an interner
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_create(c_str fail_message) {
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecInterner*      interner        = NULL;
+    u64                 length          = 1;
+
+    interner_result = basec_interner_create(&interner);
+    if (interner_result != BASEC_INTERNER_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Interner creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)basec_interner_length(interner, &length);
+    if (length != 0) {
+        (void)strncpy(
+            fail_message,
+            "New interner is not empty",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_interner_destroy(&interner);
+        return false;
+    }
+    (void)basec_interner_destroy(&interner);
+
+    interner_result = basec_interner_create(NULL);
+    if (interner_result != BASEC_INTERNER_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Creating interner with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test interning strings and reading back their canonical views
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_intern(c_str fail_message) {
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecInterner*      interner        = NULL;
+    BasecStringView     string          = {0};
+    BasecStringView     view            = {0};
+    c8                  buffer[64];
+    u32                 atom            = 0;
+    u64                 length          = 0;
+
+    interner_result = basec_interner_create(&interner);
+    if (interner_result != BASEC_INTERNER_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Interner creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // 50 distinct tags among many tokens, enough atoms to fill a few segments
+    string.data = buffer;
+    for (u64 i = 0; i < 5000; i++) {
+        string.length = (u64)snprintf(
+            buffer,
+            sizeof(buffer),
+            "tag-%lu",
+            (unsigned long)(i < 1000 ? i % 50 : i)
+        );
+        interner_result = basec_interner_intern(interner, string, &atom);
+        if (
+            interner_result != BASEC_INTERNER_SUCCESS ||
+            atom != (i < 1000 ? i % 50 : i - 950)
+        ) {
+            (void)strncpy(
+                fail_message,
+                "Interned atom does not match expected value",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_interner_destroy(&interner);
+            return false;
+        }
+    }
+
+    (void)basec_interner_length(interner, &length);
+    interner_result = basec_interner_view(interner, 4049, &view);
+    if (
+        interner_result != BASEC_INTERNER_SUCCESS ||
+        length != 4050 ||
+        view.length != 8 ||
+        strcmp(view.data, "tag-4999") != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Canonical view does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_interner_destroy(&interner);
+        return false;
+    }
+
+    interner_result = basec_interner_view(interner, 4050, &view);
+    if (interner_result != BASEC_INTERNER_INVALID_ATOM) {
+        (void)strncpy(
+            fail_message,
+            "Viewing an unknown atom succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_interner_destroy(&interner);
+        return false;
+    }
+
+    (void)basec_interner_destroy(&interner);
+    return true;
+}
+
+/**
+ * @brief Test finding strings in an interner without adding them
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_find(c_str fail_message) {
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecInterner*      interner        = NULL;
+    BasecStringView     string          = {"content-type", 12};
+    u32                 atom            = 0;
+    u32                 found           = 0;
+    u64                 length          = 0;
+
+    interner_result = basec_interner_create(&interner);
+    if (interner_result != BASEC_INTERNER_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Interner creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    interner_result = basec_interner_find(interner, string, &found);
+    (void)basec_interner_length(interner, &length);
+    if (interner_result != BASEC_INTERNER_NOT_FOUND || length != 0) {
+        (void)strncpy(
+            fail_message,
+            "Finding a new string succeeded or added it",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_interner_destroy(&interner);
+        return false;
+    }
+
+    (void)basec_interner_intern(interner, string, &atom);
+    interner_result = basec_interner_find(interner, string, &found);
+    if (interner_result != BASEC_INTERNER_SUCCESS || found != atom) {
+        (void)strncpy(
+            fail_message,
+            "Found atom does not match interned atom",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_interner_destroy(&interner);
+        return false;
+    }
+
+    (void)basec_interner_destroy(&interner);
+    return true;
+}
+
+/**
+ * @struct _TestInternerWorker
+ * @brief The strings interned by one thread and the atoms it got for them
+ */
+typedef struct {
+    BasecInterner* interner;
+    u32            atoms[200];
+    u64            offset;
+} _TestInternerWorker;
+
+/**
+ * @brief Intern the same strings as other threads, in a different order
+ * @param arg The _TestInternerWorker of the thread
+ * @return NULL
+ */
+static void* _test_interner_worker(void* arg) {
+    _TestInternerWorker* worker = (_TestInternerWorker*)arg;
+    BasecStringView      string = {0};
+    c8                   buffer[64];
+    u64                  index  = 0;
+
+    string.data = buffer;
+    for (u64 i = 0; i < 200; i++) {
+        index         = (i + worker->offset) % 200;
+        string.length = (u64)snprintf(
+            buffer,
+            sizeof(buffer),
+            "a-field-name-longer-than-inline-%lu",
+            (unsigned long)index
+        );
+        if (
+            basec_interner_intern(
+                worker->interner,
+                string,
+                &worker->atoms[index]
+            ) != BASEC_INTERNER_SUCCESS
+        ) worker->atoms[index] = U32_MAX;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Test interning the same strings from several threads
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_threads(c_str fail_message) {
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecInterner*      interner        = NULL;
+    _TestInternerWorker workers[4];
+    pthread_t           threads[3];
+    u64                 length          = 0;
+    u64                 started         = 0;
+    bool                matches         = true;
+
+    interner_result = basec_interner_create(&interner);
+    if (interner_result != BASEC_INTERNER_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Interner creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // The first worker runs on this thread, alongside the others
+    for (u64 i = 0; i < 4; i++) {
+        workers[i].interner = interner;
+        workers[i].offset   = i * 50;
+    }
+    for (u64 i = 1; i < 4; i++) {
+        if (
+            pthread_create(
+                &threads[started],
+                NULL,
+                _test_interner_worker,
+                &workers[i]
+            ) == 0
+        ) started++;
+        else (void)_test_interner_worker(&workers[i]);
+    }
+    (void)_test_interner_worker(&workers[0]);
+    for (u64 i = 0; i < started; i++) (void)pthread_join(threads[i], NULL);
+
+    for (u64 i = 0; i < 200; i++) {
+        for (u64 j = 1; j < 4; j++) {
+            if (workers[j].atoms[i] != workers[0].atoms[i]) matches = false;
+        }
+    }
+
+    (void)basec_interner_length(interner, &length);
+    if (!matches || length != 200) {
+        (void)strncpy(
+            fail_message,
+            "Threads did not agree on the atoms of the strings",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_interner_destroy(&interner);
+        return false;
+    }
+
+    (void)basec_interner_destroy(&interner);
+    return true;
+}
+
+/**
+ * @brief Test splitting a string into atoms
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_split_interned(c_str fail_message) {
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecInterner*      interner        = NULL;
+    BasecString*        string          = NULL;
+    BasecArray*         atoms           = NULL;
+    BasecStringView     view            = {0};
+    u32                 expected[5]     = {0, 1, 2, 0, 1};
+
+    (void)basec_interner_create(&interner);
+    (void)basec_string_create(&string, "GET,,POST,GET,", 32);
+    if (interner == NULL || string == NULL) {
+        (void)strncpy(
+            fail_message,
+            "Interner or string creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (interner != NULL) (void)basec_interner_destroy(&interner);
+        if (string != NULL) (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    interner_result = basec_string_split_interned(
+        string,
+        ",",
+        interner,
+        &atoms
+    );
+    if (
+        interner_result != BASEC_INTERNER_SUCCESS ||
+        atoms->length != 5 ||
+        memcmp(atoms->data, expected, sizeof(expected)) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Split atoms do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (atoms != NULL) (void)basec_array_destroy(&atoms);
+        (void)basec_interner_destroy(&interner);
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    (void)basec_interner_view(interner, 2, &view);
+    if (view.length != 4 || strcmp(view.data, "POST") != 0) {
+        (void)strncpy(
+            fail_message,
+            "Split part does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&atoms);
+        (void)basec_interner_destroy(&interner);
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    interner_result = basec_string_split_interned(
+        string,
+        "",
+        interner,
+        &atoms
+    );
+    (void)basec_array_destroy(&atoms);
+    (void)basec_interner_destroy(&interner);
+    (void)basec_string_destroy(&string);
+    if (interner_result != BASEC_INTERNER_INVALID_DELIMITER) {
+        (void)strncpy(
+            fail_message,
+            "Splitting by an empty delimiter succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test the destruction of an interner
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_interner_destroy(c_str fail_message) {
+    BasecInternerResult interner_result = BASEC_INTERNER_SUCCESS;
+    BasecInterner*      interner        = NULL;
+
+    interner_result = basec_interner_create(&interner);
+    if (interner_result != BASEC_INTERNER_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Interner creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    interner_result = basec_interner_destroy(&interner);
+    if (interner_result != BASEC_INTERNER_SUCCESS || interner != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Interner destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    interner_result = basec_interner_destroy(&interner);
+    if (interner_result != BASEC_INTERNER_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying NULL interner succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add Interner tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_interner_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result                = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test                = NULL;
+    BasecTest*       intern_test                = NULL;
+    BasecTest*       find_test                  = NULL;
+    BasecTest*       threads_test               = NULL;
+    BasecTest*       string_split_interned_test = NULL;
+    BasecTest*       destroy_test               = NULL;
+    BasecTestModule* interner_module            = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_interner_create",
+        "Test the creation of an interner",
+        &test_interner_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &intern_test,
+        "test_interner_intern",
+        "Test interning strings and reading back their canonical views",
+        &test_interner_intern
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &find_test,
+        "test_interner_find",
+        "Test finding strings in an interner without adding them",
+        &test_interner_find
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&intern_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &threads_test,
+        "test_interner_threads",
+        "Intern the same strings as other threads, in a different order",
+        &test_interner_threads
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&intern_test);
+        (void)basec_test_destroy(&find_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &string_split_interned_test,
+        "test_string_split_interned",
+        "Test splitting a string into atoms",
+        &test_string_split_interned
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&intern_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&threads_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_interner_destroy",
+        "Test the destruction of an interner",
+        &test_interner_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&intern_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&string_split_interned_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &interner_module,
+        "Interner"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&intern_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&string_split_interned_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(interner_module, create_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&intern_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&string_split_interned_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&interner_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(interner_module, intern_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&intern_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&string_split_interned_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&interner_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(interner_module, find_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&string_split_interned_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&interner_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(interner_module, threads_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&threads_test);
+        (void)basec_test_destroy(&string_split_interned_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&interner_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        interner_module,
+        string_split_interned_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&string_split_interned_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&interner_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(interner_module, destroy_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&interner_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, interner_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&interner_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
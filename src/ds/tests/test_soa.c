@@ -0,0 +1,530 @@
+#include "ds/tests/test_soa.h"
+
+/**
+ * @struct _TestSoARecord
+ * @brief A record with fields of different sizes and padding after flag
+ */
+typedef struct {
+    u64 id;
+    f32 score;
+    u8  flag;
+} _TestSoARecord;
+
+/**
+ * @brief Test the creation of SoAs from field layouts
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_create(c_str fail_message) {
+    BasecSoAResult soa_result = BASEC_SOA_SUCCESS;
+    BasecSoA*      soa        = NULL;
+    BasecSoAField  fields[3]  = {
+        BASEC_SOA_FIELD(_TestSoARecord, id),
+        BASEC_SOA_FIELD(_TestSoARecord, score),
+        BASEC_SOA_FIELD(_TestSoARecord, flag),
+    };
+    BasecSoAField  overlap[2] = {{0, 8}, {4, 4}};
+    BasecSoAField  outside[1] = {{sizeof(_TestSoARecord) - 2, 4}};
+
+    soa_result = basec_soa_create(
+        &soa,
+        fields,
+        3,
+        sizeof(_TestSoARecord),
+        10
+    );
+    if (
+        soa_result != BASEC_SOA_SUCCESS ||
+        soa->field_count != 3 ||
+        soa->length != 0 ||
+        soa->columns[0]->element_size != sizeof(u64) ||
+        soa->columns[1]->element_size != sizeof(f32) ||
+        soa->columns[2]->element_size != sizeof(u8) ||
+        (uintptr_t)soa->columns[2]->data % BASEC_SOA_COLUMN_ALIGNMENT != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "SoA creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (soa != NULL) (void)basec_soa_destroy(&soa);
+        return false;
+    }
+    (void)basec_soa_destroy(&soa);
+
+    soa_result = basec_soa_create(&soa, overlap, 2, 16, 10);
+    if (soa_result != BASEC_SOA_INVALID_LAYOUT) {
+        (void)strncpy(
+            fail_message,
+            "Creating SoA with overlapping fields succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    soa_result = basec_soa_create(
+        &soa,
+        outside,
+        1,
+        sizeof(_TestSoARecord),
+        10
+    );
+    if (soa_result != BASEC_SOA_INVALID_LAYOUT) {
+        (void)strncpy(
+            fail_message,
+            "Creating SoA with a field past the row succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    soa_result = basec_soa_create(
+        &soa,
+        fields,
+        3,
+        sizeof(_TestSoARecord),
+        0
+    );
+    if (soa_result != BASEC_SOA_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Creating SoA with capacity 0 succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test appending rows and getting them back
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_append(c_str fail_message) {
+    BasecSoAResult soa_result = BASEC_SOA_SUCCESS;
+    BasecSoA*      soa        = NULL;
+    BasecSoAField  fields[3]  = {
+        BASEC_SOA_FIELD(_TestSoARecord, id),
+        BASEC_SOA_FIELD(_TestSoARecord, score),
+        BASEC_SOA_FIELD(_TestSoARecord, flag),
+    };
+    _TestSoARecord record     = {0};
+    u64            length     = 0;
+    bool           matched    = true;
+
+    soa_result = basec_soa_create(
+        &soa,
+        fields,
+        3,
+        sizeof(_TestSoARecord),
+        2
+    );
+    if (soa_result != BASEC_SOA_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "SoA creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // Appends past the capacity grow every column together
+    for (u64 i = 0; i < 100 && soa_result == BASEC_SOA_SUCCESS; i++) {
+        record.id    = i;
+        record.score = (f32)i / 2;
+        record.flag  = (u8)(i % 2);
+        soa_result   = basec_soa_append(soa, &record);
+    }
+    for (u64 i = 0; i < 100 && soa_result == BASEC_SOA_SUCCESS; i++) {
+        soa_result = basec_soa_get(soa, i, &record);
+        matched    = matched &&
+                     record.id == i &&
+                     record.score == (f32)i / 2 &&
+                     record.flag == (u8)(i % 2);
+    }
+    (void)basec_soa_length(soa, &length);
+    if (soa_result != BASEC_SOA_SUCCESS || !matched || length != 100) {
+        (void)strncpy(
+            fail_message,
+            "Rows did not come back as they were appended",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_soa_destroy(&soa);
+        return false;
+    }
+
+    soa_result = basec_soa_get(soa, 100, &record);
+    (void)basec_soa_destroy(&soa);
+    if (soa_result != BASEC_SOA_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Getting past the end succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test setting rows and reading fields through column spans
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_column(c_str fail_message) {
+    BasecSoAResult soa_result = BASEC_SOA_SUCCESS;
+    BasecSoA*      soa        = NULL;
+    BasecSoAField  fields[2]  = {
+        BASEC_SOA_FIELD(_TestSoARecord, score),
+        BASEC_SOA_FIELD(_TestSoARecord, id),
+    };
+    _TestSoARecord record     = {0};
+    BasecSoASpan   ids        = {0};
+    BasecSoASpan   scores     = {0};
+    u64            sum        = 0;
+    f32            total      = 0;
+
+    soa_result = basec_soa_create(
+        &soa,
+        fields,
+        2,
+        sizeof(_TestSoARecord),
+        16
+    );
+    if (soa_result != BASEC_SOA_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "SoA creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 10; i++) {
+        record.id    = i;
+        record.score = 1;
+        (void)basec_soa_append(soa, &record);
+    }
+    record.id    = 100;
+    record.score = 5;
+    soa_result   = basec_soa_set(soa, 3, &record);
+    if (soa_result == BASEC_SOA_SUCCESS) {
+        soa_result = basec_soa_column(soa, 1, &ids);
+    }
+    if (soa_result == BASEC_SOA_SUCCESS) {
+        soa_result = basec_soa_column(soa, 0, &scores);
+    }
+    for (u64 i = 0; soa_result == BASEC_SOA_SUCCESS && i < ids.length; i++) {
+        sum   += ((u64*)ids.data)[i];
+        total += ((f32*)scores.data)[i];
+    }
+    if (
+        soa_result != BASEC_SOA_SUCCESS ||
+        ids.length != 10 ||
+        ids.element_size != sizeof(u64) ||
+        scores.element_size != sizeof(f32) ||
+        sum != 45 - 3 + 100 ||
+        total != 14
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Column spans did not hold the fields of every row",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_soa_destroy(&soa);
+        return false;
+    }
+
+    soa_result = basec_soa_column(soa, 2, &ids);
+    if (soa_result == BASEC_SOA_INVALID_FIELD) {
+        soa_result = basec_soa_set(soa, 10, &record);
+    }
+    (void)basec_soa_destroy(&soa);
+    if (soa_result != BASEC_SOA_OUT_OF_BOUNDS) {
+        (void)strncpy(
+            fail_message,
+            "Getting a missing column or setting past the end succeeded",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test converting between an array of structs and a SoA
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_array(c_str fail_message) {
+    BasecSoAResult soa_result = BASEC_SOA_SUCCESS;
+    BasecSoA*      soa        = NULL;
+    BasecArray*    array      = NULL;
+    BasecArray*    copy       = NULL;
+    BasecSoAField  fields[3]  = {
+        BASEC_SOA_FIELD(_TestSoARecord, id),
+        BASEC_SOA_FIELD(_TestSoARecord, score),
+        BASEC_SOA_FIELD(_TestSoARecord, flag),
+    };
+    _TestSoARecord record     = {0};
+    _TestSoARecord row        = {0};
+    bool           matched    = true;
+
+    if (
+        basec_array_create(
+            &array,
+            sizeof(_TestSoARecord),
+            16
+        ) != BASEC_ARRAY_SUCCESS
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    for (u64 i = 0; i < 1000; i++) {
+        (void)memset(&record, 0, sizeof(record));
+        record.id    = i * 3;
+        record.score = (f32)i;
+        record.flag  = (u8)i;
+        (void)basec_array_append(array, &record);
+    }
+
+    // Both conversions replace what is already in their output
+    soa_result = basec_soa_from_array(array, fields, 3, &soa);
+    if (soa_result == BASEC_SOA_SUCCESS) {
+        soa_result = basec_soa_from_array(array, fields, 3, &soa);
+    }
+    if (soa_result == BASEC_SOA_SUCCESS) {
+        soa_result = basec_soa_to_array(soa, &copy);
+    }
+    if (soa_result == BASEC_SOA_SUCCESS) {
+        soa_result = basec_soa_to_array(soa, &copy);
+    }
+    for (u64 i = 0; soa_result == BASEC_SOA_SUCCESS && i < soa->length; i++) {
+        (void)basec_soa_get(soa, i, &row);
+        matched = matched && row.id == i * 3 && row.flag == (u8)i;
+    }
+    if (
+        soa_result != BASEC_SOA_SUCCESS ||
+        soa->length != 1000 ||
+        copy->length != 1000 ||
+        memcmp(copy->data, array->data, 1000 * sizeof(_TestSoARecord)) != 0 ||
+        !matched
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Records changed on the way through the SoA",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (soa != NULL) (void)basec_soa_destroy(&soa);
+        if (copy != NULL) (void)basec_array_destroy(&copy);
+        (void)basec_array_destroy(&array);
+        return false;
+    }
+    (void)basec_soa_destroy(&soa);
+    (void)basec_array_destroy(&copy);
+    (void)basec_array_destroy(&array);
+
+    return true;
+}
+
+/**
+ * @brief Test the destruction of SoAs
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_soa_destroy(c_str fail_message) {
+    BasecSoAResult soa_result = BASEC_SOA_SUCCESS;
+    BasecSoA*      soa        = NULL;
+    BasecSoAField  fields[1]  = {BASEC_SOA_FIELD(_TestSoARecord, id)};
+    _TestSoARecord record     = {0};
+
+    (void)basec_soa_create(&soa, fields, 1, sizeof(_TestSoARecord), 4);
+    for (u64 i = 0; i < 100; i++) (void)basec_soa_append(soa, &record);
+
+    soa_result = basec_soa_destroy(&soa);
+    if (soa_result != BASEC_SOA_SUCCESS || soa != NULL) {
+        (void)strncpy(
+            fail_message,
+            "SoA destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    soa_result = basec_soa_destroy(&soa);
+    if (soa_result != BASEC_SOA_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying a destroyed SoA succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add SoA tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_soa_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result  = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test  = NULL;
+    BasecTest*       append_test  = NULL;
+    BasecTest*       column_test  = NULL;
+    BasecTest*       array_test   = NULL;
+    BasecTest*       destroy_test = NULL;
+    BasecTestModule* soa_module   = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_soa_create",
+        "Test the creation of SoAs from field layouts",
+        &test_soa_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &append_test,
+        "test_soa_append",
+        "Test appending rows and getting them back",
+        &test_soa_append
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &column_test,
+        "test_soa_column",
+        "Test setting rows and reading fields through column spans",
+        &test_soa_column
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &array_test,
+        "test_soa_array",
+        "Test converting between an array of structs and a SoA",
+        &test_soa_array
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&column_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_soa_destroy",
+        "Test the destruction of SoAs",
+        &test_soa_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&column_test);
+        (void)basec_test_destroy(&array_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &soa_module,
+        "SoA"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&column_test);
+        (void)basec_test_destroy(&array_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(
+        soa_module,
+        create_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&column_test);
+        (void)basec_test_destroy(&array_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&soa_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        soa_module,
+        append_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&column_test);
+        (void)basec_test_destroy(&array_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&soa_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        soa_module,
+        column_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&column_test);
+        (void)basec_test_destroy(&array_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&soa_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        soa_module,
+        array_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&array_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&soa_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        soa_module,
+        destroy_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&soa_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(
+        test_suite,
+        soa_module
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&soa_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
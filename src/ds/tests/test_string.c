@@ -474,15 +474,15 @@ bool test_string_append(c_str fail_message) {
 }
 
 /**
- * @brief Test pushing a string to a string
+ * @brief Test appending unsigned integers to a string
  * @param fail_message The message to display if the test fails
  * @return The result of the test
  */
-bool test_string_push(c_str fail_message) {
+bool test_string_append_u64(c_str fail_message) {
     BasecStringResult string_result = BASEC_STRING_SUCCESS;
     BasecString*      string        = NULL;
 
-    string_result = basec_string_create(&string, "Hello, ", 16);
+    string_result = basec_string_create(&string, "n=", 4);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
@@ -492,71 +492,123 @@ bool test_string_push(c_str fail_message) {
         return false;
     }
 
-    string_result = basec_string_push(string, "World!");
-    if (string_result != BASEC_STRING_SUCCESS) {
+    string_result = basec_string_append_u64(string, 0);
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append_u64(string, 9);
+    }
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append_u64(string, 10);
+    }
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append_u64(string, 18446744073709551615ULL);
+    }
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(string->data, "n=091018446744073709551615") != 0 ||
+        string->length != strlen("n=091018446744073709551615")
+    ) {
         (void)strncpy(
             fail_message,
-            "String push operation failed",
+            "Appended unsigned integers do not match expected value",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         (void)basec_string_destroy(&string);
         return false;
     }
 
-    if (strcmp(string->data, "Hello, World!") != 0) {
+    string_result = basec_string_append_u64(NULL, 1);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "String content does not match expected value after push",
+            "Appending with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_push(NULL, "Hello, ");
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    (void)basec_string_destroy(&string);
+    return true;
+}
+
+/**
+ * @brief Test appending signed integers to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_append_i64(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+
+    string_result = basec_string_create(&string, "", 1);
+    if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "Pushing with NULL pointer succeeded, but should fail",
+            "String creation failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
     }
 
-    string_result = basec_string_push(string, NULL);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    string_result = basec_string_append_i64(string, -42);
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append(string, ",");
+    }
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append_i64(string, 7);
+    }
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append(string, ",");
+    }
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append_i64(string, INT64_MIN);
+    }
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(string->data, "-42,7,-9223372036854775808") != 0
+    ) {
         (void)strncpy(
             fail_message,
-            "Pushing with NULL pointer succeeded, but should fail",
+            "Appended signed integers do not match expected value",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_destroy(&string);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    string_result = basec_string_append_i64(NULL, 1);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "String destruction failed",
+            "Appending with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&string);
         return false;
     }
 
+    (void)basec_string_destroy(&string);
     return true;
 }
 
 /**
- * @brief Test checking if a string contains a substring
+ * @brief Test appending doubles to a string
  * @param fail_message The message to display if the test fails
  * @return The result of the test
  */
-bool test_string_contains(c_str fail_message) {
+bool test_string_append_f64(c_str fail_message) {
     BasecStringResult string_result = BASEC_STRING_SUCCESS;
     BasecString*      string        = NULL;
-    bool              contains_out  = false;
-
-    string_result = basec_string_create(&string, "Hello, World!", 16);
+    f64               values[9]     = {
+        0.1, -2.5, 100.0, 123456.789, 0.000001, 1e-7, 1e21, 5e-324, 0.0
+    };
+    c_str             expected[9]   = {
+        "0.1", "-2.5", "100", "123456.789", "0.000001", "1e-7", "1e21",
+        "5e-324", "0"
+    };
+    f64               round_trip    = 0.0;
+
+    string_result = basec_string_create(&string, "", 1);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
@@ -566,168 +618,317 @@ bool test_string_contains(c_str fail_message) {
         return false;
     }
 
-    string_result = basec_string_contains(string, "World", &contains_out);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    for (u64 i = 0; i < 9; i++) {
+        string->length  = 0;
+        string->data[0] = '\0';
+
+        string_result = basec_string_append_f64(string, values[i]);
+        if (
+            string_result != BASEC_STRING_SUCCESS ||
+            strcmp(string->data, expected[i]) != 0
+        ) {
+            (void)strncpy(
+                fail_message,
+                "Appended double does not match expected value",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_string_destroy(&string);
+            return false;
+        }
+    }
+
+    for (u64 i = 1; i < 100000; i++) {
+        f64 value = (f64)i * 1.0000001 / 3.0;
+
+        string->length  = 0;
+        string->data[0] = '\0';
+
+        (void)basec_string_append_f64(string, value);
+        round_trip = strtod(string->data, NULL);
+        if (round_trip != value) {
+            (void)strncpy(
+                fail_message,
+                "Appended double does not round trip",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_string_destroy(&string);
+            return false;
+        }
+    }
+
+    string_result = basec_string_append_f64(NULL, 1.0);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "Checking for substring failed",
+            "Appending with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         (void)basec_string_destroy(&string);
         return false;
     }
 
-    if (!contains_out) {
+    (void)basec_string_destroy(&string);
+    return true;
+}
+
+/**
+ * @brief Test appending hexadecimal integers to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_append_hex(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+
+    string_result = basec_string_create(&string, "0x", 2);
+    if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "Expected to find substring in the string, but did not",
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_append_hex(string, 0xdeadbeef);
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append(string, " ");
+    }
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append_hex(string, 0);
+    }
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append(string, " ");
+    }
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_append_hex(string, 0xFFFFFFFFFFFFFFFFULL);
+    }
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(string->data, "0xdeadbeef 0 ffffffffffffffff") != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Appended hexadecimal does not match expected value",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_contains(string, "NotFound", &contains_out);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    string_result = basec_string_append_hex(NULL, 1);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "Checking for substring failed",
+            "Appending with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         (void)basec_string_destroy(&string);
         return false;
     }
 
-    if (contains_out) {
+    (void)basec_string_destroy(&string);
+    return true;
+}
+
+/**
+ * @brief Test appending formatted text to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_appendf(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+    BasecString*      name          = NULL;
+    BasecStringView   view          = {"world!", 5};
+    c8                expected[128];
+
+    string_result = basec_string_create(&string, "> ", 3);
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_create(&name, "basec", 6);
+    }
+    if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "Expected not to find substring in the string, but did",
+            "String creation failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         (void)basec_string_destroy(&string);
         return false;
     }
-    
-    string_result = basec_string_contains(NULL, "World", &contains_out);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+
+    string_result = basec_string_appendf(
+        string,
+        "%s %d %lu %x %c %f %5.2f|%-4d|%% %S %V",
+        "id",
+        -12,
+        (unsigned long)42,
+        255u,
+        'z',
+        2.5,
+        3.14159,
+        7,
+        name,
+        view
+    );
+    (void)snprintf(
+        expected,
+        sizeof(expected),
+        "> %s %d %lu %x %c %f %5.2f|%-4d|%% basec world",
+        "id",
+        -12,
+        (unsigned long)42,
+        255u,
+        'z',
+        2.5,
+        3.14159,
+        7
+    );
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(string->data, expected) != 0 ||
+        string->length != strlen(expected)
+    ) {
         (void)strncpy(
             fail_message,
-            "Checking for substring with NULL pointer succeeded, but should fail",
+            "Formatted text does not match expected value",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&name);
+        (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_contains(string, NULL, &contains_out);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    // Longer than the spare capacity, so the string has to grow
+    for (u64 i = 0; i < 100; i++) {
+        string_result = basec_string_appendf(string, "[%lu:%f]", i, 0.1);
+        if (string_result != BASEC_STRING_SUCCESS) break;
+    }
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strstr(string->data, "[99:0.100000]") == NULL ||
+        string->length >= string->capacity
+    ) {
         (void)strncpy(
             fail_message,
-            "Checking for substring with NULL pointer succeeded, but should fail",
+            "Formatted text was not appended after growing",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&name);
+        (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_contains(string, "World", NULL);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    (void)strncpy(expected, string->data, sizeof(expected) - 1);
+    expected[sizeof(expected) - 1] = '\0';
+    string_result = basec_string_appendf(string, "%d %", 1);
+    if (
+        string_result != BASEC_STRING_FORMAT_FAILURE ||
+        strncmp(string->data, expected, sizeof(expected) - 1) != 0
+    ) {
         (void)strncpy(
             fail_message,
-            "Checking for substring with NULL pointer succeeded, but should fail",
+            "Appending an invalid format succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&name);
+        (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_destroy(&string);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    string_result = basec_string_appendf(NULL, "%d", 1);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "String destruction failed",
+            "Appending with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&name);
+        (void)basec_string_destroy(&string);
         return false;
     }
 
+    (void)basec_string_destroy(&name);
+    (void)basec_string_destroy(&string);
     return true;
 }
 
 /**
- * @brief Test finding a substring in a string
+ * @brief Test parsing unsigned integers from views
  * @param fail_message The message to display if the test fails
  * @return The result of the test
  */
-bool test_string_find(c_str fail_message) {
+bool test_string_parse_u64(c_str fail_message) {
     BasecStringResult string_result = BASEC_STRING_SUCCESS;
-    BasecString*      string        = NULL;
-    u64               index_out     = 0;
+    BasecStringView   view          = {0};
+    u64               value         = 0;
 
-    string_result = basec_string_create(&string, "Hello, World!", 16);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    view.data     = "18446744073709551615";
+    view.length   = strlen(view.data);
+    string_result = basec_string_parse_u64(view, &value);
+    if (string_result != BASEC_STRING_SUCCESS || value != UINT64_MAX) {
         (void)strncpy(
             fail_message,
-            "String creation failed",
+            "Parsed unsigned integer does not match expected value",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
     }
 
-    string_result = basec_string_find(string, "World", &index_out);
-    if (string_result != BASEC_STRING_SUCCESS || index_out != 7) {
+    // Only the first three characters belong to the view
+    view.data     = "4213";
+    view.length   = 3;
+    string_result = basec_string_parse_u64(view, &value);
+    if (string_result != BASEC_STRING_SUCCESS || value != 421) {
         (void)strncpy(
             fail_message,
-            "Failed to find existing substring",
+            "Parsing did not respect the view length",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-        (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_find(string, "NotFound", &index_out);
-    if (string_result != BASEC_STRING_NOT_FOUND) {
+    view.data     = "18446744073709551616";
+    view.length   = strlen(view.data);
+    string_result = basec_string_parse_u64(view, &value);
+    if (string_result != BASEC_STRING_OUT_OF_RANGE) {
         (void)strncpy(
             fail_message,
-            "Found non-existant substring",
+            "Parsing an overflowing integer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-        (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_find(NULL, "World", &index_out);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    view.data     = "1234567x9";
+    view.length   = strlen(view.data);
+    string_result = basec_string_parse_u64(view, &value);
+    if (string_result != BASEC_STRING_PARSE_FAILURE) {
         (void)strncpy(
             fail_message,
-            "Finding substring with NULL pointer succeeded, but should fail",
+            "Parsing an invalid integer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
     }
 
-    string_result = basec_string_find(string, NULL, &index_out);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    view.data     = "";
+    view.length   = 0;
+    string_result = basec_string_parse_u64(view, &value);
+    if (string_result != BASEC_STRING_PARSE_FAILURE) {
         (void)strncpy(
             fail_message,
-            "Finding substring with NULL pointer succeeded, but should fail",
+            "Parsing an empty view succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
     }
 
-    string_result = basec_string_find(string, "World", NULL);
+    string_result = basec_string_parse_u64(view, NULL);
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "Finding substring with NULL pointer succeeded, but should fail",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
-        return false;
-    }
-
-    string_result = basec_string_destroy(&string);
-    if (string_result != BASEC_STRING_SUCCESS) {
-        (void)strncpy(
-            fail_message,
-            "String destruction failed",
+            "Parsing with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
@@ -737,135 +938,158 @@ bool test_string_find(c_str fail_message) {
 }
 
 /**
- * @brief Test finding all instances of a substring in a string
+ * @brief Test parsing signed integers from views
  * @param fail_message The message to display if the test fails
  * @return The result of the test
  */
-bool test_string_find_all(c_str fail_message) {
-    BasecStringResult string_result      = BASEC_STRING_SUCCESS;
-    BasecString*      string             = NULL;
-    BasecArray*       indices            = NULL;
-    BasecArrayResult  array_result       = BASEC_ARRAY_SUCCESS;
-    u64               expected_indices[] = {4, 8, 15, 19, 22, 26};
+bool test_string_parse_i64(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecStringView   view          = {0};
+    i64               value         = 0;
 
-    string_result = basec_string_create(&string, "Hello, World! How do you do?", 32);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    view.data     = "-9223372036854775808";
+    view.length   = strlen(view.data);
+    string_result = basec_string_parse_i64(view, &value);
+    if (string_result != BASEC_STRING_SUCCESS || value != INT64_MIN) {
         (void)strncpy(
             fail_message,
-            "String creation failed",
+            "Parsed minimum integer does not match expected value",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
     }
 
-    string_result = basec_string_find_all(string, "o", &indices);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    view.data     = "+1234567890123";
+    view.length   = strlen(view.data);
+    string_result = basec_string_parse_i64(view, &value);
+    if (string_result != BASEC_STRING_SUCCESS || value != 1234567890123LL) {
         (void)strncpy(
             fail_message,
-            "Finding all instances failed",
+            "Parsed signed integer does not match expected value",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
-        (void)basec_string_destroy(&string);
         return false;
     }
 
-    if (indices->length != 6) {
+    view.data     = "9223372036854775808";
+    view.length   = strlen(view.data);
+    string_result = basec_string_parse_i64(view, &value);
+    if (string_result != BASEC_STRING_OUT_OF_RANGE) {
         (void)strncpy(
             fail_message,
-            "Unexpected number of instances found",
+            "Parsing an overflowing integer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        return false;
+    }
 
-        (void)basec_string_destroy(&string);
-        (void)basec_array_destroy(&indices);
+    view.data     = "-";
+    view.length   = 1;
+    string_result = basec_string_parse_i64(view, &value);
+    if (string_result != BASEC_STRING_PARSE_FAILURE) {
+        (void)strncpy(
+            fail_message,
+            "Parsing a lone sign succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
         return false;
     }
-    
-    for (u64 i = 0; i < indices->length; i++) {
-        u64 index;
-        array_result = basec_array_get(indices, i, &index);
-        if (array_result != BASEC_ARRAY_SUCCESS) {
+
+    return true;
+}
+
+/**
+ * @brief Test parsing doubles from views
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_parse_f64(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecStringView   view          = {0};
+    f64               value         = 0.0;
+    c_str             valid[8]      = {
+        "0.1", "-2.5e-3", "1e23", "123456789012345678901234567890",
+        "2.2250738585072011e-308", "4.9e-324", "1.7976931348623157e308", ".5"
+    };
+    c_str             invalid[6]    = {"", ".", "1e", "1.2.3", " 1", "0x10"};
+    c8                buffer[64];
+
+    for (u64 i = 0; i < 8; i++) {
+        view.data     = valid[i];
+        view.length   = strlen(valid[i]);
+        string_result = basec_string_parse_f64(view, &value);
+        if (
+            string_result != BASEC_STRING_SUCCESS ||
+            value != strtod(valid[i], NULL)
+        ) {
             (void)strncpy(
                 fail_message,
-                "Array get failed",
+                "Parsed double does not match strtod",
                 BASEC_TEST_FAIL_MESSAGE_MAX_LEN
             );
-
-            (void)basec_string_destroy(&string);
-            (void)basec_array_destroy(&indices);
             return false;
         }
+    }
 
-        if (index != expected_indices[i]) {
+    for (u64 i = 1; i < 100000; i++) {
+        (void)snprintf(
+            buffer,
+            sizeof(buffer),
+            "%.17g",
+            (f64)i * 1.37e-5 / 3.0
+        );
+        view.data     = buffer;
+        view.length   = strlen(buffer);
+        string_result = basec_string_parse_f64(view, &value);
+        if (
+            string_result != BASEC_STRING_SUCCESS ||
+            value != strtod(buffer, NULL)
+        ) {
             (void)strncpy(
                 fail_message,
-                "Index mismatch",
+                "Parsed double does not round trip",
                 BASEC_TEST_FAIL_MESSAGE_MAX_LEN
             );
-
-            (void)basec_string_destroy(&string);
-            (void)basec_array_destroy(&indices);
             return false;
         }
-    } 
-    
-    string_result = basec_string_find_all(NULL, "o", &indices);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
-        (void)strncpy(
-            fail_message,
-            "Finding all instances with NULL string succeeded, but should fail",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
+    }
 
-        (void)basec_string_destroy(&string);
-        (void)basec_array_destroy(&indices);
-        return false;
+    for (u64 i = 0; i < 6; i++) {
+        view.data     = invalid[i];
+        view.length   = strlen(invalid[i]);
+        string_result = basec_string_parse_f64(view, &value);
+        if (string_result != BASEC_STRING_PARSE_FAILURE) {
+            (void)strncpy(
+                fail_message,
+                "Parsing an invalid double succeeded, but should fail",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            return false;
+        }
     }
 
-    string_result = basec_string_find_all(string, NULL, &indices);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    view.data     = "1e400";
+    view.length   = strlen(view.data);
+    string_result = basec_string_parse_f64(view, &value);
+    if (string_result != BASEC_STRING_OUT_OF_RANGE) {
         (void)strncpy(
             fail_message,
-            "Finding all instances with NULL substring succeeded, but should fail",
+            "Parsing an overflowing double succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
-        (void)basec_string_destroy(&string);
-        (void)basec_array_destroy(&indices);
         return false;
     }
 
-    string_result = basec_string_find_all(string, "o", NULL);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    view.data     = "-inf";
+    view.length   = strlen(view.data);
+    string_result = basec_string_parse_f64(view, &value);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        value >= -1.7976931348623157e308
+    ) {
         (void)strncpy(
             fail_message,
-            "Finding all instances with NULL output array succeeded, but should fail",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
-
-        (void)basec_string_destroy(&string);
-        (void)basec_array_destroy(&indices);
-        return false;
-    }
-
-    string_result = basec_string_destroy(&string);
-    if (string_result != BASEC_STRING_SUCCESS) {
-        (void)strncpy(
-            fail_message,
-            "String destruction failed",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
-
-        (void)basec_array_destroy(&indices);
-        return false;
-    }
-
-    array_result = basec_array_destroy(&indices);
-    if (array_result != BASEC_ARRAY_SUCCESS) {
-        (void)strncpy(
-            fail_message,
-            "Array destruction failed",
+            "Parsed infinity does not match expected value",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
@@ -875,123 +1099,128 @@ bool test_string_find_all(c_str fail_message) {
 }
 
 /**
- * @brief Test replacing a substring in a string
+ * @brief Test parsing a split string into a typed array
  * @param fail_message The message to display if the test fails
  * @return The result of the test
  */
-bool test_string_replace(c_str fail_message) {
+bool test_string_strings_parse(c_str fail_message) {
     BasecStringResult string_result = BASEC_STRING_SUCCESS;
     BasecString*      string        = NULL;
-    BasecString*      result_string = NULL;
+    BasecArray*       tokens        = NULL;
+    BasecArray*       values        = NULL;
+    u64               index         = 0;
 
-    string_result = basec_string_create(&string, "Hello, World!", 16);
+    string_result = basec_string_create(&string, "3,-1,4.5,1e2", 13);
+    if (string_result == BASEC_STRING_SUCCESS) {
+        string_result = basec_string_split(string, ",", &tokens);
+    }
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "String creation failed",
+            "String creation or split failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_replace(string, "World", "Universe", &result_string);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    string_result = basec_strings_parse_f64(tokens, &values, &index);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        values->length != 4 ||
+        values->element_size != sizeof(f64) ||
+        ((f64*)values->data)[0] != 3.0 ||
+        ((f64*)values->data)[1] != -1.0 ||
+        ((f64*)values->data)[2] != 4.5 ||
+        ((f64*)values->data)[3] != 100.0
+    ) {
         (void)strncpy(
             fail_message,
-            "String replacement failed",
+            "Parsed doubles do not match expected values",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
+        (void)basec_array_destroy(&values);
+        (void)basec_strings_destroy(&tokens);
         (void)basec_string_destroy(&string);
         return false;
     }
 
-    if (strcmp(result_string->data, "Hello, Universe!") != 0) {
+    string_result = basec_strings_parse_i64(tokens, &values, &index);
+    if (string_result != BASEC_STRING_PARSE_FAILURE || index != 2) {
         (void)strncpy(
             fail_message,
-            "Replacement result does not match expected value",
+            "Parsing a non-integer token did not report its index",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
+        (void)basec_array_destroy(&values);
+        (void)basec_strings_destroy(&tokens);
         (void)basec_string_destroy(&string);
-        (void)basec_string_destroy(&result_string);
         return false;
     }
-    
-    string_result = basec_string_replace(string, "World", "Universe", &string);
+
+    (void)basec_array_destroy(&values);
+    (void)basec_strings_destroy(&tokens);
+    (void)basec_string_destroy(&string);
+    return true;
+}
+
+/**
+ * @brief Test pushing a string to a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_push(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+
+    string_result = basec_string_create(&string, "Hello, ", 16);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "In-place string replacement failed",
+            "String creation failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
-        (void)basec_string_destroy(&string);
-        (void)basec_string_destroy(&result_string);
         return false;
     }
-    
-    if (strcmp(string->data, "Hello, Universe!") != 0) {
-        (void)strncpy(
-            fail_message,
-            "In-place string replacement result does not match expected value",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
 
-        (void)basec_string_destroy(&string);
-        (void)basec_string_destroy(&result_string);
-        return false;
-    }
-    
-    string_result = basec_string_replace(NULL, "World", "Universe", &result_string);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    string_result = basec_string_push(string, "World!");
+    if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "String replacement with NULL pointer succeeded, but should fail",
+            "String push operation failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
         (void)basec_string_destroy(&string);
-        (void)basec_string_destroy(&result_string);
         return false;
     }
 
-    string_result = basec_string_replace(string, NULL, "Universe", &result_string);
-    if (string_result != BASEC_STRING_NULL_POINTER) {
+    if (strcmp(string->data, "Hello, World!") != 0) {
         (void)strncpy(
             fail_message,
-            "String replacement with NULL pointer succeeded, but should fail",
+            "String content does not match expected value after push",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
         (void)basec_string_destroy(&string);
-        (void)basec_string_destroy(&result_string);
         return false;
     }
 
-    string_result = basec_string_replace(string, "World", NULL, &result_string);
+    string_result = basec_string_push(NULL, "Hello, ");
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "String replacement with NULL pointer succeeded, but should fail",
+            "Pushing with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
-        (void)basec_string_destroy(&string);
-        (void)basec_string_destroy(&result_string);
         return false;
     }
 
-    string_result = basec_string_replace(string, "World", "Universe", NULL);
+    string_result = basec_string_push(string, NULL);
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "String replacement with NULL pointer succeeded, but should fail",
+            "Pushing with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
-        (void)basec_string_destroy(&string);
-        (void)basec_string_destroy(&result_string);
         return false;
     }
 
@@ -1002,17 +1231,6 @@ bool test_string_replace(c_str fail_message) {
             "String destruction failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-        (void)basec_string_destroy(&result_string);
-        return false;
-    }
-
-    string_result = basec_string_destroy(&result_string);
-    if (string_result != BASEC_STRING_SUCCESS) {
-        (void)strncpy(
-            fail_message,
-            "Result string destruction failed",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
         return false;
     }
 
@@ -1020,20 +1238,16 @@ bool test_string_replace(c_str fail_message) {
 }
 
 /**
- * @brief Test splitting a string into an array of strings
+ * @brief Test checking if a string contains a substring
  * @param fail_message The message to display if the test fails
  * @return The result of the test
  */
-bool test_string_split(c_str fail_message) {
-    BasecStringResult string_result    = BASEC_STRING_SUCCESS;
-    BasecString*      string           = NULL;
-    BasecArray*       result_array     = NULL;
-    BasecArrayResult  array_result     = BASEC_ARRAY_SUCCESS;
-    BasecString*      part             = NULL;
-    const char*       expected_parts[] = {"Hello,", "World!", "How", "are", "you?"};
-    BasecArray*       populated_array  = NULL;
+bool test_string_contains(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+    bool              contains_out  = false;
 
-    string_result = basec_string_create(&string, "Hello, World! How are you?", 32);
+    string_result = basec_string_create(&string, "Hello, World!", 16);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
@@ -1043,172 +1257,75 @@ bool test_string_split(c_str fail_message) {
         return false;
     }
 
-    string_result = basec_string_split(string, " ", &result_array);
+    string_result = basec_string_contains(string, "World", &contains_out);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "String splitting failed",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
-
-        (void)basec_string_destroy(&string);
-        return false;
-    }
-
-    if (result_array->length != 5) {
-        (void)strncpy(
-            fail_message,
-            "Unexpected number of split strings",
+            "Checking for substring failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
         (void)basec_string_destroy(&string);
-        (void)basec_strings_destroy(&result_array);
         return false;
     }
 
-    for (u64 i = 0; i < 5; i++) {
-        array_result = basec_array_get(result_array, i, &part);
-        if (array_result != BASEC_ARRAY_SUCCESS) {
-            (void)strncpy(
-                fail_message,
-                "Array get failed",
-                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-            );
-
-            (void)basec_string_destroy(&string);
-            (void)basec_strings_destroy(&result_array);
-            return false;
-        }
-
-        if (strcmp(part->data, expected_parts[i]) != 0) {
-            (void)strncpy(
-                fail_message,
-                "Split string content mismatch",
-                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-            );
-
-            (void)basec_string_destroy(&string);
-            (void)basec_strings_destroy(&result_array);
-            return false;
-        }
-    }
-    
-    array_result = basec_array_create(&populated_array, sizeof(u64), 5);
-    if (array_result != BASEC_ARRAY_SUCCESS) {
+    if (!contains_out) {
         (void)strncpy(
             fail_message,
-            "Array creation failed",
+            "Expected to find substring in the string, but did not",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
         (void)basec_string_destroy(&string);
-        (void)basec_strings_destroy(&result_array);
         return false;
     }
-    
-    for (u64 i = 0; i < 5; i++) {
-        array_result = basec_array_append(populated_array, &expected_parts[i]);
-        if (array_result != BASEC_ARRAY_SUCCESS) {
-            (void)strncpy(
-                fail_message,
-                "Array append failed",
-                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-            );
 
-            (void)basec_string_destroy(&string);
-            (void)basec_strings_destroy(&result_array);
-            (void)basec_array_destroy(&populated_array);
-            return false;
-        }
-    }
-    
-    string_result = basec_string_split(string, " ", &populated_array);
+    string_result = basec_string_contains(string, "NotFound", &contains_out);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "String splitting failed",
+            "Checking for substring failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
         (void)basec_string_destroy(&string);
-        (void)basec_strings_destroy(&result_array);
-        (void)basec_array_destroy(&populated_array);
         return false;
     }
-    
-    if (populated_array->length != 5) {
+
+    if (contains_out) {
         (void)strncpy(
             fail_message,
-            "Unexpected number of split strings",
+            "Expected not to find substring in the string, but did",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
         (void)basec_string_destroy(&string);
-        (void)basec_strings_destroy(&result_array);
-        (void)basec_array_destroy(&populated_array);
         return false;
     }
     
-    for (u64 i = 0; i < 5; i++) {
-        array_result = basec_array_get(populated_array, i, &part);
-        if (array_result != BASEC_ARRAY_SUCCESS) {
-            (void)strncpy(
-                fail_message,
-                "Array get failed",
-                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-            );
-
-            (void)basec_string_destroy(&string);
-            (void)basec_strings_destroy(&result_array);
-            (void)basec_array_destroy(&populated_array);
-            return false;
-        }
-
-        if (strcmp(part->data, expected_parts[i]) != 0) {
-            (void)strncpy(
-                fail_message,
-                "Split string content mismatch",
-                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-            );
-
-            (void)basec_string_destroy(&string);
-            (void)basec_strings_destroy(&result_array);
-            (void)basec_array_destroy(&populated_array);
-            return false;
-        }
-    }
-    
-    string_result = basec_string_split(NULL, " ", &result_array);
+    string_result = basec_string_contains(NULL, "World", &contains_out);
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "String split with NULL pointer succeeded, but should fail",
+            "Checking for substring with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-        (void)basec_array_destroy(&populated_array);
         return false;
     }
 
-    string_result = basec_string_split(string, NULL, &result_array);
+    string_result = basec_string_contains(string, NULL, &contains_out);
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "String split with NULL pointer succeeded, but should fail",
+            "Checking for substring with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-        (void)basec_array_destroy(&populated_array);
         return false;
     }
 
-    string_result = basec_string_split(string, " ", NULL);
+    string_result = basec_string_contains(string, "World", NULL);
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "String split with NULL pointer succeeded, but should fail",
+            "Checking for substring with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-        (void)basec_array_destroy(&populated_array);
         return false;
     }
 
@@ -1219,45 +1336,21 @@ bool test_string_split(c_str fail_message) {
             "String destruction failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
-
-        (void)basec_strings_destroy(&result_array);
-        return false;
-    }
-
-    string_result = basec_strings_destroy(&result_array);
-    if (string_result != BASEC_STRING_SUCCESS) {
-        (void)strncpy(
-            fail_message,
-            "Strings array destruction failed",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
-
-        (void)basec_array_destroy(&populated_array);
-        return false;
-    }
-    
-    array_result = basec_array_destroy(&populated_array);
-    if (array_result != BASEC_ARRAY_SUCCESS) {
-        (void)strncpy(
-            fail_message,
-            "Array destruction failed",
-            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
-        );
         return false;
     }
 
     return true;
 }
 
-
 /**
- * @brief Test the destruction of a string
+ * @brief Test finding a substring in a string
  * @param fail_message The message to display if the test fails
  * @return The result of the test
  */
-bool test_string_destroy(c_str fail_message) {
+bool test_string_find(c_str fail_message) {
     BasecStringResult string_result = BASEC_STRING_SUCCESS;
     BasecString*      string        = NULL;
+    u64               index_out     = 0;
 
     string_result = basec_string_create(&string, "Hello, World!", 16);
     if (string_result != BASEC_STRING_SUCCESS) {
@@ -1269,40 +1362,63 @@ bool test_string_destroy(c_str fail_message) {
         return false;
     }
 
-    string_result = basec_string_destroy(&string);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    string_result = basec_string_find(string, "World", &index_out);
+    if (string_result != BASEC_STRING_SUCCESS || index_out != 7) {
         (void)strncpy(
             fail_message,
-            "String destruction failed",
+            "Failed to find existing substring",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&string);
         return false;
     }
 
-    if (string != NULL) {
+    string_result = basec_string_find(string, "NotFound", &index_out);
+    if (string_result != BASEC_STRING_NOT_FOUND) {
         (void)strncpy(
             fail_message,
-            "String was non-NULL after destruction",
+            "Found non-existant substring",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+        (void)basec_string_destroy(&string);
         return false;
     }
-    
-    string_result = basec_string_destroy(&string);
+
+    string_result = basec_string_find(NULL, "World", &index_out);
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "Double destruction succeeded, but should fail",
+            "Finding substring with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
     }
 
-    string_result = basec_string_destroy(NULL);
+    string_result = basec_string_find(string, NULL, &index_out);
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "Destroying NULL pointer succeeded, but should fail",
+            "Finding substring with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_find(string, "World", NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Finding substring with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String destruction failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
@@ -1312,19 +1428,18 @@ bool test_string_destroy(c_str fail_message) {
 }
 
 /**
- * @brief Test the destruction of an array of strings
+ * @brief Test finding all instances of a substring in a string
  * @param fail_message The message to display if the test fails
  * @return The result of the test
  */
-bool test_strings_destroy(c_str fail_message) {
-    BasecStringResult string_result = BASEC_STRING_SUCCESS;
-    BasecString*      string1       = NULL;
-    BasecString*      string2       = NULL;
-    BasecString*      string3       = NULL;
-    BasecArrayResult  array_result  = BASEC_ARRAY_SUCCESS;
-    BasecArray*       string_array  = NULL;
+bool test_string_find_all(c_str fail_message) {
+    BasecStringResult string_result      = BASEC_STRING_SUCCESS;
+    BasecString*      string             = NULL;
+    BasecArray*       indices            = NULL;
+    BasecArrayResult  array_result       = BASEC_ARRAY_SUCCESS;
+    u64               expected_indices[] = {4, 8, 15, 19, 22, 26};
 
-    string_result = basec_string_create(&string1, "String 1", 16);
+    string_result = basec_string_create(&string, "Hello, World! How do you do?", 32);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
@@ -1334,105 +1449,1356 @@ bool test_strings_destroy(c_str fail_message) {
         return false;
     }
 
-    string_result = basec_string_create(&string2, "String 2", 16);
+    string_result = basec_string_find_all(string, "o", &indices);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "String creation failed",
+            "Finding all instances failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+
+        (void)basec_string_destroy(&string);
         return false;
     }
 
-    string_result = basec_string_create(&string3, "String 3", 16);
-    if (string_result != BASEC_STRING_SUCCESS) {
+    if (indices->length != 6) {
         (void)strncpy(
             fail_message,
-            "String creation failed",
+            "Unexpected number of instances found",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_array_destroy(&indices);
         return false;
     }
     
-    array_result = basec_array_create(&string_array, sizeof(BasecString*), 3);
-    if (array_result != BASEC_ARRAY_SUCCESS) {
+    for (u64 i = 0; i < indices->length; i++) {
+        u64 index;
+        array_result = basec_array_get(indices, i, &index);
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "Array get failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+
+            (void)basec_string_destroy(&string);
+            (void)basec_array_destroy(&indices);
+            return false;
+        }
+
+        if (index != expected_indices[i]) {
+            (void)strncpy(
+                fail_message,
+                "Index mismatch",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+
+            (void)basec_string_destroy(&string);
+            (void)basec_array_destroy(&indices);
+            return false;
+        }
+    } 
+    
+    string_result = basec_string_find_all(NULL, "o", &indices);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "Array creation failed",
+            "Finding all instances with NULL string succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_array_destroy(&indices);
         return false;
     }
 
+    string_result = basec_string_find_all(string, NULL, &indices);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Finding all instances with NULL substring succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_array_destroy(&indices);
+        return false;
+    }
 
-    array_result = basec_array_append(string_array, &string1);
-    if (array_result != BASEC_ARRAY_SUCCESS) {
+    string_result = basec_string_find_all(string, "o", NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "Failed to add string to array",
+            "Finding all instances with NULL output array succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_array_destroy(&indices);
         return false;
     }
 
-    array_result = basec_array_append(string_array, &string2);
-    if (array_result != BASEC_ARRAY_SUCCESS) {
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "Failed to add string to array",
+            "String destruction failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+
+        (void)basec_array_destroy(&indices);
         return false;
     }
 
-    array_result = basec_array_append(string_array, &string3);
+    array_result = basec_array_destroy(&indices);
     if (array_result != BASEC_ARRAY_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "Failed to add string to array",
+            "Array destruction failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
     }
-    
-    string_result = basec_strings_destroy(&string_array);
+
+    return true;
+}
+
+/**
+ * @brief Test replacing a substring in a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_replace(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+    BasecString*      result_string = NULL;
+
+    string_result = basec_string_create(&string, "Hello, World!", 16);
     if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "Failed to destroy the array of strings",
+            "String creation failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
         return false;
     }
 
-    if (string_array != NULL) {
+    string_result = basec_string_replace(string, "World", "Universe", &result_string);
+    if (string_result != BASEC_STRING_SUCCESS) {
         (void)strncpy(
             fail_message,
-            "Array was non-NULL after destruction",
+            "String replacement failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    if (strcmp(result_string->data, "Hello, Universe!") != 0) {
+        (void)strncpy(
+            fail_message,
+            "Replacement result does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_string_destroy(&result_string);
+        return false;
+    }
+    
+    string_result = basec_string_replace(string, "World", "Universe", &string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "In-place string replacement failed",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_string_destroy(&result_string);
         return false;
     }
     
-    string_result = basec_string_destroy(NULL);
+    if (strcmp(string->data, "Hello, Universe!") != 0) {
+        (void)strncpy(
+            fail_message,
+            "In-place string replacement result does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_string_destroy(&result_string);
+        return false;
+    }
+    
+    string_result = basec_string_replace(NULL, "World", "Universe", &result_string);
     if (string_result != BASEC_STRING_NULL_POINTER) {
         (void)strncpy(
             fail_message,
-            "Destroying NULL pointer succeeded, but should fail",
+            "String replacement with NULL pointer succeeded, but should fail",
             BASEC_TEST_FAIL_MESSAGE_MAX_LEN
         );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_string_destroy(&result_string);
         return false;
     }
 
-    return true;
-}
+    string_result = basec_string_replace(string, NULL, "Universe", &result_string);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "String replacement with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
 
-/**
- * @brief Add String tests to a test suite
- * @param test_suite The test suite to add the tests to
- * @return The result of the operation
- */
-BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
+        (void)basec_string_destroy(&string);
+        (void)basec_string_destroy(&result_string);
+        return false;
+    }
+
+    string_result = basec_string_replace(string, "World", NULL, &result_string);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "String replacement with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_string_destroy(&result_string);
+        return false;
+    }
+
+    string_result = basec_string_replace(string, "World", "Universe", NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "String replacement with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_string_destroy(&result_string);
+        return false;
+    }
+
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&result_string);
+        return false;
+    }
+
+    string_result = basec_string_destroy(&result_string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Result string destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test splitting a string into an array of strings
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_split(c_str fail_message) {
+    BasecStringResult string_result    = BASEC_STRING_SUCCESS;
+    BasecString*      string           = NULL;
+    BasecArray*       result_array     = NULL;
+    BasecArrayResult  array_result     = BASEC_ARRAY_SUCCESS;
+    BasecString*      part             = NULL;
+    const char*       expected_parts[] = {"Hello,", "World!", "How", "are", "you?"};
+    BasecArray*       populated_array  = NULL;
+
+    string_result = basec_string_create(&string, "Hello, World! How are you?", 32);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_split(string, " ", &result_array);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String splitting failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    if (result_array->length != 5) {
+        (void)strncpy(
+            fail_message,
+            "Unexpected number of split strings",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_strings_destroy(&result_array);
+        return false;
+    }
+
+    for (u64 i = 0; i < 5; i++) {
+        array_result = basec_array_get(result_array, i, &part);
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "Array get failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+
+            (void)basec_string_destroy(&string);
+            (void)basec_strings_destroy(&result_array);
+            return false;
+        }
+
+        if (strcmp(part->data, expected_parts[i]) != 0) {
+            (void)strncpy(
+                fail_message,
+                "Split string content mismatch",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+
+            (void)basec_string_destroy(&string);
+            (void)basec_strings_destroy(&result_array);
+            return false;
+        }
+    }
+    
+    array_result = basec_array_create(&populated_array, sizeof(u64), 5);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_strings_destroy(&result_array);
+        return false;
+    }
+    
+    for (u64 i = 0; i < 5; i++) {
+        array_result = basec_array_append(populated_array, &expected_parts[i]);
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "Array append failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+
+            (void)basec_string_destroy(&string);
+            (void)basec_strings_destroy(&result_array);
+            (void)basec_array_destroy(&populated_array);
+            return false;
+        }
+    }
+    
+    string_result = basec_string_split(string, " ", &populated_array);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String splitting failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_strings_destroy(&result_array);
+        (void)basec_array_destroy(&populated_array);
+        return false;
+    }
+    
+    if (populated_array->length != 5) {
+        (void)strncpy(
+            fail_message,
+            "Unexpected number of split strings",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_string_destroy(&string);
+        (void)basec_strings_destroy(&result_array);
+        (void)basec_array_destroy(&populated_array);
+        return false;
+    }
+    
+    for (u64 i = 0; i < 5; i++) {
+        array_result = basec_array_get(populated_array, i, &part);
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "Array get failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+
+            (void)basec_string_destroy(&string);
+            (void)basec_strings_destroy(&result_array);
+            (void)basec_array_destroy(&populated_array);
+            return false;
+        }
+
+        if (strcmp(part->data, expected_parts[i]) != 0) {
+            (void)strncpy(
+                fail_message,
+                "Split string content mismatch",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+
+            (void)basec_string_destroy(&string);
+            (void)basec_strings_destroy(&result_array);
+            (void)basec_array_destroy(&populated_array);
+            return false;
+        }
+    }
+    
+    string_result = basec_string_split(NULL, " ", &result_array);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "String split with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&populated_array);
+        return false;
+    }
+
+    string_result = basec_string_split(string, NULL, &result_array);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "String split with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&populated_array);
+        return false;
+    }
+
+    string_result = basec_string_split(string, " ", NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "String split with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&populated_array);
+        return false;
+    }
+
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_strings_destroy(&result_array);
+        return false;
+    }
+
+    string_result = basec_strings_destroy(&result_array);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Strings array destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+
+        (void)basec_array_destroy(&populated_array);
+        return false;
+    }
+    
+    array_result = basec_array_destroy(&populated_array);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Array destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Test the conversion of a string to lower and uppercase
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_to_lower(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+
+    // Long enough to cover both the 16 byte blocks and the tail
+    string_result = basec_string_create(
+        &string,
+        "Hello, World! [@`{] ABCXYZ abcxyz \xC3\x89t\xC3\xA9",
+        64
+    );
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_to_lower(string);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(
+            string->data,
+            "hello, world! [@`{] abcxyz abcxyz \xC3\x89t\xC3\xA9"
+        ) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Lowercase string does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_to_upper(string);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(
+            string->data,
+            "HELLO, WORLD! [@`{] ABCXYZ ABCXYZ \xC3\x89T\xC3\xA9"
+        ) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Uppercase string does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_to_lower(NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Converting NULL string succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test trimming whitespace from a string view
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_trim(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecStringView   view          = {0};
+    BasecStringView   trimmed       = {0};
+
+    view.data     = " \t\r\n\v\f                   key = value \t  "
+                    "                  \n";
+    view.length   = strlen(view.data);
+    string_result = basec_string_trim(view, &trimmed);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        trimmed.length != 11 ||
+        strncmp(trimmed.data, "key = value", 11) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Trimmed view does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_trim_start(view, &trimmed);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        trimmed.data != view.data + 25 ||
+        trimmed.length != view.length - 25
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Start trimmed view does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_trim_end(view, &trimmed);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        trimmed.data != view.data ||
+        trimmed.length != 36
+    ) {
+        (void)strncpy(
+            fail_message,
+            "End trimmed view does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    view.data     = "    \n\t    ";
+    view.length   = strlen(view.data);
+    string_result = basec_string_trim(view, &trimmed);
+    if (string_result != BASEC_STRING_SUCCESS || trimmed.length != 0) {
+        (void)strncpy(
+            fail_message,
+            "Trimming only whitespace did not give an empty view",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_trim(view, NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Trimming with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test finding a substring in a string, ignoring case
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_find_icase(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+    u64               index_out     = 0;
+    bool              contains_out  = false;
+
+    string_result = basec_string_create(
+        &string,
+        "GET /index.html HTTP/1.1\r\nHost: example.com\r\n"
+        "Content-Type: text/html\r\n",
+        128
+    );
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_find_icase(
+        string,
+        "content-TYPE:",
+        &index_out
+    );
+    if (string_result != BASEC_STRING_SUCCESS || index_out != 45) {
+        (void)strncpy(
+            fail_message,
+            "Failed to find existing substring",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    // [ and { differ from letters by bit 0x20 too, but must not match
+    string_result = basec_string_find_icase(string, "h[ml", &index_out);
+    if (string_result != BASEC_STRING_NOT_FOUND) {
+        (void)strncpy(
+            fail_message,
+            "Found non-existant substring",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_contains_icase(
+        string,
+        "HOST: EXAMPLE.COM",
+        &contains_out
+    );
+    if (string_result != BASEC_STRING_SUCCESS || !contains_out) {
+        (void)strncpy(
+            fail_message,
+            "String does not contain existing substring",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_contains_icase(
+        string,
+        "HTTP/2",
+        &contains_out
+    );
+    if (string_result != BASEC_STRING_SUCCESS || contains_out) {
+        (void)strncpy(
+            fail_message,
+            "String contains non-existant substring",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_find_icase(string, NULL, &index_out);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Finding substring with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test hashing the contents of a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_hash(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+    u64               hash          = 0;
+    u64               expected      = 0;
+
+    string_result = basec_string_create(&string, "Hello, World!", 16);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)basec_hash_bytes("Hello, World!", 13, &expected);
+    string_result = basec_string_hash(string, &hash);
+    if (string_result != BASEC_STRING_SUCCESS || hash != expected) {
+        (void)strncpy(
+            fail_message,
+            "String hash does not match the hash of its bytes",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_hash(string, NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Hashing with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test mapping a file into a string view
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_map_file(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecStringView   view          = {0};
+    c_str             path          = "/tmp/basec_test_map_file.txt";
+    c_str             contents      = "Hello, World!\nSecond line\n";
+    FILE*             file          = NULL;
+
+    file = fopen(path, "w");
+    if (file == NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create test file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    (void)fputs(contents, file);
+    (void)fclose(file);
+
+    string_result = basec_string_map_file(path, &view);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to map file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (
+        view.length != strlen(contents) ||
+        memcmp(view.data, contents, view.length) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Mapped view does not match the file contents",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_unmap_file(&view);
+        return false;
+    }
+
+    string_result = basec_string_unmap_file(&view);
+    if (string_result != BASEC_STRING_SUCCESS || view.data != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to unmap file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_map_file("/tmp/basec_missing_file", &view);
+    if (string_result != BASEC_STRING_IO_FAILURE) {
+        (void)strncpy(
+            fail_message,
+            "Mapping a missing file succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_map_file(NULL, &view);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Mapping file with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)remove(path);
+    return true;
+}
+
+/**
+ * @brief Test reading a file into a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_read_file(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+    c_str             path          = "/tmp/basec_test_read_file.txt";
+    c_str             contents      = "Hello, World!\nSecond line\n";
+    FILE*             file          = NULL;
+
+    file = fopen(path, "w");
+    if (file == NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create test file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    (void)fputs(contents, file);
+    (void)fclose(file);
+
+    string_result = basec_string_read_file(path, &string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to read file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (
+        string->length != strlen(contents) ||
+        strcmp(string->data, contents) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "String does not match the file contents",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_append(string, "Extra");
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to append to read string",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_read_file(path, &string);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(string->data, contents) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Re-reading into an existing string failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_read_file(path, NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Reading file with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)remove(path);
+    return true;
+}
+
+/**
+ * @brief Test validating UTF-8
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_utf8_validate(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecStringView   view          = {0};
+    bool              valid         = false;
+    c_str             valid_text[3] = {
+        "",
+        "plain ascii text that is longer than one sixteen byte block",
+        "h\xC3\xA9llo \xE2\x82\xAC \xF0\x9F\x98\x80 w\xC3\xB6rld, "
+        "\xF4\x8F\xBF\xBF and \xED\x9F\xBF at the end"
+    };
+    c_str             invalid[6]    = {
+        "overlong slash \xC0\xAF in the middle of the text",
+        "a surrogate \xED\xA0\x80 in the middle of the text",
+        "above the last codepoint \xF4\x90\x80\x80 in the text",
+        "a lone continuation \x80 in the middle of the text",
+        "a truncated sequence at the very end \xE2\x82",
+        "\xFF"
+    };
+
+    for (u64 i = 0; i < 3; i++) {
+        view.data     = valid_text[i];
+        view.length   = strlen(valid_text[i]);
+        string_result = basec_string_utf8_validate(view, &valid);
+        if (string_result != BASEC_STRING_SUCCESS || !valid) {
+            (void)strncpy(
+                fail_message,
+                "Valid UTF-8 was rejected",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            return false;
+        }
+    }
+
+    for (u64 i = 0; i < 6; i++) {
+        view.data     = invalid[i];
+        view.length   = strlen(invalid[i]);
+        string_result = basec_string_utf8_validate(view, &valid);
+        if (string_result != BASEC_STRING_SUCCESS || valid) {
+            (void)strncpy(
+                fail_message,
+                "Invalid UTF-8 was accepted",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            return false;
+        }
+    }
+
+    string_result = basec_string_utf8_validate(view, NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Validating with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test counting and indexing UTF-8 codepoints
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_utf8_length(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecStringView   view          = {0};
+    u64               length        = 0;
+    u64               offset        = 0;
+
+    // 20 ASCII characters then e acute, euro and an emoji
+    view.data     = "0123456789abcdefghij\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80!";
+    view.length   = strlen(view.data);
+    string_result = basec_string_utf8_length(view, &length);
+    if (string_result != BASEC_STRING_SUCCESS || length != 24) {
+        (void)strncpy(
+            fail_message,
+            "Codepoint count does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_utf8_index(view, 22, &offset);
+    if (string_result != BASEC_STRING_SUCCESS || offset != 25) {
+        (void)strncpy(
+            fail_message,
+            "Codepoint offset does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_utf8_index(view, 24, &offset);
+    if (string_result != BASEC_STRING_OUT_OF_RANGE) {
+        (void)strncpy(
+            fail_message,
+            "Indexing past the end succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test iterating over UTF-8 codepoints
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_utf8_iterator(c_str fail_message) {
+    BasecStringResult       string_result = BASEC_STRING_SUCCESS;
+    BasecStringView         view          = {0};
+    BasecStringUtf8Iterator iterator      = {0};
+    u32                     codepoint     = 0;
+    u32                     expected[5]   = {'a', 0xE9, 0x20AC, 0x1F600, 'z'};
+
+    view.data     = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z\x80";
+    view.length   = strlen(view.data);
+    string_result = basec_string_utf8_iterator(view, &iterator);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Iterator creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 5; i++) {
+        string_result = basec_string_utf8_next(&iterator, &codepoint);
+        if (string_result != BASEC_STRING_SUCCESS || codepoint != expected[i]) {
+            (void)strncpy(
+                fail_message,
+                "Decoded codepoint does not match expected value",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            return false;
+        }
+    }
+
+    string_result = basec_string_utf8_next(&iterator, &codepoint);
+    if (string_result != BASEC_STRING_INVALID_UTF8) {
+        (void)strncpy(
+            fail_message,
+            "Decoding a lone continuation byte succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_utf8_next(&iterator, &codepoint);
+    if (string_result != BASEC_STRING_END_OF_STRING) {
+        (void)strncpy(
+            fail_message,
+            "Iterator did not stop at the end of the string",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test the destruction of a string
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_string_destroy(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string        = NULL;
+
+    string_result = basec_string_create(&string, "Hello, World!", 16);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (string != NULL) {
+        (void)strncpy(
+            fail_message,
+            "String was non-NULL after destruction",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    
+    string_result = basec_string_destroy(&string);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Double destruction succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_destroy(NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test the destruction of an array of strings
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strings_destroy(c_str fail_message) {
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecString*      string1       = NULL;
+    BasecString*      string2       = NULL;
+    BasecString*      string3       = NULL;
+    BasecArrayResult  array_result  = BASEC_ARRAY_SUCCESS;
+    BasecArray*       string_array  = NULL;
+
+    string_result = basec_string_create(&string1, "String 1", 16);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_create(&string2, "String 2", 16);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_create(&string3, "String 3", 16);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    
+    array_result = basec_array_create(&string_array, sizeof(BasecString*), 3);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Array creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+
+    array_result = basec_array_append(string_array, &string1);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to add string to array",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_array_append(string_array, &string2);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to add string to array",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    array_result = basec_array_append(string_array, &string3);
+    if (array_result != BASEC_ARRAY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to add string to array",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    
+    string_result = basec_strings_destroy(&string_array);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to destroy the array of strings",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (string_array != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Array was non-NULL after destruction",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    
+    string_result = basec_string_destroy(NULL);
+    if (string_result != BASEC_STRING_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add String tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
     BasecTestResult  test_result        = BASEC_TEST_SUCCESS;
     BasecTest*       create_test        = NULL;
     BasecTest*       c_str_test         = NULL;
@@ -1440,79 +2806,520 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
     BasecTest*       capacity_test      = NULL;
     BasecTest*       prepend_test       = NULL;
     BasecTest*       append_test        = NULL;
+    BasecTest*       append_u64_test    = NULL;
+    BasecTest*       append_i64_test    = NULL;
+    BasecTest*       append_f64_test    = NULL;
+    BasecTest*       append_hex_test    = NULL;
+    BasecTest*       appendf_test       = NULL;
+    BasecTest*       parse_u64_test     = NULL;
+    BasecTest*       parse_i64_test     = NULL;
+    BasecTest*       parse_f64_test     = NULL;
+    BasecTest*       strings_parse_test = NULL;
     BasecTest*       push_test          = NULL;
     BasecTest*       contains_test      = NULL;
     BasecTest*       find_test          = NULL;
     BasecTest*       find_all_test      = NULL;
     BasecTest*       replace_test       = NULL;
     BasecTest*       split_test         = NULL;
+    BasecTest*       to_lower_test      = NULL;
+    BasecTest*       trim_test          = NULL;
+    BasecTest*       find_icase_test    = NULL;
+    BasecTest*       hash_test          = NULL;
+    BasecTest*       map_file_test      = NULL;
+    BasecTest*       read_file_test     = NULL;
+    BasecTest*       utf8_validate_test = NULL;
+    BasecTest*       utf8_length_test   = NULL;
+    BasecTest*       utf8_iterator_test = NULL;
     BasecTest*       destroy_test       = NULL;
     BasecTest*       destroy_array_test = NULL;
     BasecTestModule* string_module      = NULL;
 
     test_result = basec_test_create(
-        &create_test,
-        "test_string_create",
-        "Test the creation of a string",
-        &test_string_create
+        &create_test,
+        "test_string_create",
+        "Test the creation of a string",
+        &test_string_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &c_str_test,
+        "test_string_c_str",
+        "Test getting the c_str",
+        &test_string_c_str
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &length_test,
+        "test_string_length",
+        "Test getting the length of a string",
+        &test_string_length
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &capacity_test,
+        "test_string_capacity",
+        "Test getting the capacity of a string",
+        &test_string_capacity
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &prepend_test,
+        "test_string_prepend",
+        "Test prepending a string to a string",
+        &test_string_prepend
     );
-    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        return test_result;
+    }
     
     test_result = basec_test_create(
-        &c_str_test,
-        "test_string_c_str",
-        "Test getting the c_str",
-        &test_string_c_str
+        &append_test,
+        "test_string_append",
+        "Test appending a string to a string",
+        &test_string_append
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &length_test,
-        "test_string_length",
-        "Test getting the length of a string",
-        &test_string_length
+        &append_u64_test,
+        "test_string_append_u64",
+        "Test appending unsigned integers to a string",
+        &test_string_append_u64
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
         (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &capacity_test,
-        "test_string_capacity",
-        "Test getting the capacity of a string",
-        &test_string_capacity
+        &append_i64_test,
+        "test_string_append_i64",
+        "Test appending signed integers to a string",
+        &test_string_append_i64
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &append_f64_test,
+        "test_string_append_f64",
+        "Test appending doubles to a string",
+        &test_string_append_f64
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &append_hex_test,
+        "test_string_append_hex",
+        "Test appending hexadecimal integers to a string",
+        &test_string_append_hex
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &appendf_test,
+        "test_string_appendf",
+        "Test appending formatted text to a string",
+        &test_string_appendf
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &parse_u64_test,
+        "test_string_parse_u64",
+        "Test parsing unsigned integers from views",
+        &test_string_parse_u64
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &parse_i64_test,
+        "test_string_parse_i64",
+        "Test parsing signed integers from views",
+        &test_string_parse_i64
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &parse_f64_test,
+        "test_string_parse_f64",
+        "Test parsing doubles from views",
+        &test_string_parse_f64
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &strings_parse_test,
+        "test_string_strings_parse",
+        "Test parsing a split string into a typed array",
+        &test_string_strings_parse
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &push_test,
+        "test_string_push",
+        "Test pushing a string to a string",
+        &test_string_push
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &contains_test,
+        "test_string_contains",
+        "Test checking if a string contains a substring",
+        &test_string_contains
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &find_test,
+        "test_string_find",
+        "Test finding a substring in a string",
+        &test_string_find
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &find_all_test,
+        "test_string_find_all",
+        "Test finding all instances of a substring in a string",
+        &test_string_find_all
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &replace_test,
+        "test_string_replace",
+        "Test replacing a substring in a string",
+        &test_string_replace
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &split_test,
+        "test_string_split",
+        "Test splitting a string into an array of strings",
+        &test_string_split
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&c_str_test);
+        (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &to_lower_test,
+        "test_string_to_lower",
+        "Test converting a string to lower and uppercase",
+        &test_string_to_lower
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
         (void)basec_test_destroy(&c_str_test);
         (void)basec_test_destroy(&length_test);
+        (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &prepend_test,
-        "test_string_prepend",
-        "Test prepending a string to a string",
-        &test_string_prepend
+        &trim_test,
+        "test_string_trim",
+        "Test trimming whitespace from a string view",
+        &test_string_trim
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
         (void)basec_test_destroy(&c_str_test);
         (void)basec_test_destroy(&length_test);
         (void)basec_test_destroy(&capacity_test);
+        (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &append_test,
-        "test_string_append",
-        "Test appending a string to a string",
-        &test_string_append
+        &find_icase_test,
+        "test_string_find_icase",
+        "Test finding a substring ignoring case",
+        &test_string_find_icase
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1520,14 +3327,32 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&length_test);
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
+        (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &push_test,
-        "test_string_push",
-        "Test pushing a string to a string",
-        &test_string_push
+        &hash_test,
+        "test_string_hash",
+        "Test hashing the contents of a string",
+        &test_string_hash
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1536,14 +3361,32 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &contains_test,
-        "test_string_contains",
-        "Test checking if a string contains a substring",
-        &test_string_contains
+        &map_file_test,
+        "test_string_map_file",
+        "Test mapping a file into a string view",
+        &test_string_map_file
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1552,15 +3395,33 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &find_test,
-        "test_string_find",
-        "Test finding a substring in a string",
-        &test_string_find
+        &read_file_test,
+        "test_string_read_file",
+        "Test reading a file into a string",
+        &test_string_read_file
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1569,16 +3430,34 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &find_all_test,
-        "test_string_find_all",
-        "Test finding all instances of a substring in a string",
-        &test_string_find_all
+        &utf8_validate_test,
+        "test_string_utf8_validate",
+        "Test validating UTF-8",
+        &test_string_utf8_validate
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1587,17 +3466,35 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &replace_test,
-        "test_string_replace",
-        "Test replacing a substring in a string",
-        &test_string_replace
+        &utf8_length_test,
+        "test_string_utf8_length",
+        "Test counting and indexing UTF-8 codepoints",
+        &test_string_utf8_length
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1606,18 +3503,36 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
         return test_result;
     }
     
     test_result = basec_test_create(
-        &split_test,
-        "test_string_split",
-        "Test splitting a string into an array of strings",
-        &test_string_split
+        &utf8_iterator_test,
+        "test_string_utf8_iterator",
+        "Test iterating over UTF-8 codepoints",
+        &test_string_utf8_iterator
     );
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&create_test);
@@ -1626,14 +3541,32 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
         return test_result;
     }
-
+    
     test_result = basec_test_create(
         &destroy_test,
         "test_string_destroy",
@@ -1647,12 +3580,30 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         return test_result;
     }
     
@@ -1669,16 +3620,34 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         return test_result;
     }
-    
+
     test_result = basec_test_module_create(
         &string_module,
         "String"
@@ -1690,12 +3659,30 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         return test_result;
@@ -1709,12 +3696,30 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1728,12 +3733,30 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1746,12 +3769,30 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1763,12 +3804,30 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&capacity_test);
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1779,12 +3838,30 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&prepend_test);
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1794,12 +3871,282 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
     test_result = basec_test_module_add_test(string_module, append_test);
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&append_test);
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, append_u64_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&append_u64_test);
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, append_i64_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&append_i64_test);
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, append_f64_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&append_f64_test);
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, append_hex_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&append_hex_test);
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, appendf_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&appendf_test);
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, parse_u64_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&parse_u64_test);
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, parse_i64_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&parse_i64_test);
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, parse_f64_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&parse_f64_test);
+        (void)basec_test_destroy(&strings_parse_test);
+        (void)basec_test_destroy(&push_test);
+        (void)basec_test_destroy(&contains_test);
+        (void)basec_test_destroy(&find_test);
+        (void)basec_test_destroy(&find_all_test);
+        (void)basec_test_destroy(&replace_test);
+        (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, strings_parse_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&strings_parse_test);
         (void)basec_test_destroy(&push_test);
         (void)basec_test_destroy(&contains_test);
         (void)basec_test_destroy(&find_test);
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1814,6 +4161,15 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1827,6 +4183,15 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1839,6 +4204,15 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1850,6 +4224,15 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
         (void)basec_test_destroy(&find_all_test);
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1860,6 +4243,15 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&replace_test);
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
@@ -1869,12 +4261,138 @@ BasecTestResult test_string_add_tests(BasecTestSuite* test_suite) {
     test_result = basec_test_module_add_test(string_module, split_test);
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&split_test);
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
         (void)basec_test_destroy(&destroy_test);
         (void)basec_test_destroy(&destroy_array_test);
         (void)basec_test_module_destroy(&string_module);
         return test_result;
     }
-
+    
+    test_result = basec_test_module_add_test(string_module, to_lower_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&to_lower_test);
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, trim_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&trim_test);
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, find_icase_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&find_icase_test);
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, hash_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&hash_test);
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, map_file_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&map_file_test);
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, read_file_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&read_file_test);
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, utf8_validate_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&utf8_validate_test);
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, utf8_length_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&utf8_length_test);
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(string_module, utf8_iterator_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&utf8_iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_destroy(&destroy_array_test);
+        (void)basec_test_module_destroy(&string_module);
+        return test_result;
+    }
+    
     test_result = basec_test_module_add_test(string_module, destroy_test);
     if (test_result != BASEC_TEST_SUCCESS) {
         (void)basec_test_destroy(&destroy_test);
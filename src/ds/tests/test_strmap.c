@@ -0,0 +1,512 @@
+#include "ds/tests/test_strmap.h"
+
+/**
+ * @brief Test the creation of a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_create(c_str fail_message) {
+    BasecStrMapResult map_result = BASEC_STRMAP_SUCCESS;
+    BasecStrMap*      map        = NULL;
+
+    map_result = basec_strmap_create(&map, sizeof(u64), 100);
+    if (map_result != BASEC_STRMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    if (map->length != 0 || map->capacity < 100 || map->arena != NULL) {
+        (void)strncpy(
+            fail_message,
+            "String map fields do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+    (void)basec_strmap_destroy(&map);
+
+    map_result = basec_strmap_create(&map, sizeof(u64), 0);
+    if (map_result != BASEC_STRMAP_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Creating string map with no capacity succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    map_result = basec_strmap_create(NULL, sizeof(u64), 100);
+    if (map_result != BASEC_STRMAP_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Creating string map with NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test inserting short and long keys into a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_insert(c_str fail_message) {
+    BasecStrMapResult map_result = BASEC_STRMAP_SUCCESS;
+    BasecStrMap*      map        = NULL;
+    BasecStringView   key        = {0};
+    c8                buffer[64];
+    u64               value      = 0;
+
+    map_result = basec_strmap_create(&map, sizeof(u64), 1);
+    if (map_result != BASEC_STRMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // Every other key is too long to be stored inline
+    for (u64 i = 0; i < 1000; i++) {
+        key.data   = buffer;
+        key.length = (u64)snprintf(
+            buffer,
+            sizeof(buffer),
+            i % 2 == 0 ? "key-%lu" : "a-long-key-stored-in-the-arena-%lu",
+            (unsigned long)i
+        );
+        map_result = basec_strmap_insert(map, key, &i);
+        if (map_result != BASEC_STRMAP_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "String map insertion failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_strmap_destroy(&map);
+            return false;
+        }
+    }
+
+    key.data   = "a-long-key-stored-in-the-arena-999";
+    key.length = strlen(key.data);
+    map_result = basec_strmap_get(map, key, &value);
+    if (map_result != BASEC_STRMAP_SUCCESS || value != 999) {
+        (void)strncpy(
+            fail_message,
+            "Long key value does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+
+    // Lookups only read length bytes, so a key can be a slice of a line
+    key.data   = "key-998,key-2";
+    key.length = 7;
+    map_result = basec_strmap_get(map, key, &value);
+    if (map_result != BASEC_STRMAP_SUCCESS || value != 998) {
+        (void)strncpy(
+            fail_message,
+            "Short key value does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+
+    value      = 1;
+    map_result = basec_strmap_insert(map, key, &value);
+    if (map_result == BASEC_STRMAP_SUCCESS) {
+        map_result = basec_strmap_get(map, key, &value);
+    }
+    if (
+        map_result != BASEC_STRMAP_SUCCESS ||
+        value != 1 ||
+        map->length != 1000
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Inserting an existing key did not replace its value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+
+    key.length = 6;
+    map_result = basec_strmap_get(map, key, &value);
+    if (map_result != BASEC_STRMAP_NOT_FOUND) {
+        (void)strncpy(
+            fail_message,
+            "Found a prefix of an existing key",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+
+    map_result = basec_strmap_destroy(&map);
+    if (map_result != BASEC_STRMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String map destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test removing keys from a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_remove(c_str fail_message) {
+    BasecStrMapResult map_result = BASEC_STRMAP_SUCCESS;
+    BasecStrMap*      map        = NULL;
+    BasecStringView   key        = {0};
+    c8                buffer[64];
+    bool              contains   = false;
+
+    map_result = basec_strmap_create(&map, 0, 64);
+    if (map_result != BASEC_STRMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // Churn through long keys, the arena must not keep every removed key
+    key.data = buffer;
+    for (u64 i = 0; i < 10000; i++) {
+        key.length = (u64)snprintf(
+            buffer,
+            sizeof(buffer),
+            "session-token-%032lu",
+            (unsigned long)i
+        );
+        map_result = basec_strmap_insert(map, key, NULL);
+        if (map_result == BASEC_STRMAP_SUCCESS && i >= 16) {
+            key.length = (u64)snprintf(
+                buffer,
+                sizeof(buffer),
+                "session-token-%032lu",
+                (unsigned long)(i - 16)
+            );
+            map_result = basec_strmap_remove(map, key);
+        }
+        if (map_result != BASEC_STRMAP_SUCCESS) {
+            (void)strncpy(
+                fail_message,
+                "Inserting and removing keys failed",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_strmap_destroy(&map);
+            return false;
+        }
+    }
+
+    if (map->length != 16 || map->arena_length > 100 * key.length) {
+        (void)strncpy(
+            fail_message,
+            "String map size does not match expected value",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+
+    key.length = (u64)snprintf(
+        buffer,
+        sizeof(buffer),
+        "session-token-%032d",
+        9999
+    );
+    (void)basec_strmap_contains(map, key, &contains);
+    if (!contains) {
+        (void)strncpy(
+            fail_message,
+            "String map does not contain an existing key",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+
+    key.length = (u64)snprintf(
+        buffer,
+        sizeof(buffer),
+        "session-token-%032d",
+        0
+    );
+    map_result = basec_strmap_remove(map, key);
+    if (map_result != BASEC_STRMAP_NOT_FOUND) {
+        (void)strncpy(
+            fail_message,
+            "Removing a missing key succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+
+    (void)basec_strmap_destroy(&map);
+    return true;
+}
+
+/**
+ * @brief Test iterating over the entries of a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_iterator(c_str fail_message) {
+    BasecStrMapResult   map_result = BASEC_STRMAP_SUCCESS;
+    BasecStrMap*        map        = NULL;
+    BasecStrMapIterator iterator   = {0};
+    BasecStringView     key        = {0};
+    void*               value      = NULL;
+    c_str               words[3]   = {
+        "alpha",
+        "beta",
+        "a key long enough to live in the arena",
+    };
+    u64                 found      = 0;
+
+    map_result = basec_strmap_create(&map, sizeof(u64), 16);
+    if (map_result != BASEC_STRMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 3; i++) {
+        key.data   = words[i];
+        key.length = strlen(words[i]);
+        (void)basec_strmap_insert(map, key, &i);
+    }
+
+    (void)basec_strmap_iterator(map, &iterator);
+    while (
+        (map_result = basec_strmap_next(&iterator, &key, &value)) ==
+        BASEC_STRMAP_SUCCESS
+    ) {
+        u64 index = *(u64*)value;
+
+        if (
+            index < 3 &&
+            key.length == strlen(words[index]) &&
+            memcmp(key.data, words[index], key.length) == 0
+        ) found |= 1ULL << index;
+    }
+
+    if (map_result != BASEC_STRMAP_END_OF_MAP || found != 7) {
+        (void)strncpy(
+            fail_message,
+            "Iterated entries do not match expected values",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_strmap_destroy(&map);
+        return false;
+    }
+
+    (void)basec_strmap_destroy(&map);
+    return true;
+}
+
+/**
+ * @brief Test the destruction of a string map
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_strmap_destroy(c_str fail_message) {
+    BasecStrMapResult map_result = BASEC_STRMAP_SUCCESS;
+    BasecStrMap*      map        = NULL;
+
+    map_result = basec_strmap_create(&map, sizeof(u64), 16);
+    if (map_result != BASEC_STRMAP_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String map creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    map_result = basec_strmap_destroy(&map);
+    if (map_result != BASEC_STRMAP_SUCCESS || map != NULL) {
+        (void)strncpy(
+            fail_message,
+            "String map destruction failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    map_result = basec_strmap_destroy(&map);
+    if (map_result != BASEC_STRMAP_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Destroying NULL string map succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add StrMap tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+
+BasecTestResult test_strmap_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result   = BASEC_TEST_SUCCESS;
+    BasecTest*       create_test   = NULL;
+    BasecTest*       insert_test   = NULL;
+    BasecTest*       remove_test   = NULL;
+    BasecTest*       iterator_test = NULL;
+    BasecTest*       destroy_test  = NULL;
+    BasecTestModule* strmap_module = NULL;
+
+    test_result = basec_test_create(
+        &create_test,
+        "test_strmap_create",
+        "Test the creation of a string map",
+        &test_strmap_create
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &insert_test,
+        "test_strmap_insert",
+        "Test inserting short and long keys into a string map",
+        &test_strmap_insert
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &remove_test,
+        "test_strmap_remove",
+        "Test removing keys from a string map",
+        &test_strmap_remove
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &iterator_test,
+        "test_strmap_iterator",
+        "Test iterating over the entries of a string map",
+        &test_strmap_iterator
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &destroy_test,
+        "test_strmap_destroy",
+        "Test the destruction of a string map",
+        &test_strmap_destroy
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &strmap_module,
+        "StrMap"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(strmap_module, create_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&create_test);
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&strmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(strmap_module, insert_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&insert_test);
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&strmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(strmap_module, remove_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&remove_test);
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&strmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(strmap_module, iterator_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&iterator_test);
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&strmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(strmap_module, destroy_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&destroy_test);
+        (void)basec_test_module_destroy(&strmap_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, strmap_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&strmap_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
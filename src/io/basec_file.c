@@ -0,0 +1,1098 @@
+#include "io/basec_file.h"
+
+// Growth factor for reader buffers that cannot hold a full line
+static const u8 _GROWTH_FACTOR = 2;
+
+// Number of iovecs handed to a single writev call
+#define _BASEC_FILE_IOV_BATCH 64
+
+/**
+ * @brief Refill a reader's buffer, compacting unconsumed data to the front
+ * @param reader The reader to refill
+ * @return The result of the operation
+ */
+static BasecFileResult _basec_reader_fill(BasecReader* reader) {
+    if (reader == NULL) return BASEC_FILE_NULL_POINTER;
+
+    ssize_t bytes_read = 0;
+
+    if (reader->start > 0) {
+        if (reader->end > reader->start) {
+            (void)memmove(
+                reader->buffer,
+                reader->buffer + reader->start,
+                reader->end - reader->start
+            );
+        }
+        reader->end  -= reader->start;
+        reader->start = 0;
+    }
+
+    do {
+        bytes_read = read(
+            reader->fd,
+            reader->buffer + reader->end,
+            reader->capacity - reader->end
+        );
+    } while (bytes_read < 0 && errno == EINTR);
+    if (bytes_read < 0) return BASEC_FILE_READ_FAILURE;
+
+    if (bytes_read == 0) reader->eof = true;
+    reader->end += (u64)bytes_read;
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Write every byte described by an iovec array
+ * @param fd The file descriptor to write to
+ * @param iov The iovec array, modified in place on partial writes
+ * @param count The number of iovecs
+ * @return The result of the operation
+ */
+static BasecFileResult _basec_file_writev_all(
+    i32           fd,
+    struct iovec* iov,
+    i32           count
+) {
+    if (iov == NULL) return BASEC_FILE_NULL_POINTER;
+
+    ssize_t written = 0;
+
+    while (count > 0) {
+        written = writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return BASEC_FILE_WRITE_FAILURE;
+        }
+
+        while (count > 0 && (u64)written >= iov->iov_len) {
+            written -= (ssize_t)iov->iov_len;
+            iov++;
+            count--;
+        }
+
+        if (count > 0) {
+            iov->iov_base = (c8*)iov->iov_base + written;
+            iov->iov_len -= (u64)written;
+        }
+    }
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @struct _BasecFileRing
+ * @brief The shared memory of an io_uring instance
+ */
+typedef struct {
+    i32                  fd;
+    u32                  entries;
+    u32*                 sq_tail;
+    u32*                 sq_mask;
+    u32*                 sq_array;
+    u32*                 cq_head;
+    u32*                 cq_tail;
+    u32*                 cq_mask;
+    struct io_uring_sqe* sqes;
+    struct io_uring_cqe* cqes;
+    void*                sq_ring;
+    u64                  sq_ring_size;
+    void*                cq_ring;
+    u64                  cq_ring_size;
+    u64                  sqes_size;
+} _BasecFileRing;
+
+/**
+ * @struct _BasecFileSlot
+ * @brief A read in flight on an io_uring instance
+ */
+typedef struct {
+    u64          index;
+    i32          fd;
+    u64          size;
+    u64          offset;
+    struct iovec iov;
+} _BasecFileSlot;
+
+/**
+ * @struct _BasecFileWorkers
+ * @brief State shared by the threads of the thread backend
+ */
+typedef struct {
+    c_str*          paths;
+    u64             count;
+    BasecString**   strings;
+    atomic_ullong   next;
+    atomic_int      result;
+} _BasecFileWorkers;
+
+/**
+ * @brief Destroy an io_uring instance
+ * @param ring The ring to destroy
+ */
+static void _basec_file_ring_destroy(_BasecFileRing* ring) {
+    if (ring == NULL) return;
+
+    if (ring->sqes != NULL) (void)munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != NULL && ring->cq_ring != ring->sq_ring) {
+        (void)munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring != NULL) (void)munmap(ring->sq_ring, ring->sq_ring_size);
+    if (ring->fd >= 0) (void)close(ring->fd);
+
+    (void)memset(ring, 0, sizeof(_BasecFileRing));
+    ring->fd = -1;
+}
+
+/**
+ * @brief Create an io_uring instance
+ * @param ring The ring to create
+ * @param entries The number of submission queue entries
+ * @return The result of the operation
+ */
+static BasecFileResult _basec_file_ring_create(
+    _BasecFileRing* ring,
+    u32             entries
+) {
+    if (ring == NULL) return BASEC_FILE_NULL_POINTER;
+
+    struct io_uring_params params = {0};
+    u8*                    sq_ptr = NULL;
+    u8*                    cq_ptr = NULL;
+
+    (void)memset(ring, 0, sizeof(_BasecFileRing));
+
+    ring->fd = (i32)syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0) {
+        ring->fd = -1;
+        return BASEC_FILE_UNSUPPORTED;
+    }
+    ring->entries = params.sq_entries;
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(u32);
+    ring->cq_ring_size = params.cq_off.cqes +
+                         params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_ring_size > ring->sq_ring_size) {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    ring->sq_ring = mmap(
+        NULL,
+        ring->sq_ring_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        ring->fd,
+        IORING_OFF_SQ_RING
+    );
+    if (ring->sq_ring == MAP_FAILED) {
+        ring->sq_ring = NULL;
+        _basec_file_ring_destroy(ring);
+        return BASEC_FILE_UNSUPPORTED;
+    }
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cq_ring = ring->sq_ring;
+    } else {
+        ring->cq_ring = mmap(
+            NULL,
+            ring->cq_ring_size,
+            PROT_READ | PROT_WRITE,
+            MAP_SHARED | MAP_POPULATE,
+            ring->fd,
+            IORING_OFF_CQ_RING
+        );
+        if (ring->cq_ring == MAP_FAILED) {
+            ring->cq_ring = NULL;
+            _basec_file_ring_destroy(ring);
+            return BASEC_FILE_UNSUPPORTED;
+        }
+    }
+
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe*)mmap(
+        NULL,
+        ring->sqes_size,
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE,
+        ring->fd,
+        IORING_OFF_SQES
+    );
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        _basec_file_ring_destroy(ring);
+        return BASEC_FILE_UNSUPPORTED;
+    }
+
+    sq_ptr = (u8*)ring->sq_ring;
+    cq_ptr = (u8*)ring->cq_ring;
+
+    ring->sq_tail  = (u32*)(sq_ptr + params.sq_off.tail);
+    ring->sq_mask  = (u32*)(sq_ptr + params.sq_off.ring_mask);
+    ring->sq_array = (u32*)(sq_ptr + params.sq_off.array);
+    ring->cq_head  = (u32*)(cq_ptr + params.cq_off.head);
+    ring->cq_tail  = (u32*)(cq_ptr + params.cq_off.tail);
+    ring->cq_mask  = (u32*)(cq_ptr + params.cq_off.ring_mask);
+    ring->cqes     = (struct io_uring_cqe*)(cq_ptr + params.cq_off.cqes);
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Queue the next read of a slot on the submission ring
+ * @param ring The ring to queue the read on
+ * @param slots The slots of the batch
+ * @param slot The index of the slot to read into
+ * @param string The string the slot reads into
+ */
+static void _basec_file_ring_queue_read(
+    _BasecFileRing* ring,
+    _BasecFileSlot* slots,
+    u32             slot,
+    BasecString*    string
+) {
+    u32                  tail = *ring->sq_tail;
+    u32                  idx  = tail & *ring->sq_mask;
+    struct io_uring_sqe* sqe  = &ring->sqes[idx];
+
+    slots[slot].iov.iov_base = string->data + slots[slot].offset;
+    slots[slot].iov.iov_len  = slots[slot].size - slots[slot].offset;
+
+    (void)memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode    = IORING_OP_READV;
+    sqe->fd        = slots[slot].fd;
+    sqe->addr      = (u64)&slots[slot].iov;
+    sqe->len       = 1;
+    sqe->off       = slots[slot].offset;
+    sqe->user_data = slot;
+
+    ring->sq_array[idx] = idx;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Open a file and create a string sized to hold it
+ * @param path The path of the file to open
+ * @param fd_out The opened file descriptor
+ * @param size_out The size of the file
+ * @param string_out The string sized to hold the file
+ * @return The result of the operation
+ */
+static BasecFileResult _basec_file_open_sized(
+    c_str         path,
+    i32*          fd_out,
+    u64*          size_out,
+    BasecString** string_out
+) {
+    struct stat file_stat = {0};
+    i32         fd        = -1;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return BASEC_FILE_OPEN_FAILURE;
+
+    if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+        (void)close(fd);
+        return BASEC_FILE_OPEN_FAILURE;
+    }
+
+    if (basec_string_create(
+        string_out,
+        "",
+        file_stat.st_size > 0 ? (u64)file_stat.st_size : 1
+    ) != BASEC_STRING_SUCCESS) {
+        (void)close(fd);
+        return BASEC_FILE_STRING_FAILURE;
+    }
+
+    *fd_out   = fd;
+    *size_out = (u64)file_stat.st_size;
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Read a batch of files with io_uring
+ * @param ring The ring to read the files with
+ * @param paths The paths of the files to read
+ * @param count The number of paths
+ * @param queue_depth The number of reads to keep in flight
+ * @param strings The strings to read the files into
+ * @return The result of the operation
+ */
+static BasecFileResult _basec_file_read_batch_io_uring(
+    _BasecFileRing* ring,
+    c_str*          paths,
+    u64             count,
+    u32             queue_depth,
+    BasecString**   strings
+) {
+    BasecFileResult      file_result = BASEC_FILE_SUCCESS;
+    _BasecFileSlot*      slots       = NULL;
+    u32*                 free_slots  = NULL;
+    u32                  free_count  = 0;
+    u32                  in_flight   = 0;
+    u32                  pending     = 0;
+    u64                  next        = 0;
+    u32                  head        = 0;
+    u32                  slot        = 0;
+    i32                  res         = 0;
+    i32                  enter_res   = 0;
+    struct io_uring_cqe* cqe         = NULL;
+
+    if (queue_depth > ring->entries) queue_depth = ring->entries;
+
+    slots      = (_BasecFileSlot*)malloc(queue_depth * sizeof(_BasecFileSlot));
+    free_slots = (u32*)malloc(queue_depth * sizeof(u32));
+    if (slots == NULL || free_slots == NULL) {
+        free(slots);
+        free(free_slots);
+        return BASEC_FILE_ALLOCATION_FAILURE;
+    }
+
+    for (u32 i = 0; i < queue_depth; i++) free_slots[i] = queue_depth - 1 - i;
+    free_count = queue_depth;
+
+    // On failure stop queueing new files, but drain reads already in flight
+    // since the kernel may still be writing into their strings
+    while (in_flight > 0 || (next < count && file_result == BASEC_FILE_SUCCESS)) {
+        while (
+            file_result == BASEC_FILE_SUCCESS &&
+            free_count > 0 && next < count
+        ) {
+            slot = free_slots[free_count - 1];
+
+            file_result = _basec_file_open_sized(
+                paths[next],
+                &slots[slot].fd,
+                &slots[slot].size,
+                &strings[next]
+            );
+            if (file_result != BASEC_FILE_SUCCESS) break;
+
+            if (slots[slot].size == 0) {
+                (void)close(slots[slot].fd);
+                next++;
+                continue;
+            }
+
+            slots[slot].index  = next;
+            slots[slot].offset = 0;
+            _basec_file_ring_queue_read(ring, slots, slot, strings[next]);
+
+            free_count--;
+            in_flight++;
+            pending++;
+            next++;
+        }
+
+        if (in_flight == 0) break;
+
+        enter_res = (i32)syscall(
+            __NR_io_uring_enter,
+            ring->fd,
+            pending,
+            1,
+            IORING_ENTER_GETEVENTS,
+            NULL,
+            0
+        );
+        if (enter_res < 0) {
+            if (errno == EINTR) continue;
+            // Nothing can be reaped if the ring itself is broken
+            file_result = BASEC_FILE_READ_FAILURE;
+            break;
+        }
+        pending -= (u32)enter_res < pending ? (u32)enter_res : pending;
+
+        head = *ring->cq_head;
+        while (head != __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE)) {
+            cqe  = &ring->cqes[head & *ring->cq_mask];
+            slot = (u32)cqe->user_data;
+            res  = cqe->res;
+            head++;
+
+            if (res == -EINTR || res == -EAGAIN) {
+                _basec_file_ring_queue_read(
+                    ring,
+                    slots,
+                    slot,
+                    strings[slots[slot].index]
+                );
+                pending++;
+                continue;
+            }
+
+            if (res < 0) {
+                file_result = BASEC_FILE_READ_FAILURE;
+            } else {
+                slots[slot].offset += (u64)res;
+            }
+
+            if (
+                res > 0 && file_result == BASEC_FILE_SUCCESS &&
+                slots[slot].offset < slots[slot].size
+            ) {
+                _basec_file_ring_queue_read(
+                    ring,
+                    slots,
+                    slot,
+                    strings[slots[slot].index]
+                );
+                pending++;
+                continue;
+            }
+
+            strings[slots[slot].index]->length = slots[slot].offset;
+            strings[slots[slot].index]->data[slots[slot].offset] = '\0';
+            (void)close(slots[slot].fd);
+
+            free_slots[free_count++] = slot;
+            in_flight--;
+        }
+        __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    }
+
+    free(slots);
+    free(free_slots);
+    return file_result;
+}
+
+/**
+ * @brief Read files claimed from a shared counter until none remain
+ * @param arg The shared worker state
+ * @return NULL
+ */
+static void* _basec_file_worker(void* arg) {
+    _BasecFileWorkers* workers = (_BasecFileWorkers*)arg;
+    u64                index   = 0;
+
+    while (atomic_load(&workers->result) == BASEC_FILE_SUCCESS) {
+        index = atomic_fetch_add(&workers->next, 1);
+        if (index >= workers->count) break;
+
+        if (basec_string_read_file(
+            workers->paths[index],
+            &workers->strings[index]
+        ) != BASEC_STRING_SUCCESS) {
+            atomic_store(&workers->result, BASEC_FILE_READ_FAILURE);
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Read a batch of files with a pool of threads
+ * @param paths The paths of the files to read
+ * @param count The number of paths
+ * @param thread_count The number of threads to read with
+ * @param strings The strings to read the files into
+ * @return The result of the operation
+ */
+static BasecFileResult _basec_file_read_batch_threads(
+    c_str*        paths,
+    u64           count,
+    u32           thread_count,
+    BasecString** strings
+) {
+    _BasecFileWorkers workers = {
+        .paths   = paths,
+        .count   = count,
+        .strings = strings
+    };
+    pthread_t*        threads = NULL;
+    u32               started = 0;
+
+    atomic_init(&workers.next, 0);
+    atomic_init(&workers.result, BASEC_FILE_SUCCESS);
+
+    if (thread_count > count) thread_count = (u32)count;
+
+    // The calling thread reads too, so one less thread is started
+    if (thread_count > 1) {
+        threads = (pthread_t*)malloc((thread_count - 1) * sizeof(pthread_t));
+        if (threads == NULL) return BASEC_FILE_ALLOCATION_FAILURE;
+
+        for (u32 i = 0; i < thread_count - 1; i++) {
+            if (pthread_create(
+                &threads[started],
+                NULL,
+                _basec_file_worker,
+                &workers
+            ) != 0) break;
+            started++;
+        }
+    }
+
+    (void)_basec_file_worker(&workers);
+
+    for (u32 i = 0; i < started; i++) (void)pthread_join(threads[i], NULL);
+    free(threads);
+
+    return (BasecFileResult)atomic_load(&workers.result);
+}
+
+/**
+ * @brief Handle the result of a file operation
+ * @param result The result of the operation
+ */
+void basec_file_handle_result(BasecFileResult result) {
+    switch (result) {
+        case BASEC_FILE_SUCCESS:
+            break;
+        case BASEC_FILE_NULL_POINTER:
+            (void)printf(
+                "[Error][File] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_FILE_INVALID_CAPACITY:
+            (void)printf(
+                "[Error][File] "
+                "Operation failed due to an invalid buffer size.\n"
+            );
+            exit(1);
+        case BASEC_FILE_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][File] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        case BASEC_FILE_OPEN_FAILURE:
+            (void)printf(
+                "[Error][File] "
+                "Operation failed because the file could not be opened.\n"
+            );
+            exit(1);
+        case BASEC_FILE_READ_FAILURE:
+            (void)printf(
+                "[Error][File] "
+                "Operation failed because the file could not be read.\n"
+            );
+            exit(1);
+        case BASEC_FILE_WRITE_FAILURE:
+            (void)printf(
+                "[Error][File] "
+                "Operation failed because the file could not be written.\n"
+            );
+            exit(1);
+        case BASEC_FILE_END_OF_FILE:
+            (void)printf(
+                "[Error][File] "
+                "Operation failed due to reaching the end of the file.\n"
+            );
+            exit(1);
+        case BASEC_FILE_UNSUPPORTED:
+            (void)printf(
+                "[Error][File] "
+                "Operation failed because the backend is not supported.\n"
+            );
+            exit(1);
+        case BASEC_FILE_STRING_FAILURE:
+            (void)printf(
+                "[Error][File] A string operation failed.\n"
+            );
+            exit(1);
+        case BASEC_FILE_ARRAY_FAILURE:
+            (void)printf(
+                "[Error][File] An array operation failed.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][File] "
+                "An unknown error occurred during file operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Read a batch of files into strings
+ * @param paths The paths of the files to read
+ * @param count The number of paths
+ * @param backend The backend to read the files with
+ * @param queue_depth The number of reads to keep in flight
+ * @param strings_out The array of BasecString* to store the files in
+ * @return The result of the operation
+ */
+BasecFileResult basec_file_read_batch(
+    c_str*           paths,
+    u64              count,
+    BasecFileBackend backend,
+    u32              queue_depth,
+    BasecArray**     strings_out
+) {
+    if (paths == NULL || strings_out == NULL) return BASEC_FILE_NULL_POINTER;
+    if (queue_depth == 0) return BASEC_FILE_INVALID_CAPACITY;
+
+    BasecFileResult  file_result  = BASEC_FILE_SUCCESS;
+    BasecArrayResult array_result = BASEC_ARRAY_SUCCESS;
+    BasecArray*      array        = NULL;
+    BasecString**    strings      = NULL;
+    _BasecFileRing   ring         = {.fd = -1};
+
+    for (u64 i = 0; i < count; i++) {
+        if (paths[i] == NULL) return BASEC_FILE_NULL_POINTER;
+    }
+
+    strings = (BasecString**)calloc(count > 0 ? count : 1, sizeof(BasecString*));
+    if (strings == NULL) return BASEC_FILE_ALLOCATION_FAILURE;
+
+    if (
+        backend == BASEC_FILE_BACKEND_AUTO ||
+        backend == BASEC_FILE_BACKEND_IO_URING
+    ) {
+        file_result = _basec_file_ring_create(&ring, queue_depth);
+        if (file_result == BASEC_FILE_SUCCESS) {
+            backend = BASEC_FILE_BACKEND_IO_URING;
+        } else if (backend == BASEC_FILE_BACKEND_AUTO) {
+            backend     = BASEC_FILE_BACKEND_THREADS;
+            file_result = BASEC_FILE_SUCCESS;
+        }
+    }
+
+    if (file_result == BASEC_FILE_SUCCESS) {
+        switch (backend) {
+            case BASEC_FILE_BACKEND_IO_URING:
+                file_result = _basec_file_read_batch_io_uring(
+                    &ring,
+                    paths,
+                    count,
+                    queue_depth,
+                    strings
+                );
+                _basec_file_ring_destroy(&ring);
+                break;
+            case BASEC_FILE_BACKEND_THREADS:
+                file_result = _basec_file_read_batch_threads(
+                    paths,
+                    count,
+                    queue_depth,
+                    strings
+                );
+                break;
+            default:
+                for (u64 i = 0; i < count; i++) {
+                    if (basec_string_read_file(paths[i], &strings[i]) !=
+                        BASEC_STRING_SUCCESS) {
+                        file_result = BASEC_FILE_READ_FAILURE;
+                        break;
+                    }
+                }
+                break;
+        }
+    }
+
+    if (file_result == BASEC_FILE_SUCCESS) {
+        array_result = basec_array_create(
+            &array,
+            sizeof(BasecString*),
+            count > 0 ? count : 1
+        );
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            file_result = BASEC_FILE_ARRAY_FAILURE;
+        }
+    }
+
+    for (u64 i = 0; i < count && file_result == BASEC_FILE_SUCCESS; i++) {
+        array_result = basec_array_append(array, &strings[i]);
+        if (array_result != BASEC_ARRAY_SUCCESS) {
+            file_result = BASEC_FILE_ARRAY_FAILURE;
+        }
+    }
+
+    if (file_result != BASEC_FILE_SUCCESS) {
+        for (u64 i = 0; i < count; i++) {
+            if (strings[i] != NULL) (void)basec_string_destroy(&strings[i]);
+        }
+        if (array != NULL) (void)basec_array_destroy(&array);
+        free(strings);
+        return file_result;
+    }
+    free(strings);
+
+    if (*strings_out != NULL) (void)basec_strings_destroy(strings_out);
+    *strings_out = array;
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Open a file for buffered reading
+ * @param reader The reader to create
+ * @param path The path of the file to read
+ * @param buffer_size The size of the read buffer
+ * @return The result of the operation
+ */
+BasecFileResult basec_reader_open(
+    BasecReader** reader,
+    const c_str   path,
+    u64           buffer_size
+) {
+    if (reader == NULL || path == NULL) return BASEC_FILE_NULL_POINTER;
+    if (buffer_size == 0) return BASEC_FILE_INVALID_CAPACITY;
+
+    i32 fd = open(path, O_RDONLY);
+    if (fd < 0) return BASEC_FILE_OPEN_FAILURE;
+
+    // Readers only move forward, let the kernel read ahead aggressively
+    (void)posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    *reader = (BasecReader*)malloc(sizeof(BasecReader));
+    if (*reader == NULL) {
+        (void)close(fd);
+        return BASEC_FILE_ALLOCATION_FAILURE;
+    }
+
+    (*reader)->buffer = (c_str)malloc(buffer_size);
+    if ((*reader)->buffer == NULL) {
+        free(*reader);
+        *reader = NULL;
+        (void)close(fd);
+        return BASEC_FILE_ALLOCATION_FAILURE;
+    }
+
+    (*reader)->fd       = fd;
+    (*reader)->capacity = buffer_size;
+    (*reader)->start    = 0;
+    (*reader)->end      = 0;
+    (*reader)->eof      = false;
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Read up to size bytes from the reader
+ * @param reader The reader to read from
+ * @param data_out The buffer to read into
+ * @param size The maximum number of bytes to read
+ * @param read_out The number of bytes read
+ * @return The result of the operation
+ */
+BasecFileResult basec_reader_read(
+    BasecReader* reader,
+    void*        data_out,
+    u64          size,
+    u64*         read_out
+) {
+    if (reader == NULL || data_out == NULL || read_out == NULL) {
+        return BASEC_FILE_NULL_POINTER;
+    }
+
+    BasecFileResult file_result = BASEC_FILE_SUCCESS;
+    u64             total       = 0;
+    u64             available   = 0;
+    ssize_t         bytes_read  = 0;
+
+    while (total < size) {
+        available = reader->end - reader->start;
+
+        if (available > 0) {
+            if (available > size - total) available = size - total;
+
+            (void)memcpy(
+                (c8*)data_out + total,
+                reader->buffer + reader->start,
+                available
+            );
+            reader->start += available;
+            total         += available;
+            continue;
+        }
+
+        if (reader->eof) break;
+
+        // Large requests bypass the buffer and go straight to the caller
+        if (size - total >= reader->capacity) {
+            bytes_read = read(reader->fd, (c8*)data_out + total, size - total);
+            if (bytes_read < 0) {
+                if (errno == EINTR) continue;
+                return BASEC_FILE_READ_FAILURE;
+            }
+            if (bytes_read == 0) reader->eof = true;
+            total += (u64)bytes_read;
+            continue;
+        }
+
+        file_result = _basec_reader_fill(reader);
+        if (file_result != BASEC_FILE_SUCCESS) return file_result;
+    }
+
+    *read_out = total;
+    if (total == 0 && size > 0) return BASEC_FILE_END_OF_FILE;
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Read the next line from the reader
+ * @param reader The reader to read from
+ * @param line_out The view to store the line in
+ * @return The result of the operation
+ */
+BasecFileResult basec_reader_read_line(
+    BasecReader*     reader,
+    BasecStringView* line_out
+) {
+    if (reader == NULL || line_out == NULL) return BASEC_FILE_NULL_POINTER;
+
+    BasecFileResult file_result = BASEC_FILE_SUCCESS;
+    u64             scanned     = 0;
+    c_str           newline     = NULL;
+    c_str           new_buffer  = NULL;
+
+    while (true) {
+        newline = (c_str)memchr(
+            reader->buffer + reader->start + scanned,
+            '\n',
+            reader->end - reader->start - scanned
+        );
+
+        if (newline != NULL) {
+            line_out->data   = reader->buffer + reader->start;
+            line_out->length = (u64)(newline - line_out->data);
+            reader->start    = (u64)(newline - reader->buffer) + 1;
+            return BASEC_FILE_SUCCESS;
+        }
+        scanned = reader->end - reader->start;
+
+        if (reader->eof) {
+            if (scanned == 0) return BASEC_FILE_END_OF_FILE;
+
+            line_out->data   = reader->buffer + reader->start;
+            line_out->length = scanned;
+            reader->start    = reader->end;
+            return BASEC_FILE_SUCCESS;
+        }
+
+        if (reader->start == 0 && reader->end == reader->capacity) {
+            new_buffer = (c_str)realloc(
+                reader->buffer,
+                reader->capacity * _GROWTH_FACTOR
+            );
+            if (new_buffer == NULL) return BASEC_FILE_ALLOCATION_FAILURE;
+
+            reader->buffer    = new_buffer;
+            reader->capacity *= _GROWTH_FACTOR;
+        }
+
+        file_result = _basec_reader_fill(reader);
+        if (file_result != BASEC_FILE_SUCCESS) return file_result;
+    }
+}
+
+/**
+ * @brief Close a reader
+ * @param reader The reader to close
+ * @return The result of the operation
+ */
+BasecFileResult basec_reader_close(BasecReader** reader) {
+    if (reader == NULL || *reader == NULL) return BASEC_FILE_NULL_POINTER;
+
+    (void)close((*reader)->fd);
+    free((*reader)->buffer);
+    free(*reader);
+    *reader = NULL;
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Open a file for buffered writing, truncating it if it exists
+ * @param writer The writer to create
+ * @param path The path of the file to write
+ * @param buffer_size The size of the write buffer
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_open(
+    BasecWriter** writer,
+    const c_str   path,
+    u64           buffer_size
+) {
+    if (writer == NULL || path == NULL) return BASEC_FILE_NULL_POINTER;
+    if (buffer_size == 0) return BASEC_FILE_INVALID_CAPACITY;
+
+    i32 fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return BASEC_FILE_OPEN_FAILURE;
+
+    *writer = (BasecWriter*)malloc(sizeof(BasecWriter));
+    if (*writer == NULL) {
+        (void)close(fd);
+        return BASEC_FILE_ALLOCATION_FAILURE;
+    }
+
+    (*writer)->buffer = (c_str)malloc(buffer_size);
+    if ((*writer)->buffer == NULL) {
+        free(*writer);
+        *writer = NULL;
+        (void)close(fd);
+        return BASEC_FILE_ALLOCATION_FAILURE;
+    }
+
+    (*writer)->fd       = fd;
+    (*writer)->capacity = buffer_size;
+    (*writer)->length   = 0;
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Write bytes to the writer
+ * @param writer The writer to write to
+ * @param data The bytes to write
+ * @param size The number of bytes to write
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_write(
+    BasecWriter* writer,
+    const void*  data,
+    u64          size
+) {
+    if (writer == NULL || data == NULL) return BASEC_FILE_NULL_POINTER;
+
+    BasecStringView view = {
+        .data   = (c_str)data,
+        .length = size
+    };
+
+    return basec_writer_writev(writer, &view, 1);
+}
+
+/**
+ * @brief Write a string to the writer
+ * @param writer The writer to write to
+ * @param string The string to write
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_write_string(
+    BasecWriter* writer,
+    BasecString* string
+) {
+    if (writer == NULL || string == NULL) return BASEC_FILE_NULL_POINTER;
+
+    return basec_writer_write(writer, string->data, string->length);
+}
+
+/**
+ * @brief Write a string view to the writer
+ * @param writer The writer to write to
+ * @param view The view to write
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_write_view(
+    BasecWriter*    writer,
+    BasecStringView view
+) {
+    if (writer == NULL || view.data == NULL) return BASEC_FILE_NULL_POINTER;
+
+    return basec_writer_writev(writer, &view, 1);
+}
+
+/**
+ * @brief Write several views to the writer in one batch
+ * @param writer The writer to write to
+ * @param views The views to write
+ * @param count The number of views
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_writev(
+    BasecWriter*     writer,
+    BasecStringView* views,
+    u64              count
+) {
+    if (writer == NULL || views == NULL) return BASEC_FILE_NULL_POINTER;
+
+    BasecFileResult file_result = BASEC_FILE_SUCCESS;
+    struct iovec    iov[_BASEC_FILE_IOV_BATCH];
+    i32             iov_count   = 0;
+    u64             total       = 0;
+
+    for (u64 i = 0; i < count; i++) total += views[i].length;
+
+    if (writer->length + total <= writer->capacity) {
+        for (u64 i = 0; i < count; i++) {
+            (void)memcpy(
+                writer->buffer + writer->length,
+                views[i].data,
+                views[i].length
+            );
+            writer->length += views[i].length;
+        }
+        return BASEC_FILE_SUCCESS;
+    }
+
+    if (writer->length > 0) {
+        iov[iov_count].iov_base = writer->buffer;
+        iov[iov_count].iov_len  = writer->length;
+        iov_count++;
+    }
+
+    for (u64 i = 0; i < count; i++) {
+        if (views[i].length == 0) continue;
+
+        iov[iov_count].iov_base = views[i].data;
+        iov[iov_count].iov_len  = views[i].length;
+        iov_count++;
+
+        if (iov_count == _BASEC_FILE_IOV_BATCH) {
+            file_result = _basec_file_writev_all(writer->fd, iov, iov_count);
+            if (file_result != BASEC_FILE_SUCCESS) return file_result;
+
+            writer->length = 0;
+            iov_count      = 0;
+        }
+    }
+
+    if (iov_count > 0) {
+        file_result = _basec_file_writev_all(writer->fd, iov, iov_count);
+        if (file_result != BASEC_FILE_SUCCESS) return file_result;
+    }
+    writer->length = 0;
+
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Flush buffered data to the file
+ * @param writer The writer to flush
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_flush(BasecWriter* writer) {
+    if (writer == NULL) return BASEC_FILE_NULL_POINTER;
+    if (writer->length == 0) return BASEC_FILE_SUCCESS;
+
+    BasecFileResult file_result = BASEC_FILE_SUCCESS;
+    struct iovec    iov         = {
+        .iov_base = writer->buffer,
+        .iov_len  = writer->length
+    };
+
+    file_result = _basec_file_writev_all(writer->fd, &iov, 1);
+    if (file_result != BASEC_FILE_SUCCESS) return file_result;
+
+    writer->length = 0;
+    return BASEC_FILE_SUCCESS;
+}
+
+/**
+ * @brief Flush and close a writer
+ * @param writer The writer to close
+ * @return The result of the operation
+ */
+BasecFileResult basec_writer_close(BasecWriter** writer) {
+    if (writer == NULL || *writer == NULL) return BASEC_FILE_NULL_POINTER;
+
+    BasecFileResult file_result = basec_writer_flush(*writer);
+
+    if (close((*writer)->fd) != 0 && file_result == BASEC_FILE_SUCCESS) {
+        file_result = BASEC_FILE_WRITE_FAILURE;
+    }
+    free((*writer)->buffer);
+    free(*writer);
+    *writer = NULL;
+
+    return file_result;
+}
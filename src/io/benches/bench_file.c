@@ -0,0 +1,132 @@
+#include "io/benches/bench_file.h"
+
+#define _BENCH_FILE_BATCH_COUNT      2000
+#define _BENCH_FILE_BATCH_FILE_SIZE  4096
+#define _BENCH_FILE_BATCH_ITERATIONS 5
+
+/**
+ * @brief Time one backend and queue depth over the benchmark files
+ * @param name The name to report the measurement under
+ * @param paths The paths of the benchmark files
+ * @param backend The backend to read with
+ * @param queue_depth The queue depth to read with
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_file_read_batch_backend(
+    c_str            name,
+    c_str*           paths,
+    BasecFileBackend backend,
+    u32              queue_depth
+) {
+    BasecBenchTimer timer       = {0};
+    u64             elapsed_ns  = 0;
+    BasecArray*     strings     = NULL;
+    BasecFileResult file_result = BASEC_FILE_SUCCESS;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_FILE_BATCH_ITERATIONS; i++) {
+        file_result = basec_file_read_batch(
+            paths,
+            _BENCH_FILE_BATCH_COUNT,
+            backend,
+            queue_depth,
+            &strings
+        );
+        if (file_result == BASEC_FILE_UNSUPPORTED) {
+            (void)printf("  %-40s unsupported\n", name);
+            return BASEC_BENCH_SUCCESS;
+        }
+        if (file_result != BASEC_FILE_SUCCESS) return BASEC_BENCH_RUN_FAILURE;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    (void)basec_strings_destroy(&strings);
+    return basec_bench_print(
+        name,
+        _BENCH_FILE_BATCH_ITERATIONS * _BENCH_FILE_BATCH_COUNT,
+        _BENCH_FILE_BATCH_FILE_SIZE,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark reading a batch of small files with each backend
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_file_read_batch(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    c8               contents[_BENCH_FILE_BATCH_FILE_SIZE];
+    c8               (*paths)[64] = NULL;
+    c_str*           path_ptrs    = NULL;
+    FILE*            file         = NULL;
+    u32              depths[3]    = {8, 64, 256};
+    c8               name[64];
+
+    paths     = malloc(_BENCH_FILE_BATCH_COUNT * sizeof(*paths));
+    path_ptrs = (c_str*)malloc(_BENCH_FILE_BATCH_COUNT * sizeof(c_str));
+    if (paths == NULL || path_ptrs == NULL) {
+        free(paths);
+        free(path_ptrs);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+
+    (void)memset(contents, 'x', sizeof(contents));
+    for (u64 i = 0; i < _BENCH_FILE_BATCH_COUNT; i++) {
+        (void)snprintf(paths[i], sizeof(paths[i]), "/tmp/basec_bench_file_%lu", i);
+        path_ptrs[i] = paths[i];
+
+        file = fopen(paths[i], "w");
+        if (file == NULL) {
+            bench_result = BASEC_BENCH_RUN_FAILURE;
+            break;
+        }
+        (void)fwrite(contents, 1, sizeof(contents), file);
+        (void)fclose(file);
+    }
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = _bench_file_read_batch_backend(
+            "read_batch blocking",
+            path_ptrs,
+            BASEC_FILE_BACKEND_BLOCKING,
+            1
+        );
+    }
+
+    for (u64 i = 0; i < 3 && bench_result == BASEC_BENCH_SUCCESS; i++) {
+        (void)snprintf(name, sizeof(name), "read_batch threads (depth %u)", depths[i]);
+        bench_result = _bench_file_read_batch_backend(
+            name,
+            path_ptrs,
+            BASEC_FILE_BACKEND_THREADS,
+            depths[i]
+        );
+        if (bench_result != BASEC_BENCH_SUCCESS) break;
+
+        (void)snprintf(name, sizeof(name), "read_batch io_uring (depth %u)", depths[i]);
+        bench_result = _bench_file_read_batch_backend(
+            name,
+            path_ptrs,
+            BASEC_FILE_BACKEND_IO_URING,
+            depths[i]
+        );
+    }
+
+    for (u64 i = 0; i < _BENCH_FILE_BATCH_COUNT; i++) (void)remove(paths[i]);
+    free(paths);
+    free(path_ptrs);
+    return bench_result;
+}
+
+/**
+ * @brief Run the File benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_file_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("File");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return bench_file_read_batch();
+}
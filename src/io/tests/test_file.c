@@ -0,0 +1,722 @@
+#include "io/tests/test_file.h"
+
+/**
+ * @brief Test opening a reader
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_reader_open(c_str fail_message) {
+    BasecFileResult file_result = BASEC_FILE_SUCCESS;
+    BasecReader*    reader      = NULL;
+    c_str           path        = "/tmp/basec_test_reader_open.txt";
+    FILE*           file        = NULL;
+
+    file = fopen(path, "w");
+    if (file == NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create test file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    (void)fclose(file);
+
+    file_result = basec_reader_open(&reader, path, 64);
+    if (file_result != BASEC_FILE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to open reader",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_reader_close(&reader);
+    if (file_result != BASEC_FILE_SUCCESS || reader != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to close reader",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_reader_open(&reader, path, 0);
+    if (file_result != BASEC_FILE_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Opening reader with zero buffer succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_reader_open(&reader, "/tmp/basec_missing_file", 64);
+    if (file_result != BASEC_FILE_OPEN_FAILURE) {
+        (void)strncpy(
+            fail_message,
+            "Opening missing file succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_reader_open(NULL, path, 64);
+    if (file_result != BASEC_FILE_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Opening reader with NULL pointer succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    (void)remove(path);
+    return true;
+}
+
+/**
+ * @brief Test reading bytes from a reader
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_reader_read(c_str fail_message) {
+    BasecFileResult file_result = BASEC_FILE_SUCCESS;
+    BasecReader*    reader      = NULL;
+    c_str           path        = "/tmp/basec_test_reader_read.txt";
+    c_str           contents    = "0123456789abcdefghijklmnopqrstuvwxyz";
+    c8              buffer[64]  = {0};
+    u64             read_count  = 0;
+    FILE*           file        = NULL;
+
+    file = fopen(path, "w");
+    if (file == NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create test file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    (void)fputs(contents, file);
+    (void)fclose(file);
+
+    file_result = basec_reader_open(&reader, path, 8);
+    if (file_result != BASEC_FILE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to open reader",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_reader_read(reader, buffer, 4, &read_count);
+    if (
+        file_result != BASEC_FILE_SUCCESS ||
+        read_count  != 4                  ||
+        memcmp(buffer, "0123", 4) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Buffered read returned unexpected data",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_reader_close(&reader);
+        return false;
+    }
+
+    file_result = basec_reader_read(reader, buffer, sizeof(buffer), &read_count);
+    if (
+        file_result != BASEC_FILE_SUCCESS        ||
+        read_count  != strlen(contents) - 4      ||
+        memcmp(buffer, contents + 4, read_count) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Large read returned unexpected data",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_reader_close(&reader);
+        return false;
+    }
+
+    file_result = basec_reader_read(reader, buffer, sizeof(buffer), &read_count);
+    if (file_result != BASEC_FILE_END_OF_FILE || read_count != 0) {
+        (void)strncpy(
+            fail_message,
+            "Reading past the end did not report end of file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_reader_close(&reader);
+        return false;
+    }
+
+    file_result = basec_reader_read(NULL, buffer, 4, &read_count);
+    if (file_result != BASEC_FILE_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Reading with NULL pointer succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_reader_close(&reader);
+        return false;
+    }
+
+    (void)basec_reader_close(&reader);
+    (void)remove(path);
+    return true;
+}
+
+/**
+ * @brief Test reading lines from a reader
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_reader_read_line(c_str fail_message) {
+    BasecFileResult file_result = BASEC_FILE_SUCCESS;
+    BasecReader*    reader      = NULL;
+    BasecStringView line        = {0};
+    c_str           path        = "/tmp/basec_test_reader_read_line.txt";
+    c_str           lines[4]    = {
+        "short",
+        "",
+        "a line much longer than the reader buffer",
+        "no trailing newline"
+    };
+    FILE*           file        = NULL;
+
+    file = fopen(path, "w");
+    if (file == NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to create test file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    (void)fprintf(file, "%s\n%s\n%s\n%s", lines[0], lines[1], lines[2], lines[3]);
+    (void)fclose(file);
+
+    file_result = basec_reader_open(&reader, path, 8);
+    if (file_result != BASEC_FILE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to open reader",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 4; i++) {
+        file_result = basec_reader_read_line(reader, &line);
+        if (
+            file_result != BASEC_FILE_SUCCESS ||
+            line.length != strlen(lines[i])   ||
+            memcmp(line.data, lines[i], line.length) != 0
+        ) {
+            (void)strncpy(
+                fail_message,
+                "Read line does not match the expected line",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            (void)basec_reader_close(&reader);
+            return false;
+        }
+    }
+
+    file_result = basec_reader_read_line(reader, &line);
+    if (file_result != BASEC_FILE_END_OF_FILE) {
+        (void)strncpy(
+            fail_message,
+            "Reading past the last line did not report end of file",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_reader_close(&reader);
+        return false;
+    }
+
+    file_result = basec_reader_read_line(reader, NULL);
+    if (file_result != BASEC_FILE_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Reading line with NULL pointer succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_reader_close(&reader);
+        return false;
+    }
+
+    (void)basec_reader_close(&reader);
+    (void)remove(path);
+    return true;
+}
+
+/**
+ * @brief Test reading a batch of files with every backend
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_read_batch(c_str fail_message) {
+    BasecFileResult  file_result = BASEC_FILE_SUCCESS;
+    BasecArray*      strings     = NULL;
+    BasecString*     string      = NULL;
+    c8               paths[20][64];
+    c_str            path_ptrs[20];
+    FILE*            file        = NULL;
+    BasecFileBackend backends[4] = {
+        BASEC_FILE_BACKEND_AUTO,
+        BASEC_FILE_BACKEND_IO_URING,
+        BASEC_FILE_BACKEND_THREADS,
+        BASEC_FILE_BACKEND_BLOCKING
+    };
+
+    for (u64 i = 0; i < 20; i++) {
+        (void)snprintf(paths[i], sizeof(paths[i]), "/tmp/basec_test_batch_%lu", i);
+        path_ptrs[i] = paths[i];
+
+        file = fopen(paths[i], "w");
+        if (file == NULL) {
+            (void)strncpy(
+                fail_message,
+                "Failed to create test file",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            return false;
+        }
+        // File i holds i copies of its index letter, file 0 is empty
+        for (u64 j = 0; j < i * 1000; j++) (void)fputc('a' + (i % 26), file);
+        (void)fclose(file);
+    }
+
+    for (u64 b = 0; b < 4; b++) {
+        file_result = basec_file_read_batch(path_ptrs, 20, backends[b], 4, &strings);
+        if (file_result == BASEC_FILE_UNSUPPORTED) continue;
+        if (file_result != BASEC_FILE_SUCCESS || strings->length != 20) {
+            (void)strncpy(
+                fail_message,
+                "Failed to read batch of files",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            if (strings != NULL) (void)basec_strings_destroy(&strings);
+            return false;
+        }
+
+        for (u64 i = 0; i < 20; i++) {
+            (void)basec_array_get(strings, i, &string);
+            if (
+                string->length != i * 1000 ||
+                (i > 0 && string->data[i * 1000 - 1] != (c8)('a' + (i % 26)))
+            ) {
+                (void)strncpy(
+                    fail_message,
+                    "Batch read string does not match the file contents",
+                    BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+                );
+                (void)basec_strings_destroy(&strings);
+                return false;
+            }
+        }
+    }
+    (void)basec_strings_destroy(&strings);
+
+    path_ptrs[10] = "/tmp/basec_missing_file";
+    file_result = basec_file_read_batch(
+        path_ptrs,
+        20,
+        BASEC_FILE_BACKEND_AUTO,
+        4,
+        &strings
+    );
+    if (file_result == BASEC_FILE_SUCCESS || strings != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Reading batch with a missing file succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_file_read_batch(
+        path_ptrs,
+        20,
+        BASEC_FILE_BACKEND_AUTO,
+        0,
+        &strings
+    );
+    if (file_result != BASEC_FILE_INVALID_CAPACITY) {
+        (void)strncpy(
+            fail_message,
+            "Reading batch with zero queue depth succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_file_read_batch(
+        NULL,
+        20,
+        BASEC_FILE_BACKEND_AUTO,
+        4,
+        &strings
+    );
+    if (file_result != BASEC_FILE_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Reading batch with NULL pointer succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    for (u64 i = 0; i < 20; i++) (void)remove(paths[i]);
+    return true;
+}
+
+/**
+ * @brief Test writing strings and bytes with a writer
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_writer_write(c_str fail_message) {
+    BasecFileResult   file_result   = BASEC_FILE_SUCCESS;
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecWriter*      writer        = NULL;
+    BasecString*      string        = NULL;
+    BasecString*      contents      = NULL;
+    c_str             path          = "/tmp/basec_test_writer_write.txt";
+
+    file_result = basec_writer_open(&writer, path, 8);
+    if (file_result != BASEC_FILE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to open writer",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    string_result = basec_string_create(&string, "Hello, ", 8);
+    if (string_result != BASEC_STRING_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "String creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_writer_close(&writer);
+        return false;
+    }
+
+    file_result = basec_writer_write_string(writer, string);
+    if (file_result == BASEC_FILE_SUCCESS) {
+        file_result = basec_writer_write(writer, "World! ", 7);
+    }
+    if (file_result == BASEC_FILE_SUCCESS) {
+        file_result = basec_writer_write(writer, "A write larger than the buffer", 30);
+    }
+    if (file_result != BASEC_FILE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to write to writer",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        (void)basec_writer_close(&writer);
+        return false;
+    }
+
+    file_result = basec_writer_close(&writer);
+    if (file_result != BASEC_FILE_SUCCESS || writer != NULL) {
+        (void)strncpy(
+            fail_message,
+            "Failed to close writer",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    string_result = basec_string_read_file(path, &contents);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(contents->data, "Hello, World! A write larger than the buffer") != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Written file does not match the expected contents",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+
+    file_result = basec_writer_write_string(NULL, string);
+    if (file_result != BASEC_FILE_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Writing with NULL pointer succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&string);
+        (void)basec_string_destroy(&contents);
+        return false;
+    }
+
+    (void)basec_string_destroy(&string);
+    (void)basec_string_destroy(&contents);
+    (void)remove(path);
+    return true;
+}
+
+/**
+ * @brief Test batched writes with a writer
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_file_writer_writev(c_str fail_message) {
+    BasecFileResult   file_result   = BASEC_FILE_SUCCESS;
+    BasecStringResult string_result = BASEC_STRING_SUCCESS;
+    BasecWriter*      writer        = NULL;
+    BasecString*      contents      = NULL;
+    c_str             path          = "/tmp/basec_test_writer_writev.txt";
+    BasecStringView   views[100]    = {0};
+    c8                expected[301] = {0};
+
+    for (u64 i = 0; i < 100; i++) {
+        views[i].data   = "abc";
+        views[i].length = 3;
+        (void)memcpy(expected + i * 3, "abc", 3);
+    }
+
+    file_result = basec_writer_open(&writer, path, 16);
+    if (file_result != BASEC_FILE_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Failed to open writer",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_writer_writev(writer, views, 2);
+    if (file_result != BASEC_FILE_SUCCESS || writer->length != 6) {
+        (void)strncpy(
+            fail_message,
+            "Small batch was not buffered",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_writer_close(&writer);
+        return false;
+    }
+
+    file_result = basec_writer_writev(writer, views + 2, 98);
+    if (file_result != BASEC_FILE_SUCCESS || writer->length != 0) {
+        (void)strncpy(
+            fail_message,
+            "Large batch was not written through",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_writer_close(&writer);
+        return false;
+    }
+
+    (void)basec_writer_close(&writer);
+
+    string_result = basec_string_read_file(path, &contents);
+    if (
+        string_result != BASEC_STRING_SUCCESS ||
+        strcmp(contents->data, expected) != 0
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Written file does not match the expected contents",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    file_result = basec_writer_writev(NULL, views, 2);
+    if (file_result != BASEC_FILE_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Batched write with NULL pointer succeeded, expected failure",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_string_destroy(&contents);
+        return false;
+    }
+
+    (void)basec_string_destroy(&contents);
+    (void)remove(path);
+    return true;
+}
+
+/**
+ * @brief Add File tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+
+BasecTestResult test_file_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result           = BASEC_TEST_SUCCESS;
+    BasecTest*       reader_open_test      = NULL;
+    BasecTest*       reader_read_test      = NULL;
+    BasecTest*       reader_read_line_test = NULL;
+    BasecTest*       read_batch_test       = NULL;
+    BasecTest*       writer_write_test     = NULL;
+    BasecTest*       writer_writev_test    = NULL;
+    BasecTestModule* file_module           = NULL;
+
+    test_result = basec_test_create(
+        &reader_open_test,
+        "test_file_reader_open",
+        "Test opening a reader",
+        &test_file_reader_open
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &reader_read_test,
+        "test_file_reader_read",
+        "Test reading bytes from a reader",
+        &test_file_reader_read
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_open_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &reader_read_line_test,
+        "test_file_reader_read_line",
+        "Test reading lines from a reader",
+        &test_file_reader_read_line
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_open_test);
+        (void)basec_test_destroy(&reader_read_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &read_batch_test,
+        "test_file_read_batch",
+        "Test reading a batch of files with every backend",
+        &test_file_read_batch
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_open_test);
+        (void)basec_test_destroy(&reader_read_test);
+        (void)basec_test_destroy(&reader_read_line_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &writer_write_test,
+        "test_file_writer_write",
+        "Test writing strings and bytes with a writer",
+        &test_file_writer_write
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_open_test);
+        (void)basec_test_destroy(&reader_read_test);
+        (void)basec_test_destroy(&reader_read_line_test);
+        (void)basec_test_destroy(&read_batch_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &writer_writev_test,
+        "test_file_writer_writev",
+        "Test batched writes with a writer",
+        &test_file_writer_writev
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_open_test);
+        (void)basec_test_destroy(&reader_read_test);
+        (void)basec_test_destroy(&reader_read_line_test);
+        (void)basec_test_destroy(&read_batch_test);
+        (void)basec_test_destroy(&writer_write_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &file_module,
+        "File"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_open_test);
+        (void)basec_test_destroy(&reader_read_test);
+        (void)basec_test_destroy(&reader_read_line_test);
+        (void)basec_test_destroy(&read_batch_test);
+        (void)basec_test_destroy(&writer_write_test);
+        (void)basec_test_destroy(&writer_writev_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(file_module, reader_open_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_open_test);
+        (void)basec_test_destroy(&reader_read_test);
+        (void)basec_test_destroy(&reader_read_line_test);
+        (void)basec_test_destroy(&read_batch_test);
+        (void)basec_test_destroy(&writer_write_test);
+        (void)basec_test_destroy(&writer_writev_test);
+        (void)basec_test_module_destroy(&file_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(file_module, reader_read_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_read_test);
+        (void)basec_test_destroy(&reader_read_line_test);
+        (void)basec_test_destroy(&read_batch_test);
+        (void)basec_test_destroy(&writer_write_test);
+        (void)basec_test_destroy(&writer_writev_test);
+        (void)basec_test_module_destroy(&file_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(file_module, reader_read_line_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&reader_read_line_test);
+        (void)basec_test_destroy(&read_batch_test);
+        (void)basec_test_destroy(&writer_write_test);
+        (void)basec_test_destroy(&writer_writev_test);
+        (void)basec_test_module_destroy(&file_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(file_module, read_batch_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&read_batch_test);
+        (void)basec_test_destroy(&writer_write_test);
+        (void)basec_test_destroy(&writer_writev_test);
+        (void)basec_test_module_destroy(&file_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(file_module, writer_write_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&writer_write_test);
+        (void)basec_test_destroy(&writer_writev_test);
+        (void)basec_test_module_destroy(&file_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(file_module, writer_writev_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&writer_writev_test);
+        (void)basec_test_module_destroy(&file_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, file_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&file_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
@@ -14,6 +14,20 @@ static void _build(void) {
             "src/util/basec_build.c",
             "src/ds/basec_string.c",
             "src/ds/basec_array.c",
+            "src/io/basec_file.c",
+            "src/util/basec_hash.c",
+            "src/ds/basec_hashmap.c",
+            "src/ds/basec_strmap.c",
+            "src/ds/basec_interner.c",
+            "src/ds/basec_hashset.c",
+            "src/ds/basec_heap.c",
+            "src/ds/basec_deque.c",
+            "src/concurrency/basec_queue.c",
+            "src/concurrency/basec_jobs.c",
+            "src/concurrency/basec_concurrent_array.c",
+            "src/ds/basec_chunked_array.c",
+            "src/util/basec_memory.c",
+            "src/ds/basec_soa.c",
         },
         .includes = {
             "include",
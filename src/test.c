@@ -1,6 +1,20 @@
 #include "util/basec_build.h"
 #include "ds/tests/test_string.h"
 #include "ds/tests/test_array.h"
+#include "ds/tests/test_hashmap.h"
+#include "ds/tests/test_hashset.h"
+#include "ds/tests/test_heap.h"
+#include "ds/tests/test_deque.h"
+#include "ds/tests/test_chunked_array.h"
+#include "ds/tests/test_soa.h"
+#include "ds/tests/test_strmap.h"
+#include "ds/tests/test_interner.h"
+#include "io/tests/test_file.h"
+#include "concurrency/tests/test_queue.h"
+#include "concurrency/tests/test_jobs.h"
+#include "concurrency/tests/test_concurrent_array.h"
+#include "util/tests/test_hash.h"
+#include "util/tests/test_memory.h"
 
 static void _build(void) {
     BuildSystem* build_system = NULL;
@@ -12,9 +26,37 @@ static void _build(void) {
             "src/util/basec_build.c",
             "src/ds/basec_string.c",
             "src/ds/basec_array.c",
+            "src/io/basec_file.c",
+            "src/util/basec_hash.c",
+            "src/ds/basec_hashmap.c",
+            "src/ds/basec_strmap.c",
+            "src/ds/basec_interner.c",
+            "src/ds/basec_hashset.c",
+            "src/ds/basec_heap.c",
+            "src/ds/basec_deque.c",
+            "src/concurrency/basec_queue.c",
+            "src/concurrency/basec_jobs.c",
+            "src/concurrency/basec_concurrent_array.c",
+            "src/ds/basec_chunked_array.c",
+            "src/util/basec_memory.c",
+            "src/ds/basec_soa.c",
             "src/util/basec_test.c",
             "src/ds/tests/test_string.c",
             "src/ds/tests/test_array.c",
+            "src/io/tests/test_file.c",
+            "src/util/tests/test_hash.c",
+            "src/ds/tests/test_hashmap.c",
+            "src/ds/tests/test_strmap.c",
+            "src/ds/tests/test_interner.c",
+            "src/ds/tests/test_hashset.c",
+            "src/ds/tests/test_heap.c",
+            "src/ds/tests/test_deque.c",
+            "src/concurrency/tests/test_queue.c",
+            "src/concurrency/tests/test_jobs.c",
+            "src/concurrency/tests/test_concurrent_array.c",
+            "src/ds/tests/test_chunked_array.c",
+            "src/util/tests/test_memory.c",
+            "src/ds/tests/test_soa.c",
         },
         .includes = {
             "include",
@@ -38,6 +80,20 @@ int main(void) {
 
     basec_test_handle_result(test_string_add_tests(test_suite));
     basec_test_handle_result(test_array_add_tests(test_suite));
+    basec_test_handle_result(test_hashmap_add_tests(test_suite));
+    basec_test_handle_result(test_hashset_add_tests(test_suite));
+    basec_test_handle_result(test_heap_add_tests(test_suite));
+    basec_test_handle_result(test_deque_add_tests(test_suite));
+    basec_test_handle_result(test_chunked_array_add_tests(test_suite));
+    basec_test_handle_result(test_soa_add_tests(test_suite));
+    basec_test_handle_result(test_strmap_add_tests(test_suite));
+    basec_test_handle_result(test_interner_add_tests(test_suite));
+    basec_test_handle_result(test_file_add_tests(test_suite));
+    basec_test_handle_result(test_hash_add_tests(test_suite));
+    basec_test_handle_result(test_memory_add_tests(test_suite));
+    basec_test_handle_result(test_queue_add_tests(test_suite));
+    basec_test_handle_result(test_jobs_add_tests(test_suite));
+    basec_test_handle_result(test_concurrent_array_add_tests(test_suite));
 
     basec_test_handle_result(basec_test_suite_run(test_suite));
     basec_test_handle_result(basec_test_suite_print_results(test_suite));
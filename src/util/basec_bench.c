@@ -0,0 +1,128 @@
+#include "util/basec_bench.h"
+
+/**
+ * @brief Get the current monotonic time
+ * @param now_ns_out The current time in nanoseconds
+ * @return The result of the operation
+ */
+static BasecBenchResult _basec_bench_now(u64* now_ns_out) {
+    if (now_ns_out == NULL) return BASEC_BENCH_NULL_POINTER;
+
+    struct timespec now = {0};
+
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+        return BASEC_BENCH_CLOCK_FAILURE;
+    }
+
+    *now_ns_out = (u64)now.tv_sec * 1000000000ULL + (u64)now.tv_nsec;
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Handle a benchmark result
+ * @param result The result to handle
+ */
+void basec_bench_handle_result(BasecBenchResult result) {
+    switch (result) {
+        case BASEC_BENCH_SUCCESS:
+            break;
+        case BASEC_BENCH_NULL_POINTER:
+            (void)printf("[Error][Bench] Null pointer passed to function\n");
+            exit(1);
+        case BASEC_BENCH_ALLOCATION_FAILURE:
+            (void)printf("[Error][Bench] Failed to allocate memory\n");
+            exit(1);
+        case BASEC_BENCH_CLOCK_FAILURE:
+            (void)printf("[Error][Bench] Failed to read the clock\n");
+            exit(1);
+        case BASEC_BENCH_RUN_FAILURE:
+            (void)printf("[Error][Bench] Failed to run benchmark\n");
+            exit(1);
+        default:
+            (void)printf("[Error][Bench] Unknown error\n");
+            exit(1);
+    }
+}
+
+/**
+ * @brief Start a timer
+ * @param timer The timer to start
+ * @return The result of the operation
+ */
+BasecBenchResult basec_bench_timer_start(BasecBenchTimer* timer) {
+    if (timer == NULL) return BASEC_BENCH_NULL_POINTER;
+
+    timer->elapsed_ns = 0;
+    return _basec_bench_now(&timer->start_ns);
+}
+
+/**
+ * @brief Stop a timer
+ * @param timer The timer to stop
+ * @param elapsed_ns_out The elapsed time in nanoseconds
+ * @return The result of the operation
+ */
+BasecBenchResult basec_bench_timer_stop(
+    BasecBenchTimer* timer,
+    u64*             elapsed_ns_out
+) {
+    if (timer == NULL || elapsed_ns_out == NULL) {
+        return BASEC_BENCH_NULL_POINTER;
+    }
+
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    u64              now_ns       = 0;
+
+    bench_result = _basec_bench_now(&now_ns);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    timer->elapsed_ns = now_ns - timer->start_ns;
+    *elapsed_ns_out = timer->elapsed_ns;
+
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Print the header of a benchmark module
+ * @param name The name of the module
+ * @return The result of the operation
+ */
+BasecBenchResult basec_bench_print_module(c_str name) {
+    if (name == NULL) return BASEC_BENCH_NULL_POINTER;
+
+    (void)printf("\n\033[1m\033[0;33m[MODULE] %s\033[0m\n", name);
+    return BASEC_BENCH_SUCCESS;
+}
+
+/**
+ * @brief Print a benchmark measurement
+ * @param name The name of the benchmark
+ * @param iterations The number of iterations that were timed
+ * @param bytes The number of bytes processed per iteration (0 if unused)
+ * @param elapsed_ns The total elapsed time in nanoseconds
+ * @return The result of the operation
+ */
+BasecBenchResult basec_bench_print(
+    c_str name,
+    u64   iterations,
+    u64   bytes,
+    u64   elapsed_ns
+) {
+    if (name == NULL) return BASEC_BENCH_NULL_POINTER;
+    if (iterations == 0) return BASEC_BENCH_RUN_FAILURE;
+
+    f64 ns_per_op = (f64)elapsed_ns / (f64)iterations;
+
+    if (bytes == 0 || elapsed_ns == 0) {
+        (void)printf("  %-40s %14.1f ns/op\n", name, ns_per_op);
+        return BASEC_BENCH_SUCCESS;
+    }
+
+    (void)printf(
+        "  %-40s %14.1f ns/op %10.1f MB/s\n",
+        name,
+        ns_per_op,
+        ((f64)bytes * (f64)iterations / 1e6) / ((f64)elapsed_ns / 1e9)
+    );
+    return BASEC_BENCH_SUCCESS;
+}
@@ -0,0 +1,398 @@
+#include "util/basec_hash.h"
+
+/**
+ * @brief The secret constants mixed into every hash
+ */
+static const u64 _SECRET[4] = {
+    0x2D358DCCAA6C78A5ULL,
+    0x8BB84B93962EACC9ULL,
+    0x4B33A62ED433D4A3ULL,
+    0x4D5A2DA51DE1AA47ULL,
+};
+
+/**
+ * @brief Multiply two u64s, keeping the low half in a and the high half in b
+ * @param a The first factor, replaced by the low 64 bits of the product
+ * @param b The second factor, replaced by the high 64 bits of the product
+ */
+static void _basec_hash_multiply(u64* a, u64* b) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 u128;
+
+    u128 product = (u128)*a * *b;
+
+    *a = (u64)product;
+    *b = (u64)(product >> 64);
+#else
+    const u64 mask_32 = 0xFFFFFFFFULL;
+    u64       x_high  = *a >> 32;
+    u64       x_low   = *a & mask_32;
+    u64       y_high  = *b >> 32;
+    u64       y_low   = *b & mask_32;
+    u64       mid     = ((x_low * y_low) >> 32) + ((x_high * y_low) & mask_32) +
+                        ((x_low * y_high) & mask_32);
+
+    *a = (mid << 32) | ((x_low * y_low) & mask_32);
+    *b = x_high * y_high + ((x_high * y_low) >> 32) +
+         ((x_low * y_high) >> 32) + (mid >> 32);
+#endif
+}
+
+/**
+ * @brief Mix two u64s by folding their 128 bit product
+ * @param a The first value
+ * @param b The second value
+ * @return The mixed value
+ */
+static u64 _basec_hash_mix(u64 a, u64 b) {
+    _basec_hash_multiply(&a, &b);
+    return a ^ b;
+}
+
+/**
+ * @brief Read 8 little endian bytes
+ * @param data The bytes to read
+ * @return The bytes as a u64
+ */
+static u64 _basec_hash_read_8(const u8* data) {
+    u64 value = 0;
+
+    (void)memcpy(&value, data, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap64(value);
+#endif
+    return value;
+}
+
+/**
+ * @brief Read 4 little endian bytes
+ * @param data The bytes to read
+ * @return The bytes as a u64
+ */
+static u64 _basec_hash_read_4(const u8* data) {
+    u32 value = 0;
+
+    (void)memcpy(&value, data, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    value = __builtin_bswap32(value);
+#endif
+    return value;
+}
+
+/**
+ * @brief Scramble the seed with the secret before any input is mixed in
+ * @param seed The seed given by the caller
+ * @return The seed the hash starts from
+ */
+static u64 _basec_hash_start(u64 seed) {
+    return seed ^ _basec_hash_mix(seed ^ _SECRET[0], _SECRET[1]);
+}
+
+/**
+ * @brief Mix a block of BASEC_HASH_BLOCK_SIZE bytes into three lanes
+ * @param seed The first lane
+ * @param lanes The second and third lanes
+ * @param data The bytes of the block
+ */
+static void _basec_hash_block(u64* seed, u64* lanes, const u8* data) {
+    *seed    = _basec_hash_mix(
+        _basec_hash_read_8(data) ^ _SECRET[1],
+        _basec_hash_read_8(data + 8) ^ *seed
+    );
+    lanes[0] = _basec_hash_mix(
+        _basec_hash_read_8(data + 16) ^ _SECRET[2],
+        _basec_hash_read_8(data + 24) ^ lanes[0]
+    );
+    lanes[1] = _basec_hash_mix(
+        _basec_hash_read_8(data + 32) ^ _SECRET[3],
+        _basec_hash_read_8(data + 40) ^ lanes[1]
+    );
+}
+
+/**
+ * @brief Mix the last two words of input with the seed and length
+ * @param a The first word
+ * @param b The second word
+ * @param seed The running seed
+ * @param length The total number of bytes hashed
+ * @return The hash
+ */
+static u64 _basec_hash_finish(u64 a, u64 b, u64 seed, u64 length) {
+    a ^= _SECRET[1];
+    b ^= seed;
+    _basec_hash_multiply(&a, &b);
+    return _basec_hash_mix(a ^ _SECRET[0] ^ length, b ^ _SECRET[1]);
+}
+
+/**
+ * @brief Hash at most 16 bytes
+ *
+ * Up to 16 bytes fit in two words read with overlapping loads, so short keys
+ * take no branches on their exact length.
+ *
+ * @param seed The running seed
+ * @param data The bytes to hash
+ * @param length The number of bytes, at most 16
+ * @return The hash
+ */
+static u64 _basec_hash_short(u64 seed, const u8* data, u64 length) {
+    u64 a     = 0;
+    u64 b     = 0;
+    u64 shift = (length >> 3) << 2;
+
+    if (length >= 4) {
+        a = (_basec_hash_read_4(data) << 32) |
+            _basec_hash_read_4(data + shift);
+        b = (_basec_hash_read_4(data + length - 4) << 32) |
+            _basec_hash_read_4(data + length - 4 - shift);
+    } else if (length > 0) {
+        a = ((u64)data[0] << 16) | ((u64)data[length >> 1] << 8) |
+            data[length - 1];
+    }
+
+    return _basec_hash_finish(a, b, seed, length);
+}
+
+/**
+ * @brief Hash what remains after the blocks of more than 16 bytes of input
+ *
+ * The last 16 bytes are read ending at the end of the input, so they may
+ * reach back before data into bytes that were already mixed.
+ *
+ * @param seed The running seed
+ * @param data The bytes left after the blocks
+ * @param remaining The number of bytes left, between 1 and the block size
+ * @param length The total number of bytes hashed
+ * @return The hash
+ */
+static u64 _basec_hash_tail(
+    u64       seed,
+    const u8* data,
+    u64       remaining,
+    u64       length
+) {
+    while (remaining > 16) {
+        seed = _basec_hash_mix(
+            _basec_hash_read_8(data) ^ _SECRET[1],
+            _basec_hash_read_8(data + 8) ^ seed
+        );
+        data      += 16;
+        remaining -= 16;
+    }
+
+    return _basec_hash_finish(
+        _basec_hash_read_8(data + remaining - 16),
+        _basec_hash_read_8(data + remaining - 8),
+        seed,
+        length
+    );
+}
+
+/**
+ * @brief Handle the result of a hash operation
+ * @param result The result of the operation
+ */
+void basec_hash_handle_result(BasecHashResult result) {
+    switch (result) {
+        case BASEC_HASH_SUCCESS:
+            break;
+        case BASEC_HASH_NULL_POINTER:
+            (void)printf(
+                "[Error][Hash] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][Hash] "
+                "An unknown error occurred during hash operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Hash bytes with the default seed
+ * @param data The bytes to hash
+ * @param length The number of bytes
+ * @param hash_out The hash of the bytes
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_bytes(
+    const void* data,
+    u64         length,
+    u64*        hash_out
+) {
+    return basec_hash_bytes_seeded(
+        data,
+        length,
+        BASEC_HASH_DEFAULT_SEED,
+        hash_out
+    );
+}
+
+/**
+ * @brief Hash bytes with a seed
+ * @param data The bytes to hash
+ * @param length The number of bytes
+ * @param seed The seed of the hash
+ * @param hash_out The hash of the bytes
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_bytes_seeded(
+    const void* data,
+    u64         length,
+    u64         seed,
+    u64*        hash_out
+) {
+    if (data == NULL || hash_out == NULL) return BASEC_HASH_NULL_POINTER;
+
+    const u8* bytes     = (const u8*)data;
+    u64       remaining = length;
+    u64       lanes[2]  = {0};
+
+    seed = _basec_hash_start(seed);
+    if (length <= 16) {
+        *hash_out = _basec_hash_short(seed, bytes, length);
+        return BASEC_HASH_SUCCESS;
+    }
+
+    if (remaining > BASEC_HASH_BLOCK_SIZE) {
+        lanes[0] = seed;
+        lanes[1] = seed;
+        while (remaining > BASEC_HASH_BLOCK_SIZE) {
+            _basec_hash_block(&seed, lanes, bytes);
+            bytes     += BASEC_HASH_BLOCK_SIZE;
+            remaining -= BASEC_HASH_BLOCK_SIZE;
+        }
+        seed ^= lanes[0] ^ lanes[1];
+    }
+
+    *hash_out = _basec_hash_tail(seed, bytes, remaining, length);
+    return BASEC_HASH_SUCCESS;
+}
+
+/**
+ * @brief Get an unpredictable seed from the kernel
+ * @param seed_out The seed
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_random_seed(u64* seed_out) {
+    if (seed_out == NULL) return BASEC_HASH_NULL_POINTER;
+
+    struct timespec now = {0};
+
+    if ((u64)getrandom(seed_out, sizeof(*seed_out), 0) == sizeof(*seed_out)) {
+        return BASEC_HASH_SUCCESS;
+    }
+
+    // Without getrandom, the clock and the stack address still vary per run
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    *seed_out = _basec_hash_mix(
+        (u64)now.tv_sec * 1000000000ULL + (u64)now.tv_nsec,
+        (u64)(uintptr_t)&now ^ _SECRET[2]
+    );
+    return BASEC_HASH_SUCCESS;
+}
+
+/**
+ * @brief Start an incremental hash
+ * @param state The state to initialise
+ * @param seed The seed of the hash
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_init(BasecHashState* state, u64 seed) {
+    if (state == NULL) return BASEC_HASH_NULL_POINTER;
+
+    state->seed     = _basec_hash_start(seed);
+    state->lanes[0] = state->seed;
+    state->lanes[1] = state->seed;
+    state->length   = 0;
+    state->buffered = 0;
+    state->mixed    = false;
+    return BASEC_HASH_SUCCESS;
+}
+
+/**
+ * @brief Add bytes to an incremental hash
+ *
+ * A block is only mixed once more input is known to follow it, matching
+ * basec_hash_bytes_seeded, which always leaves the last block to the tail.
+ *
+ * @param state The state of the hash
+ * @param data The bytes to add
+ * @param length The number of bytes
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_update(
+    BasecHashState* state,
+    const void*     data,
+    u64             length
+) {
+    if (state == NULL || data == NULL) return BASEC_HASH_NULL_POINTER;
+
+    const u8* bytes   = (const u8*)data;
+    u8*       pending = state->buffer + 16;
+    u64       copied  = 0;
+
+    state->length += length;
+    while (length > 0) {
+        if (state->buffered == BASEC_HASH_BLOCK_SIZE) {
+            _basec_hash_block(&state->seed, state->lanes, pending);
+            (void)memcpy(
+                state->buffer,
+                pending + BASEC_HASH_BLOCK_SIZE - 16,
+                16
+            );
+            state->buffered = 0;
+            state->mixed    = true;
+        }
+
+        // Whole blocks are mixed straight from the input
+        if (state->buffered == 0 && length > BASEC_HASH_BLOCK_SIZE) {
+            while (length > BASEC_HASH_BLOCK_SIZE) {
+                _basec_hash_block(&state->seed, state->lanes, bytes);
+                bytes  += BASEC_HASH_BLOCK_SIZE;
+                length -= BASEC_HASH_BLOCK_SIZE;
+            }
+            (void)memcpy(state->buffer, bytes - 16, 16);
+            state->mixed = true;
+        }
+
+        copied = BASEC_HASH_BLOCK_SIZE - state->buffered;
+        if (copied > length) copied = length;
+        (void)memcpy(pending + state->buffered, bytes, copied);
+        state->buffered += copied;
+        bytes           += copied;
+        length          -= copied;
+    }
+
+    return BASEC_HASH_SUCCESS;
+}
+
+/**
+ * @brief Get the hash of the bytes added so far
+ * @param state The state of the hash
+ * @param hash_out The hash of the bytes
+ * @return The result of the operation
+ */
+BasecHashResult basec_hash_final(BasecHashState* state, u64* hash_out) {
+    if (state == NULL || hash_out == NULL) return BASEC_HASH_NULL_POINTER;
+
+    const u8* pending = state->buffer + 16;
+    u64       seed    = state->seed;
+
+    if (state->length <= 16) {
+        *hash_out = _basec_hash_short(seed, pending, state->length);
+        return BASEC_HASH_SUCCESS;
+    }
+
+    if (state->mixed) seed ^= state->lanes[0] ^ state->lanes[1];
+    *hash_out = _basec_hash_tail(
+        seed,
+        pending,
+        state->buffered,
+        state->length
+    );
+    return BASEC_HASH_SUCCESS;
+}
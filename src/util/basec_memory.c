@@ -0,0 +1,309 @@
+// mremap and MREMAP_MAYMOVE are Linux extensions
+#define _GNU_SOURCE
+#include "util/basec_memory.h"
+
+static bool _huge_pages = false;
+
+/**
+ * @brief Map an anonymous buffer
+ * @param size The size of the buffer in bytes
+ * @return The buffer, NULL if it could not be mapped
+ */
+static void* _basec_memory_map(u64 size) {
+    void* data = mmap(
+        NULL,
+        size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0
+    );
+
+    if (data == MAP_FAILED) return NULL;
+    return data;
+}
+
+/**
+ * @brief Check that an alignment is a power of two up to the page size
+ * @param alignment The alignment
+ * @return Whether the alignment can be used
+ */
+static bool _basec_memory_valid_alignment(u64 alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) return false;
+    return alignment <= (u64)sysconf(_SC_PAGESIZE);
+}
+
+/**
+ * @brief Allocate a heap buffer aligned to alignment bytes
+ * @param size The size of the buffer in bytes
+ * @param alignment The alignment, a power of two
+ * @return The buffer, NULL if it could not be allocated
+ */
+static void* _basec_memory_heap(u64 size, u64 alignment) {
+    if (alignment <= BASEC_MEMORY_ALIGNMENT) return malloc(size);
+
+    // aligned_alloc takes sizes that are a multiple of the alignment
+    return aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+}
+
+/**
+ * @brief Get the number of pages a mapped buffer spans
+ * @param size The size of the buffer in bytes
+ * @return The number of pages
+ */
+static u64 _basec_memory_pages(u64 size) {
+    u64 page = (u64)sysconf(_SC_PAGESIZE);
+
+    return (size + page - 1) / page;
+}
+
+/**
+ * @brief Ask for huge pages on a mapped buffer, if enabled
+ * @param data The buffer
+ * @param size The size of the buffer in bytes
+ */
+static void _basec_memory_advise(void* data, u64 size) {
+#if defined(MADV_HUGEPAGE)
+    if (__atomic_load_n(&_huge_pages, __ATOMIC_RELAXED)) {
+        (void)madvise(data, size, MADV_HUGEPAGE);
+    }
+#else
+    (void)data;
+    (void)size;
+#endif
+}
+
+/**
+ * @brief Handle the result of a memory operation
+ * @param result The result of the operation
+ */
+void basec_memory_handle_result(BasecMemoryResult result) {
+    switch (result) {
+        case BASEC_MEMORY_SUCCESS:
+            break;
+        case BASEC_MEMORY_NULL_POINTER:
+            (void)printf(
+                "[Error][Memory] "
+                "Operation failed due to a null pointer reference.\n"
+            );
+            exit(1);
+        case BASEC_MEMORY_INVALID_SIZE:
+            (void)printf(
+                "[Error][Memory] "
+                "Operation failed due to an invalid size.\n"
+            );
+            exit(1);
+        case BASEC_MEMORY_INVALID_ALIGNMENT:
+            (void)printf(
+                "[Error][Memory] "
+                "Operation failed due to an invalid alignment.\n"
+            );
+            exit(1);
+        case BASEC_MEMORY_ALLOCATION_FAILURE:
+            (void)printf(
+                "[Error][Memory] "
+                "Operation failed due to an allocation failure.\n"
+            );
+            exit(1);
+        default:
+            (void)printf(
+                "[Error][Memory] "
+                "An unknown error occurred during memory operation.\n"
+            );
+            exit(1);
+    }
+}
+
+/**
+ * @brief Choose whether mapped buffers ask for transparent huge pages
+ * @param enabled Whether to ask for huge pages
+ */
+void basec_memory_set_huge_pages(bool enabled) {
+    __atomic_store_n(&_huge_pages, enabled, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Ask for transparent huge pages on one mapped buffer
+ * @param data The buffer
+ * @param size The size of the buffer in bytes
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_advise_huge_pages(void* data, u64 size) {
+    if (data == NULL) return BASEC_MEMORY_NULL_POINTER;
+
+#if defined(MADV_HUGEPAGE)
+    (void)madvise(data, size, MADV_HUGEPAGE);
+#else
+    (void)size;
+#endif
+    return BASEC_MEMORY_SUCCESS;
+}
+
+/**
+ * @brief Allocate a buffer, mapping it if it is at least
+ *        BASEC_MEMORY_MAP_THRESHOLD bytes
+ * @param data_out The buffer
+ * @param size The size of the buffer in bytes
+ * @param mapped_out Whether the buffer was mapped
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_allocate(
+    void** data_out,
+    u64    size,
+    bool*  mapped_out
+) {
+    return basec_memory_allocate_aligned(
+        data_out,
+        size,
+        BASEC_MEMORY_ALIGNMENT,
+        mapped_out
+    );
+}
+
+/**
+ * @brief Allocate a buffer aligned to alignment bytes
+ * @param data_out The buffer
+ * @param size The size of the buffer in bytes
+ * @param alignment The alignment, a power of two up to the page size
+ * @param mapped_out Whether the buffer was mapped
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_allocate_aligned(
+    void** data_out,
+    u64    size,
+    u64    alignment,
+    bool*  mapped_out
+) {
+    if (data_out == NULL || mapped_out == NULL) {
+        return BASEC_MEMORY_NULL_POINTER;
+    }
+    if (size == 0) return BASEC_MEMORY_INVALID_SIZE;
+    if (!_basec_memory_valid_alignment(alignment)) {
+        return BASEC_MEMORY_INVALID_ALIGNMENT;
+    }
+
+    void* data = NULL;
+
+    if (size >= BASEC_MEMORY_MAP_THRESHOLD) {
+        data = _basec_memory_map(size);
+        if (data == NULL) return BASEC_MEMORY_ALLOCATION_FAILURE;
+        _basec_memory_advise(data, size);
+    } else {
+        data = _basec_memory_heap(size, alignment);
+        if (data == NULL) return BASEC_MEMORY_ALLOCATION_FAILURE;
+    }
+
+    *data_out   = data;
+    *mapped_out = size >= BASEC_MEMORY_MAP_THRESHOLD;
+    return BASEC_MEMORY_SUCCESS;
+}
+
+/**
+ * @brief Resize a buffer, keeping its first bytes
+ * @param data The buffer, replaced by the resized buffer
+ * @param size The current size of the buffer in bytes
+ * @param new_size The new size of the buffer in bytes
+ * @param mapped Whether the buffer is mapped, updated for the new buffer
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_resize(
+    void** data,
+    u64    size,
+    u64    new_size,
+    bool*  mapped
+) {
+    return basec_memory_resize_aligned(
+        data,
+        size,
+        new_size,
+        BASEC_MEMORY_ALIGNMENT,
+        mapped
+    );
+}
+
+/**
+ * @brief Resize a buffer allocated with basec_memory_allocate_aligned,
+ *        keeping its alignment
+ * @param data The buffer, replaced by the resized buffer
+ * @param size The current size of the buffer in bytes
+ * @param new_size The new size of the buffer in bytes
+ * @param alignment The alignment of the buffer
+ * @param mapped Whether the buffer is mapped, updated for the new buffer
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_resize_aligned(
+    void** data,
+    u64    size,
+    u64    new_size,
+    u64    alignment,
+    bool*  mapped
+) {
+    if (data == NULL || *data == NULL || mapped == NULL) {
+        return BASEC_MEMORY_NULL_POINTER;
+    }
+    if (new_size == 0) return BASEC_MEMORY_INVALID_SIZE;
+    if (!_basec_memory_valid_alignment(alignment)) {
+        return BASEC_MEMORY_INVALID_ALIGNMENT;
+    }
+
+    void* resized = NULL;
+    u64   kept    = size < new_size ? size : new_size;
+
+    if (
+        new_size < BASEC_MEMORY_MAP_THRESHOLD &&
+        !*mapped &&
+        alignment <= BASEC_MEMORY_ALIGNMENT
+    ) {
+        resized = realloc(*data, new_size);
+        if (resized == NULL) return BASEC_MEMORY_ALLOCATION_FAILURE;
+    } else if (new_size < BASEC_MEMORY_MAP_THRESHOLD) {
+        // Over aligned, or shrunk below the threshold back onto the heap
+        resized = _basec_memory_heap(new_size, alignment);
+        if (resized == NULL) return BASEC_MEMORY_ALLOCATION_FAILURE;
+        (void)memcpy(resized, *data, kept);
+        if (*mapped) {
+            (void)munmap(*data, size);
+        } else {
+            free(*data);
+        }
+    } else if (*mapped) {
+        // The mapping already spans the pages the new size needs
+        if (_basec_memory_pages(size) == _basec_memory_pages(new_size)) {
+            return BASEC_MEMORY_SUCCESS;
+        }
+        resized = mremap(*data, size, new_size, MREMAP_MAYMOVE);
+        if (resized == MAP_FAILED) return BASEC_MEMORY_ALLOCATION_FAILURE;
+        _basec_memory_advise(resized, new_size);
+    } else {
+        // Crossed the threshold, the last copy this buffer needs
+        resized = _basec_memory_map(new_size);
+        if (resized == NULL) return BASEC_MEMORY_ALLOCATION_FAILURE;
+        _basec_memory_advise(resized, new_size);
+        (void)memcpy(resized, *data, kept);
+        free(*data);
+    }
+
+    *data   = resized;
+    *mapped = new_size >= BASEC_MEMORY_MAP_THRESHOLD;
+    return BASEC_MEMORY_SUCCESS;
+}
+
+/**
+ * @brief Release a buffer
+ * @param data The buffer, set to NULL
+ * @param size The size of the buffer in bytes
+ * @param mapped Whether the buffer is mapped
+ * @return The result of the operation
+ */
+BasecMemoryResult basec_memory_release(void** data, u64 size, bool mapped) {
+    if (data == NULL) return BASEC_MEMORY_NULL_POINTER;
+
+    if (mapped && *data != NULL) {
+        (void)munmap(*data, size);
+    } else {
+        free(*data);
+    }
+
+    *data = NULL;
+    return BASEC_MEMORY_SUCCESS;
+}
@@ -0,0 +1,209 @@
+#include "util/benches/bench_hash.h"
+
+#define _BENCH_HASH_POOL_SIZE       4096
+#define _BENCH_HASH_KEY_ITERATIONS  10000000
+#define _BENCH_HASH_LONG_SIZE       (64ULL * 1024 * 1024)
+#define _BENCH_HASH_LONG_ITERATIONS 10
+#define _BENCH_HASH_PIECE_SIZE      4096
+
+/**
+ * @brief Hash bytes with 64 bit FNV-1a, the usual byte at a time baseline
+ * @param data The bytes to hash
+ * @param length The number of bytes
+ * @return The hash of the bytes
+ */
+static u64 _bench_hash_fnv1a(const u8* data, u64 length) {
+    u64 hash = 0xCBF29CE484222325ULL;
+
+    for (u64 i = 0; i < length; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Fill a buffer with pseudo random bytes
+ * @param data The buffer to fill
+ * @param length The number of bytes
+ */
+static void _bench_hash_fill(u8* data, u64 length) {
+    u64 state = 0x9E3779B97F4A7C15ULL;
+
+    for (u64 i = 0; i < length; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        data[i] = (u8)state;
+    }
+}
+
+/**
+ * @brief Time hashing keys of one size taken from a pool of random bytes
+ * @param name The name to report the measurement under
+ * @param pool The pool of random bytes
+ * @param size The size of the keys
+ * @param fnv1a Whether to hash with the FNV-1a baseline
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_hash_keys(
+    c_str     name,
+    const u8* pool,
+    u64       size,
+    bool      fnv1a
+) {
+    BasecBenchTimer timer      = {0};
+    u64             elapsed_ns = 0;
+    u64             hash       = 0;
+    u64             checksum   = 0;
+    u64             offset     = 0;
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_HASH_KEY_ITERATIONS; i++) {
+        offset = (i * 61) & (_BENCH_HASH_POOL_SIZE - 64 - 1);
+        if (fnv1a) {
+            hash = _bench_hash_fnv1a(pool + offset, size);
+        } else {
+            (void)basec_hash_bytes(pool + offset, size, &hash);
+        }
+        checksum += hash;
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+    if (checksum == 0) return BASEC_BENCH_RUN_FAILURE;
+    return basec_bench_print(
+        name,
+        _BENCH_HASH_KEY_ITERATIONS,
+        size,
+        elapsed_ns
+    );
+}
+
+/**
+ * @brief Benchmark hashing short keys of 8 to 64 bytes
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hash_short_keys(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    u8               pool[_BENCH_HASH_POOL_SIZE];
+    u64              sizes[4]     = {8, 16, 32, 64};
+    c8               name[64];
+
+    _bench_hash_fill(pool, sizeof(pool));
+    for (u64 i = 0; i < 4 && bench_result == BASEC_BENCH_SUCCESS; i++) {
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "fnv1a (%lu B keys)",
+            (unsigned long)sizes[i]
+        );
+        bench_result = _bench_hash_keys(name, pool, sizes[i], true);
+        if (bench_result != BASEC_BENCH_SUCCESS) break;
+
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "basec_hash_bytes (%lu B keys)",
+            (unsigned long)sizes[i]
+        );
+        bench_result = _bench_hash_keys(name, pool, sizes[i], false);
+    }
+
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark hashing a long buffer at once and incrementally
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_hash_long_buffer(void) {
+    BasecBenchTimer  timer        = {0};
+    u64              elapsed_ns   = 0;
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecHashState   state        = {0};
+    u8*              data         = NULL;
+    u64              hash         = 0;
+    u64              checksum     = 0;
+
+    data = (u8*)malloc(_BENCH_HASH_LONG_SIZE);
+    if (data == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+    _bench_hash_fill(data, _BENCH_HASH_LONG_SIZE);
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    for (u64 i = 0; i < _BENCH_HASH_LONG_ITERATIONS; i++) {
+        checksum += _bench_hash_fnv1a(data, _BENCH_HASH_LONG_SIZE);
+    }
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+    bench_result = basec_bench_print(
+        "fnv1a (64 MB)",
+        _BENCH_HASH_LONG_ITERATIONS,
+        _BENCH_HASH_LONG_SIZE,
+        elapsed_ns
+    );
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        basec_bench_handle_result(basec_bench_timer_start(&timer));
+        for (u64 i = 0; i < _BENCH_HASH_LONG_ITERATIONS; i++) {
+            (void)basec_hash_bytes(data, _BENCH_HASH_LONG_SIZE, &hash);
+            checksum += hash;
+        }
+        basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+        bench_result = basec_bench_print(
+            "basec_hash_bytes (64 MB)",
+            _BENCH_HASH_LONG_ITERATIONS,
+            _BENCH_HASH_LONG_SIZE,
+            elapsed_ns
+        );
+    }
+
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        basec_bench_handle_result(basec_bench_timer_start(&timer));
+        for (u64 i = 0; i < _BENCH_HASH_LONG_ITERATIONS; i++) {
+            (void)basec_hash_init(&state, BASEC_HASH_DEFAULT_SEED);
+            for (
+                u64 offset = 0;
+                offset < _BENCH_HASH_LONG_SIZE;
+                offset += _BENCH_HASH_PIECE_SIZE
+            ) {
+                (void)basec_hash_update(
+                    &state,
+                    data + offset,
+                    _BENCH_HASH_PIECE_SIZE
+                );
+            }
+            (void)basec_hash_final(&state, &hash);
+            checksum += hash;
+        }
+        basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+        bench_result = basec_bench_print(
+            "basec_hash_update (4 KB pieces)",
+            _BENCH_HASH_LONG_ITERATIONS,
+            _BENCH_HASH_LONG_SIZE,
+            elapsed_ns
+        );
+    }
+
+    free(data);
+    if (bench_result == BASEC_BENCH_SUCCESS && checksum == 0) {
+        return BASEC_BENCH_RUN_FAILURE;
+    }
+    return bench_result;
+}
+
+/**
+ * @brief Run the Hash benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_hash_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("Hash");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_hash_short_keys();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_hash_long_buffer();
+    }
+
+    return bench_result;
+}
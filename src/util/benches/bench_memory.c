@@ -0,0 +1,196 @@
+#include "util/benches/bench_memory.h"
+
+#define _BENCH_MEMORY_MIN_SIZE     (16ULL * 1024 * 1024)
+#define _BENCH_MEMORY_MAX_SIZE     (1024ULL * 1024 * 1024)
+#define _BENCH_MEMORY_ARRAY_BYTES  (1024ULL * 1024 * 1024)
+#define _BENCH_MEMORY_ARRAY_START  1024
+
+/**
+ * @brief Double a touched buffer the way realloc does on the heap
+ * @param size The size of the buffer in bytes
+ * @param elapsed_ns_out The time the grow took
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_memory_copy_grow(
+    u64  size,
+    u64* elapsed_ns_out
+) {
+    BasecBenchTimer  timer        = {0};
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    u8*              data         = NULL;
+    u8*              grown        = NULL;
+
+    data = (u8*)malloc(size);
+    if (data == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+    (void)memset(data, 1, size);
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    grown = (u8*)malloc(size * 2);
+    if (grown != NULL) (void)memcpy(grown, data, size);
+    free(data);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, elapsed_ns_out));
+
+    if (grown == NULL) return BASEC_BENCH_ALLOCATION_FAILURE;
+    if (grown[size - 1] != 1) bench_result = BASEC_BENCH_RUN_FAILURE;
+    free(grown);
+    return bench_result;
+}
+
+/**
+ * @brief Double a touched buffer with basec_memory_resize
+ * @param size The size of the buffer in bytes
+ * @param elapsed_ns_out The time the grow took
+ * @return The result of the benchmark
+ */
+static BasecBenchResult _bench_memory_remap_grow(
+    u64  size,
+    u64* elapsed_ns_out
+) {
+    BasecBenchTimer   timer         = {0};
+    BasecBenchResult  bench_result  = BASEC_BENCH_SUCCESS;
+    BasecMemoryResult memory_result = BASEC_MEMORY_SUCCESS;
+    void*             data          = NULL;
+    bool              mapped        = false;
+
+    if (
+        basec_memory_allocate(&data, size, &mapped) != BASEC_MEMORY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+    (void)memset(data, 1, size);
+
+    basec_bench_handle_result(basec_bench_timer_start(&timer));
+    memory_result = basec_memory_resize(&data, size, size * 2, &mapped);
+    basec_bench_handle_result(basec_bench_timer_stop(&timer, elapsed_ns_out));
+
+    if (memory_result != BASEC_MEMORY_SUCCESS) {
+        (void)basec_memory_release(&data, size, mapped);
+        return BASEC_BENCH_ALLOCATION_FAILURE;
+    }
+    if (((u8*)data)[size - 1] != 1) bench_result = BASEC_BENCH_RUN_FAILURE;
+    (void)basec_memory_release(&data, size * 2, mapped);
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark doubling a large buffer by copying and by remapping
+ *
+ * Each buffer is written through before it grows, so the copy moves real
+ * pages. Remapping keeps the pages where they are and only moves the page
+ * table entries, with and without transparent huge pages.
+ *
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_memory_resize(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    u64              elapsed_ns   = 0;
+    c8               name[64];
+
+    for (
+        u64 size = _BENCH_MEMORY_MIN_SIZE;
+        bench_result == BASEC_BENCH_SUCCESS && size <= _BENCH_MEMORY_MAX_SIZE;
+        size *= 4
+    ) {
+        bench_result = _bench_memory_copy_grow(size, &elapsed_ns);
+        if (bench_result != BASEC_BENCH_SUCCESS) break;
+        (void)snprintf(
+            name,
+            sizeof(name),
+            "malloc + memcpy grow, %lu MB",
+            (unsigned long)(size >> 20)
+        );
+        bench_result = basec_bench_print(name, 1, size, elapsed_ns);
+        if (bench_result != BASEC_BENCH_SUCCESS) break;
+
+        for (u64 huge = 0; huge < 2; huge++) {
+            basec_memory_set_huge_pages(huge == 1);
+            bench_result = _bench_memory_remap_grow(size, &elapsed_ns);
+            if (bench_result != BASEC_BENCH_SUCCESS) break;
+            (void)snprintf(
+                name,
+                sizeof(name),
+                "basec_memory_resize%s, %lu MB",
+                huge == 1 ? " THP" : "",
+                (unsigned long)(size >> 20)
+            );
+            bench_result = basec_bench_print(name, 1, size, elapsed_ns);
+            if (bench_result != BASEC_BENCH_SUCCESS) break;
+        }
+        basec_memory_set_huge_pages(false);
+    }
+
+    return bench_result;
+}
+
+/**
+ * @brief Benchmark the slowest grow while appending to a large BasecArray
+ * @return The result of the benchmark
+ */
+BasecBenchResult bench_memory_array_grow(void) {
+    BasecBenchTimer  timer        = {0};
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+    BasecArray*      array        = NULL;
+    u64              count        = _BENCH_MEMORY_ARRAY_BYTES / sizeof(u64);
+    u64              elapsed_ns   = 0;
+    u64              total_ns     = 0;
+    u64              slowest_ns   = 0;
+
+    if (
+        basec_array_create(
+            &array,
+            sizeof(u64),
+            _BENCH_MEMORY_ARRAY_START
+        ) != BASEC_ARRAY_SUCCESS
+    ) return BASEC_BENCH_ALLOCATION_FAILURE;
+
+    for (u64 i = 0; bench_result == BASEC_BENCH_SUCCESS && i < count; i++) {
+        // Only appends that grow the array are timed on their own
+        if (array->length < array->capacity) {
+            array->length++;
+            ((u64*)array->data)[i] = i;
+            continue;
+        }
+
+        basec_bench_handle_result(basec_bench_timer_start(&timer));
+        if (basec_array_append(array, &i) != BASEC_ARRAY_SUCCESS) {
+            bench_result = BASEC_BENCH_ALLOCATION_FAILURE;
+        }
+        basec_bench_handle_result(basec_bench_timer_stop(&timer, &elapsed_ns));
+
+        total_ns += elapsed_ns;
+        if (elapsed_ns > slowest_ns) slowest_ns = elapsed_ns;
+    }
+    (void)basec_array_destroy(&array);
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = basec_bench_print(
+        "basec_array grows to 1 GB, total",
+        1,
+        0,
+        total_ns
+    );
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    return basec_bench_print(
+        "basec_array grows to 1 GB, slowest",
+        1,
+        0,
+        slowest_ns
+    );
+}
+
+/**
+ * @brief Run the Memory benchmarks
+ * @return The result of the operation
+ */
+BasecBenchResult bench_memory_run(void) {
+    BasecBenchResult bench_result = BASEC_BENCH_SUCCESS;
+
+    bench_result = basec_bench_print_module("Memory");
+    if (bench_result != BASEC_BENCH_SUCCESS) return bench_result;
+
+    bench_result = bench_memory_resize();
+    if (bench_result == BASEC_BENCH_SUCCESS) {
+        bench_result = bench_memory_array_grow();
+    }
+
+    return bench_result;
+}
@@ -0,0 +1,255 @@
+#include "util/tests/test_hash.h"
+
+/**
+ * @brief Test hashing bytes with and without a seed
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hash_bytes(c_str fail_message) {
+    BasecHashResult hash_result = BASEC_HASH_SUCCESS;
+    const c8        key[]       = "the quick brown fox jumps over the lazy dog";
+    u64             hash        = 0;
+    u64             again       = 0;
+    u64             other       = 0;
+
+    hash_result = basec_hash_bytes(key, sizeof(key) - 1, &hash);
+    if (hash_result != BASEC_HASH_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Hashing bytes failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    hash_result = basec_hash_bytes_seeded(
+        key,
+        sizeof(key) - 1,
+        BASEC_HASH_DEFAULT_SEED,
+        &again
+    );
+    if (hash_result != BASEC_HASH_SUCCESS || again != hash) {
+        (void)strncpy(
+            fail_message,
+            "Default seed does not match the unseeded hash",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    hash_result = basec_hash_bytes_seeded(key, sizeof(key) - 1, 42, &other);
+    if (hash_result != BASEC_HASH_SUCCESS || other == hash) {
+        (void)strncpy(
+            fail_message,
+            "Different seeds gave the same hash",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    // Every length up to a few blocks must depend on every byte
+    for (u64 length = 1; length < sizeof(key); length++) {
+        c8 changed[sizeof(key)] = {0};
+
+        (void)memcpy(changed, key, length);
+        changed[length - 1] ^= 1;
+        (void)basec_hash_bytes(key, length, &hash);
+        (void)basec_hash_bytes(changed, length, &other);
+        if (hash == other) {
+            (void)strncpy(
+                fail_message,
+                "Changing the last byte did not change the hash",
+                BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+            );
+            return false;
+        }
+    }
+
+    hash_result = basec_hash_bytes(NULL, 0, &hash);
+    if (hash_result != BASEC_HASH_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Hashing NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test that incremental hashing matches hashing all at once
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hash_incremental(c_str fail_message) {
+    BasecHashResult hash_result = BASEC_HASH_SUCCESS;
+    BasecHashState  state       = {0};
+    u8              data[200]   = {0};
+    u64             expected    = 0;
+    u64             hash        = 0;
+    u64             offset      = 0;
+    u64             piece       = 0;
+
+    for (u64 i = 0; i < sizeof(data); i++) data[i] = (u8)(i * 31 + 7);
+
+    // Split every length into pieces of every size from 1 to 64 bytes
+    for (u64 length = 0; length <= sizeof(data); length++) {
+        (void)basec_hash_bytes_seeded(data, length, 7, &expected);
+
+        for (u64 size = 1; size <= 64; size++) {
+            hash_result = basec_hash_init(&state, 7);
+            for (offset = 0; offset < length; offset += piece) {
+                piece = length - offset < size ? length - offset : size;
+                (void)basec_hash_update(&state, data + offset, piece);
+            }
+            (void)basec_hash_final(&state, &hash);
+
+            if (hash_result != BASEC_HASH_SUCCESS || hash != expected) {
+                (void)strncpy(
+                    fail_message,
+                    "Incremental hash does not match one shot hash",
+                    BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+                );
+                return false;
+            }
+        }
+    }
+
+    hash_result = basec_hash_update(NULL, data, 1);
+    if (hash_result != BASEC_HASH_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Updating NULL state succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test getting random seeds
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_hash_random_seed(c_str fail_message) {
+    BasecHashResult hash_result = BASEC_HASH_SUCCESS;
+    u64             first       = 0;
+    u64             second      = 0;
+
+    hash_result = basec_hash_random_seed(&first);
+    if (hash_result == BASEC_HASH_SUCCESS) {
+        hash_result = basec_hash_random_seed(&second);
+    }
+    if (hash_result != BASEC_HASH_SUCCESS || first == second) {
+        (void)strncpy(
+            fail_message,
+            "Random seeds were not distinct",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    hash_result = basec_hash_random_seed(NULL);
+    if (hash_result != BASEC_HASH_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Seeding NULL pointer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Add Hash tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+
+BasecTestResult test_hash_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result      = BASEC_TEST_SUCCESS;
+    BasecTest*       bytes_test       = NULL;
+    BasecTest*       incremental_test = NULL;
+    BasecTest*       random_seed_test = NULL;
+    BasecTestModule* hash_module      = NULL;
+
+    test_result = basec_test_create(
+        &bytes_test,
+        "test_hash_bytes",
+        "Test hashing bytes with and without a seed",
+        &test_hash_bytes
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &incremental_test,
+        "test_hash_incremental",
+        "Test that incremental hashing matches hashing all at once",
+        &test_hash_incremental
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&bytes_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &random_seed_test,
+        "test_hash_random_seed",
+        "Test getting random seeds",
+        &test_hash_random_seed
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&bytes_test);
+        (void)basec_test_destroy(&incremental_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &hash_module,
+        "Hash"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&bytes_test);
+        (void)basec_test_destroy(&incremental_test);
+        (void)basec_test_destroy(&random_seed_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(hash_module, bytes_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&bytes_test);
+        (void)basec_test_destroy(&incremental_test);
+        (void)basec_test_destroy(&random_seed_test);
+        (void)basec_test_module_destroy(&hash_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hash_module, incremental_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&incremental_test);
+        (void)basec_test_destroy(&random_seed_test);
+        (void)basec_test_module_destroy(&hash_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(hash_module, random_seed_test);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&random_seed_test);
+        (void)basec_test_module_destroy(&hash_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(test_suite, hash_module);
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&hash_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file
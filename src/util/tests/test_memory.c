@@ -0,0 +1,284 @@
+#include "util/tests/test_memory.h"
+
+/**
+ * @brief Test allocating small and large buffers
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_memory_allocate(c_str fail_message) {
+    BasecMemoryResult memory_result = BASEC_MEMORY_SUCCESS;
+    void*             small         = NULL;
+    void*             large         = NULL;
+    bool              small_mapped  = true;
+    bool              large_mapped  = false;
+
+    memory_result = basec_memory_allocate(&small, 64, &small_mapped);
+    if (memory_result == BASEC_MEMORY_SUCCESS) {
+        memory_result = basec_memory_allocate(
+            &large,
+            BASEC_MEMORY_MAP_THRESHOLD,
+            &large_mapped
+        );
+    }
+    if (
+        memory_result != BASEC_MEMORY_SUCCESS ||
+        small_mapped ||
+        !large_mapped
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Buffers were not mapped from the threshold up",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_memory_release(&small, 64, small_mapped);
+        (void)basec_memory_release(
+            &large,
+            BASEC_MEMORY_MAP_THRESHOLD,
+            large_mapped
+        );
+        return false;
+    }
+
+    // Both kinds of buffer can be written through to their last byte
+    (void)memset(small, 0xAB, 64);
+    (void)memset(large, 0xAB, BASEC_MEMORY_MAP_THRESHOLD);
+    (void)basec_memory_release(&small, 64, small_mapped);
+    (void)basec_memory_release(
+        &large,
+        BASEC_MEMORY_MAP_THRESHOLD,
+        large_mapped
+    );
+
+    memory_result = basec_memory_allocate(&small, 0, &small_mapped);
+    if (memory_result != BASEC_MEMORY_INVALID_SIZE) {
+        (void)strncpy(
+            fail_message,
+            "Allocating 0 bytes succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test resizing a buffer across the mapping threshold both ways
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_memory_resize(c_str fail_message) {
+    BasecMemoryResult memory_result = BASEC_MEMORY_SUCCESS;
+    void*             data          = NULL;
+    bool              mapped        = false;
+    u64               sizes[4]      = {
+        4096,
+        BASEC_MEMORY_MAP_THRESHOLD * 2,
+        BASEC_MEMORY_MAP_THRESHOLD * 8,
+        1024,
+    };
+    u64               size          = 1024;
+    bool              matched       = true;
+
+    memory_result = basec_memory_allocate(&data, size, &mapped);
+    if (memory_result != BASEC_MEMORY_SUCCESS) {
+        (void)strncpy(
+            fail_message,
+            "Buffer allocation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+    for (u64 i = 0; i < size; i++) ((u8*)data)[i] = (u8)i;
+
+    // Heap to heap, heap to mapped, mapped to mapped and back to the heap
+    for (u64 i = 0; i < 4 && memory_result == BASEC_MEMORY_SUCCESS; i++) {
+        memory_result = basec_memory_resize(&data, size, sizes[i], &mapped);
+        if (memory_result != BASEC_MEMORY_SUCCESS) break;
+        size    = sizes[i];
+        matched = matched && mapped == (size >= BASEC_MEMORY_MAP_THRESHOLD);
+        for (u64 j = 0; j < 1024; j++) {
+            matched = matched && ((u8*)data)[j] == (u8)j;
+        }
+        ((u8*)data)[size - 1] = 0xFF;
+    }
+    (void)basec_memory_release(&data, size, mapped);
+    if (memory_result != BASEC_MEMORY_SUCCESS || !matched) {
+        (void)strncpy(
+            fail_message,
+            "Resizing across the threshold lost bytes",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    memory_result = basec_memory_resize(&data, 0, 64, &mapped);
+    if (memory_result != BASEC_MEMORY_NULL_POINTER) {
+        (void)strncpy(
+            fail_message,
+            "Resizing a NULL buffer succeeded, but should fail",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Test that large arrays and strings keep their contents as they grow
+ * @param fail_message The message to display if the test fails
+ * @return The result of the test
+ */
+bool test_memory_grow(c_str fail_message) {
+    BasecArray*  array      = NULL;
+    BasecString* string     = NULL;
+    u64          count      = BASEC_MEMORY_MAP_THRESHOLD / sizeof(u64) * 4;
+    bool         matched    = true;
+    c8           line[4096] = {0};
+
+    if (
+        basec_array_create(&array, sizeof(u64), 16) != BASEC_ARRAY_SUCCESS ||
+        basec_string_create(&string, "", 16) != BASEC_STRING_SUCCESS
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Array or string creation failed",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        if (array != NULL) (void)basec_array_destroy(&array);
+        return false;
+    }
+
+    for (u64 i = 0; i < count; i++) (void)basec_array_append(array, &i);
+    for (u64 i = 0; i < array->length; i++) {
+        matched = matched && ((u64*)array->data)[i] == i;
+    }
+    for (u64 i = 0; i < sizeof(line) - 1; i++) line[i] = 'a' + i % 26;
+    for (u64 i = 0; i < BASEC_MEMORY_MAP_THRESHOLD / 1024; i++) {
+        (void)basec_string_append(string, line);
+    }
+    for (u64 i = 0; i < string->length; i++) {
+        matched = matched && string->data[i] == line[i % (sizeof(line) - 1)];
+    }
+    if (
+        array->length != count ||
+        !array->mapped ||
+        string->length != BASEC_MEMORY_MAP_THRESHOLD / 1024 * 4095 ||
+        !string->mapped ||
+        string->data[string->length] != '\0' ||
+        !matched
+    ) {
+        (void)strncpy(
+            fail_message,
+            "Growing past the threshold lost elements",
+            BASEC_TEST_FAIL_MESSAGE_MAX_LEN
+        );
+        (void)basec_array_destroy(&array);
+        (void)basec_string_destroy(&string);
+        return false;
+    }
+    (void)basec_array_destroy(&array);
+    (void)basec_string_destroy(&string);
+
+    return true;
+}
+
+/**
+ * @brief Add Memory tests to a test suite
+ * @param test_suite The test suite to add the tests to
+ * @return The result of the operation
+ */
+BasecTestResult test_memory_add_tests(BasecTestSuite* test_suite) {
+    BasecTestResult  test_result   = BASEC_TEST_SUCCESS;
+    BasecTest*       allocate_test = NULL;
+    BasecTest*       resize_test   = NULL;
+    BasecTest*       grow_test     = NULL;
+    BasecTestModule* memory_module = NULL;
+
+    test_result = basec_test_create(
+        &allocate_test,
+        "test_memory_allocate",
+        "Test allocating small and large buffers",
+        &test_memory_allocate
+    );
+    if (test_result != BASEC_TEST_SUCCESS) return test_result;
+    
+    test_result = basec_test_create(
+        &resize_test,
+        "test_memory_resize",
+        "Test resizing a buffer across the mapping threshold both ways",
+        &test_memory_resize
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&allocate_test);
+        return test_result;
+    }
+    
+    test_result = basec_test_create(
+        &grow_test,
+        "test_memory_grow",
+        "Test that large arrays and strings keep their contents as they grow",
+        &test_memory_grow
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&allocate_test);
+        (void)basec_test_destroy(&resize_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_create(
+        &memory_module,
+        "Memory"
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&allocate_test);
+        (void)basec_test_destroy(&resize_test);
+        (void)basec_test_destroy(&grow_test);
+        return test_result;
+    }
+
+    test_result = basec_test_module_add_test(
+        memory_module,
+        allocate_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&allocate_test);
+        (void)basec_test_destroy(&resize_test);
+        (void)basec_test_destroy(&grow_test);
+        (void)basec_test_module_destroy(&memory_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        memory_module,
+        resize_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&resize_test);
+        (void)basec_test_destroy(&grow_test);
+        (void)basec_test_module_destroy(&memory_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_module_add_test(
+        memory_module,
+        grow_test
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_destroy(&grow_test);
+        (void)basec_test_module_destroy(&memory_module);
+        return test_result;
+    }
+    
+    test_result = basec_test_suite_add_module(
+        test_suite,
+        memory_module
+    );
+    if (test_result != BASEC_TEST_SUCCESS) {
+        (void)basec_test_module_destroy(&memory_module);
+        return test_result;
+    }
+
+    return BASEC_TEST_SUCCESS;
+}
\ No newline at end of file